@@ -984,17 +984,16 @@ int device_handle_close(
 	return( 0 );
 }
 
-/* Reads a storage media buffer from the input of the device handle
- * Returns the number of bytes written or -1 on error
+/* Reads a buffer from the input of the device handle
+ * Returns the number of bytes read or -1 on error
  */
-ssize_t device_handle_read_storage_media_buffer(
+ssize_t device_handle_read_buffer(
          device_handle_t *device_handle,
-         storage_media_buffer_t *storage_media_buffer,
-         off64_t storage_media_offset,
-         size_t read_size,
+         uint8_t *buffer,
+         size_t buffer_size,
          libcerror_error_t **error )
 {
-	static char *function = "device_handle_read_storage_media_buffer";
+	static char *function = "device_handle_read_buffer";
 	ssize_t read_count    = 0;
 
 	if( device_handle == NULL )
@@ -1008,23 +1007,12 @@ ssize_t device_handle_read_storage_media_buffer(
 
 		return( -1 );
 	}
-	if( storage_media_buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid storage media buffer.",
-		 function );
-
-		return( -1 );
-	}
 	if( device_handle->type == DEVICE_HANDLE_TYPE_DEVICE )
 	{
 		read_count = libsmdev_handle_read_buffer(
 			      device_handle->smdev_input_handle,
-			      storage_media_buffer->raw_buffer,
-			      read_size,
+			      buffer,
+			      buffer_size,
 		              error );
 
 		if( read_count < 0 )
@@ -1043,8 +1031,8 @@ ssize_t device_handle_read_storage_media_buffer(
 	{
 		read_count = libodraw_handle_read_buffer(
 			      device_handle->odraw_input_handle,
-			      storage_media_buffer->raw_buffer,
-			      read_size,
+			      buffer,
+			      buffer_size,
 		              error );
 
 		if( read_count < 0 )
@@ -1063,8 +1051,8 @@ ssize_t device_handle_read_storage_media_buffer(
 	{
 		read_count = libsmraw_handle_read_buffer(
 			      device_handle->smraw_input_handle,
-			      storage_media_buffer->raw_buffer,
-			      read_size,
+			      buffer,
+			      buffer_size,
 		              error );
 
 		if( read_count < 0 )
@@ -1079,6 +1067,39 @@ ssize_t device_handle_read_storage_media_buffer(
 			return( -1 );
 		}
 	}
+	return( read_count );
+}
+
+/* Reads a storage media buffer from the input of the device handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t device_handle_read_storage_media_buffer(
+         device_handle_t *device_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         off64_t storage_media_offset,
+         size_t read_size,
+         libcerror_error_t **error )
+{
+	static char *function = "device_handle_read_storage_media_buffer";
+	ssize_t read_count    = 0;
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = device_handle_read_buffer(
+	              device_handle,
+	              storage_media_buffer->raw_buffer,
+	              read_size,
+	              error );
+
 	if( read_count < 0 )
 	{
 		libcerror_error_set(
@@ -159,6 +159,12 @@ int device_handle_close(
      device_handle_t *device_handle,
      libcerror_error_t **error );
 
+ssize_t device_handle_read_buffer(
+         device_handle_t *device_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 ssize_t device_handle_read_storage_media_buffer(
          device_handle_t *device_handle,
          storage_media_buffer_t *storage_media_buffer,
@@ -0,0 +1,919 @@
+/*
+ * Device read thread
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "device_handle.h"
+#include "device_read_thread.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a device read thread
+ * The thread reads storage_media_size bytes from the device handle, starting at
+ * storage_media_offset, into storage media buffers grabbed from the storage media
+ * buffer queue, keeping up to maximum_number_of_reads_in_flight reads ahead of the caller
+ * Make sure the value read_thread is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int device_read_thread_initialize(
+     device_read_thread_t **read_thread,
+     device_handle_t *device_handle,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     off64_t storage_media_offset,
+     size64_t storage_media_size,
+     size_t buffer_size,
+     int maximum_number_of_reads_in_flight,
+     libcerror_error_t **error )
+{
+	static char *function = "device_read_thread_initialize";
+
+	if( read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid storage media offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( storage_media_size == 0 )
+	 || ( storage_media_size > (size64_t) ( INT64_MAX - storage_media_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid storage media size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_reads_in_flight <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of reads in flight value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*read_thread = memory_allocate_structure(
+	                device_read_thread_t );
+
+	if( *read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_thread,
+	     0,
+	     sizeof( device_read_thread_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read thread.",
+		 function );
+
+		memory_free(
+		 *read_thread );
+
+		*read_thread = NULL;
+
+		return( -1 );
+	}
+	( *read_thread )->device_handle                     = device_handle;
+	( *read_thread )->storage_media_buffer_queue        = storage_media_buffer_queue;
+	( *read_thread )->buffer_size                       = buffer_size;
+	( *read_thread )->request_offset                    = storage_media_offset;
+	( *read_thread )->read_offset                       = storage_media_offset;
+	( *read_thread )->end_offset                        = storage_media_offset + (off64_t) storage_media_size;
+	( *read_thread )->maximum_number_of_reads_in_flight = maximum_number_of_reads_in_flight;
+
+	if( libcthreads_queue_initialize(
+	     &( ( *read_thread )->request_queue ),
+	     maximum_number_of_reads_in_flight,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create request queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *read_thread )->read_queue ),
+	     maximum_number_of_reads_in_flight,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_create(
+	     &( ( *read_thread )->thread ),
+	     NULL,
+	     (int (*)(void *)) &device_read_thread_callback,
+	     (void *) *read_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+	/* Queue the first reads so the device is read while the caller is still setting up
+	 */
+	if( device_read_thread_push_read_requests(
+	     *read_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read requests.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_thread != NULL )
+	{
+		device_read_thread_free(
+		 read_thread,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a device read thread
+ * This function stops the reader thread and releases the storage media buffers
+ * that are still in flight onto the storage media buffer queue
+ * If the reader thread cannot be stopped the read thread is not freed and
+ * *read_thread is not set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int device_read_thread_free(
+     device_read_thread_t **read_thread,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "device_read_thread_free";
+	int result                                   = 1;
+
+	if( read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_thread != NULL )
+	{
+		if( ( *read_thread )->thread != NULL )
+		{
+			/* The reader thread stops after it has handled the last read request,
+			 * if that request was not pushed yet a request without a size is used
+			 * to stop it
+			 */
+			if( ( ( *read_thread )->last_read_requested == 0 )
+			 && ( ( *read_thread )->reader_stopped == 0 ) )
+			{
+				( *read_thread )->abort = 1;
+
+				if( ( *read_thread )->number_of_reads_in_flight > 0 )
+				{
+					if( libcthreads_queue_pop(
+					     ( *read_thread )->read_queue,
+					     (intptr_t **) &storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+						 "%s: unable to pop storage media buffer from read queue.",
+						 function );
+
+						storage_media_buffer = NULL;
+						result               = -1;
+					}
+					else if( storage_media_buffer == (storage_media_buffer_t *) *read_thread )
+					{
+						( *read_thread )->reader_stopped = 1;
+
+						storage_media_buffer = NULL;
+					}
+					else
+					{
+						( *read_thread )->number_of_reads_in_flight -= 1;
+					}
+				}
+				else if( storage_media_buffer_queue_grab_buffer(
+				          ( *read_thread )->storage_media_buffer_queue,
+				          &storage_media_buffer,
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to grab storage media buffer from queue.",
+					 function );
+
+					storage_media_buffer = NULL;
+					result               = -1;
+				}
+				if( storage_media_buffer != NULL )
+				{
+					storage_media_buffer->requested_size = 0;
+
+					if( libcthreads_queue_push(
+					     ( *read_thread )->request_queue,
+					     (intptr_t *) storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to push storage media buffer onto request queue.",
+						 function );
+
+						storage_media_buffer_queue_release_buffer(
+						 ( *read_thread )->storage_media_buffer_queue,
+						 storage_media_buffer,
+						 NULL );
+
+						result = -1;
+					}
+					else
+					{
+						( *read_thread )->number_of_reads_in_flight += 1;
+						( *read_thread )->last_read_requested        = 1;
+					}
+					storage_media_buffer = NULL;
+				}
+			}
+			if( ( ( *read_thread )->last_read_requested != 0 )
+			 || ( ( *read_thread )->reader_stopped != 0 ) )
+			{
+				while( ( ( *read_thread )->reader_stopped == 0 )
+				    && ( ( *read_thread )->number_of_reads_in_flight > 0 ) )
+				{
+					if( libcthreads_queue_pop(
+					     ( *read_thread )->read_queue,
+					     (intptr_t **) &storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+						 "%s: unable to pop storage media buffer from read queue.",
+						 function );
+
+						result = -1;
+
+						break;
+					}
+					if( storage_media_buffer == (storage_media_buffer_t *) *read_thread )
+					{
+						( *read_thread )->reader_stopped = 1;
+
+						storage_media_buffer = NULL;
+
+						break;
+					}
+					( *read_thread )->number_of_reads_in_flight -= 1;
+
+					if( storage_media_buffer_queue_release_buffer(
+					     ( *read_thread )->storage_media_buffer_queue,
+					     storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to release storage media buffer onto queue.",
+						 function );
+
+						storage_media_buffer_free(
+						 &storage_media_buffer,
+						 NULL );
+
+						result = -1;
+					}
+					storage_media_buffer = NULL;
+				}
+				if( libcthreads_thread_join(
+				     &( ( *read_thread )->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		/* The queues can only be freed once the reader thread no longer uses them,
+		 * if the reader thread was not stopped the read thread is kept so that
+		 * freeing it can be retried
+		 */
+		if( ( *read_thread )->thread != NULL )
+		{
+			return( -1 );
+		}
+		/* If the reader thread stopped on an error storage media buffers can be left
+		 * on the queues, these are freed with the queues
+		 */
+		if( ( *read_thread )->read_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *read_thread )->read_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_thread )->request_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *read_thread )->request_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free request queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *read_thread );
+		*read_thread = NULL;
+	}
+	return( result );
+}
+
+/* Signals the device read thread to abort
+ * Reads that are in flight are returned without data
+ * Returns 1 if successful or -1 on error
+ */
+int device_read_thread_signal_abort(
+     device_read_thread_t *read_thread,
+     libcerror_error_t **error )
+{
+	static char *function = "device_read_thread_signal_abort";
+
+	if( read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread.",
+		 function );
+
+		return( -1 );
+	}
+	read_thread->abort = 1;
+
+	return( 1 );
+}
+
+/* Pushes read requests until the maximum number of reads is in flight
+ * or until the last read was requested
+ * Returns 1 if successful or -1 on error
+ */
+int device_read_thread_push_read_requests(
+     device_read_thread_t *read_thread,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "device_read_thread_push_read_requests";
+	size_t read_size                             = 0;
+
+	if( read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( read_thread->last_read_requested == 0 )
+	    && ( read_thread->number_of_reads_in_flight < read_thread->maximum_number_of_reads_in_flight ) )
+	{
+		if( storage_media_buffer_queue_grab_buffer(
+		     read_thread->storage_media_buffer_queue,
+		     &storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab storage media buffer from queue.",
+			 function );
+
+			return( -1 );
+		}
+		if( storage_media_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = read_thread->buffer_size;
+
+		if( (size64_t) read_size > (size64_t) ( read_thread->end_offset - read_thread->request_offset ) )
+		{
+			read_size = (size_t) ( read_thread->end_offset - read_thread->request_offset );
+		}
+		storage_media_buffer->storage_media_offset = read_thread->request_offset;
+		storage_media_buffer->requested_size       = read_size;
+
+		if( libcthreads_queue_push(
+		     read_thread->request_queue,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto request queue.",
+			 function );
+
+			storage_media_buffer_queue_release_buffer(
+			 read_thread->storage_media_buffer_queue,
+			 storage_media_buffer,
+			 NULL );
+
+			return( -1 );
+		}
+		read_thread->number_of_reads_in_flight += 1;
+		read_thread->request_offset            += (off64_t) read_size;
+
+		if( read_thread->request_offset >= read_thread->end_offset )
+		{
+			read_thread->last_read_requested = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the next storage media buffer that was read from the device
+ * The storage media buffers are returned in storage media offset order
+ * Returns the number of bytes read, 0 when no more data can be read or -1 on error
+ */
+ssize_t device_read_thread_read_buffer(
+         device_read_thread_t *read_thread,
+         storage_media_buffer_t **storage_media_buffer,
+         libcerror_error_t **error )
+{
+	storage_media_buffer_t *read_buffer = NULL;
+	static char *function               = "device_read_thread_read_buffer";
+	ssize_t read_count                  = 0;
+
+	if( read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *storage_media_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid storage media buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_thread->reader_stopped != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read thread - reader thread stopped.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_thread->number_of_reads_in_flight == 0 )
+	{
+		return( 0 );
+	}
+	if( libcthreads_queue_pop(
+	     read_thread->read_queue,
+	     (intptr_t **) &read_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to pop storage media buffer from read queue.",
+		 function );
+
+		return( -1 );
+	}
+	/* The reader thread pushes the read thread itself onto the read queue
+	 * when it stops on an error
+	 */
+	if( read_buffer == (storage_media_buffer_t *) read_thread )
+	{
+		read_thread->reader_stopped = 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read storage media buffer from device - reader thread stopped.",
+		 function );
+
+		return( -1 );
+	}
+	read_thread->number_of_reads_in_flight -= 1;
+
+	if( read_thread->read_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read storage media buffer from device.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = (ssize_t) read_buffer->raw_buffer_data_size;
+
+	if( read_count == 0 )
+	{
+		if( storage_media_buffer_queue_release_buffer(
+		     read_thread->storage_media_buffer_queue,
+		     read_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to release storage media buffer onto queue.",
+			 function );
+
+			read_buffer = NULL;
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	/* Keep the reader thread busy while the caller processes the buffer
+	 */
+	if( device_read_thread_push_read_requests(
+	     read_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read requests.",
+		 function );
+
+		goto on_error;
+	}
+	*storage_media_buffer = read_buffer;
+
+	return( read_count );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		storage_media_buffer_queue_release_buffer(
+		 read_thread->storage_media_buffer_queue,
+		 read_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the requested storage media buffers from the device
+ * Thread function of the device read thread
+ * Returns 1 if successful or -1 on error
+ */
+int device_read_thread_callback(
+     device_read_thread_t *read_thread )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "device_read_thread_callback";
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	int last_read                                = 0;
+
+	if( read_thread == NULL )
+	{
+		return( -1 );
+	}
+	while( last_read == 0 )
+	{
+		if( libcthreads_queue_pop(
+		     read_thread->request_queue,
+		     (intptr_t **) &storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop storage media buffer from request queue.",
+			 function );
+
+			storage_media_buffer = NULL;
+
+			goto on_error;
+		}
+		read_size = storage_media_buffer->requested_size;
+
+		if( ( read_size == 0 )
+		 || ( ( storage_media_buffer->storage_media_offset + (off64_t) read_size ) >= read_thread->end_offset ) )
+		{
+			last_read = 1;
+		}
+		storage_media_buffer->raw_buffer_data_size = 0;
+
+		/* Once the device returned less data than requested the next reads no longer
+		 * start at the requested storage media offset and are returned without data
+		 */
+		if( ( read_size > 0 )
+		 && ( read_thread->abort == 0 )
+		 && ( read_thread->read_failed == 0 )
+		 && ( read_thread->read_offset == storage_media_buffer->storage_media_offset ) )
+		{
+			/* Read error retries are handled by the device handle, while they are retried
+			 * the buffers that were already read are processed by the caller
+			 */
+			read_count = device_handle_read_storage_media_buffer(
+			              read_thread->device_handle,
+			              storage_media_buffer,
+			              read_thread->read_offset,
+			              read_size,
+			              &error );
+
+			/* The device can return less data than requested, the remaining data is
+			 * read so that the next request starts at its storage media offset
+			 */
+			while( ( read_count > 0 )
+			    && ( storage_media_buffer->raw_buffer_data_size < read_size ) )
+			{
+				read_count = device_handle_read_buffer(
+				              read_thread->device_handle,
+				              &( storage_media_buffer->raw_buffer[ storage_media_buffer->raw_buffer_data_size ] ),
+				              read_size - storage_media_buffer->raw_buffer_data_size,
+				              &error );
+
+				if( read_count > 0 )
+				{
+					storage_media_buffer->raw_buffer_data_size += (size_t) read_count;
+				}
+			}
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read storage media buffer from device.",
+				 function );
+
+				read_thread->read_failed = 1;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+			}
+			else
+			{
+				read_thread->read_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+			}
+		}
+		if( libcthreads_queue_push(
+		     read_thread->read_queue,
+		     (intptr_t *) storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto read queue.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer = NULL;
+	}
+	return( 1 );
+
+on_error:
+	read_thread->read_failed = 1;
+
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	/* The buffer that is not handed back is released so that the read queue has room
+	 * for the read thread itself, which signals the caller that no more buffers follow
+	 */
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_queue_release_buffer(
+		 read_thread->storage_media_buffer_queue,
+		 storage_media_buffer,
+		 NULL );
+	}
+	libcthreads_queue_push(
+	 read_thread->read_queue,
+	 (intptr_t *) read_thread,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,141 @@
+/*
+ * Device read thread
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEVICE_READ_THREAD_H )
+#define _DEVICE_READ_THREAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "device_handle.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct device_read_thread device_read_thread_t;
+
+struct device_read_thread
+{
+	/* The device handle
+	 */
+	device_handle_t *device_handle;
+
+	/* The storage media buffer queue the buffers to read into are grabbed from
+	 */
+	libcthreads_queue_t *storage_media_buffer_queue;
+
+	/* The queue of storage media buffers that are to be read
+	 */
+	libcthreads_queue_t *request_queue;
+
+	/* The queue of storage media buffers that have been read
+	 */
+	libcthreads_queue_t *read_queue;
+
+	/* The reader thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The storage media buffer size
+	 */
+	size_t buffer_size;
+
+	/* The storage media offset of the next read request
+	 */
+	off64_t request_offset;
+
+	/* The storage media offset of the next read
+	 */
+	off64_t read_offset;
+
+	/* The storage media end offset
+	 */
+	off64_t end_offset;
+
+	/* The maximum number of reads in flight
+	 */
+	int maximum_number_of_reads_in_flight;
+
+	/* The number of reads in flight
+	 */
+	int number_of_reads_in_flight;
+
+	/* Value to indicate the last read was requested
+	 */
+	int last_read_requested;
+
+	/* Value to indicate reading from the device failed
+	 */
+	int read_failed;
+
+	/* Value to indicate the reader thread stopped before it handled all read requests
+	 */
+	int reader_stopped;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int device_read_thread_initialize(
+     device_read_thread_t **read_thread,
+     device_handle_t *device_handle,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     off64_t storage_media_offset,
+     size64_t storage_media_size,
+     size_t buffer_size,
+     int maximum_number_of_reads_in_flight,
+     libcerror_error_t **error );
+
+int device_read_thread_free(
+     device_read_thread_t **read_thread,
+     libcerror_error_t **error );
+
+int device_read_thread_signal_abort(
+     device_read_thread_t *read_thread,
+     libcerror_error_t **error );
+
+int device_read_thread_push_read_requests(
+     device_read_thread_t *read_thread,
+     libcerror_error_t **error );
+
+ssize_t device_read_thread_read_buffer(
+         device_read_thread_t *read_thread,
+         storage_media_buffer_t **storage_media_buffer,
+         libcerror_error_t **error );
+
+int device_read_thread_callback(
+     device_read_thread_t *read_thread );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEVICE_READ_THREAD_H ) */
+
@@ -36,6 +36,7 @@
 
 #include "byte_size_string.h"
 #include "device_handle.h"
+#include "device_read_thread.h"
 #include "ewfcommon.h"
 #include "ewfinput.h"
 #include "ewftools_getopt.h"
@@ -124,7 +125,8 @@ void ewfacquire_usage_fprint(
 	                 "                  [ -C case_number ] [ -d digest_type ] [ -D description ]\n"
 	                 "                  [ -e examiner_name ] [ -E evidence_number ] [ -f format ]\n"
 	                 "                  [ -g number_of_sectors ] [ -j jobs ] [ -l log_filename ]\n"
-	                 "                  [ -m media_type ] [ -M media_flags ] [ -N notes ]\n"
+	                 "                  [ -L number_of_chunks ] [ -m media_type ]\n"
+	                 "                  [ -M media_flags ] [ -N notes ]\n"
 	                 "                  [ -o offset ] [ -p process_buffer_size ]\n"
 	                 "                  [ -P bytes_per_sector ] [ -r read_error_retries ]\n"
 	                 "                  [ -S segment_file_size ] [ -t target ] [ -T toc_file ]\n"
@@ -147,6 +149,15 @@ void ewfacquire_usage_fprint(
 	                 "\t        (bzip2 is only supported by EWF2 formats)\n"
 #else
 	                 "\t        compression method options: deflate (default)\n"
+#endif
+#if defined( HAVE_ZSTD )
+	                 "\t        libewf specific compression method option: zstd\n"
+#endif
+#if defined( HAVE_LZ4 )
+	                 "\t        libewf specific compression method option: lz4\n"
+#endif
+#if defined( HAVE_ZSTD ) || defined( HAVE_LZ4 )
+	                 "\t        (libewf specific methods are only supported by EWF2 formats)\n"
 #endif
 	                 "\t        compression level options: none (default), empty-block,\n"
 	                 "\t        fast or best\n" );
@@ -165,6 +176,10 @@ void ewfacquire_usage_fprint(
 	                 "\t        a number of 0 represents single-threaded mode (default is 4\n"
 	                 "\t        if multi-threaded mode is supported)\n" );
 	fprintf( stream, "\t-l:     logs acquiry errors and the digest (hash) to the log_filename\n" );
+	fprintf( stream, "\t-L:     store a digest tree with a SHA256 digest per number of chunks\n"
+	                 "\t        (leaf) that can be verified in parallel with ewfverify -t\n"
+	                 "\t        (default is 0 which disables the digest tree, only supported\n"
+	                 "\t        by EWF1 formats)\n" );
 	fprintf( stream, "\t-m:     specify the media type, options: fixed (default), removable,\n"
 	                 "\t        optical, memory\n" );
 	fprintf( stream, "\t-M:     specify the media flags, options: logical, physical (default)\n" );
@@ -585,6 +600,9 @@ int ewfacquire_read_input(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	device_read_thread_t *device_read_thread     = NULL;
+#endif
 	storage_media_buffer_t *storage_media_buffer = NULL;
 	static char *function                        = "ewfacquire_read_input";
 	size64_t acquiry_count                       = 0;
@@ -598,6 +616,9 @@ int ewfacquire_read_input(
 	off64_t read_error_offset                    = 0;
 	off64_t storage_media_offset                 = 0;
 	uint8_t storage_media_buffer_mode            = 0;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int maximum_number_of_reads_in_flight        = 0;
+#endif
 	int number_of_read_errors                    = 0;
         int read_error_iterator                      = 0;
 	int status                                   = PROCESS_STATUS_COMPLETED;
@@ -830,38 +851,6 @@ int ewfacquire_read_input(
 		{
 			break;
 		}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-		if( ( storage_media_buffer == NULL )
-		 && ( imaging_handle->number_of_threads > 0 ) )
-		{
-			if( storage_media_buffer_queue_grab_buffer(
-			     imaging_handle->storage_media_buffer_queue,
-			     &storage_media_buffer,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to grab storage media buffer from queue.",
-				 function );
-
-				goto on_error;
-			}
-			if( storage_media_buffer == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing storage media buffer.",
-				 function );
-
-				goto on_error;
-			}
-		}
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
-
 		read_size = process_buffer_size;
 
 		if( remaining_aquiry_size < (size64_t) read_size )
@@ -870,6 +859,38 @@ int ewfacquire_read_input(
 		}
 		if( imaging_handle->last_offset_written < resume_acquiry_offset )
 		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( ( storage_media_buffer == NULL )
+			 && ( imaging_handle->number_of_threads > 0 ) )
+			{
+				if( storage_media_buffer_queue_grab_buffer(
+				     imaging_handle->storage_media_buffer_queue,
+				     &storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to grab storage media buffer from queue.",
+					 function );
+
+					goto on_error;
+				}
+				if( storage_media_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing storage media buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 			/* Align with resume acquiry offset if necessary
 			 */
 			if( ( resume_acquiry_offset - (off64_t) acquiry_count ) < (off64_t) read_size )
@@ -936,6 +957,69 @@ int ewfacquire_read_input(
 			}
 			read_count = process_count;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		else if( imaging_handle->number_of_threads > 0 )
+		{
+			/* The device is read by a separate thread that keeps reads in flight
+			 * so that device read latency overlaps with processing the data
+			 */
+			if( device_read_thread == NULL )
+			{
+				maximum_number_of_reads_in_flight = imaging_handle->maximum_number_of_queued_items / 2;
+
+				if( maximum_number_of_reads_in_flight < 1 )
+				{
+					maximum_number_of_reads_in_flight = 1;
+				}
+				if( device_read_thread_initialize(
+				     &device_read_thread,
+				     device_handle,
+				     imaging_handle->storage_media_buffer_queue,
+				     storage_media_offset,
+				     remaining_aquiry_size,
+				     process_buffer_size,
+				     maximum_number_of_reads_in_flight,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create device read thread.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			read_count = device_read_thread_read_buffer(
+				      device_read_thread,
+				      &storage_media_buffer,
+				      error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: error reading data from input.",
+				 function );
+
+				goto on_error;
+			}
+			if( read_count == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of input.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 		else
 		{
 			read_count = device_handle_read_storage_media_buffer(
@@ -1028,6 +1112,22 @@ int ewfacquire_read_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	else
 	{
+		if( device_read_thread != NULL )
+		{
+			if( device_read_thread_free(
+			     &device_read_thread,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device read thread.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( imaging_handle_threads_stop(
 		     imaging_handle,
 		     error ) != 1 )
@@ -1193,6 +1293,12 @@ on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	else
 	{
+		if( device_read_thread != NULL )
+		{
+			device_read_thread_free(
+			 &device_read_thread,
+			 NULL );
+		}
 		imaging_handle_threads_stop(
 		 imaging_handle,
 		 NULL );
@@ -1237,6 +1343,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_examiner_name             = NULL;
 	system_character_t *option_format                    = NULL;
 	system_character_t *option_header_codepage           = NULL;
+	system_character_t *option_digest_tree_leaf_size     = NULL;
 	system_character_t *option_maximum_segment_size      = NULL;
 	system_character_t *option_media_flags               = NULL;
 	system_character_t *option_media_type                = NULL;
@@ -1300,7 +1407,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hj:l:m:M:N:o:p:P:qr:RsS:t:T:uvVwx2:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hj:l:L:m:M:N:o:p:P:qr:RsS:t:T:uvVwx2:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -1395,6 +1502,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'L':
+				option_digest_tree_leaf_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'm':
 				option_media_type = optarg;
 
@@ -2115,6 +2227,29 @@ int main( int argc, char * const argv[] )
 			 ewfacquire_imaging_handle->sector_error_granularity );
 		}
 	}
+	if( option_digest_tree_leaf_size != NULL )
+	{
+		result = imaging_handle_set_number_of_chunks_per_digest_tree_leaf(
+			  ewfacquire_imaging_handle,
+			  option_digest_tree_leaf_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of chunks per digest tree leaf.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of chunks per digest tree leaf defaulting to: %" PRIu32 ".\n",
+			 ewfacquire_imaging_handle->number_of_chunks_per_digest_tree_leaf );
+		}
+	}
 	if( option_maximum_segment_size != NULL )
 	{
 		result = imaging_handle_set_maximum_segment_size(
@@ -143,6 +143,15 @@ void usage_fprint(
 	                 "\t           (bzip2 is only supported by EWF2 formats)\n"
 #else
 	                 "\t           compression method options: deflate (default)\n"
+#endif
+#if defined( HAVE_ZSTD )
+	                 "\t           libewf specific compression method option: zstd\n"
+#endif
+#if defined( HAVE_LZ4 )
+	                 "\t           libewf specific compression method option: lz4\n"
+#endif
+#if defined( HAVE_ZSTD ) || defined( HAVE_LZ4 )
+	                 "\t           (libewf specific methods are only supported by EWF2 formats)\n"
 #endif
 	                 "\t           compression level options: none (default), empty-block,\n"
 	                 "\t           fast or best\n" );
@@ -57,6 +57,7 @@
 enum EWFINFO_MODES
 {
 	EWFINFO_MODE_FILE_ENTRY,
+	EWFINFO_MODE_FILE_ENTRIES_MEMORY_USAGE,
 	EWFINFO_MODE_FILE_SYSTEM_HIERARCHY,
 	EWFINFO_MODE_IMAGE
 };
@@ -77,7 +78,7 @@ void usage_fprint(
 	                 " Compression Format).\n\n" );
 
 	fprintf( stream, "Usage: ewfinfo [ -A codepage ] [ -B bodyfile ] [ -d date_format ]\n"
-	                 "               [ -f format ] [ -F path ] [ -s separator ] [ -ehHimvVx ]\n"
+	                 "               [ -f format ] [ -F path ] [ -s separator ] [ -ehHimMvVx ]\n"
 	                 "               ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
@@ -98,6 +99,7 @@ void usage_fprint(
 	fprintf( stream, "\t-H:        shows the logical files hierarchy\n" );
 	fprintf( stream, "\t-i:        only show EWF acquiry information\n" );
 	fprintf( stream, "\t-m:        only show EWF media information\n" );
+	fprintf( stream, "\t-M:        shows the memory used by the logical files\n" );
 	fprintf( stream, "\t-s:        path segment separator, options: / (default), \\\n" );
 	fprintf( stream, "\t-v:        verbose output to stderr\n" );
 	fprintf( stream, "\t-V:        print version\n" );
@@ -211,7 +213,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:B:d:ef:F:hHims:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:B:d:ef:F:hHimMs:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -338,6 +340,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'M':
+				option_mode = EWFINFO_MODE_FILE_ENTRIES_MEMORY_USAGE;
+
+				break;
+
 			case (system_integer_t) 's':
 				option_path_segment_separator = optarg;
 
@@ -736,6 +743,27 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 
+		case EWFINFO_MODE_FILE_ENTRIES_MEMORY_USAGE:
+			if( info_handle_logical_files_memory_usage_fprint(
+			     ewfinfo_info_handle,
+			     &error ) != 1 )
+			{
+				if( print_header != 0 )
+				{
+					ewftools_output_version_fprint(
+					 stderr,
+					 program );
+
+					print_header = 0;
+				}
+				fprintf(
+				 stderr,
+				 "Unable to print logical files memory usage.\n" );
+
+				goto on_error;
+			}
+			break;
+
 		case EWFINFO_MODE_FILE_SYSTEM_HIERARCHY:
 			if( info_handle_logical_files_hierarchy_fprint(
 			     ewfinfo_info_handle,
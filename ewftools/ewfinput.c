@@ -43,14 +43,20 @@
 
 /* Input selection definitions
  */
-#if defined( HAVE_BZIP2_SUPPORT )
-system_character_t *ewfinput_compression_methods[ 2 ] = {
+/* The libewf specific compression methods are listed after the EWF compression methods
+ */
+system_character_t *ewfinput_compression_methods[ EWFINPUT_COMPRESSION_METHODS_AMOUNT ] = {
 	_SYSTEM_STRING( "deflate" ),
-	_SYSTEM_STRING( "bzip2" ) };
-#else
-system_character_t *ewfinput_compression_methods[ 1 ] = {
-	_SYSTEM_STRING( "deflate" ) };
+#if defined( HAVE_BZIP2_SUPPORT )
+	_SYSTEM_STRING( "bzip2" ),
+#endif
+#if defined( HAVE_ZSTD )
+	_SYSTEM_STRING( "zstd" ),
 #endif
+#if defined( HAVE_LZ4 )
+	_SYSTEM_STRING( "lz4" ),
+#endif
+};
 
 system_character_t *ewfinput_compression_levels[ 4 ] = {
 	_SYSTEM_STRING( "none" ),
@@ -459,31 +465,46 @@ int ewfinput_determine_compression_method(
 	string_length = system_string_length(
 	                 string );
 
-#if defined( HAVE_BZIP2_SUPPORT )
-	if( string_length == 5 )
+	if( string_length == 3 )
 	{
+#if defined( HAVE_LZ4 )
 		if( system_string_compare(
 		     string,
-		     _SYSTEM_STRING( "bzip2" ),
-		     5 ) == 0 )
+		     _SYSTEM_STRING( "lz4" ),
+		     3 ) == 0 )
 		{
-			*compression_method = LIBEWF_COMPRESSION_METHOD_BZIP2;
+			*compression_method = LIBEWF_COMPRESSION_METHOD_LZ4;
 			result              = 1;
 		}
+#endif
 	}
-	else if( string_length == 7 )
+	else if( string_length == 4 )
 	{
+#if defined( HAVE_ZSTD )
 		if( system_string_compare(
 		     string,
-		     _SYSTEM_STRING( "deflate" ),
-		     7 ) == 0 )
+		     _SYSTEM_STRING( "zstd" ),
+		     4 ) == 0 )
 		{
-			*compression_method = LIBEWF_COMPRESSION_METHOD_DEFLATE;
+			*compression_method = LIBEWF_COMPRESSION_METHOD_ZSTD;
 			result              = 1;
 		}
+#endif
 	}
-#else
-	if( string_length == 7 )
+	else if( string_length == 5 )
+	{
+#if defined( HAVE_BZIP2_SUPPORT )
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bzip2" ),
+		     5 ) == 0 )
+		{
+			*compression_method = LIBEWF_COMPRESSION_METHOD_BZIP2;
+			result              = 1;
+		}
+#endif
+	}
+	else if( string_length == 7 )
 	{
 		if( system_string_compare(
 		     string,
@@ -494,7 +515,6 @@ int ewfinput_determine_compression_method(
 			result              = 1;
 		}
 	}
-#endif
 	return( result );
 }
 
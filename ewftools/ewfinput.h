@@ -32,10 +32,23 @@ extern "C" {
 #endif
 
 #if defined( HAVE_BZIP2_SUPPORT )
-#define EWFINPUT_COMPRESSION_METHODS_AMOUNT		2
+#define EWFINPUT_COMPRESSION_METHODS_BZIP2_AMOUNT	1
 #else
-#define EWFINPUT_COMPRESSION_METHODS_AMOUNT		1
+#define EWFINPUT_COMPRESSION_METHODS_BZIP2_AMOUNT	0
 #endif
+#if defined( HAVE_ZSTD )
+#define EWFINPUT_COMPRESSION_METHODS_ZSTD_AMOUNT	1
+#else
+#define EWFINPUT_COMPRESSION_METHODS_ZSTD_AMOUNT	0
+#endif
+#if defined( HAVE_LZ4 )
+#define EWFINPUT_COMPRESSION_METHODS_LZ4_AMOUNT		1
+#else
+#define EWFINPUT_COMPRESSION_METHODS_LZ4_AMOUNT		0
+#endif
+
+#define EWFINPUT_COMPRESSION_METHODS_AMOUNT \
+	( 1 + EWFINPUT_COMPRESSION_METHODS_BZIP2_AMOUNT + EWFINPUT_COMPRESSION_METHODS_ZSTD_AMOUNT + EWFINPUT_COMPRESSION_METHODS_LZ4_AMOUNT )
 #define EWFINPUT_COMPRESSION_METHODS_DEFAULT		0
 
 #define EWFINPUT_COMPRESSION_LEVELS_AMOUNT		4
@@ -53,11 +66,7 @@ extern "C" {
 #define EWFINPUT_SECTOR_PER_BLOCK_SIZES_AMOUNT		12
 #define EWFINPUT_SECTOR_PER_BLOCK_SIZES_DEFAULT		2
 
-#if defined( HAVE_BZIP2_SUPPORT )
-extern system_character_t *ewfinput_compression_methods[ 2 ];
-#else
-extern system_character_t *ewfinput_compression_methods[ 1 ];
-#endif
+extern system_character_t *ewfinput_compression_methods[ EWFINPUT_COMPRESSION_METHODS_AMOUNT ];
 extern system_character_t *ewfinput_compression_levels[ 4 ];
 extern system_character_t *ewfinput_format_types[ 15 ];
 extern system_character_t *ewfinput_media_types[ 4 ];
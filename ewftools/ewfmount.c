@@ -71,7 +71,8 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use ewfmount to mount an Expert Witness Compression Format (EWF) image file\n\n" );
 
-	fprintf( stream, "Usage: ewfmount [ -f format ] [ -X extended_options ] [ -hvV ] image mount_point\n\n" );
+	fprintf( stream, "Usage: ewfmount [ -f format ] [ -j jobs ] [ -X extended_options ] [ -hvV ]\n"
+	                 "                image mount_point\n\n" );
 
 	fprintf( stream, "\timage:       an Expert Witness Compression Format (EWF) image file\n\n" );
 	fprintf( stream, "\tmount_point: the directory to serve as mount point\n\n" );
@@ -79,6 +80,9 @@ void usage_fprint(
 	fprintf( stream, "\t-f:          specify the input format, options: raw (default), files (restricted to\n"
 	                 "\t             logical volume files)\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-j:          the number of concurrent read jobs (threads), where a number\n"
+	                 "\t             of 0 represents single-threaded mode (default is 4 if\n"
+	                 "\t             multi-threaded mode is supported)\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr, while ewfmount will remain running in the\n"
 	                 "\t             foreground\n" );
 	fprintf( stream, "\t-V:          print version\n" );
@@ -146,6 +150,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *mount_point             = NULL;
 	system_character_t *option_extended_options = NULL;
 	system_character_t *option_format           = NULL;
+	system_character_t *option_number_of_jobs   = NULL;
 	const system_character_t *path_prefix       = NULL;
 	system_character_t *program                 = _SYSTEM_STRING( "ewfmount" );
 	system_integer_t option                     = 0;
@@ -211,7 +216,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "f:hvVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "f:hj:vVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -238,6 +243,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -359,6 +369,40 @@ int main( int argc, char * const argv[] )
 			 "Unsupported input format defaulting to: raw.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		result = mount_handle_set_number_of_threads(
+			  ewfmount_mount_handle,
+			  option_number_of_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			ewfmount_mount_handle->number_of_threads = 4;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: %d.\n",
+			 ewfmount_mount_handle->number_of_threads );
+		}
+#else
+		ewfmount_mount_handle->number_of_threads = 0;
+
+		fprintf(
+		 stderr,
+		 "Unsupported number of jobs (threads) defaulting to: %d.\n",
+		 ewfmount_mount_handle->number_of_threads );
+#endif
+	}
 #if defined( HAVE_GETRLIMIT )
 	if( getrlimit(
 	     RLIMIT_NOFILE,
@@ -563,8 +607,27 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          ewfmount_fuse_handle );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ewfmount_mount_handle->number_of_threads > 0 )
+	{
+		/* The threads share the handle of the mount file system, which supports
+		 * concurrent reads
+		 */
+#if defined( HAVE_LIBFUSE3 )
+		result = fuse_loop_mt(
+		          ewfmount_fuse_handle,
+		          0 );
+#else
+		result = fuse_loop_mt(
+		          ewfmount_fuse_handle );
+#endif
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		result = fuse_loop(
+		          ewfmount_fuse_handle );
+	}
 
 	if( result != 0 )
 	{
@@ -608,10 +671,20 @@ int main( int argc, char * const argv[] )
 	ewfmount_dokan_options.Version    = DOKAN_VERSION;
 	ewfmount_dokan_options.MountPoint = mount_point;
 
+	/* The threads share the handle of the mount file system, which supports
+	 * concurrent reads
+	 */
 #if DOKAN_MINIMUM_COMPATIBLE_VERSION >= 200
-	ewfmount_dokan_options.SingleThread = TRUE;
+	if( ewfmount_mount_handle->number_of_threads > 0 )
+	{
+		ewfmount_dokan_options.SingleThread = FALSE;
+	}
+	else
+	{
+		ewfmount_dokan_options.SingleThread = TRUE;
+	}
 #else
-	ewfmount_dokan_options.ThreadCount  = 0;
+	ewfmount_dokan_options.ThreadCount  = (USHORT) ewfmount_mount_handle->number_of_threads;
 #endif
 	if( verbose != 0 )
 	{
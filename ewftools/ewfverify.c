@@ -73,7 +73,7 @@ void usage_fprint(
 
 	fprintf( stream, "Usage: ewfverify [ -A codepage ] [ -d digest_type ] [ -f format ]\n"
 	                 "                 [ -j jobs ] [ -l log_filename ] [ -p process_buffer_size ]\n"
-	                 "                 [ -hqvVwx ] ewf_files\n\n" );
+	                 "                 [ -hqtvVwx ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -95,6 +95,10 @@ void usage_fprint(
 	                 "\t           log_filename\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
 	fprintf( stream, "\t-q:        quiet shows minimal status information\n" );
+	fprintf( stream, "\t-t:        verify the digest tree stored in the EWF segment files\n"
+	                 "\t           instead of calculating the digest (hash) of the media\n"
+	                 "\t           data, where the leaves are verified concurrently in\n"
+	                 "\t           multi-threaded mode\n" );
 	fprintf( stream, "\t-v:        verbose output to stderr\n" );
 	fprintf( stream, "\t-V:        print version\n" );
 	fprintf( stream, "\t-w:        zero sectors on checksum error (mimic EnCase like behavior)\n" );
@@ -171,6 +175,7 @@ int main( int argc, char * const argv[] )
 	system_integer_t option                        = 0;
 	uint8_t print_status_information               = 1;
 	uint8_t use_data_chunk_functions               = 0;
+	uint8_t verify_digest_tree                     = 0;
 	uint8_t verbose                                = 0;
 	uint8_t zero_chunk_on_error                    = 0;
 	int number_of_filenames                        = 0;
@@ -213,7 +218,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:d:f:j:hl:p:qvVwx" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:d:f:j:hl:p:qtvVwx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -270,6 +275,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 't':
+				verify_digest_tree = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -613,6 +623,26 @@ int main( int argc, char * const argv[] )
 			 &error );
 		}
 	}
+	else if( verify_digest_tree != 0 )
+	{
+		result = verification_handle_verify_digest_tree(
+		          ewfverify_verification_handle,
+		          print_status_information,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify digest tree.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	else
 	{
 		result = verification_handle_verify_input(
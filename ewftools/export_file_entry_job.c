@@ -0,0 +1,329 @@
+/*
+ * Export file entry job
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "ewftools_libcdata.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libewf.h"
+#include "export_file_entry_job.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates an export file entry job
+ * Make sure the value job is referencing, is set to NULL
+ * The media location of the data is determined from the file entry
+ * so that the job can be read through any (cloned) handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_file_entry_job_initialize(
+     export_file_entry_job_t **job,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "export_file_entry_job_initialize";
+	off64_t duplicate_media_data_offset = -1;
+	uint32_t flags                      = 0;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( target_path_size == 0 )
+	 || ( target_path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*job = memory_allocate_structure(
+	        export_file_entry_job_t );
+
+	if( *job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *job,
+	     0,
+	     sizeof( export_file_entry_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
+		 function );
+
+		memory_free(
+		 *job );
+
+		*job = NULL;
+
+		return( -1 );
+	}
+	( *job )->target_path = system_string_allocate(
+	                         target_path_size );
+
+	if( ( *job )->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *job )->target_path,
+	     target_path,
+	     target_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path.",
+		 function );
+
+		goto on_error;
+	}
+	( *job )->target_path[ target_path_size - 1 ] = 0;
+
+	( *job )->target_path_size = target_path_size;
+
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &( ( *job )->data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_media_data_offset(
+	     file_entry,
+	     &( ( *job )->data_offset ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media data offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_get_flags(
+	     file_entry,
+	     &flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* Sparse data is stored either as a reference to duplicate data
+	 * or as a single byte that is repeated for the size of the data
+	 */
+	if( ( flags & LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA ) != 0 )
+	{
+		if( libewf_file_entry_get_duplicate_media_data_offset(
+		     file_entry,
+		     &duplicate_media_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve duplicate media data offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( duplicate_media_data_offset >= 0 )
+		{
+			( *job )->data_offset = duplicate_media_data_offset;
+		}
+		else
+		{
+			( *job )->is_sparse = 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *job != NULL )
+	{
+		if( ( *job )->target_path != NULL )
+		{
+			memory_free(
+			 ( *job )->target_path );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export file entry job
+ * Returns 1 if successful or -1 on error
+ */
+int export_file_entry_job_free(
+     export_file_entry_job_t **job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_file_entry_job_free";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		if( ( *job )->target_path != NULL )
+		{
+			memory_free(
+			 ( *job )->target_path );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two export file entry jobs by the media offset of their data
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER
+ * if successful or -1 on error
+ */
+int export_file_entry_job_compare(
+     export_file_entry_job_t *first_job,
+     export_file_entry_job_t *second_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_file_entry_job_compare";
+
+	if( first_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first job.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second job.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_job->data_offset < second_job->data_offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_job->data_offset > second_job->data_offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
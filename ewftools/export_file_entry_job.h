@@ -0,0 +1,90 @@
+/*
+ * Export file entry job
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_FILE_ENTRY_JOB_H )
+#define _EXPORT_FILE_ENTRY_JOB_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libewf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct export_file_entry_job export_file_entry_job_t;
+
+struct export_file_entry_job
+{
+	/* The target path
+	 */
+	system_character_t *target_path;
+
+	/* The target path size
+	 */
+	size_t target_path_size;
+
+	/* The media offset of the data to read
+	 */
+	off64_t data_offset;
+
+	/* The size of the data
+	 */
+	size64_t data_size;
+
+	/* Value to indicate the data consists of a single repeated byte
+	 */
+	uint8_t is_sparse;
+
+	/* The result of the job
+	 * 1 if exported, 0 if not or -1 on error
+	 */
+	int result;
+};
+
+int export_file_entry_job_initialize(
+     export_file_entry_job_t **job,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error );
+
+int export_file_entry_job_free(
+     export_file_entry_job_t **job,
+     libcerror_error_t **error );
+
+int export_file_entry_job_compare(
+     export_file_entry_job_t *first_job,
+     export_file_entry_job_t *second_job,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_FILE_ENTRY_JOB_H ) */
+
@@ -54,6 +54,7 @@
 #include "ewftools_libsmraw.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_system_string.h"
+#include "export_file_entry_job.h"
 #include "export_handle.h"
 #include "guid.h"
 #include "process_status.h"
@@ -65,6 +66,8 @@
 #define EXPORT_HANDLE_STRING_SIZE			1024
 #define EXPORT_HANDLE_NOTIFY_STREAM			stderr
 #define EXPORT_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE	64 * 1024 * 1024
+#define EXPORT_HANDLE_PREFETCH_WINDOW_PER_THREAD	4
+#define EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH		32
 
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
@@ -4510,8 +4513,6 @@ int export_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      export_handle_t *export_handle )
 {
-	libcdata_list_element_t *element                    = NULL;
-	libcdata_list_element_t *next_element               = NULL;
         libcerror_error_t *error                            = NULL;
 	storage_media_buffer_t *output_storage_media_buffer = NULL;
 	uint8_t *data                                       = NULL;
@@ -4546,72 +4547,41 @@ int export_handle_output_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
-	if( libcdata_list_insert_value(
-	     export_handle->output_list,
-	     (intptr_t *) storage_media_buffer,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_compare,
-	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	if( storage_media_buffer_ring_insert_buffer(
+	     export_handle->output_ring,
+	     storage_media_buffer,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert storage media buffer into output list.",
+		 "%s: unable to insert storage media buffer into output ring.",
 		 function );
 
 		goto on_error;
 	}
 	storage_media_buffer = NULL;
 
-	if( libcdata_list_get_first_element(
-	     export_handle->output_list,
-	     &element,
-	     &error ) != 1 )
+	while( export_handle->abort == 0 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          export_handle->output_ring,
+		          &storage_media_buffer,
+		          &error );
 
-		goto on_error;
-	}
-	while( element != NULL )
-	{
-		if( export_handle->abort != 0 )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove next storage media buffer from output ring.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer->storage_media_offset != export_handle->last_offset_hashed )
+		else if( result == 0 )
 		{
 			break;
 		}
@@ -4628,8 +4598,6 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine if storage media buffer is corrupted.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		else if( result != 0 )
@@ -4649,8 +4617,6 @@ int export_handle_output_storage_media_buffer_callback(
 				 "%s: unable to append read error.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
@@ -4667,8 +4633,6 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine storage media buffer data.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		/* Swap byte pairs
@@ -4688,8 +4652,6 @@ int export_handle_output_storage_media_buffer_callback(
 				 "%s: unable to swap byte pairs.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
@@ -4708,8 +4670,6 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to update integrity hash(es).",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		export_handle->last_offset_hashed = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
@@ -4730,8 +4690,6 @@ int export_handle_output_storage_media_buffer_callback(
 				 "%s: unable to create output storage media buffer.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
@@ -4751,56 +4709,6 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to write to export handle.",
 			 function );
 
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     export_handle->output_list,
-		     element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
 			goto on_error;
 		}
 /* TODO: if storage media buffer can be passed on do not release it */
@@ -4837,8 +4745,6 @@ int export_handle_output_storage_media_buffer_callback(
 				goto on_error;
 			}
 		}
-		element = next_element;
-
 		if( process_status_update(
 		     export_handle->process_status,
 		     export_handle->last_offset_hashed,
@@ -4912,10 +4818,7 @@ int export_handle_empty_output_list(
      export_handle_t *export_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "export_handle_empty_output_list";
+        static char *function = "export_handle_empty_output_list";
 
 	if( export_handle == NULL )
 	{
@@ -4928,109 +4831,20 @@ int export_handle_empty_output_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     export_handle->output_list,
-	     &element,
+	if( storage_media_buffer_ring_empty(
+	     export_handle->output_ring,
+	     export_handle->storage_media_buffer_queue,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty output ring.",
 		 function );
 
 		return( -1 );
 	}
-	while( element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer_queue_release_buffer(
-		     export_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
-			 function );
-
-			return( -1 );
-		}
-		storage_media_buffer = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_remove_element(
-		     export_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			return( -1 );
-		}
-		element = next_element;
-	}
 	return( 1 );
 }
 
@@ -5051,6 +4865,8 @@ int export_handle_export_input(
 	uint8_t *data                                       = NULL;
 	static char *function                               = "export_handle_export_input";
 	size64_t remaining_export_size                      = 0;
+	uint64_t number_of_prefetch_hits                    = 0;
+	uint64_t number_of_prefetched_chunks                = 0;
 	size_t data_size                                    = 0;
 	size_t process_buffer_size                          = 0;
 	size_t read_size                                    = 0;
@@ -5199,6 +5015,22 @@ int export_handle_export_input(
 	{
 		maximum_number_of_queued_items = 1 + (int) ( EXPORT_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE / process_buffer_size );
 
+		/* Prefetch the chunks ahead of the sequential reads of the input handle
+		 */
+		if( libewf_handle_set_prefetch_window(
+		     export_handle->input_handle,
+		     EXPORT_HANDLE_PREFETCH_WINDOW_PER_THREAD * export_handle->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set prefetch window in input handle.",
+			 function );
+
+			goto on_error;
+		}
 		if( libcthreads_thread_pool_create(
 		     &( export_handle->input_process_thread_pool ),
 		     NULL,
@@ -5235,15 +5067,16 @@ int export_handle_export_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( export_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( export_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -5414,6 +5247,20 @@ int export_handle_export_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( export_handle->number_of_threads != 0 )
 		{
+			if( storage_media_buffer_ring_set_sequence_number(
+			     export_handle->output_ring,
+			     input_storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set storage media buffer sequence number.",
+				 function );
+
+				goto on_error;
+			}
 			if( libcthreads_thread_pool_push(
 			     export_handle->input_process_thread_pool,
 			     (intptr_t *) input_storage_media_buffer,
@@ -5661,7 +5508,7 @@ int export_handle_export_input(
 			goto on_error;
 		}
 	}
-	if( export_handle->output_list != NULL )
+	if( export_handle->output_ring != NULL )
 	{
 		if( export_handle_empty_output_list(
 		     export_handle,
@@ -5676,16 +5523,15 @@ int export_handle_export_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( export_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( export_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -5769,6 +5615,29 @@ int export_handle_export_input(
 
 		goto on_error;
 	}
+	if( libcnotify_verbose != 0 )
+	{
+		if( libewf_handle_get_prefetch_statistics(
+		     export_handle->input_handle,
+		     &number_of_prefetched_chunks,
+		     &number_of_prefetch_hits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve prefetch statistics from input handle.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: number of prefetched chunks: %" PRIu64 ", of which read from cache: %" PRIu64 ".\n",
+		 function,
+		 number_of_prefetched_chunks,
+		 number_of_prefetch_hits );
+	}
 	if( export_handle->abort == 0 )
 	{
 		if( export_handle_hash_values_fprint(
@@ -5871,14 +5740,13 @@ on_error:
 		 &( export_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( export_handle->output_list != NULL )
+	if( export_handle->output_ring != NULL )
 	{
 		export_handle_empty_output_list(
 		 export_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( export_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( export_handle->output_ring ),
 		 NULL );
 	}
 	if( export_handle->storage_media_buffer_queue != NULL )
@@ -6052,6 +5920,62 @@ int export_handle_export_single_files(
 
 		goto on_error;
 	}
+	if( export_handle->abort == 0 )
+	{
+		result = export_handle_export_data_ordered_file_entries(
+		          export_handle,
+		          sanitized_name,
+		          sanitized_name_size,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export data ordered file entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->file_entry_jobs != NULL )
+	{
+		if( export_handle->abort == 0 )
+		{
+			if( export_handle_export_file_entry_jobs(
+			     export_handle,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export file entry jobs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_free_file_entry_jobs(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry jobs.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 	memory_free(
 	 sanitized_name );
 
@@ -6105,6 +6029,14 @@ int export_handle_export_single_files(
 	return( 1 );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->file_entry_jobs != NULL )
+	{
+		export_handle_free_file_entry_jobs(
+		 export_handle,
+		 NULL );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 	if( export_handle->process_status != NULL )
 	{
 		process_status_stop(
@@ -6189,6 +6121,13 @@ int export_handle_export_file_entry(
 
 		goto on_error;
 	}
+	/* The file entry data is exported after the file entries have been walked,
+	 * in the order of the media data offsets
+	 */
+	if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_FILE )
+	{
+		return( 1 );
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libewf_file_entry_get_utf16_name_size(
 	          file_entry,
@@ -6353,76 +6292,25 @@ int export_handle_export_file_entry(
 			 log_handle,
 			 "Skipping file entry it already exists.\n" );
 		}
-		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_FILE )
+		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
 		{
-			if( file_entry_path_index >= target_path_size )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libcpath_path_make_directory_wide(
+			     target_path,
+			     error ) != 1 )
+#else
+			if( libcpath_path_make_directory(
+			     target_path,
+			     error ) != 1 )
+#endif
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: file entry path index value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			/* TODO what about NTFS streams ?
-			 */
-			fprintf(
-			 export_handle->notify_stream,
-			 "Single file: %" PRIs_SYSTEM "\n",
-			 &( target_path[ file_entry_path_index ] ) );
-
-			return_value = export_handle_export_file_entry_data(
-				        export_handle,
-			                file_entry,
-			                target_path,
-			                error );
-
-			if( return_value == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export file entry data.",
-				 function );
-
-				goto on_error;
-			}
-			if( return_value == 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "FAILED\n" );
-
-				if( log_handle != NULL )
-				{
-					log_handle_printf(
-					 log_handle,
-					 "FAILED\n" );
-				}
-			}
-		}
-		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
-		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libcpath_path_make_directory_wide(
-			     target_path,
-			     error ) != 1 )
-#else
-			if( libcpath_path_make_directory(
-			     target_path,
-			     error ) != 1 )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to create directory: %" PRIs_SYSTEM "",
-				 function,
-				 target_path );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to create directory: %" PRIs_SYSTEM "",
+				 function,
+				 target_path );
 
 				goto on_error;
 			}
@@ -6495,24 +6383,25 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the data of a (single) file entry
+/* Exports the (single) file entries in the order of their media data offsets
  * Returns 1 if successful, 0 if not or -1 on error
  */
-int export_handle_export_file_entry_data(
+int export_handle_export_data_ordered_file_entries(
      export_handle_t *export_handle,
-     libewf_file_entry_t *file_entry,
      const system_character_t *export_path,
+     size_t export_path_size,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcfile_file_t *file         = NULL;
-	uint8_t *file_entry_data      = NULL;
-	static char *function         = "export_handle_export_file_entry_data";
-	size64_t file_entry_data_size = 0;
-	size_t process_buffer_size    = EXPORT_HANDLE_BUFFER_SIZE;
-	size_t read_size              = 0;
-	ssize_t read_count            = 0;
-	ssize_t write_count           = 0;
-	int result                    = 1;
+	libewf_file_entry_t *file_entry = NULL;
+	system_character_t *target_path = NULL;
+	static char *function           = "export_handle_export_data_ordered_file_entries";
+	size_t name_size                = 0;
+	size_t target_path_size         = 0;
+	int file_entry_index            = 0;
+	int number_of_file_entries      = 0;
+	int result                      = 0;
+	int return_value                = 1;
 
 	if( export_handle == NULL )
 	{
@@ -6525,39 +6414,6 @@ int export_handle_export_file_entry_data(
 
 		return( -1 );
 	}
-	if( export_handle->input_chunk_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing input chunk size.",
-		 function );
-
-		return( -1 );
-	}
-	if( export_handle->input_chunk_size > (size32_t) INT32_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid input chunk size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid export handle - process buffer size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
 	if( export_path == NULL )
 	{
 		libcerror_error_set(
@@ -6569,222 +6425,1814 @@ int export_handle_export_file_entry_data(
 
 		return( -1 );
 	}
-	if( libcfile_file_initialize(
-	     &file,
-	     error ) != 1 )
+	if( ( export_path_size == 0 )
+	 || ( export_path_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export path size value out of bounds.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcfile_file_open_wide(
-	     file,
-	     export_path,
-	     LIBCFILE_OPEN_WRITE,
-	     error ) != 1 )
-#else
-	if( libcfile_file_open(
-	     file,
-	     export_path,
-	     LIBCFILE_OPEN_WRITE,
-	     error ) != 1 )
-#endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %" PRIs_SYSTEM ".",
-		 function,
-		 export_path );
-
-		goto on_error;
+		return( -1 );
 	}
-	/* Export the file entry data
-	 */
-	if( libewf_file_entry_get_size(
-	     file_entry,
-	     &file_entry_data_size,
+	if( libewf_handle_get_number_of_data_ordered_file_entries(
+	     export_handle->input_handle,
+	     &number_of_file_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry data size.",
+		 "%s: unable to retrieve number of data ordered file entries.",
 		 function );
 
 		goto on_error;
 	}
-	/* If there is no file entry data an empty file is written
-	 */
-	if( file_entry_data_size > 0 )
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
 	{
-		if( export_handle->process_buffer_size == 0 )
-		{
-			process_buffer_size = export_handle->input_chunk_size;
-		}
-		else
+		if( export_handle->abort != 0 )
 		{
-			process_buffer_size = export_handle->process_buffer_size;
+			break;
 		}
-		/* This function in not necessary for normal use
-		 * but it was added for testing
-		 */
-		if( libewf_file_entry_seek_offset(
-		     file_entry,
-		     0,
-		     SEEK_SET,
-		     error ) != 0 )
+		if( libewf_handle_get_data_ordered_file_entry_by_index(
+		     export_handle->input_handle,
+		     file_entry_index,
+		     &file_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to seek the start of the file entry data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data ordered file entry: %d.",
+			 function,
+			 file_entry_index );
 
 			goto on_error;
 		}
-		file_entry_data = (uint8_t *) memory_allocate(
-		                               sizeof( uint8_t ) * process_buffer_size );
-
-		if( file_entry_data == NULL )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libewf_file_entry_get_utf16_name_size(
+		          file_entry,
+		          &name_size,
+		          error );
+#else
+		result = libewf_file_entry_get_utf8_name_size(
+		          file_entry,
+		          &name_size,
+		          error );
+#endif
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create file entry data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the name size.",
 			 function );
 
 			goto on_error;
 		}
-		while( file_entry_data_size > 0 )
+		if( name_size <= 1 )
 		{
-			if( file_entry_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
-			{
-				read_size = EXPORT_HANDLE_BUFFER_SIZE;
-			}
-			else
-			{
-				read_size = (size_t) file_entry_data_size;
-			}
-			read_count = libewf_file_entry_read_buffer(
-			              file_entry,
-			              file_entry_data,
-			              read_size,
-			              error );
-
-			if( read_count == (ssize_t) -1 )
+			log_handle_printf(
+			 log_handle,
+			 "Skipping file entry without a name.\n" );
+		}
+		else
+		{
+			if( export_handle_get_file_entry_target_path(
+			     export_handle,
+			     file_entry,
+			     export_path,
+			     export_path_size,
+			     &target_path,
+			     &target_path_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file entry data.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve target path of file entry: %d.",
+				 function,
+				 file_entry_index );
 
 				goto on_error;
 			}
-			else if( read_count != (ssize_t) read_size )
-			{
-				result = 0;
-
-				break;
-			}
-			file_entry_data_size -= read_size;
-
-			write_count = libcfile_file_write_buffer(
-			               file,
-			               file_entry_data,
-			               read_size,
-			               error );
-
-			if( write_count != (ssize_t) read_size )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libcfile_file_exists_wide(
+				  target_path,
+				  error );
+#else
+			result = libcfile_file_exists(
+				  target_path,
+				  error );
+#endif
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write file entry data.",
-				 function );
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+				 function,
+				 target_path );
 
 				goto on_error;
 			}
-		}
-		memory_free(
-		 file_entry_data );
+			else if( result != 0 )
+			{
+				log_handle_printf(
+				 log_handle,
+				 "Skipping file entry it already exists.\n" );
+			}
+			else
+			{
+				/* TODO what about NTFS streams ?
+				 */
+				fprintf(
+				 export_handle->notify_stream,
+				 "Single file: %" PRIs_SYSTEM "\n",
+				 &( target_path[ export_path_size - 1 ] ) );
 
-		file_entry_data = NULL;
-	}
-	if( libcfile_file_close(
-	     file,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close file.",
-		 function );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				if( export_handle->number_of_threads != 0 )
+				{
+					if( export_handle_append_file_entry_job(
+					     export_handle,
+					     file_entry,
+					     target_path,
+					     target_path_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append file entry job.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+				{
+					result = export_handle_export_file_entry_data(
+						  export_handle,
+						  file_entry,
+						  target_path,
+						  error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to export file entry data.",
+						 function );
+
+						goto on_error;
+					}
+					else if( result == 0 )
+					{
+						fprintf(
+						 export_handle->notify_stream,
+						 "FAILED\n" );
+
+						if( log_handle != NULL )
+						{
+							log_handle_printf(
+							 log_handle,
+							 "FAILED\n" );
+						}
+						return_value = 0;
+					}
+				}
+			}
+			memory_free(
+			 target_path );
+
+			target_path = NULL;
+		}
+		if( libewf_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( return_value );
+
+on_error:
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the target path of a (single) file entry
+ * The target path is determined from the sanitized names of the file entry
+ * and its parents, relative to the export path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_file_entry_target_path(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *parent_file_entry = NULL;
+	system_character_t *name               = NULL;
+	system_character_t *parent_path        = NULL;
+	system_character_t *sanitized_name     = NULL;
+	static char *function                  = "export_handle_get_file_entry_target_path";
+	size_t name_size                       = 0;
+	size_t parent_path_size                = 0;
+	size_t sanitized_name_size             = 0;
+	int result                             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_path_size == 0 )
+	 || ( export_path_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_file_entry_get_parent_file_entry(
+	          file_entry,
+	          &parent_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( export_handle_get_file_entry_target_path(
+		     export_handle,
+		     parent_file_entry,
+		     export_path,
+		     export_path_size,
+		     &parent_path,
+		     &parent_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file entry target path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_file_entry_free(
+		     &parent_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parent file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		parent_path = system_string_allocate(
+		               export_path_size );
+
+		if( parent_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parent path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     parent_path,
+		     export_path,
+		     export_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy export path.",
+			 function );
+
+			goto on_error;
+		}
+		parent_path[ export_path_size - 1 ] = 0;
+
+		parent_path_size = export_path_size;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the name size.",
+		 function );
+
+		goto on_error;
+	}
+	/* A file entry without a name is exported into the path of its parent
+	 */
+	if( name_size <= 1 )
+	{
+		*target_path      = parent_path;
+		*target_path_size = parent_path_size;
+
+		return( 1 );
+	}
+	name = system_string_allocate(
+	        name_size );
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) name,
+	          name_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) name,
+	          name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the name.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_get_sanitized_filename_wide(
+	     name,
+	     name_size - 1,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
+#else
+	if( libcpath_path_get_sanitized_filename(
+	     name,
+	     name_size - 1,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable sanitize name.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 name );
+
+	name = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     target_path,
+	     target_path_size,
+	     parent_path,
+	     parent_path_size - 1,
+	     sanitized_name,
+	     sanitized_name_size - 1,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     target_path,
+	     target_path_size,
+	     parent_path,
+	     parent_path_size - 1,
+	     sanitized_name,
+	     sanitized_name_size - 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create target path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sanitized_name );
+
+	memory_free(
+	 parent_path );
+
+	return( 1 );
+
+on_error:
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( parent_path != NULL )
+	{
+		memory_free(
+		 parent_path );
+	}
+	if( parent_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the data of a (single) file entry
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry_data(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file         = NULL;
+	uint8_t *file_entry_data      = NULL;
+	static char *function         = "export_handle_export_file_entry_data";
+	size64_t file_entry_data_size = 0;
+	size_t process_buffer_size    = EXPORT_HANDLE_BUFFER_SIZE;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	ssize_t write_count           = 0;
+	int result                    = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing input chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export handle - process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     export_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     export_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 export_path );
+
+		goto on_error;
+	}
+	/* Export the file entry data
+	 */
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &file_entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* If there is no file entry data an empty file is written
+	 */
+	if( file_entry_data_size > 0 )
+	{
+		if( export_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = export_handle->input_chunk_size;
+		}
+		else
+		{
+			process_buffer_size = export_handle->process_buffer_size;
+		}
+		/* This function in not necessary for normal use
+		 * but it was added for testing
+		 */
+		if( libewf_file_entry_seek_offset(
+		     file_entry,
+		     0,
+		     SEEK_SET,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to seek the start of the file entry data.",
+			 function );
+
+			goto on_error;
+		}
+		file_entry_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * process_buffer_size );
+
+		if( file_entry_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entry data.",
+			 function );
+
+			goto on_error;
+		}
+		while( file_entry_data_size > 0 )
+		{
+			if( file_entry_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
+			{
+				read_size = EXPORT_HANDLE_BUFFER_SIZE;
+			}
+			else
+			{
+				read_size = (size_t) file_entry_data_size;
+			}
+			read_count = libewf_file_entry_read_buffer(
+			              file_entry,
+			              file_entry_data,
+			              read_size,
+			              error );
+
+			if( read_count == (ssize_t) -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( read_count != (ssize_t) read_size )
+			{
+				result = 0;
+
+				break;
+			}
+			file_entry_data_size -= read_size;
+
+			write_count = libcfile_file_write_buffer(
+			               file,
+			               file_entry_data,
+			               read_size,
+			               error );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write file entry data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 file_entry_data );
+
+		file_entry_data = NULL;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_entry_data != NULL )
+	{
+		memory_free(
+		 file_entry_data );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a (single) file entry sub file entries
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry_sub_file_entries(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *sub_file_entry = NULL;
+	static char *function               = "export_handle_export_file_entry_sub_file_entries";
+	int number_of_sub_file_entries      = 0;
+	int result                          = 0;
+	int return_value                    = 1;
+	int sub_file_entry_index            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libewf_file_entry_get_sub_file_entry(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to free retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		result = export_handle_export_file_entry(
+		          export_handle,
+		          sub_file_entry,
+		          export_path,
+		          export_path_size,
+		          file_entry_path_index,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return_value = 0;
+		}
+		if( libewf_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( return_value );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates the input handle clones
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_input_handle_clones(
+     export_handle_t *export_handle,
+     int number_of_input_handle_clones,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_create_input_handle_clones";
+	size_t clones_size           = 0;
+	int input_handle_clone_index = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_handle_clones != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - input handle clones value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_input_handle_clones <= 0 )
+	 || ( (size_t) number_of_input_handle_clones > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_handle_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of input handle clones value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	clones_size = sizeof( libewf_handle_t * ) * number_of_input_handle_clones;
+
+	export_handle->input_handle_clones = (libewf_handle_t **) memory_allocate(
+	                                                                 clones_size );
+
+	if( export_handle->input_handle_clones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->input_handle_clones,
+	     0,
+	     clones_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->number_of_input_handle_clones = number_of_input_handle_clones;
+
+	if( libcthreads_queue_initialize(
+	     &( export_handle->input_handle_clones_queue ),
+	     number_of_input_handle_clones,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle clones queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( input_handle_clone_index = 0;
+	     input_handle_clone_index < number_of_input_handle_clones;
+	     input_handle_clone_index++ )
+	{
+		if( libewf_handle_clone(
+		     &( export_handle->input_handle_clones[ input_handle_clone_index ] ),
+		     export_handle->input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input handle clone: %d.",
+			 function,
+			 input_handle_clone_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     export_handle->input_handle_clones_queue,
+		     (intptr_t *) export_handle->input_handle_clones[ input_handle_clone_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push input handle clone: %d onto queue.",
+			 function,
+			 input_handle_clone_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	export_handle_free_input_handle_clones(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the input handle clones
+ * The input handle clones should not be in use when they are freed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_input_handle_clones(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_free_input_handle_clones";
+	int input_handle_clone_index = 0;
+	int result                   = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The input handle clones are owned by the input handle clones array not by the queue
+	 */
+	if( export_handle->input_handle_clones_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( export_handle->input_handle_clones_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input handle clones queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->input_handle_clones != NULL )
+	{
+		for( input_handle_clone_index = 0;
+		     input_handle_clone_index < export_handle->number_of_input_handle_clones;
+		     input_handle_clone_index++ )
+		{
+			if( export_handle->input_handle_clones[ input_handle_clone_index ] == NULL )
+			{
+				continue;
+			}
+			if( libewf_handle_free(
+			     &( export_handle->input_handle_clones[ input_handle_clone_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle clone: %d.",
+				 function,
+				 input_handle_clone_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->input_handle_clones );
+
+		export_handle->input_handle_clones = NULL;
+	}
+	export_handle->number_of_input_handle_clones = 0;
+
+	return( result );
+}
+
+/* Appends a file entry job
+ * The jobs are kept ordered by the media offset of their data, since the
+ * file entries are appended in that order the position of the job
+ * is searched for from the end of the jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_file_entry_job(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error )
+{
+	export_file_entry_job_t *job = NULL;
+	void *reallocation           = NULL;
+	static char *function        = "export_handle_append_file_entry_job";
+	int compare_result           = 0;
+	int job_index                = 0;
+	int number_of_jobs           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_file_entry_jobs == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export handle - number of file entry jobs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_file_entry_jobs >= export_handle->number_of_allocated_file_entry_jobs )
+	{
+		if( export_handle->number_of_allocated_file_entry_jobs == 0 )
+		{
+			number_of_jobs = EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH;
+		}
+		else if( export_handle->number_of_allocated_file_entry_jobs <= ( INT_MAX / 2 ) )
+		{
+			number_of_jobs = export_handle->number_of_allocated_file_entry_jobs * 2;
+		}
+		else
+		{
+			number_of_jobs = INT_MAX;
+		}
+		if( (size_t) number_of_jobs > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_file_entry_job_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file entry jobs value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                export_handle->file_entry_jobs,
+		                sizeof( export_file_entry_job_t * ) * number_of_jobs );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file entry jobs.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->file_entry_jobs                     = (export_file_entry_job_t **) reallocation;
+		export_handle->number_of_allocated_file_entry_jobs = number_of_jobs;
+	}
+	if( export_file_entry_job_initialize(
+	     &job,
+	     file_entry,
+	     target_path,
+	     target_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry job.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = export_handle->number_of_file_entry_jobs;
+	     job_index > 0;
+	     job_index-- )
+	{
+		compare_result = export_file_entry_job_compare(
+		                  export_handle->file_entry_jobs[ job_index - 1 ],
+		                  job,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare file entry job: %d.",
+			 function,
+			 job_index - 1 );
+
+			goto on_error;
+		}
+		else if( compare_result != LIBCDATA_COMPARE_GREATER )
+		{
+			break;
+		}
+		export_handle->file_entry_jobs[ job_index ] = export_handle->file_entry_jobs[ job_index - 1 ];
+	}
+	export_handle->file_entry_jobs[ job_index ] = job;
+
+	export_handle->number_of_file_entry_jobs += 1;
+
+	return( 1 );
+
+on_error:
+	/* Close the gap left by the jobs that were moved
+	 */
+	while( job_index < export_handle->number_of_file_entry_jobs )
+	{
+		export_handle->file_entry_jobs[ job_index ] = export_handle->file_entry_jobs[ job_index + 1 ];
+
+		job_index++;
+	}
+	export_file_entry_job_free(
+	 &job,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the file entry jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_file_entry_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free_file_entry_jobs";
+	int job_index         = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->file_entry_jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < export_handle->number_of_file_entry_jobs;
+		     job_index++ )
+		{
+			if( export_file_entry_job_free(
+			     &( export_handle->file_entry_jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry job: %d.",
+				 function,
+				 job_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->file_entry_jobs );
+
+		export_handle->file_entry_jobs = NULL;
+	}
+	export_handle->number_of_file_entry_jobs           = 0;
+	export_handle->number_of_allocated_file_entry_jobs = 0;
+
+	return( result );
+}
+
+/* Exports the data of a file entry job
+ * The data is read directly from the media so that any (cloned) input handle can be used
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry_job(
+     export_handle_t *export_handle,
+     libewf_handle_t *input_handle,
+     export_file_entry_job_t *job,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	static char *function = "export_handle_export_file_entry_job";
+	size64_t data_size    = 0;
+	off64_t data_offset   = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	ssize_t write_count   = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     job->target_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     job->target_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 job->target_path );
+
+		goto on_error;
+	}
+	data_offset = job->data_offset;
+	data_size   = job->data_size;
+
+	/* Sparse data is stored as a single byte that is repeated for the size of the data
+	 */
+	if( ( job->is_sparse != 0 )
+	 && ( data_size > 0 ) )
+	{
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
+		              input_handle,
+		              buffer,
+		              1,
+		              data_offset,
+		              error );
+
+		if( read_count == (ssize_t) -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sparse data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		else if( read_count != 1 )
+		{
+			result = 0;
+		}
+		else if( memory_set(
+		          &( buffer[ 1 ] ),
+		          buffer[ 0 ],
+		          buffer_size - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set sparse data in buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* If there is no file entry data an empty file is written
+	 */
+	while( ( result == 1 )
+	    && ( data_size > 0 ) )
+	{
+		if( export_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( data_size >= (size64_t) buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		else
+		{
+			read_size = (size_t) data_size;
+		}
+		if( job->is_sparse == 0 )
+		{
+			read_count = libewf_handle_read_buffer_at_offset_concurrent(
+			              input_handle,
+			              buffer,
+			              read_size,
+			              data_offset,
+			              error );
+
+			if( read_count == (ssize_t) -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_offset,
+				 data_offset );
+
+				goto on_error;
+			}
+			else if( read_count != (ssize_t) read_size )
+			{
+				result = 0;
+
+				break;
+			}
+			data_offset += read_size;
+		}
+		data_size -= read_size;
+
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               buffer,
+		               read_size,
+		               error );
+
+		if( write_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file entry data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a batch of consecutive file entry jobs
+ * Callback function for the file entry jobs thread pool
+ * Every batch is read through an input handle clone that is not in use,
+ * the batches are taken from the thread pool queue by whichever thread is
+ * idle, so the threads that export smaller files take on more batches
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_file_entry_job_batch_callback(
+     export_file_entry_job_t **first_job,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error      = NULL;
+	libewf_handle_t *input_handle = NULL;
+	uint8_t *buffer               = NULL;
+	static char *function         = "export_handle_export_file_entry_job_batch_callback";
+	size_t buffer_size            = 0;
+	int first_job_index           = 0;
+	int job_index                 = 0;
+	int last_job_index            = 0;
+	int result                    = 1;
+
+	if( first_job == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first job.",
+		 function );
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &file,
-	     error ) != 1 )
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	first_job_index = (int) ( first_job - export_handle->file_entry_jobs );
+
+	if( first_job_index > ( export_handle->number_of_file_entry_jobs - EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH ) )
+	{
+		last_job_index = export_handle->number_of_file_entry_jobs;
+	}
+	else
+	{
+		last_job_index = first_job_index + EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH;
+	}
+	if( export_handle->process_buffer_size == 0 )
+	{
+		buffer_size = export_handle->input_chunk_size;
+	}
+	else
+	{
+		buffer_size = export_handle->process_buffer_size;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_pop(
+	     export_handle->input_handle_clones_queue,
+	     (intptr_t **) &input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file.",
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to pop input handle clone from queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = first_job_index;
+	     job_index < last_job_index;
+	     job_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		export_handle->file_entry_jobs[ job_index ]->result = export_handle_export_file_entry_job(
+		                                                       export_handle,
+		                                                       input_handle,
+		                                                       export_handle->file_entry_jobs[ job_index ],
+		                                                       buffer,
+		                                                       buffer_size,
+		                                                       &error );
+
+		if( export_handle->file_entry_jobs[ job_index ]->result == -1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_queue_push(
+	     export_handle->input_handle_clones_queue,
+	     (intptr_t *) input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push input handle clone onto queue.",
 		 function );
 
 		goto on_error;
 	}
+	memory_free(
+	 buffer );
+
 	return( result );
 
 on_error:
-	if( file_entry_data != NULL )
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
 	{
 		memory_free(
-		 file_entry_data );
+		 buffer );
 	}
-	if( file != NULL )
+	if( export_handle != NULL )
 	{
-		libcfile_file_free(
-		 &file,
-		 NULL );
+		if( export_handle->abort == 0 )
+		{
+			export_handle_signal_abort(
+			 export_handle,
+			 NULL );
+		}
 	}
 	return( -1 );
 }
 
-/* Exports a (single) file entry sub file entries
- * Returns 1 if successful, 0 if not or -1 on error
+/* Exports the data of the file entry jobs
+ * The jobs are ordered by the media offset of their data and are handed out
+ * in batches of consecutive jobs to the threads, where every thread reads
+ * through its own input handle clone
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_file_entry_sub_file_entries(
+int export_handle_export_file_entry_jobs(
      export_handle_t *export_handle,
-     libewf_file_entry_t *file_entry,
-     const system_character_t *export_path,
-     size_t export_path_size,
-     size_t file_entry_path_index,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libewf_file_entry_t *sub_file_entry = NULL;
-	static char *function               = "export_handle_export_file_entry_sub_file_entries";
-	int number_of_sub_file_entries      = 0;
-	int result                          = 0;
-	int return_value                    = 1;
-	int sub_file_entry_index            = 0;
+	libcthreads_thread_pool_t *file_entry_jobs_thread_pool = NULL;
+	static char *function                                  = "export_handle_export_file_entry_jobs";
+	int job_index                                          = 0;
+	int number_of_batches                                  = 0;
+	int number_of_threads                                  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -6797,92 +8245,175 @@ int export_handle_export_file_entry_sub_file_entries(
 
 		return( -1 );
 	}
-	if( libewf_file_entry_get_number_of_sub_file_entries(
-	     file_entry,
-	     &number_of_sub_file_entries,
+	if( export_handle->input_chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing input chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export handle - process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_file_entry_jobs == 0 )
+	{
+		return( 1 );
+	}
+	number_of_batches = 1 + ( ( export_handle->number_of_file_entry_jobs - 1 ) / EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH );
+	number_of_threads = export_handle->number_of_threads;
+
+	if( number_of_threads > number_of_batches )
+	{
+		number_of_threads = number_of_batches;
+	}
+	if( export_handle_create_input_handle_clones(
+	     export_handle,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input handle clones.",
 		 function );
 
 		goto on_error;
 	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
+	if( libcthreads_thread_pool_create(
+	     &file_entry_jobs_thread_pool,
+	     NULL,
+	     number_of_threads,
+	     number_of_batches,
+	     (int (*)(intptr_t *, void *)) &export_handle_export_file_entry_job_batch_callback,
+	     (void *) export_handle,
+	     error ) != 1 )
 	{
-		if( libewf_file_entry_get_sub_file_entry(
-		     file_entry,
-		     sub_file_entry_index,
-		     &sub_file_entry,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file entry jobs thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < export_handle->number_of_file_entry_jobs;
+	     job_index += EXPORT_HANDLE_FILE_ENTRY_JOBS_PER_BATCH )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libcthreads_thread_pool_push(
+		     file_entry_jobs_thread_pool,
+		     (intptr_t *) &( export_handle->file_entry_jobs[ job_index ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to free retrieve sub file entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file entry job: %d onto queue.",
 			 function,
-			 sub_file_entry_index );
+			 job_index );
 
 			goto on_error;
 		}
-		result = export_handle_export_file_entry(
-		          export_handle,
-		          sub_file_entry,
-		          export_path,
-		          export_path_size,
-		          file_entry_path_index,
-		          log_handle,
-		          error );
+	}
+	if( libcthreads_thread_pool_join(
+	     &file_entry_jobs_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join file entry jobs thread pool.",
+		 function );
 
-		if( result == -1 )
+		goto on_error;
+	}
+	if( export_handle_free_input_handle_clones(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	for( job_index = 0;
+	     job_index < export_handle->number_of_file_entry_jobs;
+	     job_index++ )
+	{
+		if( export_handle->file_entry_jobs[ job_index ]->result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export sub file entry: %d.",
+			 "%s: unable to export file entry data: %" PRIs_SYSTEM ".",
 			 function,
-			 sub_file_entry_index );
+			 export_handle->file_entry_jobs[ job_index ]->target_path );
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			return_value = 0;
+			return( -1 );
 		}
-		if( libewf_file_entry_free(
-		     &sub_file_entry,
-		     error ) != 1 )
+		else if( export_handle->file_entry_jobs[ job_index ]->result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			fprintf(
+			 export_handle->notify_stream,
+			 "Single file: %" PRIs_SYSTEM " FAILED\n",
+			 export_handle->file_entry_jobs[ job_index ]->target_path );
 
-			goto on_error;
+			if( log_handle != NULL )
+			{
+				log_handle_printf(
+				 log_handle,
+				 "Single file: %" PRIs_SYSTEM " FAILED\n",
+				 export_handle->file_entry_jobs[ job_index ]->target_path );
+			}
 		}
 	}
-	return( return_value );
+	return( 1 );
 
 on_error:
-	if( sub_file_entry != NULL )
+	if( file_entry_jobs_thread_pool != NULL )
 	{
-		libewf_file_entry_free(
-		 &sub_file_entry,
+		libcthreads_thread_pool_join(
+		 &file_entry_jobs_thread_pool,
 		 NULL );
 	}
+	export_handle_free_input_handle_clones(
+	 export_handle,
+	 NULL );
+
 	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Print the hash values to a stream
  * Returns 1 if successful or -1 on error
  */
@@ -32,9 +32,11 @@
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_libsmraw.h"
+#include "export_file_entry_job.h"
 #include "log_handle.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_ring.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -177,14 +179,38 @@ struct export_handle
 	 */
 	libcthreads_thread_pool_t *output_thread_pool;
 
-	/* The output list
+	/* The output ring
 	 */
-	libcdata_list_t *output_list;
+	storage_media_buffer_ring_t *output_ring;
 
 	/* The storage media buffer queue
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The file entry jobs ordered by the media offset of their data
+	 */
+	export_file_entry_job_t **file_entry_jobs;
+
+	/* The number of file entry jobs
+	 */
+	int number_of_file_entry_jobs;
+
+	/* The number of allocated file entry jobs
+	 */
+	int number_of_allocated_file_entry_jobs;
+
+	/* The input handle clones used to export the file entries concurrently
+	 */
+	libewf_handle_t **input_handle_clones;
+
+	/* The number of input handle clones
+	 */
+	int number_of_input_handle_clones;
+
+	/* The queue of input handle clones that are not in use
+	 */
+	libcthreads_queue_t *input_handle_clones_queue;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -515,6 +541,22 @@ int export_handle_export_file_entry(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_data_ordered_file_entries(
+     export_handle_t *export_handle,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_file_entry_target_path(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error );
+
 int export_handle_export_file_entry_data(
      export_handle_t *export_handle,
      libewf_file_entry_t *file_entry,
@@ -530,6 +572,47 @@ int export_handle_export_file_entry_sub_file_entries(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_create_input_handle_clones(
+     export_handle_t *export_handle,
+     int number_of_input_handle_clones,
+     libcerror_error_t **error );
+
+int export_handle_free_input_handle_clones(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_append_file_entry_job(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error );
+
+int export_handle_export_file_entry_job(
+     export_handle_t *export_handle,
+     libewf_handle_t *input_handle,
+     export_file_entry_job_t *job,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int export_handle_free_file_entry_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_file_entry_job_batch_callback(
+     export_file_entry_job_t **first_job,
+     export_handle_t *export_handle );
+
+int export_handle_export_file_entry_jobs(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_hash_values_fprint(
      export_handle_t *export_handle,
      FILE *stream,
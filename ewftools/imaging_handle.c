@@ -46,6 +46,7 @@
 #include "ewftools_system_string.h"
 #include "guid.h"
 #include "imaging_handle.h"
+#include "integrity_hash_thread_pool.h"
 #include "platform.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
@@ -1622,6 +1623,8 @@ int imaging_handle_threads_start(
 	}
 	maximum_number_of_queued_items = 1 + (int) ( IMAGING_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE / process_buffer_size );
 
+	imaging_handle->maximum_number_of_queued_items = maximum_number_of_queued_items;
+
 	if( libcthreads_thread_pool_create(
 	     &( imaging_handle->process_thread_pool ),
 	     NULL,
@@ -1658,15 +1661,16 @@ int imaging_handle_threads_start(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( imaging_handle->output_list ),
+	if( storage_media_buffer_ring_initialize(
+	     &( imaging_handle->output_ring ),
+	     maximum_number_of_queued_items,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create output list.",
+		 "%s: unable to create output ring.",
 		 function );
 
 		goto on_error;
@@ -1703,14 +1707,10 @@ on_error:
 		 &( imaging_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->output_ring != NULL )
 	{
-		imaging_handle_empty_output_list(
-		 imaging_handle,
-		 NULL );
-		libcdata_list_free(
-		 &( imaging_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( imaging_handle->output_ring ),
 		 NULL );
 	}
 	if( imaging_handle->storage_media_buffer_queue != NULL )
@@ -1775,7 +1775,29 @@ int imaging_handle_threads_stop(
 			result = -1;
 		}
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->integrity_hash_thread_pool != NULL )
+	{
+		if( imaging_handle->abort != 0 )
+		{
+			integrity_hash_thread_pool_signal_abort(
+			 imaging_handle->integrity_hash_thread_pool,
+			 NULL );
+		}
+		if( integrity_hash_thread_pool_free(
+		     &( imaging_handle->integrity_hash_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free integrity hash thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( imaging_handle->output_ring != NULL )
 	{
 		if( imaging_handle_empty_output_list(
 		     imaging_handle,
@@ -1790,16 +1812,15 @@ int imaging_handle_threads_stop(
 
 			result = -1;
 		}
-		if( libcdata_list_free(
-		     &( imaging_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( imaging_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			result = -1;
@@ -1851,6 +1872,27 @@ int imaging_handle_process_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
+	/* The storage media buffer data cannot be packed before it has been hashed
+	 */
+	if( imaging_handle->integrity_hash_thread_pool != NULL )
+	{
+		if( integrity_hash_thread_pool_wait_for_buffer(
+		     imaging_handle->integrity_hash_thread_pool,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for storage media buffer to be hashed.",
+			 function );
+
+			storage_media_buffer = NULL;
+
+			goto on_error;
+		}
+	}
 	process_count = storage_media_buffer_write_process(
 			 storage_media_buffer,
 			 &error );
@@ -1933,12 +1975,10 @@ int imaging_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      imaging_handle_t *imaging_handle )
 {
-	libcdata_list_element_t *element      = NULL;
-	libcdata_list_element_t *next_element = NULL;
-        libcerror_error_t *error              = NULL;
-        static char *function                 = "imaging_handle_output_storage_media_buffer_callback";
-	ssize_t write_count                   = 0;
-	int result                            = 0;
+        libcerror_error_t *error = NULL;
+        static char *function    = "imaging_handle_output_storage_media_buffer_callback";
+	ssize_t write_count      = 0;
+	int result               = 0;
 
 	if( imaging_handle == NULL )
 	{
@@ -1966,146 +2006,70 @@ int imaging_handle_output_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
-	if( libcdata_list_insert_value(
-	     imaging_handle->output_list,
-	     (intptr_t *) storage_media_buffer,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_compare,
-	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	if( storage_media_buffer_ring_insert_buffer(
+	     imaging_handle->output_ring,
+	     storage_media_buffer,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert storage media buffer into output list.",
+		 "%s: unable to insert storage media buffer into output ring.",
 		 function );
 
 		goto on_error;
 	}
 	storage_media_buffer = NULL;
 
-	if( libcdata_list_get_first_element(
-	     imaging_handle->output_list,
-	     &element,
-	     &error ) != 1 )
+	while( imaging_handle->abort == 0 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          imaging_handle->output_ring,
+		          &storage_media_buffer,
+		          &error );
 
-		goto on_error;
-	}
-	while( element != NULL )
-	{
-		if( imaging_handle->abort != 0 )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove next storage media buffer from output ring.",
 			 function );
 
 			storage_media_buffer = NULL;
 
 			goto on_error;
 		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer->storage_media_offset != imaging_handle->last_offset_written )
+		else if( result == 0 )
 		{
 			break;
 		}
-		write_count = imaging_handle_write_storage_media_buffer(
-			       imaging_handle,
-			       storage_media_buffer,
-			       storage_media_buffer->processed_size,
-			       &error );
-
-		if( write_count < 0 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write storage media buffer.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		imaging_handle->last_offset_written = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
-
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     imaging_handle->output_list,
-		     element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
+		/* Buffers before the last offset written were read back from the image on resume
+		 * and are only needed for the integrity hash
 		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     &error ) != 1 )
+		if( storage_media_buffer->storage_media_offset >= imaging_handle->last_offset_written )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
+			write_count = imaging_handle_write_storage_media_buffer(
+				       imaging_handle,
+				       storage_media_buffer,
+				       storage_media_buffer->processed_size,
+				       &error );
 
-			goto on_error;
-		}
-		element = next_element;
+			if( write_count < 0 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write storage media buffer.",
+				 function );
 
+				goto on_error;
+			}
+			imaging_handle->last_offset_written = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
+		}
 		if( storage_media_buffer_queue_release_buffer(
 		     imaging_handle->storage_media_buffer_queue,
 		     storage_media_buffer,
@@ -2199,10 +2163,7 @@ int imaging_handle_empty_output_list(
      imaging_handle_t *imaging_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "imaging_handle_empty_output_list";
+        static char *function = "imaging_handle_empty_output_list";
 
 	if( imaging_handle == NULL )
 	{
@@ -2215,109 +2176,20 @@ int imaging_handle_empty_output_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     imaging_handle->output_list,
-	     &element,
+	if( storage_media_buffer_ring_empty(
+	     imaging_handle->output_ring,
+	     imaging_handle->storage_media_buffer_queue,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty output ring.",
 		 function );
 
 		return( -1 );
 	}
-	while( element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer_queue_release_buffer(
-		     imaging_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
-			 function );
-
-			return( -1 );
-		}
-		storage_media_buffer = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_remove_element(
-		     imaging_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			return( -1 );
-		}
-		element = next_element;
-	}
 	return( 1 );
 }
 
@@ -4201,6 +4073,64 @@ int imaging_handle_set_maximum_segment_size(
 	return( result );
 }
 
+/* Sets the number of chunks per digest tree leaf
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int imaging_handle_set_number_of_chunks_per_digest_tree_leaf(
+     imaging_handle_t *imaging_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "imaging_handle_set_number_of_chunks_per_digest_tree_leaf";
+	size_t string_length   = 0;
+	uint64_t size_variable = 0;
+	int result             = 0;
+
+	if( imaging_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid imaging handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	result = byte_size_string_convert(
+	          string,
+	          string_length,
+	          &size_variable,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of chunks per digest tree leaf.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( size_variable > (uint64_t) UINT32_MAX )
+		{
+			result = 0;
+		}
+		else
+		{
+			imaging_handle->number_of_chunks_per_digest_tree_leaf = (uint32_t) size_variable;
+		}
+	}
+	return( result );
+}
+
 /* Sets the acquiry offset
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
@@ -5166,6 +5096,23 @@ int imaging_handle_set_output_values(
 
 		return( -1 );
 	}
+	if( imaging_handle->number_of_chunks_per_digest_tree_leaf != 0 )
+	{
+		if( libewf_handle_set_number_of_chunks_per_digest_tree_leaf(
+		     imaging_handle->output_handle,
+		     imaging_handle->number_of_chunks_per_digest_tree_leaf,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of chunks per digest tree leaf.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libewf_handle_set_sectors_per_chunk(
 	     imaging_handle->output_handle,
 	     imaging_handle->sectors_per_chunk,
@@ -5330,6 +5277,23 @@ int imaging_handle_set_output_values(
 
 			return( -1 );
 		}
+		if( imaging_handle->number_of_chunks_per_digest_tree_leaf != 0 )
+		{
+			if( libewf_handle_set_number_of_chunks_per_digest_tree_leaf(
+			     imaging_handle->secondary_output_handle,
+			     imaging_handle->number_of_chunks_per_digest_tree_leaf,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of chunks per digest tree leaf in secondary output handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libewf_handle_set_sectors_per_chunk(
 		     imaging_handle->secondary_output_handle,
 		     imaging_handle->sectors_per_chunk,
@@ -5976,6 +5940,33 @@ int imaging_handle_start(
 
 		goto on_error;
         }
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Calculate the digest hashes concurrently if more than one is needed
+	 */
+	if( ( imaging_handle->process_thread_pool != NULL )
+	 && ( ( imaging_handle->calculate_md5 + imaging_handle->calculate_sha1 + imaging_handle->calculate_sha256 ) > 1 ) )
+	{
+		if( integrity_hash_thread_pool_initialize(
+		     &( imaging_handle->integrity_hash_thread_pool ),
+		     ( imaging_handle->calculate_md5 != 0 ) ? imaging_handle->md5_context : NULL,
+		     ( imaging_handle->calculate_sha1 != 0 ) ? imaging_handle->sha1_context : NULL,
+		     ( imaging_handle->calculate_sha256 != 0 ) ? imaging_handle->sha256_context : NULL,
+		     NULL,
+		     imaging_handle->maximum_number_of_queued_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize integrity hash thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 	if( process_status_initialize(
 	     &( imaging_handle->process_status ),
 	     _SYSTEM_STRING( "Acquiry" ),
@@ -6010,6 +6001,14 @@ int imaging_handle_start(
 	return( 1 );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( imaging_handle->integrity_hash_thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &( imaging_handle->integrity_hash_thread_pool ),
+		 NULL );
+	}
+#endif
 	if( imaging_handle->sha1_context != NULL )
 	{
 		libhmac_sha1_free(
@@ -6107,8 +6106,53 @@ int imaging_handle_update(
 			return( -1 );
 		}
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The sequence number is used by the output thread to write the buffers in order
+	 */
+	if( imaging_handle->output_ring != NULL )
+	{
+		if( storage_media_buffer_ring_set_sequence_number(
+		     imaging_handle->output_ring,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set storage media buffer sequence number.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 	/* Integrity (digest) hashes are calcultated after swap
 	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( imaging_handle->integrity_hash_thread_pool != NULL )
+	{
+		/* The storage media buffer is hashed concurrently by the digest threads
+		 * and the process thread waits for the hashing to complete
+		 */
+		if( integrity_hash_thread_pool_push_buffer(
+		     imaging_handle->integrity_hash_thread_pool,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto integrity hash thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 	if( imaging_handle_update_integrity_hash(
 	     imaging_handle,
 	     data,
@@ -6763,6 +6807,18 @@ int imaging_handle_print_parameters(
 		 imaging_handle->notify_stream,
 		 "bzip2" );
 	}
+	else if( imaging_handle->compression_method == LIBEWF_COMPRESSION_METHOD_ZSTD )
+	{
+		fprintf(
+		 imaging_handle->notify_stream,
+		 "zstd" );
+	}
+	else if( imaging_handle->compression_method == LIBEWF_COMPRESSION_METHOD_LZ4 )
+	{
+		fprintf(
+		 imaging_handle->notify_stream,
+		 "lz4" );
+	}
 	fprintf(
 	 imaging_handle->notify_stream,
 	 "\n" );
@@ -31,8 +31,10 @@
 #include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
+#include "integrity_hash_thread_pool.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_ring.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -146,6 +148,10 @@ struct imaging_handle
 	 */
 	size64_t maximum_segment_size;
 
+	/* The number of chunks per digest tree leaf
+	 */
+	uint32_t number_of_chunks_per_digest_tree_leaf;
+
 	/* The acquiry offset
 	 */
 	uint64_t acquiry_offset;
@@ -224,14 +230,22 @@ struct imaging_handle
 	 */
 	libcthreads_thread_pool_t *output_thread_pool;
 
-	/* The output list
+	/* The output ring
 	 */
-	libcdata_list_t *output_list;
+	storage_media_buffer_ring_t *output_ring;
 
 	/* The storage media buffer queue
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The maximum number of queued storage media buffers
+	 */
+	int maximum_number_of_queued_items;
+
+	/* The integrity hash thread pool
+	 */
+	integrity_hash_thread_pool_t *integrity_hash_thread_pool;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf output handle
@@ -485,6 +499,11 @@ int imaging_handle_set_maximum_segment_size(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int imaging_handle_set_number_of_chunks_per_digest_tree_leaf(
+     imaging_handle_t *imaging_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int imaging_handle_set_acquiry_offset(
      imaging_handle_t *imaging_handle,
      const system_character_t *string,
@@ -2829,6 +2829,14 @@ int info_handle_media_information_fprint(
 		{
 			value_string = _SYSTEM_STRING( "bzip2" );
 		}
+		else if( compression_method == LIBEWF_COMPRESSION_METHOD_ZSTD )
+		{
+			value_string = _SYSTEM_STRING( "zstd" );
+		}
+		else if( compression_method == LIBEWF_COMPRESSION_METHOD_LZ4 )
+		{
+			value_string = _SYSTEM_STRING( "lz4" );
+		}
 		if( info_handle_section_value_string_fprint(
 		     info_handle,
 		     "compression_method",
@@ -7489,6 +7497,335 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the sub file entries of a file entry and its sub file entries
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_logical_files_read_file_entry(
+     info_handle_t *info_handle,
+     libewf_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *sub_file_entry = NULL;
+	static char *function               = "info_handle_logical_files_read_file_entry";
+	int number_of_sub_file_entries      = 0;
+	int sub_file_entry_index            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libewf_file_entry_get_sub_file_entry(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( info_handle_logical_files_read_file_entry(
+		     info_handle,
+		     sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libewf_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the memory used by the logical files
+ * The memory usage is printed before and after all file entries are read
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_logical_files_memory_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry   = NULL;
+	static char *function             = "info_handle_logical_files_memory_usage_fprint";
+	size64_t memory_usage_after_read  = 0;
+	size64_t memory_usage_before_read = 0;
+	int number_of_file_entries        = 0;
+	int result                        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_file_entries_memory_usage(
+	     info_handle->input_handle,
+	     &number_of_file_entries,
+	     &memory_usage_before_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entries memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	result = libewf_handle_get_root_file_entry(
+	          info_handle->input_handle,
+	          &file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( info_handle_logical_files_read_file_entry(
+	     info_handle,
+	     file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_file_entries_memory_usage(
+	     info_handle->input_handle,
+	     &number_of_file_entries,
+	     &memory_usage_after_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entries memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_header_fprint(
+	     info_handle,
+	     "single_files_memory_usage",
+	     "Logical files memory usage",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section header: single_files_memory_usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_value_32bit_fprint(
+	     info_handle,
+	     "number_of_file_entries",
+	     "Number of file entries",
+	     22,
+	     (uint32_t) number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section 32-bit value: number_of_file_entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_value_size_fprint(
+	     info_handle,
+	     "memory_usage_before_read",
+	     "Before reading",
+	     14,
+	     memory_usage_before_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section size value: memory_usage_before_read.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_value_64bit_fprint(
+	     info_handle,
+	     "bytes_per_file_entry_before_read",
+	     "Bytes per file entry",
+	     20,
+	     ( number_of_file_entries > 0 ) ? memory_usage_before_read / number_of_file_entries : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section 64-bit value: bytes_per_file_entry_before_read.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_value_size_fprint(
+	     info_handle,
+	     "memory_usage_after_read",
+	     "After reading",
+	     13,
+	     memory_usage_after_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section size value: memory_usage_after_read.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_value_64bit_fprint(
+	     info_handle,
+	     "bytes_per_file_entry_after_read",
+	     "Bytes per file entry",
+	     20,
+	     ( number_of_file_entries > 0 ) ? memory_usage_after_read / number_of_file_entries : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section 64-bit value: bytes_per_file_entry_after_read.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_section_footer_fprint(
+	     info_handle,
+	     "single_files_memory_usage",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print section footer: single_files_memory_usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Prints the image information
  * Returns 1 if successful or -1 on error
  */
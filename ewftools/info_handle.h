@@ -292,6 +292,15 @@ int info_handle_logical_files_hierarchy_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_logical_files_read_file_entry(
+     info_handle_t *info_handle,
+     libewf_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int info_handle_logical_files_memory_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_file_entry_fprint(
      info_handle_t *info_handle,
      libewf_file_entry_t *file_entry,
@@ -0,0 +1,893 @@
+/*
+ * Integrity hash thread pool
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libhmac.h"
+#include "integrity_hash_thread_pool.h"
+#include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates an integrity hash thread pool
+ * Every digest context that is not NULL is updated by its own thread, in the order
+ * the storage media buffers are pushed, so that the digests are calculated concurrently
+ * If a storage media buffer queue is provided hashed buffers are released onto it,
+ * otherwise the owner of a buffer must wait for the buffer to be hashed
+ * Make sure the value thread_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_initialize(
+     integrity_hash_thread_pool_t **thread_pool,
+     libhmac_md5_context_t *md5_context,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     int maximum_number_of_queued_items,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_thread_pool_initialize";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_queued_items <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of queued items value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*thread_pool = memory_allocate_structure(
+	                integrity_hash_thread_pool_t );
+
+	if( *thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *thread_pool,
+	     0,
+	     sizeof( integrity_hash_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread pool.",
+		 function );
+
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+
+		return( -1 );
+	}
+	( *thread_pool )->md5_context                = md5_context;
+	( *thread_pool )->sha1_context               = sha1_context;
+	( *thread_pool )->sha256_context             = sha256_context;
+	( *thread_pool )->storage_media_buffer_queue = storage_media_buffer_queue;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *thread_pool )->reference_count_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reference count mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *thread_pool )->reference_count_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reference count condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( md5_context != NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( ( *thread_pool )->md5_thread_pool ),
+		     NULL,
+		     1,
+		     maximum_number_of_queued_items,
+		     (int (*)(intptr_t *, void *)) &integrity_hash_thread_pool_md5_callback,
+		     (void *) *thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->number_of_thread_pools += 1;
+	}
+	if( sha1_context != NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( ( *thread_pool )->sha1_thread_pool ),
+		     NULL,
+		     1,
+		     maximum_number_of_queued_items,
+		     (int (*)(intptr_t *, void *)) &integrity_hash_thread_pool_sha1_callback,
+		     (void *) *thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->number_of_thread_pools += 1;
+	}
+	if( sha256_context != NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( ( *thread_pool )->sha256_thread_pool ),
+		     NULL,
+		     1,
+		     maximum_number_of_queued_items,
+		     (int (*)(intptr_t *, void *)) &integrity_hash_thread_pool_sha256_callback,
+		     (void *) *thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->number_of_thread_pools += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an integrity hash thread pool
+ * This function waits for all pushed storage media buffers to be hashed
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_free(
+     integrity_hash_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_thread_pool_free";
+	int result            = 1;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		if( ( *thread_pool )->md5_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *thread_pool )->md5_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join MD5 thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->sha1_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *thread_pool )->sha1_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join SHA1 thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->sha256_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *thread_pool )->sha256_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join SHA256 thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->reference_count_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *thread_pool )->reference_count_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free reference count condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->reference_count_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *thread_pool )->reference_count_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free reference count mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->update_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update integrity hash(es).",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+	}
+	return( result );
+}
+
+/* Signals the integrity hash thread pool to abort
+ * Storage media buffers that are still queued are released without being hashed
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_signal_abort(
+     integrity_hash_thread_pool_t *thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_thread_pool_signal_abort";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	thread_pool->abort = 1;
+
+	return( 1 );
+}
+
+/* Pushes a storage media buffer onto the digest thread pools
+ * The storage media buffer is released onto the storage media buffer queue
+ * after every digest thread pool has processed it
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_push_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *digest_thread_pools[ 3 ];
+
+	static char *function = "integrity_hash_thread_pool_push_buffer";
+	int number_of_pushes  = 0;
+	int pool_index        = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	digest_thread_pools[ 0 ] = thread_pool->md5_thread_pool;
+	digest_thread_pools[ 1 ] = thread_pool->sha1_thread_pool;
+	digest_thread_pools[ 2 ] = thread_pool->sha256_thread_pool;
+
+	/* The reference count is set before the first push since a digest thread
+	 * can release the storage media buffer before the last push returns
+	 */
+	storage_media_buffer->reference_count = thread_pool->number_of_thread_pools;
+
+	for( pool_index = 0;
+	     pool_index < 3;
+	     pool_index++ )
+	{
+		if( digest_thread_pools[ pool_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_pool_push(
+		     digest_thread_pools[ pool_index ],
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto digest thread pool: %d.",
+			 function,
+			 pool_index );
+
+			goto on_error;
+		}
+		number_of_pushes++;
+	}
+	return( 1 );
+
+on_error:
+	/* Drop the references of the digest thread pools the storage media buffer was not pushed onto
+	 */
+	thread_pool->update_failed = 1;
+
+	while( number_of_pushes < thread_pool->number_of_thread_pools )
+	{
+		integrity_hash_thread_pool_release_buffer(
+		 thread_pool,
+		 storage_media_buffer,
+		 NULL );
+
+		number_of_pushes++;
+	}
+	return( -1 );
+}
+
+/* Releases a reference to a storage media buffer
+ * The last reference releases the storage media buffer onto the storage media buffer queue
+ * or wakes up the owner waiting for the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_release_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_thread_pool_release_buffer";
+	int reference_count   = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->reference_count_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reference count mutex.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->reference_count -= 1;
+
+	reference_count = storage_media_buffer->reference_count;
+
+	if( ( reference_count == 0 )
+	 && ( thread_pool->storage_media_buffer_queue == NULL ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     thread_pool->reference_count_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast reference count condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 thread_pool->reference_count_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     thread_pool->reference_count_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release reference count mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( reference_count == 0 )
+	 && ( thread_pool->storage_media_buffer_queue != NULL ) )
+	{
+		if( storage_media_buffer_queue_release_buffer(
+		     thread_pool->storage_media_buffer_queue,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release storage media buffer onto queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Waits until a storage media buffer is no longer referenced by the digest thread pools
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_wait_for_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "integrity_hash_thread_pool_wait_for_buffer";
+	int result            = 1;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->reference_count_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reference count mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( storage_media_buffer->reference_count > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     thread_pool->reference_count_condition,
+		     thread_pool->reference_count_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for reference count condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     thread_pool->reference_count_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release reference count mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Updates the MD5 digest hash with a storage media buffer
+ * Callback function for the MD5 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_md5_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "integrity_hash_thread_pool_md5_callback";
+	size_t data_size         = 0;
+	int result               = 1;
+
+	if( thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( ( thread_pool->abort == 0 )
+	 && ( thread_pool->update_failed == 0 ) )
+	{
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			result = -1;
+		}
+		else if( libhmac_md5_update(
+		          thread_pool->md5_context,
+		          data,
+		          data_size,
+		          &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 digest hash.",
+			 function );
+
+			result = -1;
+		}
+		if( result == -1 )
+		{
+			thread_pool->update_failed = 1;
+		}
+	}
+	if( integrity_hash_thread_pool_release_buffer(
+	     thread_pool,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		result = -1;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Updates the SHA1 digest hash with a storage media buffer
+ * Callback function for the SHA1 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_sha1_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "integrity_hash_thread_pool_sha1_callback";
+	size_t data_size         = 0;
+	int result               = 1;
+
+	if( thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( ( thread_pool->abort == 0 )
+	 && ( thread_pool->update_failed == 0 ) )
+	{
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			result = -1;
+		}
+		else if( libhmac_sha1_update(
+		          thread_pool->sha1_context,
+		          data,
+		          data_size,
+		          &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			result = -1;
+		}
+		if( result == -1 )
+		{
+			thread_pool->update_failed = 1;
+		}
+	}
+	if( integrity_hash_thread_pool_release_buffer(
+	     thread_pool,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		result = -1;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Updates the SHA256 digest hash with a storage media buffer
+ * Callback function for the SHA256 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int integrity_hash_thread_pool_sha256_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "integrity_hash_thread_pool_sha256_callback";
+	size_t data_size         = 0;
+	int result               = 1;
+
+	if( thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( ( thread_pool->abort == 0 )
+	 && ( thread_pool->update_failed == 0 ) )
+	{
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			result = -1;
+		}
+		else if( libhmac_sha256_update(
+		          thread_pool->sha256_context,
+		          data,
+		          data_size,
+		          &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			result = -1;
+		}
+		if( result == -1 )
+		{
+			thread_pool->update_failed = 1;
+		}
+	}
+	if( integrity_hash_thread_pool_release_buffer(
+	     thread_pool,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		result = -1;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,144 @@
+/*
+ * Integrity hash thread pool
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INTEGRITY_HASH_THREAD_POOL_H )
+#define _INTEGRITY_HASH_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libhmac.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct integrity_hash_thread_pool integrity_hash_thread_pool_t;
+
+struct integrity_hash_thread_pool
+{
+	/* The MD5 digest context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The MD5 thread pool
+	 */
+	libcthreads_thread_pool_t *md5_thread_pool;
+
+	/* The SHA1 digest context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA1 thread pool
+	 */
+	libcthreads_thread_pool_t *sha1_thread_pool;
+
+	/* The SHA256 digest context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The SHA256 thread pool
+	 */
+	libcthreads_thread_pool_t *sha256_thread_pool;
+
+	/* The number of digest thread pools
+	 */
+	int number_of_thread_pools;
+
+	/* The storage media buffer queue the hashed buffers are released onto
+	 * If NULL the hashed buffers are kept by their owner
+	 */
+	libcthreads_queue_t *storage_media_buffer_queue;
+
+	/* The mutex that protects the storage media buffer reference counts
+	 */
+	libcthreads_mutex_t *reference_count_mutex;
+
+	/* The condition that is signalled when a storage media buffer is no longer referenced
+	 */
+	libcthreads_condition_t *reference_count_condition;
+
+	/* Value to indicate updating a digest hash failed
+	 */
+	int update_failed;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int integrity_hash_thread_pool_initialize(
+     integrity_hash_thread_pool_t **thread_pool,
+     libhmac_md5_context_t *md5_context,
+     libhmac_sha1_context_t *sha1_context,
+     libhmac_sha256_context_t *sha256_context,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     int maximum_number_of_queued_items,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_free(
+     integrity_hash_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_signal_abort(
+     integrity_hash_thread_pool_t *thread_pool,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_push_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_release_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_wait_for_buffer(
+     integrity_hash_thread_pool_t *thread_pool,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int integrity_hash_thread_pool_md5_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool );
+
+int integrity_hash_thread_pool_sha1_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool );
+
+int integrity_hash_thread_pool_sha256_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     integrity_hash_thread_pool_t *thread_pool );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INTEGRITY_HASH_THREAD_POOL_H ) */
+
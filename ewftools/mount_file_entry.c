@@ -1138,7 +1138,7 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 	}
 	else
 	{
-		read_count = libewf_handle_read_buffer_at_offset(
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
 		              file_entry->ewf_handle,
 		              buffer,
 		              buffer_size,
@@ -50,6 +50,10 @@ struct storage_media_buffer
 	 */
 	off64_t storage_media_offset;
 
+	/* The sequence number, used to restore the order of the buffers after processing
+	 */
+	uint64_t sequence_number;
+
 	/* The raw buffer
 	 */
 	uint8_t *raw_buffer;
@@ -77,6 +81,10 @@ struct storage_media_buffer
 	/* Value to indicate the data is corrupted
 	 */
 	uint8_t is_corrupted;
+
+	/* The number of consumers that still reference the buffer
+	 */
+	int reference_count;
 };
 
 int storage_media_buffer_initialize(
@@ -0,0 +1,408 @@
+/*
+ * Storage media buffer ring
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+#include "storage_media_buffer_ring.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a storage media buffer ring
+ * The ring restores the order of storage media buffers that were processed out of order.
+ * A buffer is stored in the slot of its sequence number modulo the number of slots, hence
+ * the number of slots must be at least the number of storage media buffers in use.
+ * The ring is not locked, buffers must only be inserted and removed by a single thread
+ * Make sure the value ring is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_ring_initialize(
+     storage_media_buffer_ring_t **ring,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_initialize";
+	size_t slots_size     = 0;
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= 0 )
+	 || ( (size_t) number_of_slots > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( storage_media_buffer_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*ring = memory_allocate_structure(
+	         storage_media_buffer_ring_t );
+
+	if( *ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *ring,
+	     0,
+	     sizeof( storage_media_buffer_ring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ring.",
+		 function );
+
+		memory_free(
+		 *ring );
+
+		*ring = NULL;
+
+		return( -1 );
+	}
+	slots_size = sizeof( storage_media_buffer_t * ) * number_of_slots;
+
+	( *ring )->slots = (storage_media_buffer_t **) memory_allocate(
+	                                                slots_size );
+
+	if( ( *ring )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *ring )->slots,
+	     0,
+	     slots_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	( *ring )->number_of_slots = number_of_slots;
+
+	return( 1 );
+
+on_error:
+	if( *ring != NULL )
+	{
+		if( ( *ring )->slots != NULL )
+		{
+			memory_free(
+			 ( *ring )->slots );
+		}
+		memory_free(
+		 *ring );
+
+		*ring = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a storage media buffer ring
+ * The storage media buffers in the ring are not freed, use storage_media_buffer_ring_empty for that
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_ring_free(
+     storage_media_buffer_ring_t **ring,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_free";
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ring != NULL )
+	{
+		if( ( *ring )->slots != NULL )
+		{
+			memory_free(
+			 ( *ring )->slots );
+		}
+		memory_free(
+		 *ring );
+
+		*ring = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a storage media buffer ring
+ * The storage media buffers in the ring are released onto the storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_ring_empty(
+     storage_media_buffer_ring_t *ring,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_empty";
+	int result            = 1;
+	int slot_index        = 0;
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < ring->number_of_slots;
+	     slot_index++ )
+	{
+		if( ring->slots[ slot_index ] == NULL )
+		{
+			continue;
+		}
+		if( storage_media_buffer_queue_release_buffer(
+		     storage_media_buffer_queue,
+		     ring->slots[ slot_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to release storage media buffer: %d onto queue.",
+			 function,
+			 slot_index );
+
+			result = -1;
+		}
+		ring->slots[ slot_index ] = NULL;
+	}
+	return( result );
+}
+
+/* Sets the sequence number of a storage media buffer
+ * The buffers must be numbered by a single thread, in the order they need to be removed
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_ring_set_sequence_number(
+     storage_media_buffer_ring_t *ring,
+     storage_media_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_set_sequence_number";
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer->sequence_number = ring->next_assigned_sequence_number;
+
+	ring->next_assigned_sequence_number += 1;
+
+	return( 1 );
+}
+
+/* Inserts a storage media buffer into the slot of its sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_ring_insert_buffer(
+     storage_media_buffer_ring_t *ring,
+     storage_media_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_insert_buffer";
+	int slot_index        = 0;
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->sequence_number < ring->next_sequence_number )
+	 || ( ( buffer->sequence_number - ring->next_sequence_number ) >= (uint64_t) ring->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer - sequence number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = (int) ( buffer->sequence_number % (uint64_t) ring->number_of_slots );
+
+	if( ring->slots[ slot_index ] != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ring - slot: %d value already set.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	ring->slots[ slot_index ] = buffer;
+
+	return( 1 );
+}
+
+/* Removes the storage media buffer with the next sequence number
+ * Returns 1 if successful, 0 if the buffer is not available yet or -1 on error
+ */
+int storage_media_buffer_ring_remove_next_buffer(
+     storage_media_buffer_ring_t *ring,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_ring_remove_next_buffer";
+	int slot_index        = 0;
+
+	if( ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = (int) ( ring->next_sequence_number % (uint64_t) ring->number_of_slots );
+
+	if( ring->slots[ slot_index ] == NULL )
+	{
+		return( 0 );
+	}
+	*buffer = ring->slots[ slot_index ];
+
+	ring->slots[ slot_index ] = NULL;
+
+	ring->next_sequence_number += 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -39,6 +39,7 @@
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_system_string.h"
+#include "integrity_hash_thread_pool.h"
 #include "log_handle.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
@@ -49,6 +50,7 @@
 #define VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE		32
 #define VERIFICATION_HANDLE_NOTIFY_STREAM			stdout
 #define VERIFICATION_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE	64 * 1024 * 1024
+#define VERIFICATION_HANDLE_PREFETCH_WINDOW_PER_THREAD		4
 
 /* Creates a verification handle
  * Make sure the value verification_handle is referencing, is set to NULL
@@ -346,6 +348,11 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->stored_sha256_hash_string );
 		}
+		if( ( *verification_handle )->digest_tree_leaf_results != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->digest_tree_leaf_results );
+		}
 		memory_free(
 		 *verification_handle );
 
@@ -1135,6 +1142,52 @@ on_error:
 	return( -1 );
 }
 
+/* Frees the calculated integrity hash(es)
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_free_calculated_integrity_hash(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_free_calculated_integrity_hash";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->calculated_sha256_hash_string != NULL )
+	{
+		memory_free(
+		 verification_handle->calculated_sha256_hash_string );
+
+		verification_handle->calculated_sha256_hash_string = NULL;
+	}
+	if( verification_handle->calculated_sha1_hash_string != NULL )
+	{
+		memory_free(
+		 verification_handle->calculated_sha1_hash_string );
+
+		verification_handle->calculated_sha1_hash_string = NULL;
+	}
+	if( verification_handle->calculated_md5_hash_string != NULL )
+	{
+		memory_free(
+		 verification_handle->calculated_md5_hash_string );
+
+		verification_handle->calculated_md5_hash_string = NULL;
+	}
+	verification_handle->file_entry_data_hashed = 0;
+
+	return( 1 );
+}
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 
 /* Prepares a storage media buffer for verification
@@ -1252,13 +1305,11 @@ int verification_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      verification_handle_t *verification_handle )
 {
-	libcdata_list_element_t *element      = NULL;
-	libcdata_list_element_t *next_element = NULL;
-        libcerror_error_t *error              = NULL;
-	uint8_t *data                         = NULL;
-        static char *function                 = "verification_handle_process_storage_media_buffer_callback";
-	size_t data_size                      = 0;
-	int result                            = 0;
+        libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+        static char *function    = "verification_handle_process_storage_media_buffer_callback";
+	size_t data_size         = 0;
+	int result               = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -1286,72 +1337,41 @@ int verification_handle_output_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
-	if( libcdata_list_insert_value(
-	     verification_handle->output_list,
-	     (intptr_t *) storage_media_buffer,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_compare,
-	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	if( storage_media_buffer_ring_insert_buffer(
+	     verification_handle->output_ring,
+	     storage_media_buffer,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert storage media buffer into output list.",
+		 "%s: unable to insert storage media buffer into output ring.",
 		 function );
 
 		goto on_error;
 	}
 	storage_media_buffer = NULL;
 
-	if( libcdata_list_get_first_element(
-	     verification_handle->output_list,
-	     &element,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
-
-		goto on_error;
-	}
-	while( element != NULL )
+	while( verification_handle->abort == 0 )
 	{
-		if( verification_handle->abort != 0 )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
-
-			storage_media_buffer = NULL;
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          verification_handle->output_ring,
+		          &storage_media_buffer,
+		          &error );
 
-			goto on_error;
-		}
-		if( storage_media_buffer == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove next storage media buffer from output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( storage_media_buffer->storage_media_offset != verification_handle->last_offset_hashed )
+		else if( result == 0 )
 		{
 			break;
 		}
@@ -1368,8 +1388,6 @@ int verification_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine if storage media buffer is corrupted.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		else if( result != 0 )
@@ -1389,8 +1407,6 @@ int verification_handle_output_storage_media_buffer_callback(
 				 "%s: unable to append read error.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
@@ -1407,83 +1423,53 @@ int verification_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine storage media buffer data.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
-		if( verification_handle_update_integrity_hash(
-		     verification_handle,
-		     data,
-		     storage_media_buffer->processed_size,
-		     &error ) != 1 )
+		if( verification_handle->integrity_hash_thread_pool == NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
-			 function );
-
-			storage_media_buffer = NULL;
+			if( verification_handle_update_integrity_hash(
+			     verification_handle,
+			     data,
+			     storage_media_buffer->processed_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update integrity hash(es).",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		verification_handle->last_offset_hashed = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
 
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     verification_handle->output_list,
-		     element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
+		/* The digest threads release the storage media buffer after it has been hashed
 		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     &error ) != 1 )
+		if( verification_handle->integrity_hash_thread_pool != NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
+			if( integrity_hash_thread_pool_push_buffer(
+			     verification_handle->integrity_hash_thread_pool,
+			     storage_media_buffer,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push storage media buffer onto integrity hash thread pool.",
+				 function );
 
-			goto on_error;
-		}
-		element = next_element;
+				storage_media_buffer = NULL;
 
-		if( storage_media_buffer_queue_release_buffer(
-		     verification_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     &error ) != 1 )
+				goto on_error;
+			}
+		}
+		else if( storage_media_buffer_queue_release_buffer(
+		          verification_handle->storage_media_buffer_queue,
+		          storage_media_buffer,
+		          &error ) != 1 )
 		{
 			libcerror_error_set(
 			 &error,
@@ -1562,10 +1548,7 @@ int verification_handle_empty_output_list(
      verification_handle_t *verification_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "verification_handle_empty_output_list";
+        static char *function = "verification_handle_empty_output_list";
 
 	if( verification_handle == NULL )
 	{
@@ -1578,109 +1561,20 @@ int verification_handle_empty_output_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     verification_handle->output_list,
-	     &element,
+	if( storage_media_buffer_ring_empty(
+	     verification_handle->output_ring,
+	     verification_handle->storage_media_buffer_queue,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty output ring.",
 		 function );
 
 		return( -1 );
 	}
-	while( element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer_queue_release_buffer(
-		     verification_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
-			 function );
-
-			return( -1 );
-		}
-		storage_media_buffer = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_remove_element(
-		     verification_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			return( -1 );
-		}
-		element = next_element;
-	}
 	return( 1 );
 }
 
@@ -1699,6 +1593,8 @@ int verification_handle_verify_input(
 	uint8_t *data                                = NULL;
 	static char *function                        = "verification_handle_verify_input";
 	size64_t remaining_media_size                = 0;
+	uint64_t number_of_prefetch_hits             = 0;
+	uint64_t number_of_prefetched_chunks         = 0;
 	size_t data_size                             = 0;
 	size_t process_buffer_size                   = 0;
 	size_t read_size                             = 0;
@@ -1808,6 +1704,22 @@ int verification_handle_verify_input(
 	{
 		maximum_number_of_queued_items = 1 + (int) ( VERIFICATION_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE / process_buffer_size );
 
+		/* Prefetch the chunks ahead of the sequential reads of the input handle
+		 */
+		if( libewf_handle_set_prefetch_window(
+		     verification_handle->input_handle,
+		     VERIFICATION_HANDLE_PREFETCH_WINDOW_PER_THREAD * verification_handle->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set prefetch window in input handle.",
+			 function );
+
+			goto on_error;
+		}
 		if( libcthreads_thread_pool_create(
 		     &( verification_handle->process_thread_pool ),
 		     NULL,
@@ -1844,15 +1756,16 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( verification_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( verification_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -1906,21 +1819,48 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
-	if( process_status_initialize(
-	     &( verification_handle->process_status ),
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
-		 function );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Calculate the digest hashes concurrently if more than one is needed
+	 */
+	if( ( verification_handle->number_of_threads != 0 )
+	 && ( ( verification_handle->calculate_md5 + verification_handle->calculate_sha1 + verification_handle->calculate_sha256 ) > 1 ) )
+	{
+		if( integrity_hash_thread_pool_initialize(
+		     &( verification_handle->integrity_hash_thread_pool ),
+		     ( verification_handle->calculate_md5 != 0 ) ? verification_handle->md5_context : NULL,
+		     ( verification_handle->calculate_sha1 != 0 ) ? verification_handle->sha1_context : NULL,
+		     ( verification_handle->calculate_sha256 != 0 ) ? verification_handle->sha256_context : NULL,
+		     verification_handle->storage_media_buffer_queue,
+		     maximum_number_of_queued_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize integrity hash thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
 
 		goto on_error;
 	}
@@ -2037,6 +1977,20 @@ int verification_handle_verify_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( verification_handle->number_of_threads != 0 )
 		{
+			if( storage_media_buffer_ring_set_sequence_number(
+			     verification_handle->output_ring,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set storage media buffer sequence number.",
+				 function );
+
+				goto on_error;
+			}
 			if( libcthreads_thread_pool_push(
 			     verification_handle->process_thread_pool,
 			     (intptr_t *) storage_media_buffer,
@@ -2210,7 +2164,39 @@ int verification_handle_verify_input(
 			goto on_error;
 		}
 	}
-	if( verification_handle->output_list != NULL )
+	if( verification_handle->integrity_hash_thread_pool != NULL )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			if( integrity_hash_thread_pool_signal_abort(
+			     verification_handle->integrity_hash_thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal integrity hash thread pool to abort.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( integrity_hash_thread_pool_free(
+		     &( verification_handle->integrity_hash_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free integrity hash thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->output_ring != NULL )
 	{
 		if( verification_handle_empty_output_list(
 		     verification_handle,
@@ -2225,16 +2211,15 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( verification_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( verification_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -2303,6 +2288,29 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
+	if( libcnotify_verbose != 0 )
+	{
+		if( libewf_handle_get_prefetch_statistics(
+		     verification_handle->input_handle,
+		     &number_of_prefetched_chunks,
+		     &number_of_prefetch_hits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve prefetch statistics from input handle.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: number of prefetched chunks: %" PRIu64 ", of which read from cache: %" PRIu64 ".\n",
+		 function,
+		 number_of_prefetched_chunks,
+		 number_of_prefetch_hits );
+	}
 	if( verification_handle->abort == 0 )
 	{
 		fprintf(
@@ -2498,14 +2506,22 @@ on_error:
 		 &( verification_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( verification_handle->output_list != NULL )
+	if( verification_handle->integrity_hash_thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_signal_abort(
+		 verification_handle->integrity_hash_thread_pool,
+		 NULL );
+		integrity_hash_thread_pool_free(
+		 &( verification_handle->integrity_hash_thread_pool ),
+		 NULL );
+	}
+	if( verification_handle->output_ring != NULL )
 	{
 		verification_handle_empty_output_list(
 		 verification_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( verification_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( verification_handle->output_ring ),
 		 NULL );
 	}
 	if( verification_handle->storage_media_buffer_queue != NULL )
@@ -2519,19 +2535,29 @@ on_error:
 	return( -1 );
 }
 
-/* Verifies single files
- * Returns 1 if successful, 0 if not or -1 on error
+/* Verifies a specific digest tree leaf
+ * The leaf digest is the SHA256 of the concatenated SHA256 digests of the chunks of the leaf
+ * Returns 1 if the leaf matches, 0 if not or -1 on error
  */
-int verification_handle_verify_single_files(
+int verification_handle_verify_digest_tree_leaf(
      verification_handle_t *verification_handle,
-     uint8_t print_status_information,
-     log_handle_t *log_handle,
+     libewf_handle_t *input_handle,
+     uint32_t leaf_index,
+     uint8_t *buffer,
+     size_t buffer_size,
      libcerror_error_t **error )
 {
-	libewf_file_entry_t *file_entry    = NULL;
-	static char *function              = "verification_handle_verify_single_files";
-	uint32_t number_of_checksum_errors = 0;
-	int result                         = 0;
+	uint8_t calculated_leaf_digest[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t chunk_digest[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t stored_leaf_digest[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libhmac_sha256_context_t *leaf_context = NULL;
+	static char *function                  = "verification_handle_verify_digest_tree_leaf";
+	size64_t remaining_media_size          = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	off64_t storage_media_offset           = 0;
+	uint32_t chunk_index                   = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -2544,206 +2570,1417 @@ int verification_handle_verify_single_files(
 
 		return( -1 );
 	}
-	if( libewf_handle_get_root_file_entry(
-	     verification_handle->input_handle,
-	     &file_entry,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root file entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_initialize(
-	     &( verification_handle->process_status ),
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
-	     error ) != 1 )
+	if( buffer_size < (size_t) verification_handle->chunk_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_start(
-	     verification_handle->process_status,
-	     error ) != 1 )
+	storage_media_offset = (off64_t) leaf_index * verification_handle->number_of_chunks_per_digest_tree_leaf * verification_handle->chunk_size;
+
+	if( (size64_t) storage_media_offset >= verification_handle->media_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to start process status.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = verification_handle_verify_file_entry(
-	          verification_handle,
-	          file_entry,
-	          _SYSTEM_STRING( "" ),
-	          0,
-	          log_handle,
-	          error );
+	remaining_media_size = verification_handle->media_size - (size64_t) storage_media_offset;
 
-	if( result == -1 )
+	if( libhmac_sha256_initialize(
+	     &leaf_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to verify root file entry.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf context.",
 		 function );
 
 		goto on_error;
 	}
-	if( process_status_stop(
-	     verification_handle->process_status,
-	     0,
-	     PROCESS_STATUS_COMPLETED,
-	     error ) != 1 )
+	for( chunk_index = 0;
+	     chunk_index < verification_handle->number_of_chunks_per_digest_tree_leaf;
+	     chunk_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to stop process status.",
-		 function );
+		if( remaining_media_size == 0 )
+		{
+			break;
+		}
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
+		read_size = (size_t) verification_handle->chunk_size;
 
-		goto on_error;
+		if( remaining_media_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_media_size;
+		}
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
+		              input_handle,
+		              buffer,
+		              read_size,
+		              storage_media_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 storage_media_offset );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_calculate(
+		     buffer,
+		     read_size,
+		     chunk_digest,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate chunk digest.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_update(
+		     leaf_context,
+		     chunk_digest,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update leaf context.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_offset += read_size;
+		remaining_media_size -= read_size;
 	}
-	if( process_status_free(
-	     &( verification_handle->process_status ),
+	if( libhmac_sha256_finalize(
+	     leaf_context,
+	     calculated_leaf_digest,
+	     LIBHMAC_SHA256_HASH_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free process status.",
+		 "%s: unable to finalize leaf context.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_file_entry_free(
-	     &file_entry,
+	if( libhmac_sha256_free(
+	     &leaf_context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root file entry.",
+		 "%s: unable to free leaf context.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_handle_get_number_of_checksum_errors(
+	if( libewf_handle_get_digest_tree_leaf(
 	     verification_handle->input_handle,
-	     &number_of_checksum_errors,
-	     error ) == -1 )
+	     leaf_index,
+	     stored_leaf_digest,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve the number of checksum errors.",
-		 function );
+		 "%s: unable to retrieve digest tree leaf: %" PRIu32 ".",
+		 function,
+		 leaf_index );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( result != 0 )
-	 && ( number_of_checksum_errors == 0 ) )
+	if( memory_compare(
+	     calculated_leaf_digest,
+	     stored_leaf_digest,
+	     LIBHMAC_SHA256_HASH_SIZE ) != 0 )
 	{
-		return( 1 );
+		return( 0 );
 	}
-	return( 0 );
+	return( 1 );
 
 on_error:
-	if( verification_handle->process_status != NULL )
-	{
-		process_status_stop(
-		 verification_handle->process_status,
-		 0,
-		 PROCESS_STATUS_FAILED,
-		 NULL );
-		process_status_free(
-		 &( verification_handle->process_status ),
-		 NULL );
-	}
-	if( file_entry != NULL )
+	if( leaf_context != NULL )
 	{
-		libewf_file_entry_free(
-		 &file_entry,
+		libhmac_sha256_free(
+		 &leaf_context,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Verifies a (single) file entry
- * Returns 1 if successful, 0 if not or -1 on error
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to verify a digest tree leaf
+ * The leaf index is determined from the position of the leaf result
+ * Every invocation reads through its own input handle clone
+ * Returns 1 if successful or -1 on error
  */
-int verification_handle_verify_file_entry(
-     verification_handle_t *verification_handle,
-     libewf_file_entry_t *file_entry,
-     const system_character_t *file_entry_path,
-     size_t file_entry_path_length,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
+int verification_handle_verify_digest_tree_leaf_callback(
+     uint8_t *leaf_result,
+     verification_handle_t *verification_handle )
 {
-	system_character_t *name        = NULL;
-	system_character_t *target_path = NULL;
-	uint8_t *file_entry_data        = NULL;
-	static char *function           = "verification_handle_verify_file_entry";
-	size64_t file_entry_data_size   = 0;
-	size_t name_size                = 0;
-	size_t process_buffer_size      = 0;
-	size_t read_size                = 0;
-	size_t target_path_size         = 0;
-	ssize_t read_count              = 0;
-	uint8_t file_entry_type         = 0;
-	int md5_hash_compare            = 0;
-	int result                      = 0;
-	int return_value                = 0;
-	int sha1_hash_compare           = 0;
-	int sha256_hash_compare         = 0;
+	libcerror_error_t *error      = NULL;
+	libewf_handle_t *input_handle = NULL;
+	uint8_t *buffer               = NULL;
+	static char *function         = "verification_handle_verify_digest_tree_leaf_callback";
+	uint32_t leaf_index           = 0;
+	int result                    = 0;
 
-	if( verification_handle == NULL )
+	if( leaf_result == NULL )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid verification handle.",
+		 "%s: invalid leaf result.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( verification_handle->chunk_size == 0 )
+	if( verification_handle == NULL )
 	{
 		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk size.",
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	if( verification_handle->abort != 0 )
 	{
-		libcerror_error_set(
+		return( 1 );
+	}
+	leaf_index = (uint32_t) ( leaf_result - verification_handle->digest_tree_leaf_results );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * verification_handle->chunk_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_pop(
+	     verification_handle->input_handle_clones_queue,
+	     (intptr_t **) &input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to pop input handle clone from queue.",
+		 function );
+
+		goto on_error;
+	}
+	result = verification_handle_verify_digest_tree_leaf(
+	          verification_handle,
+	          input_handle,
+	          leaf_index,
+	          buffer,
+	          (size_t) verification_handle->chunk_size,
+	          &error );
+
+	if( libcthreads_queue_push(
+	     verification_handle->input_handle_clones_queue,
+	     (intptr_t *) input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push input handle clone onto queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify digest tree leaf: %" PRIu32 ".",
+		 function,
+		 leaf_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		*leaf_result = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MISMATCH;
+	}
+	else
+	{
+		*leaf_result = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( leaf_result != NULL )
+	{
+		*leaf_result = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_FAILED;
+	}
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Creates the input handle clones
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_create_input_handle_clones(
+     verification_handle_t *verification_handle,
+     int number_of_input_handle_clones,
+     libcerror_error_t **error )
+{
+	static char *function        = "verification_handle_create_input_handle_clones";
+	size_t clones_size           = 0;
+	int input_handle_clone_index = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->input_handle_clones != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - input handle clones value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_input_handle_clones <= 0 )
+	 || ( (size_t) number_of_input_handle_clones > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_handle_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of input handle clones value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	clones_size = sizeof( libewf_handle_t * ) * number_of_input_handle_clones;
+
+	verification_handle->input_handle_clones = (libewf_handle_t **) memory_allocate(
+	                                                                 clones_size );
+
+	if( verification_handle->input_handle_clones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verification_handle->input_handle_clones,
+	     0,
+	     clones_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	verification_handle->number_of_input_handle_clones = number_of_input_handle_clones;
+
+	if( libcthreads_queue_initialize(
+	     &( verification_handle->input_handle_clones_queue ),
+	     number_of_input_handle_clones,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle clones queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( input_handle_clone_index = 0;
+	     input_handle_clone_index < number_of_input_handle_clones;
+	     input_handle_clone_index++ )
+	{
+		if( libewf_handle_clone(
+		     &( verification_handle->input_handle_clones[ input_handle_clone_index ] ),
+		     verification_handle->input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input handle clone: %d.",
+			 function,
+			 input_handle_clone_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     verification_handle->input_handle_clones_queue,
+		     (intptr_t *) verification_handle->input_handle_clones[ input_handle_clone_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push input handle clone: %d onto queue.",
+			 function,
+			 input_handle_clone_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	verification_handle_free_input_handle_clones(
+	 verification_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the input handle clones
+ * The input handle clones should not be in use when they are freed
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_free_input_handle_clones(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "verification_handle_free_input_handle_clones";
+	int input_handle_clone_index = 0;
+	int result                   = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The input handle clones are owned by the input handle clones array not by the queue
+	 */
+	if( verification_handle->input_handle_clones_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( verification_handle->input_handle_clones_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input handle clones queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( verification_handle->input_handle_clones != NULL )
+	{
+		for( input_handle_clone_index = 0;
+		     input_handle_clone_index < verification_handle->number_of_input_handle_clones;
+		     input_handle_clone_index++ )
+		{
+			if( verification_handle->input_handle_clones[ input_handle_clone_index ] == NULL )
+			{
+				continue;
+			}
+			if( libewf_handle_free(
+			     &( verification_handle->input_handle_clones[ input_handle_clone_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle clone: %d.",
+				 function,
+				 input_handle_clone_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 verification_handle->input_handle_clones );
+
+		verification_handle->input_handle_clones = NULL;
+	}
+	verification_handle->number_of_input_handle_clones = 0;
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies the input against the digest tree stored in the EWF segment files
+ * In multi-threaded mode the leaves are verified concurrently, each job reading
+ * through its own clone of the input handle
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_digest_tree(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer               = NULL;
+	static char *function         = "verification_handle_verify_digest_tree";
+	uint32_t leaf_index           = 0;
+	uint32_t number_of_mismatches = 0;
+	int result                    = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *digest_tree_thread_pool = NULL;
+	int maximum_number_of_queued_items                 = 0;
+#endif
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->digest_tree_leaf_results != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - digest tree leaf results value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &( verification_handle->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	result = libewf_handle_get_number_of_chunks_per_digest_tree_leaf(
+	          verification_handle->input_handle,
+	          &( verification_handle->number_of_chunks_per_digest_tree_leaf ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks per digest tree leaf.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libewf_handle_get_number_of_digest_tree_leaves(
+		          verification_handle->input_handle,
+		          &( verification_handle->number_of_digest_tree_leaves ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of digest tree leaves.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 0 )
+	 || ( verification_handle->number_of_digest_tree_leaves == 0 ) )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "No digest tree stored in EWF file(s).\n" );
+
+		return( 0 );
+	}
+	if( ( (size64_t) verification_handle->number_of_digest_tree_leaves * verification_handle->number_of_chunks_per_digest_tree_leaf * verification_handle->chunk_size ) < verification_handle->media_size )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "Digest tree does not cover the media data.\n" );
+
+		return( 0 );
+	}
+	verification_handle->digest_tree_leaf_results = (uint8_t *) memory_allocate(
+	                                                             sizeof( uint8_t ) * verification_handle->number_of_digest_tree_leaves );
+
+	if( verification_handle->digest_tree_leaf_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest tree leaf results.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verification_handle->digest_tree_leaf_results,
+	     VERIFICATION_HANDLE_DIGEST_TREE_LEAF_UNVERIFIED,
+	     sizeof( uint8_t ) * verification_handle->number_of_digest_tree_leaves ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest tree leaf results.",
+		 function );
+
+		goto on_error;
+	}
+	if( print_status_information != 0 )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "Verifying digest tree of %" PRIu32 " leaves of %" PRIu32 " chunks.\n",
+		 verification_handle->number_of_digest_tree_leaves,
+		 verification_handle->number_of_chunks_per_digest_tree_leaf );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		if( verification_handle_create_input_handle_clones(
+		     verification_handle,
+		     verification_handle->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input handle clones.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_queued_items = 1 + (int) ( ( 512 * 1024 * 1024 ) / verification_handle->chunk_size );
+
+		if( libcthreads_thread_pool_create(
+		     &digest_tree_thread_pool,
+		     NULL,
+		     verification_handle->number_of_threads,
+		     maximum_number_of_queued_items,
+		     (int (*)(intptr_t *, void *)) &verification_handle_verify_digest_tree_leaf_callback,
+		     (void *) verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest tree thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( leaf_index = 0;
+		     leaf_index < verification_handle->number_of_digest_tree_leaves;
+		     leaf_index++ )
+		{
+			if( verification_handle->abort != 0 )
+			{
+				break;
+			}
+			if( libcthreads_thread_pool_push(
+			     digest_tree_thread_pool,
+			     (intptr_t *) &( verification_handle->digest_tree_leaf_results[ leaf_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push digest tree leaf: %" PRIu32 " onto queue.",
+				 function,
+				 leaf_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &digest_tree_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join digest tree thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle_free_input_handle_clones(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input handle clones.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * verification_handle->chunk_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+		for( leaf_index = 0;
+		     leaf_index < verification_handle->number_of_digest_tree_leaves;
+		     leaf_index++ )
+		{
+			if( verification_handle->abort != 0 )
+			{
+				break;
+			}
+			result = verification_handle_verify_digest_tree_leaf(
+			          verification_handle,
+			          verification_handle->input_handle,
+			          leaf_index,
+			          buffer,
+			          (size_t) verification_handle->chunk_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+				libcerror_error_free(
+				 error );
+
+				verification_handle->digest_tree_leaf_results[ leaf_index ] = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_FAILED;
+			}
+			else if( result == 0 )
+			{
+				verification_handle->digest_tree_leaf_results[ leaf_index ] = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MISMATCH;
+			}
+			else
+			{
+				verification_handle->digest_tree_leaf_results[ leaf_index ] = VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH;
+			}
+		}
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		memory_free(
+		 verification_handle->digest_tree_leaf_results );
+
+		verification_handle->digest_tree_leaf_results = NULL;
+
+		return( 0 );
+	}
+	for( leaf_index = 0;
+	     leaf_index < verification_handle->number_of_digest_tree_leaves;
+	     leaf_index++ )
+	{
+		if( verification_handle->digest_tree_leaf_results[ leaf_index ] != VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH )
+		{
+			number_of_mismatches++;
+		}
+	}
+	if( verification_handle_digest_tree_mismatches_fprint(
+	     verification_handle,
+	     verification_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print digest tree mismatches.",
+		 function );
+
+		goto on_error;
+	}
+	if( log_handle != NULL )
+	{
+		if( verification_handle_digest_tree_mismatches_fprint(
+		     verification_handle,
+		     log_handle->log_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print digest tree mismatches in log handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 verification_handle->digest_tree_leaf_results );
+
+	verification_handle->digest_tree_leaf_results = NULL;
+
+	if( number_of_mismatches != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_tree_thread_pool != NULL )
+	{
+		verification_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &digest_tree_thread_pool,
+		 NULL );
+	}
+	verification_handle_free_input_handle_clones(
+	 verification_handle,
+	 NULL );
+#endif
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( verification_handle->digest_tree_leaf_results != NULL )
+	{
+		memory_free(
+		 verification_handle->digest_tree_leaf_results );
+
+		verification_handle->digest_tree_leaf_results = NULL;
+	}
+	return( -1 );
+}
+
+/* Prints the digest tree mismatches to a stream
+ * Consecutive leaves that did not match are printed as a single range of chunks
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_digest_tree_mismatches_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function         = "verification_handle_digest_tree_mismatches_fprint";
+	uint64_t first_chunk_index    = 0;
+	uint64_t last_chunk_index     = 0;
+	uint64_t number_of_chunks     = 0;
+	uint32_t first_leaf_index     = 0;
+	uint32_t leaf_index           = 0;
+	uint32_t number_of_mismatches = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->digest_tree_leaf_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing digest tree leaf results.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_index = 0;
+	     leaf_index < verification_handle->number_of_digest_tree_leaves;
+	     leaf_index++ )
+	{
+		if( verification_handle->digest_tree_leaf_results[ leaf_index ] != VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH )
+		{
+			number_of_mismatches++;
+		}
+	}
+	if( number_of_mismatches == 0 )
+	{
+		fprintf(
+		 stream,
+		 "Digest tree:\n\tall %" PRIu32 " leaves match\n\n",
+		 verification_handle->number_of_digest_tree_leaves );
+
+		return( 1 );
+	}
+	number_of_chunks = ( verification_handle->media_size + verification_handle->chunk_size - 1 ) / verification_handle->chunk_size;
+
+	fprintf(
+	 stream,
+	 "Digest tree mismatches:\n" );
+	fprintf(
+	 stream,
+	 "\ttotal number of leaves: %" PRIu32 "\n",
+	 number_of_mismatches );
+
+	leaf_index = 0;
+
+	while( leaf_index < verification_handle->number_of_digest_tree_leaves )
+	{
+		if( verification_handle->digest_tree_leaf_results[ leaf_index ] == VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH )
+		{
+			leaf_index++;
+
+			continue;
+		}
+		first_leaf_index = leaf_index;
+
+		while( ( leaf_index < verification_handle->number_of_digest_tree_leaves )
+		    && ( verification_handle->digest_tree_leaf_results[ leaf_index ] != VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH ) )
+		{
+			leaf_index++;
+		}
+		first_chunk_index = (uint64_t) first_leaf_index * verification_handle->number_of_chunks_per_digest_tree_leaf;
+		last_chunk_index  = ( (uint64_t) leaf_index * verification_handle->number_of_chunks_per_digest_tree_leaf ) - 1;
+
+		if( last_chunk_index >= number_of_chunks )
+		{
+			last_chunk_index = number_of_chunks - 1;
+		}
+		fprintf(
+		 stream,
+		 "\tat chunk(s): %" PRIu64 " - %" PRIu64 " (offset: 0x%08" PRIx64 " - 0x%08" PRIx64 ")\n",
+		 first_chunk_index,
+		 last_chunk_index,
+		 first_chunk_index * verification_handle->chunk_size,
+		 ( ( last_chunk_index + 1 ) * verification_handle->chunk_size ) - 1 );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Verifies single files
+ * The file entries are verified in the order their data is stored in the media
+ * so that the media data is read sequentially
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_single_files(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry        = NULL;
+	libewf_file_entry_t *parent_file_entry = NULL;
+	system_character_t *parent_path        = NULL;
+	static char *function                  = "verification_handle_verify_single_files";
+	size_t parent_path_size                = 0;
+	uint32_t number_of_checksum_errors     = 0;
+	int file_entry_index                   = 0;
+	int file_entry_result                  = 0;
+	int number_of_file_entries             = 0;
+	int result                             = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_data_ordered_file_entries(
+	     verification_handle->input_handle,
+	     &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     verification_handle->process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libewf_handle_get_data_ordered_file_entry_by_index(
+		     verification_handle->input_handle,
+		     file_entry_index,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		file_entry_result = libewf_file_entry_get_parent_file_entry(
+		                     file_entry,
+		                     &parent_file_entry,
+		                     error );
+
+		if( file_entry_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent of file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		else if( file_entry_result != 0 )
+		{
+			if( verification_handle_get_file_entry_path(
+			     verification_handle,
+			     parent_file_entry,
+			     &parent_path,
+			     &parent_path_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path of parent of file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+			if( libewf_file_entry_free(
+			     &parent_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free parent of file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+		}
+		if( parent_path != NULL )
+		{
+			file_entry_result = verification_handle_verify_file_entry(
+			                     verification_handle,
+			                     file_entry,
+			                     parent_path,
+			                     parent_path_size - 1,
+			                     log_handle,
+			                     error );
+		}
+		else
+		{
+			file_entry_result = verification_handle_verify_file_entry(
+			                     verification_handle,
+			                     file_entry,
+			                     _SYSTEM_STRING( "" ),
+			                     0,
+			                     log_handle,
+			                     error );
+		}
+		if( file_entry_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		else if( file_entry_result == 0 )
+		{
+			result = 0;
+		}
+		if( parent_path != NULL )
+		{
+			memory_free(
+			 parent_path );
+
+			parent_path = NULL;
+		}
+		if( libewf_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( process_status_stop(
+	     verification_handle->process_status,
+	     0,
+	     PROCESS_STATUS_COMPLETED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &( verification_handle->process_status ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &number_of_checksum_errors,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result != 0 )
+	 && ( number_of_checksum_errors == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( verification_handle->process_status != NULL )
+	{
+		process_status_stop(
+		 verification_handle->process_status,
+		 0,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &( verification_handle->process_status ),
+		 NULL );
+	}
+	if( parent_path != NULL )
+	{
+		memory_free(
+		 parent_path );
+	}
+	if( parent_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies a (single) file entry
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_file_entry(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *file_entry_path,
+     size_t file_entry_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *name            = NULL;
+	system_character_t *target_path     = NULL;
+	uint8_t *file_entry_data            = NULL;
+	static char *function               = "verification_handle_verify_file_entry";
+	size64_t file_entry_data_size       = 0;
+	size_t name_size                    = 0;
+	size_t process_buffer_size          = 0;
+	size_t read_size                    = 0;
+	size_t target_path_size             = 0;
+	ssize_t read_count                  = 0;
+	off64_t duplicate_media_data_offset = -1;
+	off64_t media_data_offset           = 0;
+	uint32_t flags                      = 0;
+	uint8_t file_entry_type             = 0;
+	uint8_t is_sparse                   = 0;
+	int md5_hash_compare                = 0;
+	int result                          = 0;
+	int return_value                    = 0;
+	int sha1_hash_compare               = 0;
+	int sha256_hash_compare             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
@@ -2912,132 +4149,219 @@ int verification_handle_verify_file_entry(
 
 			goto on_error;
 		}
-/* TODO determine digest (hash) types */
-		if( verification_handle_initialize_integrity_hash(
-		     verification_handle,
+		if( libewf_file_entry_get_media_data_offset(
+		     file_entry,
+		     &media_data_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize integrity hash(es).",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry media data offset.",
 			 function );
 
 			goto on_error;
 		}
-		result = 1;
+		if( libewf_file_entry_get_flags(
+		     file_entry,
+		     &flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry flags.",
+			 function );
 
-		if( file_entry_data_size > 0 )
+			goto on_error;
+		}
+		if( ( flags & LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA ) != 0 )
 		{
-			if( verification_handle->process_buffer_size == 0 )
+			if( libewf_file_entry_get_duplicate_media_data_offset(
+			     file_entry,
+			     &duplicate_media_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file entry duplicate media data offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( duplicate_media_data_offset >= 0 )
 			{
-				process_buffer_size = verification_handle->chunk_size;
+				media_data_offset = duplicate_media_data_offset;
 			}
 			else
 			{
-				process_buffer_size = verification_handle->process_buffer_size;
+				is_sparse = 1;
 			}
-			/* This function in not necessary for normal use
-			 * but it was added for testing
-			 */
-			if( libewf_file_entry_seek_offset(
-			     file_entry,
-			     0,
-			     SEEK_SET,
-			     error ) != 0 )
+		}
+		/* File entries that duplicate the same data are verified consecutively
+		 * the hashes of the previous file entry data can be reused for these
+		 */
+		if( ( verification_handle->file_entry_data_hashed != 0 )
+		 && ( verification_handle->hashed_file_entry_data_offset == media_data_offset )
+		 && ( verification_handle->hashed_file_entry_data_size == file_entry_data_size )
+		 && ( verification_handle->hashed_file_entry_data_is_sparse == is_sparse ) )
+		{
+			result = 1;
+		}
+		else
+		{
+			if( verification_handle_free_calculated_integrity_hash(
+			     verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free calculated integrity hash(es).",
+				 function );
+
+				goto on_error;
+			}
+			verification_handle->hashed_file_entry_data_offset    = media_data_offset;
+			verification_handle->hashed_file_entry_data_size      = file_entry_data_size;
+			verification_handle->hashed_file_entry_data_is_sparse = is_sparse;
+
+/* TODO determine digest (hash) types */
+			if( verification_handle_initialize_integrity_hash(
+			     verification_handle,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to seek the start of the file entry data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize integrity hash(es).",
 				 function );
 
-				goto on_error;
-			}
-			file_entry_data = (uint8_t *) memory_allocate(
-			                               sizeof( uint8_t ) * process_buffer_size );
+				goto on_error;
+			}
+			result = 1;
+
+			if( file_entry_data_size > 0 )
+			{
+				if( verification_handle->process_buffer_size == 0 )
+				{
+					process_buffer_size = verification_handle->chunk_size;
+				}
+				else
+				{
+					process_buffer_size = verification_handle->process_buffer_size;
+				}
+				/* This function in not necessary for normal use
+				 * but it was added for testing
+				 */
+				if( libewf_file_entry_seek_offset(
+				     file_entry,
+				     0,
+				     SEEK_SET,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to seek the start of the file entry data.",
+					 function );
+
+					goto on_error;
+				}
+				file_entry_data = (uint8_t *) memory_allocate(
+				                               sizeof( uint8_t ) * process_buffer_size );
+
+				if( file_entry_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create file entry data.",
+					 function );
+
+					goto on_error;
+				}
+				while( file_entry_data_size > 0 )
+				{
+					if( file_entry_data_size >= process_buffer_size )
+					{
+						read_size = process_buffer_size;
+					}
+					else
+					{
+						read_size = (size_t) file_entry_data_size;
+					}
+					read_count = libewf_file_entry_read_buffer(
+					              file_entry,
+					              file_entry_data,
+					              read_size,
+					              error );
+
+					if( read_count == (ssize_t) -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read file entry data.",
+						 function );
+
+						goto on_error;
+					}
+					else if( read_count != (ssize_t) read_size )
+					{
+						result = 0;
+
+						break;
+					}
+					file_entry_data_size -= read_size;
+
+					if( verification_handle_update_integrity_hash(
+					     verification_handle,
+					     file_entry_data,
+					     read_count,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to update integrity hash(es).",
+						 function );
+
+						goto on_error;
+					}
+				}
+				memory_free(
+				 file_entry_data );
 
-			if( file_entry_data == NULL )
+				file_entry_data = NULL;
+			}
+			if( verification_handle_finalize_integrity_hash(
+			     verification_handle,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create file entry data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize integrity hash(es).",
 				 function );
 
 				goto on_error;
 			}
-			while( file_entry_data_size > 0 )
+			if( result != 0 )
 			{
-				if( file_entry_data_size >= process_buffer_size )
-				{
-					read_size = process_buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) file_entry_data_size;
-				}
-				read_count = libewf_file_entry_read_buffer(
-				              file_entry,
-				              file_entry_data,
-				              read_size,
-				              error );
-
-				if( read_count == (ssize_t) -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read file entry data.",
-					 function );
-
-					goto on_error;
-				}
-				else if( read_count != (ssize_t) read_size )
-				{
-					result = 0;
-
-					break;
-				}
-				file_entry_data_size -= read_size;
-
-				if( verification_handle_update_integrity_hash(
-				     verification_handle,
-				     file_entry_data,
-				     read_count,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to update integrity hash(es).",
-					 function );
-
-					goto on_error;
-				}
+				verification_handle->file_entry_data_hashed = 1;
 			}
-			memory_free(
-			 file_entry_data );
-
-			file_entry_data = NULL;
-		}
-		if( verification_handle_finalize_integrity_hash(
-		     verification_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to finalize integrity hash(es).",
-			 function );
-
-			goto on_error;
 		}
 		if( result != 0 )
 		{
@@ -3294,6 +4618,283 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the path of a (single) file entry
+ * The path is determined from the names of the file entry and its parents
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_get_file_entry_path(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     system_character_t **file_entry_path,
+     size_t *file_entry_path_size,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *parent_file_entry = NULL;
+	system_character_t *name               = NULL;
+	system_character_t *parent_path        = NULL;
+	static char *function                  = "verification_handle_get_file_entry_path";
+	size_t name_size                       = 0;
+	size_t parent_path_size                = 0;
+	int result                             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry path size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_file_entry_get_parent_file_entry(
+	          file_entry,
+	          &parent_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( verification_handle_get_file_entry_path(
+		     verification_handle,
+		     parent_file_entry,
+		     &parent_path,
+		     &parent_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_file_entry_free(
+		     &parent_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parent file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name_size(
+		  file_entry,
+		  &name_size,
+		  error );
+#else
+	result = libewf_file_entry_get_utf8_name_size(
+		  file_entry,
+		  &name_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_size > 0 )
+	{
+		name = system_string_allocate(
+			name_size );
+
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libewf_file_entry_get_utf16_name(
+			  file_entry,
+			  (uint16_t *) name,
+			  name_size,
+			  error );
+#else
+		result = libewf_file_entry_get_utf8_name(
+			  file_entry,
+			  (uint8_t *) name,
+			  name_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the name.",
+			 function );
+
+			goto on_error;
+		}
+		if( parent_path == NULL )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libcpath_path_join_wide(
+			          file_entry_path,
+			          file_entry_path_size,
+			          _SYSTEM_STRING( "" ),
+			          0,
+			          name,
+			          name_size - 1,
+			          error );
+#else
+			result = libcpath_path_join(
+			          file_entry_path,
+			          file_entry_path_size,
+			          _SYSTEM_STRING( "" ),
+			          0,
+			          name,
+			          name_size - 1,
+			          error );
+#endif
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libcpath_path_join_wide(
+			          file_entry_path,
+			          file_entry_path_size,
+			          parent_path,
+			          parent_path_size - 1,
+			          name,
+			          name_size - 1,
+			          error );
+#else
+			result = libcpath_path_join(
+			          file_entry_path,
+			          file_entry_path_size,
+			          parent_path,
+			          parent_path_size - 1,
+			          name,
+			          name_size - 1,
+			          error );
+#endif
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry path.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 name );
+
+		name = NULL;
+
+		if( parent_path != NULL )
+		{
+			memory_free(
+			 parent_path );
+
+			parent_path = NULL;
+		}
+	}
+	else if( parent_path != NULL )
+	{
+		*file_entry_path      = parent_path;
+		*file_entry_path_size = parent_path_size;
+	}
+	else
+	{
+		*file_entry_path = system_string_allocate(
+		                    1 );
+
+		if( *file_entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entry path.",
+			 function );
+
+			goto on_error;
+		}
+		( *file_entry_path )[ 0 ] = 0;
+
+		*file_entry_path_size = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( parent_path != NULL )
+	{
+		memory_free(
+		 parent_path );
+	}
+	if( parent_file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves the integrity hash(es) from the input
  * Returns 1 if successful or -1 on error
  */
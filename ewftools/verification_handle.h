@@ -31,9 +31,11 @@
 #include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
+#include "integrity_hash_thread_pool.h"
 #include "log_handle.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_ring.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,6 +47,14 @@ enum VERIFICATION_HANDLE_INPUT_FORMATS
 	VERIFICATION_HANDLE_INPUT_FORMAT_RAW	= (int) 'r'
 };
 
+enum VERIFICATION_HANDLE_DIGEST_TREE_LEAF_RESULTS
+{
+	VERIFICATION_HANDLE_DIGEST_TREE_LEAF_UNVERIFIED	= 0,
+	VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MATCH	= 1,
+	VERIFICATION_HANDLE_DIGEST_TREE_LEAF_MISMATCH	= 2,
+	VERIFICATION_HANDLE_DIGEST_TREE_LEAF_FAILED	= 3
+};
+
 typedef struct verification_handle verification_handle_t;
 
 struct verification_handle
@@ -133,6 +143,22 @@ struct verification_handle
 	 */
 	char *stored_sha256_hash_string;
 
+	/* Value to indicate the calculated digest hash strings contain the hashes of previously read file entry data
+	 */
+	uint8_t file_entry_data_hashed;
+
+	/* The media offset of the previously hashed file entry data
+	 */
+	off64_t hashed_file_entry_data_offset;
+
+	/* The size of the previously hashed file entry data
+	 */
+	size64_t hashed_file_entry_data_size;
+
+	/* Value to indicate the previously hashed file entry data consists of a single repeated byte
+	 */
+	uint8_t hashed_file_entry_data_is_sparse;
+
 	/* Value to indicate if the data chunk functions instead of the buffered read and write functions should be used
 	 */
 	uint8_t use_data_chunk_functions;
@@ -155,14 +181,30 @@ struct verification_handle
 	 */
 	libcthreads_thread_pool_t *output_thread_pool;
 
-	/* The output list
+	/* The output ring
 	 */
-	libcdata_list_t *output_list;
+	storage_media_buffer_ring_t *output_ring;
 
 	/* The storage media buffer queue
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The integrity hash thread pool
+	 */
+	integrity_hash_thread_pool_t *integrity_hash_thread_pool;
+
+	/* The input handle clones used to verify the digest tree concurrently
+	 */
+	libewf_handle_t **input_handle_clones;
+
+	/* The number of input handle clones
+	 */
+	int number_of_input_handle_clones;
+
+	/* The queue of input handle clones that are not in use
+	 */
+	libcthreads_queue_t *input_handle_clones_queue;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -185,6 +227,18 @@ struct verification_handle
 	 */
 	off64_t last_offset_hashed;
 
+	/* The number of chunks per digest tree leaf
+	 */
+	uint32_t number_of_chunks_per_digest_tree_leaf;
+
+	/* The number of digest tree leaves
+	 */
+	uint32_t number_of_digest_tree_leaves;
+
+	/* The digest tree leaf results
+	 */
+	uint8_t *digest_tree_leaf_results;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -245,6 +299,10 @@ int verification_handle_finalize_integrity_hash(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
+int verification_handle_free_calculated_integrity_hash(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 
 int verification_handle_process_storage_media_buffer_callback(
@@ -267,6 +325,42 @@ int verification_handle_verify_input(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_verify_digest_tree_leaf(
+     verification_handle_t *verification_handle,
+     libewf_handle_t *input_handle,
+     uint32_t leaf_index,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_verify_digest_tree_leaf_callback(
+     uint8_t *leaf_result,
+     verification_handle_t *verification_handle );
+
+int verification_handle_create_input_handle_clones(
+     verification_handle_t *verification_handle,
+     int number_of_input_handle_clones,
+     libcerror_error_t **error );
+
+int verification_handle_free_input_handle_clones(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int verification_handle_verify_digest_tree(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int verification_handle_digest_tree_mismatches_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 int verification_handle_verify_single_files(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
@@ -289,6 +383,13 @@ int verification_handle_verify_sub_file_entries(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_get_file_entry_path(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     system_character_t **file_entry_path,
+     size_t *file_entry_path_size,
+     libcerror_error_t **error );
+
 int verification_handle_get_integrity_hash_from_input(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
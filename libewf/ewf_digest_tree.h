@@ -0,0 +1,83 @@
+/*
+ * EWF digest tree section
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EWF_DIGEST_TREE_H )
+#define _EWF_DIGEST_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The digest tree section header
+ * The header is followed by the leaf digests and a 4 byte checksum of the leaf digests data
+ */
+typedef struct ewf_digest_tree_header ewf_digest_tree_header_t;
+
+struct ewf_digest_tree_header
+{
+	/* The number of chunks per leaf
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_chunks_per_leaf[ 4 ];
+
+	/* The number of leaves
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaves[ 4 ];
+
+	/* The SHA256 root digest
+	 * Consists of 32 bytes
+	 */
+	uint8_t root_digest[ 32 ];
+
+	/* Padding
+	 * Consists of 20 bytes
+	 * value should be 0x00
+	 */
+	uint8_t padding[ 20 ];
+
+	/* The checksum of all (previous) header data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+/* The digest tree leaf
+ */
+typedef struct ewf_digest_tree_leaf ewf_digest_tree_leaf_t;
+
+struct ewf_digest_tree_leaf
+{
+	/* The SHA256 digest of the media data of the chunks of the leaf
+	 * Consists of 32 bytes
+	 */
+	uint8_t digest[ 32 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EWF_DIGEST_TREE_H ) */
+
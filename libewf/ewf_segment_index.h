@@ -0,0 +1,237 @@
+/*
+ * EWF segment index file
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EWF_SEGMENT_INDEX_H )
+#define _EWF_SEGMENT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The segment index file header
+ */
+typedef struct ewf_segment_index_file_header ewf_segment_index_file_header_t;
+
+struct ewf_segment_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of segments
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_segments[ 4 ];
+
+	/* Padding
+	 * Consists of 12 bytes
+	 */
+	uint8_t padding[ 12 ];
+
+	/* The checksum of all (previous) file header data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+/* The segment index entry header
+ * The entry header is followed by the section and chunk group entries and a 4 byte checksum
+ * of the entry header, section and chunk group entries data
+ */
+typedef struct ewf_segment_index_entry_header ewf_segment_index_entry_header_t;
+
+struct ewf_segment_index_entry_header
+{
+	/* The segment number
+	 * Consists of 4 bytes
+	 */
+	uint8_t segment_number[ 4 ];
+
+	/* The segment file type
+	 * Consists of 1 byte
+	 */
+	uint8_t type;
+
+	/* The major version
+	 * Consists of 1 byte
+	 */
+	uint8_t major_version;
+
+	/* The minor version
+	 * Consists of 1 byte
+	 */
+	uint8_t minor_version;
+
+	/* The segment file flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* The segment file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t segment_file_size[ 8 ];
+
+	/* The checksum of the data at the start of the segment file
+	 * Consists of 4 bytes
+	 */
+	uint8_t head_checksum[ 4 ];
+
+	/* The checksum of the data at the end of the segment file
+	 * Consists of 4 bytes
+	 */
+	uint8_t tail_checksum[ 4 ];
+
+	/* The compression method
+	 * Consists of 2 bytes
+	 */
+	uint8_t compression_method[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding[ 2 ];
+
+	/* The device information section index
+	 * Consists of 4 bytes
+	 */
+	uint8_t device_information_section_index[ 4 ];
+
+	/* The set identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t set_identifier[ 16 ];
+
+	/* The last section offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_section_offset[ 8 ];
+
+	/* The storage media size
+	 * Consists of 8 bytes
+	 */
+	uint8_t storage_media_size[ 8 ];
+
+	/* The number of chunks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_chunks[ 8 ];
+
+	/* The previous last chunk filled
+	 * Consists of 8 bytes
+	 */
+	uint8_t previous_last_chunk_filled[ 8 ];
+
+	/* The last chunk filled
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_chunk_filled[ 8 ];
+
+	/* The last chunk compared
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_chunk_compared[ 8 ];
+
+	/* The number of sections
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sections[ 4 ];
+
+	/* The number of chunk groups
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_chunk_groups[ 4 ];
+};
+
+/* The segment index section entry
+ */
+typedef struct ewf_segment_index_section_entry ewf_segment_index_section_entry_t;
+
+struct ewf_segment_index_section_entry
+{
+	/* The section descriptor offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offset[ 8 ];
+
+	/* The section descriptor size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The section flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Padding
+	 * Consists of 3 bytes
+	 */
+	uint8_t padding[ 3 ];
+};
+
+/* The segment index chunk group entry
+ */
+typedef struct ewf_segment_index_chunk_group_entry ewf_segment_index_chunk_group_entry_t;
+
+struct ewf_segment_index_chunk_group_entry
+{
+	/* The chunk group (table) offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offset[ 8 ];
+
+	/* The chunk group (table) size
+	 * Consists of 8 bytes
+	 */
+	uint8_t size[ 8 ];
+
+	/* The storage media size of the chunks in the chunk group
+	 * Consists of 8 bytes
+	 */
+	uint8_t mapped_size[ 8 ];
+
+	/* The range flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t range_flags[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EWF_SEGMENT_INDEX_H ) */
+
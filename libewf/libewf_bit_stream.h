@@ -62,7 +62,7 @@ struct libewf_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
@@ -81,6 +81,10 @@ int libewf_bit_stream_free(
      libewf_bit_stream_t **bit_stream,
      libcerror_error_t **error );
 
+int libewf_bit_stream_fill_bit_buffer(
+     libewf_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
 int libewf_bit_stream_get_value(
      libewf_bit_stream_t *bit_stream,
      uint8_t number_of_bits,
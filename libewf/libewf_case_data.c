@@ -1753,6 +1753,16 @@ int libewf_case_data_parse_utf8_string_value(
 				value_string      = (uint8_t *) "bzip2";
 				value_string_size = 6;
 			}
+			else if( value_64bit == 3 )
+			{
+				value_string      = (uint8_t *) "zstd";
+				value_string_size = 5;
+			}
+			else if( value_64bit == 4 )
+			{
+				value_string      = (uint8_t *) "lz4";
+				value_string_size = 4;
+			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			else
 			{
@@ -29,8 +29,13 @@
 
 #include "libewf_checksum.h"
 #include "libewf_libcerror.h"
+#include "libewf_simd.h"
 #include "libewf_types.h"
 
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+#include <immintrin.h>
+#endif
+
 #if defined( HAVE_ZLIB_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
 
 /* Calculates the little-endian Adler-32 of a buffer
@@ -90,3 +95,517 @@ int libewf_checksum_calculate_adler32(
 
 #endif /* defined( HAVE_ZLIB_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) ) */
 
+/* Calculates the little-endian Adler-32 of a buffer one byte at a time
+ * It uses the initial value to calculate a new Adler-32
+ * Returns the Adler-32
+ */
+uint32_t libewf_checksum_calculate_adler32_scalar(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	size_t data_offset   = 0;
+	uint32_t lower_word  = 0;
+	uint32_t upper_word  = 0;
+	uint32_t value_32bit = 0;
+	int block_index      = 0;
+
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	while( data_size >= 0x15b0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 16 = 347
+		 */
+		for( block_index = 0;
+		     block_index < 347;
+		     block_index++ )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+		}
+		/* Optimized equivalent of:
+		 * lower_word %= 0xfff1
+		 */
+		value_32bit = lower_word >> 16;
+		lower_word &= 0x0000ffffUL;
+		lower_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( lower_word > 65521 )
+		{
+			value_32bit = lower_word >> 16;
+			lower_word &= 0x0000ffffUL;
+			lower_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( lower_word >= 65521 )
+		{
+			lower_word -= 65521;
+		}
+		/* Optimized equivalent of:
+		 * upper_word %= 0xfff1
+		 */
+		value_32bit = upper_word >> 16;
+		upper_word &= 0x0000ffffUL;
+		upper_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+		data_size -= 0x15b0;
+	}
+	if( data_size > 0 )
+	{
+		while( data_size > 16 )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			data_size -= 16;
+		}
+		while( data_size > 0 )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			data_size--;
+		}
+		/* Optimized equivalent of:
+		 * lower_word %= 0xfff1
+		 */
+		value_32bit = lower_word >> 16;
+		lower_word &= 0x0000ffffUL;
+		lower_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( lower_word > 65521 )
+		{
+			value_32bit = lower_word >> 16;
+			lower_word &= 0x0000ffffUL;
+			lower_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( lower_word >= 65521 )
+		{
+			lower_word -= 65521;
+		}
+		/* Optimized equivalent of:
+		 * upper_word %= 0xfff1
+		 */
+		value_32bit = upper_word >> 16;
+		upper_word &= 0x0000ffffUL;
+		upper_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+
+/* Calculates the little-endian Adler-32 of a buffer 16 bytes at a time using SSE2
+ * It uses the initial value to calculate a new Adler-32
+ * Returns the Adler-32
+ */
+LIBEWF_SIMD_TARGET_SSE2 \
+uint32_t libewf_checksum_calculate_adler32_sse2(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	uint32_t lower_sums[ 4 ];
+	uint32_t previous_lower_sums[ 4 ];
+	uint32_t upper_sums[ 4 ];
+
+	__m128i block_data          = _mm_setzero_si128();
+	__m128i lower_sum           = _mm_setzero_si128();
+	__m128i previous_lower_sum  = _mm_setzero_si128();
+	__m128i upper_sum           = _mm_setzero_si128();
+	__m128i weights_high        = _mm_set_epi16( 9, 10, 11, 12, 13, 14, 15, 16 );
+	__m128i weights_low         = _mm_set_epi16( 1, 2, 3, 4, 5, 6, 7, 8 );
+	__m128i zero                = _mm_setzero_si128();
+	uint64_t lower_word         = 0;
+	uint64_t upper_word         = 0;
+	size_t number_of_blocks     = 0;
+	size_t block_index          = 0;
+	int sum_index               = 0;
+
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	while( data_size >= 16 )
+	{
+		/* The modulo calculation is needed per 5552 (347 x 16) bytes
+		 */
+		number_of_blocks = data_size / 16;
+
+		if( number_of_blocks > 347 )
+		{
+			number_of_blocks = 347;
+		}
+		data_size -= number_of_blocks * 16;
+
+		/* Every byte in the blocks adds the initial lower word to the upper word
+		 */
+		upper_word += lower_word * number_of_blocks * 16;
+
+		lower_sum          = _mm_setzero_si128();
+		previous_lower_sum = _mm_setzero_si128();
+		upper_sum          = _mm_setzero_si128();
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			block_data = _mm_loadu_si128(
+			              (const __m128i *) data );
+
+			/* The sum of the bytes of the preceding blocks is added to the upper word
+			 * once for each of the 16 bytes in the block
+			 */
+			previous_lower_sum = _mm_add_epi32(
+			                      previous_lower_sum,
+			                      lower_sum );
+
+			lower_sum = _mm_add_epi32(
+			             lower_sum,
+			             _mm_sad_epu8(
+			              block_data,
+			              zero ) );
+
+			/* Byte n of the block is added to the upper word 16 - n times
+			 */
+			upper_sum = _mm_add_epi32(
+			             upper_sum,
+			             _mm_madd_epi16(
+			              _mm_unpacklo_epi8(
+			               block_data,
+			               zero ),
+			              weights_high ) );
+
+			upper_sum = _mm_add_epi32(
+			             upper_sum,
+			             _mm_madd_epi16(
+			              _mm_unpackhi_epi8(
+			               block_data,
+			               zero ),
+			              weights_low ) );
+
+			data += 16;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) lower_sums,
+		 lower_sum );
+
+		_mm_storeu_si128(
+		 (__m128i *) previous_lower_sums,
+		 previous_lower_sum );
+
+		_mm_storeu_si128(
+		 (__m128i *) upper_sums,
+		 upper_sum );
+
+		for( sum_index = 0;
+		     sum_index < 4;
+		     sum_index++ )
+		{
+			lower_word += lower_sums[ sum_index ];
+			upper_word += ( (uint64_t) previous_lower_sums[ sum_index ] << 4 )
+			            + upper_sums[ sum_index ];
+		}
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	while( data_size > 0 )
+	{
+		lower_word += *data;
+		upper_word += lower_word;
+
+		data++;
+		data_size--;
+	}
+	lower_word %= 65521;
+	upper_word %= 65521;
+
+	return( (uint32_t) ( ( upper_word << 16 ) | lower_word ) );
+}
+
+/* Calculates the little-endian Adler-32 of a buffer 32 bytes at a time using AVX2
+ * It uses the initial value to calculate a new Adler-32
+ * Returns the Adler-32
+ */
+LIBEWF_SIMD_TARGET_AVX2 \
+uint32_t libewf_checksum_calculate_adler32_avx2(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	uint32_t lower_sums[ 8 ];
+	uint32_t previous_lower_sums[ 8 ];
+	uint32_t upper_sums[ 8 ];
+
+	__m256i block_data          = _mm256_setzero_si256();
+	__m256i lower_sum           = _mm256_setzero_si256();
+	__m256i ones                = _mm256_set1_epi16( 1 );
+	__m256i previous_lower_sum  = _mm256_setzero_si256();
+	__m256i upper_sum           = _mm256_setzero_si256();
+	__m256i weights             = _mm256_set_epi8( 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 );
+	__m256i zero                = _mm256_setzero_si256();
+	uint64_t lower_word         = 0;
+	uint64_t upper_word         = 0;
+	size_t number_of_blocks     = 0;
+	size_t block_index          = 0;
+	int sum_index               = 0;
+
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	while( data_size >= 32 )
+	{
+		/* The modulo calculation is needed per 5536 (173 x 32) bytes
+		 */
+		number_of_blocks = data_size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		data_size -= number_of_blocks * 32;
+
+		/* Every byte in the blocks adds the initial lower word to the upper word
+		 */
+		upper_word += lower_word * number_of_blocks * 32;
+
+		lower_sum          = _mm256_setzero_si256();
+		previous_lower_sum = _mm256_setzero_si256();
+		upper_sum          = _mm256_setzero_si256();
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			block_data = _mm256_loadu_si256(
+			              (const __m256i *) data );
+
+			/* The sum of the bytes of the preceding blocks is added to the upper word
+			 * once for each of the 32 bytes in the block
+			 */
+			previous_lower_sum = _mm256_add_epi32(
+			                      previous_lower_sum,
+			                      lower_sum );
+
+			lower_sum = _mm256_add_epi32(
+			             lower_sum,
+			             _mm256_sad_epu8(
+			              block_data,
+			              zero ) );
+
+			/* Byte n of the block is added to the upper word 32 - n times
+			 */
+			upper_sum = _mm256_add_epi32(
+			             upper_sum,
+			             _mm256_madd_epi16(
+			              _mm256_maddubs_epi16(
+			               block_data,
+			               weights ),
+			              ones ) );
+
+			data += 32;
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) lower_sums,
+		 lower_sum );
+
+		_mm256_storeu_si256(
+		 (__m256i *) previous_lower_sums,
+		 previous_lower_sum );
+
+		_mm256_storeu_si256(
+		 (__m256i *) upper_sums,
+		 upper_sum );
+
+		for( sum_index = 0;
+		     sum_index < 8;
+		     sum_index++ )
+		{
+			lower_word += lower_sums[ sum_index ];
+			upper_word += ( (uint64_t) previous_lower_sums[ sum_index ] << 5 )
+			            + upper_sums[ sum_index ];
+		}
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	while( data_size > 0 )
+	{
+		lower_word += *data;
+		upper_word += lower_word;
+
+		data++;
+		data_size--;
+	}
+	lower_word %= 65521;
+	upper_word %= 65521;
+
+	return( (uint32_t) ( ( upper_word << 16 ) | lower_word ) );
+}
+
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+/* Retrieves the fastest Adler-32 kernel supported by the CPU
+ * Returns a LIBEWF_CHECKSUM_ADLER32_KERNEL value
+ */
+int libewf_checksum_get_adler32_kernel(
+     void )
+{
+	switch( libewf_simd_get_instruction_set() )
+	{
+		case LIBEWF_SIMD_INSTRUCTION_SET_AVX2:
+			return( LIBEWF_CHECKSUM_ADLER32_KERNEL_AVX2 );
+
+		case LIBEWF_SIMD_INSTRUCTION_SET_SSE2:
+			return( LIBEWF_CHECKSUM_ADLER32_KERNEL_SSE2 );
+
+		default:
+			break;
+	}
+	return( LIBEWF_CHECKSUM_ADLER32_KERNEL_SCALAR );
+}
+
+/* Calculates the little-endian Adler-32 of a buffer using a specific kernel
+ * The kernel must be supported by the CPU, an unknown kernel falls back to the scalar kernel
+ * It uses the initial value to calculate a new Adler-32
+ * Returns the Adler-32
+ */
+uint32_t libewf_checksum_calculate_adler32_with_kernel(
+          int kernel,
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	switch( kernel )
+	{
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+		case LIBEWF_CHECKSUM_ADLER32_KERNEL_AVX2:
+			return( libewf_checksum_calculate_adler32_avx2(
+			         data,
+			         data_size,
+			         initial_value ) );
+
+		case LIBEWF_CHECKSUM_ADLER32_KERNEL_SSE2:
+			return( libewf_checksum_calculate_adler32_sse2(
+			         data,
+			         data_size,
+			         initial_value ) );
+#endif
+		default:
+			break;
+	}
+	return( libewf_checksum_calculate_adler32_scalar(
+	         data,
+	         data_size,
+	         initial_value ) );
+}
@@ -27,11 +27,21 @@
 
 #include "libewf_deflate.h"
 #include "libewf_libcerror.h"
+#include "libewf_simd.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The Adler-32 kernels
+ */
+enum LIBEWF_CHECKSUM_ADLER32_KERNELS
+{
+	LIBEWF_CHECKSUM_ADLER32_KERNEL_SCALAR	= 0,
+	LIBEWF_CHECKSUM_ADLER32_KERNEL_SSE2	= 1,
+	LIBEWF_CHECKSUM_ADLER32_KERNEL_AVX2	= 2
+};
+
 #if defined( HAVE_ZLIB_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) )
 
 int libewf_checksum_calculate_adler32(
@@ -47,6 +57,34 @@ int libewf_checksum_calculate_adler32(
 
 #endif /* defined( HAVE_ZLIB_ADLER32 ) && ( defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) ) */
 
+uint32_t libewf_checksum_calculate_adler32_scalar(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value );
+
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+
+uint32_t libewf_checksum_calculate_adler32_sse2(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value );
+
+uint32_t libewf_checksum_calculate_adler32_avx2(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value );
+
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+int libewf_checksum_get_adler32_kernel(
+     void );
+
+uint32_t libewf_checksum_calculate_adler32_with_kernel(
+          int kernel,
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value );
+
 #if defined( __cplusplus )
 }
 #endif
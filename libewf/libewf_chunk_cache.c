@@ -0,0 +1,1376 @@
+/*
+ * Chunk cache functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_cache.h"
+#include "libewf_chunk_data.h"
+#include "libewf_definitions.h"
+#include "libewf_libcerror.h"
+
+/* Creates a chunk cache
+ * The chunk cache contains unpacked chunk data and evicts the least recently used
+ * chunk data when the total size of the cached chunk data exceeds the maximum cache size
+ * Make sure the value chunk_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_initialize(
+     libewf_chunk_cache_t **chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_initialize";
+	size_t buckets_size   = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_cache = memory_allocate_structure(
+	                libewf_chunk_cache_t );
+
+	if( *chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_cache,
+	     0,
+	     sizeof( libewf_chunk_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk cache.",
+		 function );
+
+		memory_free(
+		 *chunk_cache );
+
+		*chunk_cache = NULL;
+
+		return( -1 );
+	}
+	buckets_size = sizeof( libewf_chunk_cache_entry_t * ) * LIBEWF_CHUNK_CACHE_MINIMUM_NUMBER_OF_BUCKETS;
+
+	( *chunk_cache )->buckets = (libewf_chunk_cache_entry_t **) memory_allocate(
+	                                                             buckets_size );
+
+	if( ( *chunk_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_cache )->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_cache )->number_of_buckets  = LIBEWF_CHUNK_CACHE_MINIMUM_NUMBER_OF_BUCKETS;
+	( *chunk_cache )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_cache != NULL )
+	{
+		if( ( *chunk_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *chunk_cache )->buckets );
+		}
+		memory_free(
+		 *chunk_cache );
+
+		*chunk_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk cache
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_free(
+     libewf_chunk_cache_t **chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_free";
+	int result            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_cache != NULL )
+	{
+		if( libewf_chunk_cache_empty(
+		     *chunk_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty chunk cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *chunk_cache )->buckets );
+
+		memory_free(
+		 *chunk_cache );
+
+		*chunk_cache = NULL;
+	}
+	return( result );
+}
+
+/* Clones the chunk cache
+ * The cached chunk data and statistics are not cloned
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_clone(
+     libewf_chunk_cache_t **destination_chunk_cache,
+     libewf_chunk_cache_t *source_chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_clone";
+
+	if( destination_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_chunk_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination chunk cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_chunk_cache == NULL )
+	{
+		*destination_chunk_cache = NULL;
+
+		return( 1 );
+	}
+	if( libewf_chunk_cache_initialize(
+	     destination_chunk_cache,
+	     source_chunk_cache->maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the chunk cache
+ * The chunk data of the entry is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_remove_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t **bucket_entry = NULL;
+	static char *function                     = "libewf_chunk_cache_remove_entry";
+	int bucket_index                          = 0;
+	int result                                = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( entry->chunk_index % chunk_cache->number_of_buckets );
+	bucket_entry = &( chunk_cache->buckets[ bucket_index ] );
+
+	while( *bucket_entry != NULL )
+	{
+		if( *bucket_entry == entry )
+		{
+			*bucket_entry = entry->next_bucket_entry;
+
+			break;
+		}
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		chunk_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		chunk_cache->last_entry = entry->previous_entry;
+	}
+	if( entry->number_of_references > 0 )
+	{
+		if( entry->previous_pinned_entry != NULL )
+		{
+			entry->previous_pinned_entry->next_pinned_entry = entry->next_pinned_entry;
+		}
+		else
+		{
+			chunk_cache->first_pinned_entry = entry->next_pinned_entry;
+		}
+		if( entry->next_pinned_entry != NULL )
+		{
+			entry->next_pinned_entry->previous_pinned_entry = entry->previous_pinned_entry;
+		}
+	}
+	chunk_cache->cache_size        -= entry->size;
+	chunk_cache->number_of_entries -= 1;
+
+	if( libewf_chunk_data_free(
+	     &( entry->chunk_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk: %" PRIu64 " data.",
+		 function,
+		 entry->chunk_index );
+
+		result = -1;
+	}
+	memory_free(
+	 entry );
+
+	return( result );
+}
+
+/* Adds a reference to an entry
+ * An entry with at least one reference is pinned and is not evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_pin_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_pin_entry";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->number_of_references == 0 )
+	{
+		entry->previous_pinned_entry = NULL;
+		entry->next_pinned_entry     = chunk_cache->first_pinned_entry;
+
+		if( chunk_cache->first_pinned_entry != NULL )
+		{
+			chunk_cache->first_pinned_entry->previous_pinned_entry = entry;
+		}
+		chunk_cache->first_pinned_entry = entry;
+	}
+	entry->number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Removes a reference from an entry
+ * The entry is no longer pinned when its last reference is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_unpin_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_unpin_entry";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry - number of references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry->number_of_references -= 1;
+
+	if( entry->number_of_references == 0 )
+	{
+		if( entry->previous_pinned_entry != NULL )
+		{
+			entry->previous_pinned_entry->next_pinned_entry = entry->next_pinned_entry;
+		}
+		else
+		{
+			chunk_cache->first_pinned_entry = entry->next_pinned_entry;
+		}
+		if( entry->next_pinned_entry != NULL )
+		{
+			entry->next_pinned_entry->previous_pinned_entry = entry->previous_pinned_entry;
+		}
+		entry->previous_pinned_entry = NULL;
+		entry->next_pinned_entry     = NULL;
+	}
+	return( 1 );
+}
+
+/* Evicts the least recently used entries until the cache size with the additional size
+ * does not exceed the maximum cache size
+ * Entries that are referenced (pinned) are not evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_evict_entries(
+     libewf_chunk_cache_t *chunk_cache,
+     size_t additional_size,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t *entry          = NULL;
+	libewf_chunk_cache_entry_t *previous_entry = NULL;
+	static char *function                      = "libewf_chunk_cache_evict_entries";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	entry = chunk_cache->last_entry;
+
+	while( ( entry != NULL )
+	    && ( ( chunk_cache->cache_size + additional_size ) > chunk_cache->maximum_cache_size ) )
+	{
+		previous_entry = entry->previous_entry;
+
+		if( entry->number_of_references == 0 )
+		{
+			if( libewf_chunk_cache_remove_entry(
+			     chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used entry.",
+				 function );
+
+				return( -1 );
+			}
+			chunk_cache->number_of_evictions += 1;
+		}
+		entry = previous_entry;
+	}
+	return( 1 );
+}
+
+/* Resizes the hash buckets
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_resize_buckets(
+     libewf_chunk_cache_t *chunk_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t **buckets = NULL;
+	libewf_chunk_cache_entry_t *entry    = NULL;
+	static char *function                = "libewf_chunk_cache_resize_buckets";
+	size_t buckets_size                  = 0;
+	int bucket_index                     = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_chunk_cache_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( libewf_chunk_cache_entry_t * ) * number_of_buckets;
+
+	buckets = (libewf_chunk_cache_entry_t **) memory_allocate(
+	                                           buckets_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( entry = chunk_cache->first_entry;
+	     entry != NULL;
+	     entry = entry->next_entry )
+	{
+		bucket_index = (int) ( entry->chunk_index % number_of_buckets );
+
+		entry->next_bucket_entry = buckets[ bucket_index ];
+		buckets[ bucket_index ]  = entry;
+	}
+	memory_free(
+	 chunk_cache->buckets );
+
+	chunk_cache->buckets           = buckets;
+	chunk_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Empties the chunk cache
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_empty(
+     libewf_chunk_cache_t *chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_empty";
+	int result            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( chunk_cache->last_entry != NULL )
+	{
+		if( libewf_chunk_cache_remove_entry(
+		     chunk_cache,
+		     chunk_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_get_maximum_cache_size(
+     libewf_chunk_cache_t *chunk_cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_get_maximum_cache_size";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = chunk_cache->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum cache size
+ * Cached chunk data is evicted if the cache size exceeds the new maximum cache size
+ * A maximum cache size of 0 disables caching
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_set_maximum_cache_size(
+     libewf_chunk_cache_t *chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_set_maximum_cache_size";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_cache->maximum_cache_size = maximum_cache_size;
+
+	if( libewf_chunk_cache_evict_entries(
+	     chunk_cache,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_get_statistics(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_get_statistics";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits      = chunk_cache->number_of_hits;
+	*number_of_misses    = chunk_cache->number_of_misses;
+	*number_of_evictions = chunk_cache->number_of_evictions;
+
+	return( 1 );
+}
+
+/* Retrieves the number of cache hits of prefetched chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_cache_get_number_of_prefetch_hits(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t *number_of_prefetch_hits,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_get_number_of_prefetch_hits";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_prefetch_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of prefetch hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_prefetch_hits = chunk_cache->number_of_prefetch_hits;
+
+	return( 1 );
+}
+
+/* Determines if the chunk data of a specific chunk is cached
+ * The cache statistics and the most recently used order are not changed
+ * Returns 1 if cached, 0 if not or -1 on error
+ */
+int libewf_chunk_cache_has_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t *entry = NULL;
+	static char *function             = "libewf_chunk_cache_has_chunk_data";
+	int bucket_index                  = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( chunk_index % chunk_cache->number_of_buckets );
+
+	for( entry = chunk_cache->buckets[ bucket_index ];
+	     entry != NULL;
+	     entry = entry->next_bucket_entry )
+	{
+		if( entry->chunk_index == chunk_index )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the chunk data of a specific chunk
+ * The chunk data is marked as the most recently used and remains managed by the cache
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libewf_chunk_cache_get_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t *entry = NULL;
+	static char *function             = "libewf_chunk_cache_get_chunk_data";
+	int bucket_index                  = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( chunk_index % chunk_cache->number_of_buckets );
+
+	for( entry = chunk_cache->buckets[ bucket_index ];
+	     entry != NULL;
+	     entry = entry->next_bucket_entry )
+	{
+		if( entry->chunk_index == chunk_index )
+		{
+			break;
+		}
+	}
+	if( entry == NULL )
+	{
+		chunk_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	if( entry != chunk_cache->first_entry )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+
+		if( entry->next_entry != NULL )
+		{
+			entry->next_entry->previous_entry = entry->previous_entry;
+		}
+		else
+		{
+			chunk_cache->last_entry = entry->previous_entry;
+		}
+		entry->previous_entry = NULL;
+		entry->next_entry     = chunk_cache->first_entry;
+
+		chunk_cache->first_entry->previous_entry = entry;
+		chunk_cache->first_entry                 = entry;
+	}
+	chunk_cache->number_of_hits += 1;
+
+	if( entry->is_prefetched != 0 )
+	{
+		chunk_cache->number_of_prefetch_hits += 1;
+
+		entry->is_prefetched = 0;
+	}
+	*chunk_data = entry->chunk_data;
+
+	return( 1 );
+}
+
+/* Inserts an entry for the chunk data of a specific chunk
+ * An entry with references (pinned) is inserted even if it exceeds the maximum cache size
+ * If inserted the chunk data is managed by the cache, otherwise the caller
+ * remains responsible for freeing the chunk data
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libewf_chunk_cache_insert_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     int number_of_references,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t *entry = NULL;
+	static char *function             = "libewf_chunk_cache_insert_entry";
+	size_t entry_size                 = 0;
+	int bucket_index                  = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_size = sizeof( libewf_chunk_cache_entry_t )
+	           + sizeof( libewf_chunk_data_t )
+	           + chunk_data->allocated_data_size;
+
+	if( chunk_data->compressed_data != NULL )
+	{
+		entry_size += chunk_data->compressed_data_size;
+	}
+	if( chunk_data->spare_data != NULL )
+	{
+		entry_size += chunk_data->allocated_data_size;
+	}
+	if( number_of_references < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_references == 0 )
+	 && ( (size64_t) entry_size > chunk_cache->maximum_cache_size ) )
+	{
+		return( 0 );
+	}
+	bucket_index = (int) ( chunk_index % chunk_cache->number_of_buckets );
+
+	for( entry = chunk_cache->buckets[ bucket_index ];
+	     entry != NULL;
+	     entry = entry->next_bucket_entry )
+	{
+		if( entry->chunk_index == chunk_index )
+		{
+			return( 0 );
+		}
+	}
+	if( libewf_chunk_cache_evict_entries(
+	     chunk_cache,
+	     entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_cache->number_of_entries / 2 ) >= chunk_cache->number_of_buckets )
+	{
+		if( libewf_chunk_cache_resize_buckets(
+		     chunk_cache,
+		     chunk_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_index = (int) ( chunk_index % chunk_cache->number_of_buckets );
+	}
+	entry = memory_allocate_structure(
+	         libewf_chunk_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->chunk_index           = chunk_index;
+	entry->chunk_data            = chunk_data;
+	entry->size                  = entry_size;
+	entry->is_prefetched         = 0;
+	entry->number_of_references  = 0;
+	entry->previous_entry        = NULL;
+	entry->next_entry            = chunk_cache->first_entry;
+	entry->next_bucket_entry     = chunk_cache->buckets[ bucket_index ];
+	entry->previous_pinned_entry = NULL;
+	entry->next_pinned_entry     = NULL;
+
+	if( chunk_cache->first_entry != NULL )
+	{
+		chunk_cache->first_entry->previous_entry = entry;
+	}
+	else
+	{
+		chunk_cache->last_entry = entry;
+	}
+	chunk_cache->first_entry             = entry;
+	chunk_cache->buckets[ bucket_index ] = entry;
+
+	chunk_cache->cache_size        += entry_size;
+	chunk_cache->number_of_entries += 1;
+
+	while( entry->number_of_references < number_of_references )
+	{
+		if( libewf_chunk_cache_pin_entry(
+		     chunk_cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pin entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts the chunk data of a specific chunk
+ * If inserted the chunk data is managed by the cache, otherwise the caller
+ * remains responsible for freeing the chunk data
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libewf_chunk_cache_insert_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_insert_chunk_data";
+	int result            = 0;
+
+	result = libewf_chunk_cache_insert_entry(
+	          chunk_cache,
+	          chunk_index,
+	          chunk_data,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Inserts prefetched chunk data of a specific chunk
+ * A cache hit of the chunk data is counted as a prefetch hit the first time it is retrieved
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libewf_chunk_cache_insert_prefetched_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_insert_prefetched_chunk_data";
+	int result            = 0;
+
+	result = libewf_chunk_cache_insert_chunk_data(
+	          chunk_cache,
+	          chunk_index,
+	          chunk_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The inserted entry is the most recently used entry
+		 */
+		chunk_cache->first_entry->is_prefetched = 1;
+	}
+	return( result );
+}
+
+/* Inserts pinned chunk data of a specific chunk
+ * The chunk data is inserted with a single reference, even if it exceeds the maximum cache size,
+ * and is not evicted until it is unpinned
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libewf_chunk_cache_insert_pinned_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_insert_pinned_chunk_data";
+	int result            = 0;
+
+	result = libewf_chunk_cache_insert_entry(
+	          chunk_cache,
+	          chunk_index,
+	          chunk_data,
+	          1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves and pins the chunk data of a specific chunk
+ * The chunk data is not evicted until it is unpinned
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libewf_chunk_cache_pin_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_cache_pin_chunk_data";
+	int result            = 0;
+
+	result = libewf_chunk_cache_get_chunk_data(
+	          chunk_cache,
+	          chunk_index,
+	          chunk_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The retrieved entry is the most recently used entry
+		 */
+		if( libewf_chunk_cache_pin_entry(
+		     chunk_cache,
+		     chunk_cache->first_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pin chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Unpins the chunk data that contains specific data
+ * Entries that exceed the maximum cache size are evicted once no longer referenced
+ * Returns 1 if successful, 0 if no pinned chunk data contains the data or -1 on error
+ */
+int libewf_chunk_cache_unpin_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_cache_entry_t *entry = NULL;
+	static char *function             = "libewf_chunk_cache_unpin_chunk_data";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the pinned entries are searched, their number is bound by the views in use
+	 */
+	for( entry = chunk_cache->first_pinned_entry;
+	     entry != NULL;
+	     entry = entry->next_pinned_entry )
+	{
+		if( ( data >= entry->chunk_data->data )
+		 && ( data < &( ( entry->chunk_data->data )[ entry->chunk_data->allocated_data_size ] ) ) )
+		{
+			break;
+		}
+	}
+	if( entry == NULL )
+	{
+		return( 0 );
+	}
+	if( libewf_chunk_cache_unpin_entry(
+	     chunk_cache,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unpin entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->number_of_references == 0 )
+	{
+		if( libewf_chunk_cache_evict_entries(
+		     chunk_cache,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
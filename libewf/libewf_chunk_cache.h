@@ -0,0 +1,252 @@
+/*
+ * Chunk cache functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_CACHE_H )
+#define _LIBEWF_CHUNK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_chunk_cache_entry libewf_chunk_cache_entry_t;
+
+struct libewf_chunk_cache_entry
+{
+	/* The chunk index
+	 */
+	uint64_t chunk_index;
+
+	/* The chunk data
+	 */
+	libewf_chunk_data_t *chunk_data;
+
+	/* The size of the entry
+	 */
+	size_t size;
+
+	/* Value to indicate the chunk data was prefetched and not yet retrieved
+	 */
+	uint8_t is_prefetched;
+
+	/* The number of references to the chunk data
+	 * An entry that is referenced is not evicted
+	 */
+	int number_of_references;
+
+	/* The previous (more recently used) entry
+	 */
+	libewf_chunk_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libewf_chunk_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash bucket
+	 */
+	libewf_chunk_cache_entry_t *next_bucket_entry;
+
+	/* The previous referenced (pinned) entry
+	 */
+	libewf_chunk_cache_entry_t *previous_pinned_entry;
+
+	/* The next referenced (pinned) entry
+	 */
+	libewf_chunk_cache_entry_t *next_pinned_entry;
+};
+
+typedef struct libewf_chunk_cache libewf_chunk_cache_t;
+
+struct libewf_chunk_cache
+{
+	/* The maximum cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache size
+	 */
+	size64_t cache_size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The hash buckets
+	 */
+	libewf_chunk_cache_entry_t **buckets;
+
+	/* The number of hash buckets
+	 */
+	int number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	libewf_chunk_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libewf_chunk_cache_entry_t *last_entry;
+
+	/* The first referenced (pinned) entry
+	 * Only referenced entries are linked so that unpinning does not need to scan the whole cache
+	 */
+	libewf_chunk_cache_entry_t *first_pinned_entry;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of cache evictions
+	 */
+	uint64_t number_of_evictions;
+
+	/* The number of cache hits of prefetched chunk data
+	 */
+	uint64_t number_of_prefetch_hits;
+};
+
+int libewf_chunk_cache_initialize(
+     libewf_chunk_cache_t **chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_free(
+     libewf_chunk_cache_t **chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_clone(
+     libewf_chunk_cache_t **destination_chunk_cache,
+     libewf_chunk_cache_t *source_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_remove_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_pin_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_unpin_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     libewf_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_evict_entries(
+     libewf_chunk_cache_t *chunk_cache,
+     size_t additional_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_resize_buckets(
+     libewf_chunk_cache_t *chunk_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_empty(
+     libewf_chunk_cache_t *chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_get_maximum_cache_size(
+     libewf_chunk_cache_t *chunk_cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_set_maximum_cache_size(
+     libewf_chunk_cache_t *chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_get_statistics(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_get_number_of_prefetch_hits(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t *number_of_prefetch_hits,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_has_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_get_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_insert_entry(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     int number_of_references,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_insert_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_insert_prefetched_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_insert_pinned_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_pin_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     uint64_t chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_cache_unpin_chunk_data(
+     libewf_chunk_cache_t *chunk_cache,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_CACHE_H ) */
+
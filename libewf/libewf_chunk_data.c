@@ -26,15 +26,24 @@
 
 #include "libewf_checksum.h"
 #include "libewf_chunk_data.h"
+#include "libewf_chunk_data_pool.h"
+#include "libewf_chunk_read_buffer.h"
 #include "libewf_compression.h"
+#include "libewf_compression_context.h"
 #include "libewf_definitions.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
 #include "libewf_libfdata.h"
+#include "libewf_libhmac.h"
+#include "libewf_simd.h"
 #include "libewf_types.h"
 #include "libewf_unused.h"
 
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+#include <immintrin.h>
+#endif
+
 #if !defined( LIBEWF_ATTRIBUTE_FALLTHROUGH )
 #if defined( __GNUC__ ) && __GNUC__ >= 7
 #define LIBEWF_ATTRIBUTE_FALLTHROUGH	__attribute__ ((fallthrough))
@@ -210,6 +219,24 @@ int libewf_chunk_data_free(
 	}
 	if( *chunk_data != NULL )
 	{
+		if( ( *chunk_data )->chunk_data_pool != NULL )
+		{
+			if( libewf_chunk_data_pool_release_chunk_data(
+			     ( *chunk_data )->chunk_data_pool,
+			     chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release chunk data to pool.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
 		if( ( ( *chunk_data )->flags & LIBEWF_CHUNK_DATA_ITEM_FLAG_MANAGED_DATA ) != 0 )
 		{
 			if( ( *chunk_data )->data != NULL )
@@ -223,6 +250,11 @@ int libewf_chunk_data_free(
 			memory_free(
 			 ( *chunk_data )->compressed_data );
 		}
+		if( ( *chunk_data )->spare_data != NULL )
+		{
+			memory_free(
+			 ( *chunk_data )->spare_data );
+		}
 		memory_free(
 		 *chunk_data );
 
@@ -231,6 +263,178 @@ int libewf_chunk_data_free(
 	return( 1 );
 }
 
+/* Clones the chunk data
+ * The clone always manages its own data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_clone(
+     libewf_chunk_data_t **destination_chunk_data,
+     libewf_chunk_data_t *source_chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_clone";
+
+	if( destination_chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination chunk data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_chunk_data == NULL )
+	{
+		*destination_chunk_data = NULL;
+
+		return( 1 );
+	}
+	if( ( source_chunk_data->data == NULL )
+	 || ( source_chunk_data->data_size > source_chunk_data->allocated_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source chunk data - data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*destination_chunk_data = memory_allocate_structure(
+	                           libewf_chunk_data_t );
+
+	if( *destination_chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_chunk_data,
+	     source_chunk_data,
+	     sizeof( libewf_chunk_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination chunk data.",
+		 function );
+
+		memory_free(
+		 *destination_chunk_data );
+
+		*destination_chunk_data = NULL;
+
+		return( -1 );
+	}
+	( *destination_chunk_data )->data            = NULL;
+	( *destination_chunk_data )->compressed_data = NULL;
+	( *destination_chunk_data )->spare_data      = NULL;
+	( *destination_chunk_data )->chunk_data_pool = NULL;
+	( *destination_chunk_data )->flags           = LIBEWF_CHUNK_DATA_ITEM_FLAG_MANAGED_DATA;
+
+	( *destination_chunk_data )->data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * source_chunk_data->allocated_data_size );
+
+	if( ( *destination_chunk_data )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *destination_chunk_data )->data,
+	     source_chunk_data->data,
+	     source_chunk_data->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination data.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_chunk_data->compressed_data != NULL )
+	{
+		( *destination_chunk_data )->compressed_data = (uint8_t *) memory_allocate(
+		                                                            sizeof( uint8_t ) * source_chunk_data->compressed_data_size );
+
+		if( ( *destination_chunk_data )->compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_chunk_data )->compressed_data,
+		     source_chunk_data->compressed_data,
+		     source_chunk_data->compressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination compressed data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_chunk_data != NULL )
+	{
+		if( ( *destination_chunk_data )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *destination_chunk_data )->compressed_data );
+		}
+		if( ( *destination_chunk_data )->data != NULL )
+		{
+			memory_free(
+			 ( *destination_chunk_data )->data );
+		}
+		memory_free(
+		 *destination_chunk_data );
+
+		*destination_chunk_data = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads chunk data into a buffer
  * Returns the number of bytes read or -1 on error
  */
@@ -314,6 +518,102 @@ ssize_t libewf_chunk_data_read_buffer(
 	return( (ssize_t) chunk_data->data_size );
 }
 
+/* Reads chunk data at a specific offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_chunk_data_read_buffer_at_offset(
+         libewf_chunk_data_t *chunk_data,
+         off64_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_read_buffer_at_offset";
+	size_t read_size      = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size_t) data_offset > chunk_data->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = chunk_data->data_size - (size_t) data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( read_size == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( ( chunk_data->data )[ data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
 /* Writes a buffer to the chunk data
  * Returns the number of bytes written or -1 on error
  */
@@ -409,9 +709,8 @@ int libewf_chunk_data_pack_determine_pack_flags(
      libcerror_error_t **error )
 {
 	static char *function   = "libewf_chunk_data_pack_determine_pack_flags";
-	uint64_t fill_pattern   = 0;
+	uint8_t data_class      = 0;
 	uint8_t safe_pack_flags = 0;
-	int result              = 0;
 
 	if( chunk_data == NULL )
 	{
@@ -470,57 +769,45 @@ int libewf_chunk_data_pack_determine_pack_flags(
 	}
 	safe_pack_flags = *pack_flags;
 
-	if( ( ( io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_PATTERN_FILL_COMPRESSION ) != 0 )
-	 && ( ( chunk_data->data_size % 8 ) == 0 ) )
+	if( ( ( io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_PATTERN_FILL_COMPRESSION ) == 0 )
+	 && ( ( io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) == 0 )
+	 && ( io_handle->compression_level == LIBEWF_COMPRESSION_LEVEL_NONE ) )
 	{
-		result = libewf_chunk_data_check_for_64_bit_pattern_fill(
-			  chunk_data->data,
-			  chunk_data->data_size,
-			  &fill_pattern,
-			  error );
+		*pack_flags = safe_pack_flags;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if chunk data contains a fill pattern.",
-			 function );
+		return( 1 );
+	}
+	/* Determine if the chunk data is a 64-bit pattern fill or empty-block in a single pass
+	 */
+	if( libewf_chunk_data_classify(
+	     chunk_data->data,
+	     chunk_data->data_size,
+	     &data_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to classify chunk data.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result != 0 )
+		return( -1 );
+	}
+	if( ( ( io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_PATTERN_FILL_COMPRESSION ) != 0 )
+	 && ( ( chunk_data->data_size % 8 ) == 0 ) )
+	{
+		if( ( chunk_data->data_size > 8 )
+		 && ( data_class != LIBEWF_CHUNK_DATA_CLASS_GENERAL ) )
 		{
 			safe_pack_flags &= ~( LIBEWF_PACK_FLAG_CALCULATE_CHECKSUM | LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING );
 			safe_pack_flags |= LIBEWF_PACK_FLAG_FORCE_COMPRESSION | LIBEWF_PACK_FLAG_USE_PATTERN_FILL_COMPRESSION;
 		}
 	}
-	else if( ( ( io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) != 0 )
-	      || ( io_handle->compression_level != LIBEWF_COMPRESSION_LEVEL_NONE ) )
+	else if( data_class == LIBEWF_CHUNK_DATA_CLASS_ZERO )
 	{
-		result = libewf_chunk_data_check_for_empty_block(
-			  chunk_data->data,
-			  chunk_data->data_size,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if chunk data is an empty block.",
-			 function );
-
-			return( -1 );
-		}
-		else if( ( result != 0 )
-		      && ( chunk_data->data[ 0 ] == 0 ) )
-		{
-			safe_pack_flags &= ~( LIBEWF_PACK_FLAG_CALCULATE_CHECKSUM );
-			safe_pack_flags |= LIBEWF_PACK_FLAG_FORCE_COMPRESSION | LIBEWF_PACK_FLAG_USE_EMPTY_BLOCK_COMPRESSION;
-		}
+		safe_pack_flags &= ~( LIBEWF_PACK_FLAG_CALCULATE_CHECKSUM );
+		safe_pack_flags |= LIBEWF_PACK_FLAG_FORCE_COMPRESSION | LIBEWF_PACK_FLAG_USE_EMPTY_BLOCK_COMPRESSION;
 	}
 	*pack_flags = safe_pack_flags;
 
@@ -830,11 +1117,13 @@ on_error:
 }
 
 /* Packs the chunk data using compression
+ * The compression context is optional, if NULL the compression state is set up for this chunk only
  * Returns 1 on success, 0 if buffer is too small or -1 on error
  */
 int libewf_chunk_data_pack_with_compression(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
+     libewf_compression_context_t *compression_context,
      libcerror_error_t **error )
 {
 	static char *function            = "libewf_chunk_data_pack_with_compression";
@@ -922,14 +1211,29 @@ int libewf_chunk_data_pack_with_compression(
 	{
 		compression_level = LIBEWF_COMPRESSION_LEVEL_DEFAULT;
 	}
-	result = libewf_compress_data(
-		  chunk_data->compressed_data,
-		  &safe_compressed_data_size,
-		  io_handle->compression_method,
-		  compression_level,
-		  chunk_data->data,
-		  chunk_data->data_size,
-		  error );
+	if( compression_context != NULL )
+	{
+		result = libewf_compression_context_compress_data(
+			  compression_context,
+			  chunk_data->compressed_data,
+			  &safe_compressed_data_size,
+			  io_handle->compression_method,
+			  compression_level,
+			  chunk_data->data,
+			  chunk_data->data_size,
+			  error );
+	}
+	else
+	{
+		result = libewf_compress_data(
+			  chunk_data->compressed_data,
+			  &safe_compressed_data_size,
+			  io_handle->compression_method,
+			  compression_level,
+			  chunk_data->data,
+			  chunk_data->data_size,
+			  error );
+	}
 
 	if( result == -1 )
 	{
@@ -956,9 +1260,10 @@ int libewf_chunk_data_pack_with_compression(
 
 			goto on_error;
 		}
-		if( io_handle->compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		if( ( io_handle->compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		 || ( io_handle->compression_method == LIBEWF_COMPRESSION_METHOD_LZ4 ) )
 		{
-			/* Deflate has its own checksum
+			/* Deflate and LZ4 compressed data end with an Adler-32 checksum
 			 */
 			byte_stream_copy_to_uint32_little_endian(
 			 &( ( chunk_data->compressed_data )[ safe_compressed_data_size - 4 ] ),
@@ -1002,11 +1307,13 @@ on_error:
 
 /* Packs the chunk data
  * This function either adds the checksum or compresses the chunk data
+ * The compression context is optional, if NULL the compression state is set up for this chunk only
  * Returns 1 if successful or -1 on error
  */
 int libewf_chunk_data_pack(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
+     libewf_compression_context_t *compression_context,
      const uint8_t *compressed_zero_byte_empty_block,
      size_t compressed_zero_byte_empty_block_size,
      uint8_t pack_flags,
@@ -1067,6 +1374,28 @@ int libewf_chunk_data_pack(
 
 		goto on_error;
 	}
+	/* The digest is calculated before the data is compressed
+	 */
+	if( ( pack_flags & LIBEWF_PACK_FLAG_CALCULATE_DIGEST ) != 0 )
+	{
+		if( libhmac_sha256_calculate(
+		     chunk_data->data,
+		     chunk_data->data_size,
+		     chunk_data->digest,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate digest.",
+			 function );
+
+			goto on_error;
+		}
+		chunk_data->digest_set = 1;
+	}
 	/* Make sure range flags are cleared before usage.
 	 */
 	chunk_data->range_flags = 0;
@@ -1115,6 +1444,7 @@ int libewf_chunk_data_pack(
 			result = libewf_chunk_data_pack_with_compression(
 			          chunk_data,
 			          io_handle,
+			          compression_context,
 			          error );
 
 			if( result == -1 )
@@ -1258,8 +1588,10 @@ int libewf_chunk_data_unpack(
      libewf_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function        = "libewf_chunk_data_unpack";
-	uint32_t calculated_checksum = 0;
+	libewf_compression_context_t *compression_context = NULL;
+	static char *function                             = "libewf_chunk_data_unpack";
+	uint32_t calculated_checksum                      = 0;
+	int result                                        = 0;
 
 	if( chunk_data == NULL )
 	{
@@ -1338,9 +1670,16 @@ int libewf_chunk_data_unpack(
 		}
 		chunk_data->allocated_data_size = ( chunk_data->allocated_data_size / 16 ) * 16;
 
-		chunk_data->data = (uint8_t *) memory_allocate(
-		                                sizeof( uint8_t ) * chunk_data->allocated_data_size );
-
+		if( chunk_data->spare_data != NULL )
+		{
+			chunk_data->data       = chunk_data->spare_data;
+			chunk_data->spare_data = NULL;
+		}
+		else
+		{
+			chunk_data->data = (uint8_t *) memory_allocate(
+			                                sizeof( uint8_t ) * chunk_data->allocated_data_size );
+		}
 		if( chunk_data->data == NULL )
 		{
 			libcerror_error_set(
@@ -1383,16 +1722,60 @@ int libewf_chunk_data_unpack(
 
 				goto on_error;
 			}
-		}
-		else
-		{
-			if( libewf_decompress_data(
-			     chunk_data->compressed_data,
-			     chunk_data->compressed_data_size,
-			     io_handle->compression_method,
-			     chunk_data->data,
-			     &( chunk_data->data_size ),
-			     error ) != 1 )
+		}
+		else
+		{
+			if( chunk_data->chunk_data_pool != NULL )
+			{
+				if( libewf_chunk_data_pool_get_compression_context(
+				     chunk_data->chunk_data_pool,
+				     &compression_context,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve compression context from pool.",
+					 function );
+
+					goto on_error;
+				}
+				result = libewf_compression_context_decompress_data(
+				          compression_context,
+				          chunk_data->compressed_data,
+				          chunk_data->compressed_data_size,
+				          io_handle->compression_method,
+				          chunk_data->data,
+				          &( chunk_data->data_size ),
+				          error );
+
+				if( libewf_chunk_data_pool_release_compression_context(
+				     chunk_data->chunk_data_pool,
+				     &compression_context,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release compression context to pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				result = libewf_decompress_data(
+				          chunk_data->compressed_data,
+				          chunk_data->compressed_data_size,
+				          io_handle->compression_method,
+				          chunk_data->data,
+				          &( chunk_data->data_size ),
+				          error );
+			}
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -1510,6 +1893,12 @@ int libewf_chunk_data_unpack(
 	return( 1 );
 
 on_error:
+	if( compression_context != NULL )
+	{
+		libewf_compression_context_free(
+		 &compression_context,
+		 NULL );
+	}
 	if( chunk_data->compressed_data != NULL )
 	{
 		if( chunk_data->data != NULL )
@@ -1526,15 +1915,165 @@ on_error:
 	return( -1 );
 }
 
-/* Checks if a buffer containing the chunk data is filled with same value bytes (empty-block)
- * Returns 1 if an empty block was found, 0 if not or -1 on error
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+
+/* Compares the chunk data in blocks of 128 bytes against the 64-bit pattern in its first 8 bytes using SSE2
+ * The data size must be at least 8 bytes and the data offset is advanced past the compared blocks
+ * Returns 1 if the compared blocks match the pattern or 0 if not
  */
-int libewf_chunk_data_check_for_empty_block(
+LIBEWF_SIMD_TARGET_SSE2 \
+int libewf_chunk_data_compare_64_bit_pattern_sse2(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset )
+{
+	__m128i block_differences = _mm_setzero_si128();
+	__m128i pattern_vector    = _mm_setzero_si128();
+	size_t safe_data_offset   = *data_offset;
+	int block_index           = 0;
+
+	pattern_vector = _mm_loadl_epi64(
+	                  (const __m128i *) data );
+
+	pattern_vector = _mm_unpacklo_epi64(
+	                  pattern_vector,
+	                  pattern_vector );
+
+	while( ( data_size - safe_data_offset ) >= 128 )
+	{
+		block_differences = _mm_setzero_si128();
+
+		for( block_index = 0;
+		     block_index < 128;
+		     block_index += 16 )
+		{
+			block_differences = _mm_or_si128(
+			                     block_differences,
+			                     _mm_xor_si128(
+			                      _mm_loadu_si128(
+			                       (const __m128i *) &( data[ safe_data_offset + block_index ] ) ),
+			                      pattern_vector ) );
+		}
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      block_differences,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			*data_offset = safe_data_offset;
+
+			return( 0 );
+		}
+		safe_data_offset += 128;
+	}
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Compares the chunk data in blocks of 256 bytes against the 64-bit pattern in its first 8 bytes using AVX2
+ * The data size must be at least 8 bytes and the data offset is advanced past the compared blocks
+ * Returns 1 if the compared blocks match the pattern or 0 if not
+ */
+LIBEWF_SIMD_TARGET_AVX2 \
+int libewf_chunk_data_compare_64_bit_pattern_avx2(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset )
+{
+	__m256i block_differences = _mm256_setzero_si256();
+	__m256i pattern_vector    = _mm256_setzero_si256();
+	size_t safe_data_offset   = *data_offset;
+	uint64_t pattern          = 0;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 data,
+	 pattern );
+
+	/* The pattern is stored in the byte order of the data, x86 is little-endian
+	 */
+	pattern_vector = _mm256_set1_epi64x(
+	                  (long long) pattern );
+
+	while( ( data_size - safe_data_offset ) >= 256 )
+	{
+		/* Combine the differences in a tree to shorten the dependency chain
+		 */
+		block_differences = _mm256_or_si256(
+		                     _mm256_or_si256(
+		                      _mm256_or_si256(
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset ] ) ),
+		                        pattern_vector ),
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 32 ] ) ),
+		                        pattern_vector ) ),
+		                      _mm256_or_si256(
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 64 ] ) ),
+		                        pattern_vector ),
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 96 ] ) ),
+		                        pattern_vector ) ) ),
+		                     _mm256_or_si256(
+		                      _mm256_or_si256(
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 128 ] ) ),
+		                        pattern_vector ),
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 160 ] ) ),
+		                        pattern_vector ) ),
+		                      _mm256_or_si256(
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 192 ] ) ),
+		                        pattern_vector ),
+		                       _mm256_xor_si256(
+		                        _mm256_loadu_si256(
+		                         (const __m256i *) &( data[ safe_data_offset + 224 ] ) ),
+		                        pattern_vector ) ) ) );
+
+		if( _mm256_testz_si256(
+		     block_differences,
+		     block_differences ) == 0 )
+		{
+			*data_offset = safe_data_offset;
+
+			return( 0 );
+		}
+		safe_data_offset += 256;
+	}
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+/* Classifies a buffer containing the chunk data in a single pass
+ * The data is compared against its first 8 bytes to determine if it is a 64-bit pattern fill,
+ * the first 8 bytes then determine if it is a single byte fill (empty-block) or consists of 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_classify(
      const uint8_t *data,
      size_t data_size,
+     uint8_t *data_class,
      libcerror_error_t **error )
 {
-	static char *function = "libewf_chunk_data_check_for_empty_block";
+	const uint64_t *aligned_data = NULL;
+	static char *function        = "libewf_chunk_data_classify";
+	size_t data_offset           = 0;
+	size_t pattern_index         = 0;
+	size_t pattern_size          = 0;
+	uint64_t differences         = 0;
+	uint64_t pattern             = 0;
+	int result                   = 1;
 
 	if( data == NULL )
 	{
@@ -1558,18 +2097,169 @@ int libewf_chunk_data_check_for_empty_block(
 
 		return( -1 );
 	}
-	if( data_size == 0 )
+	if( data_class == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data class.",
+		 function );
+
+		return( -1 );
 	}
-	else if( data_size == 1 )
+	if( data_size == 0 )
 	{
+		*data_class = LIBEWF_CHUNK_DATA_CLASS_GENERAL;
+
 		return( 1 );
 	}
-	if( memory_compare(
+	pattern_size = 8;
+
+	if( data_size < pattern_size )
+	{
+		pattern_size = data_size;
+	}
+	data_offset = pattern_size;
+
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+	if( data_size >= 8 )
+	{
+		switch( libewf_simd_get_instruction_set() )
+		{
+			case LIBEWF_SIMD_INSTRUCTION_SET_AVX2:
+				result = libewf_chunk_data_compare_64_bit_pattern_avx2(
+				          data,
+				          data_size,
+				          &data_offset );
+				break;
+
+			case LIBEWF_SIMD_INSTRUCTION_SET_SSE2:
+				result = libewf_chunk_data_compare_64_bit_pattern_sse2(
+				          data,
+				          data_size,
+				          &data_offset );
+				break;
+
+			default:
+				break;
+		}
+		if( result == 0 )
+		{
+			*data_class = LIBEWF_CHUNK_DATA_CLASS_GENERAL;
+
+			return( 1 );
+		}
+	}
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+	if( ( data_size >= 8 )
+	 && ( ( (intptr_t) data % 8 ) == 0 ) )
+	{
+		aligned_data = (const uint64_t *) data;
+		pattern      = *aligned_data;
+
+		/* Compare 32 bytes at a time, which allows to stop early on general data
+		 */
+		while( ( data_size - data_offset ) >= 32 )
+		{
+			aligned_data = (const uint64_t *) &( data[ data_offset ] );
+
+			differences = ( aligned_data[ 0 ] ^ pattern )
+			            | ( aligned_data[ 1 ] ^ pattern )
+			            | ( aligned_data[ 2 ] ^ pattern )
+			            | ( aligned_data[ 3 ] ^ pattern );
+
+			if( differences != 0 )
+			{
+				*data_class = LIBEWF_CHUNK_DATA_CLASS_GENERAL;
+
+				return( 1 );
+			}
+			data_offset += 32;
+		}
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] != data[ data_offset % 8 ] )
+		{
+			*data_class = LIBEWF_CHUNK_DATA_CLASS_GENERAL;
+
+			return( 1 );
+		}
+		data_offset++;
+	}
+	for( pattern_index = 1;
+	     pattern_index < pattern_size;
+	     pattern_index++ )
+	{
+		if( data[ pattern_index ] != data[ 0 ] )
+		{
+			*data_class = LIBEWF_CHUNK_DATA_CLASS_64_BIT_PATTERN;
+
+			return( 1 );
+		}
+	}
+	if( data[ 0 ] != 0 )
+	{
+		*data_class = LIBEWF_CHUNK_DATA_CLASS_SINGLE_BYTE_FILL;
+	}
+	else
+	{
+		*data_class = LIBEWF_CHUNK_DATA_CLASS_ZERO;
+	}
+	return( 1 );
+}
+
+/* Checks if a buffer containing the chunk data is filled with same value bytes (empty-block)
+ * Returns 1 if an empty block was found, 0 if not or -1 on error
+ */
+int libewf_chunk_data_check_for_empty_block(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_check_for_empty_block";
+	uint8_t data_class    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_chunk_data_classify(
 	     data,
-	     &( data[ 1 ] ),
-	     data_size - 1 ) != 0 )
+	     data_size,
+	     &data_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to classify data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_class < LIBEWF_CHUNK_DATA_CLASS_SINGLE_BYTE_FILL )
 	{
 		return( 0 );
 	}
@@ -1585,11 +2275,8 @@ int libewf_chunk_data_check_for_64_bit_pattern_fill(
      uint64_t *pattern,
      libcerror_error_t **error )
 {
-	libewf_aligned_t *aligned_data_index = NULL;
-	libewf_aligned_t *aligned_data_start = NULL;
-	uint8_t *data_index                  = NULL;
-	uint8_t *data_start                  = NULL;
-	static char *function                = "libewf_chunk_data_check_for_64_bit_pattern_fill";
+	static char *function = "libewf_chunk_data_check_for_64_bit_pattern_fill";
+	uint8_t data_class    = 0;
 
 	if( data == NULL )
 	{
@@ -1629,63 +2316,24 @@ int libewf_chunk_data_check_for_64_bit_pattern_fill(
 	{
 		return( 0 );
 	}
-	data_start = (uint8_t *) data;
-	data_index = (uint8_t *) data + 8;
-	data_size -= 8;
-
-	/* Only optimize for data larger than the alignment
-	 */
-	if( data_size > ( sizeof( libewf_aligned_t ) + sizeof( libewf_aligned_t ) ) )
+	if( libewf_chunk_data_classify(
+	     data,
+	     data_size,
+	     &data_class,
+	     error ) != 1 )
 	{
-		/* Align the data start
-		 */
-		while( ( (intptr_t) data_start % sizeof( libewf_aligned_t ) ) != 0 )
-		{
-			if( *data_start != *data_index )
-			{
-				return( 0 );
-			}
-			data_start++;
-			data_index++;
-			data_size--;
-		}
-		/* Align the data index
-		 */
-		while( ( (intptr_t) data_index % sizeof( libewf_aligned_t ) ) != 0 )
-		{
-			if( *data_start != *data_index )
-			{
-				return( 0 );
-			}
-			data_index++;
-			data_size--;
-		}
-		aligned_data_start = (libewf_aligned_t *) data_start;
-		aligned_data_index = (libewf_aligned_t *) data_index;
-
-		while( data_size > sizeof( libewf_aligned_t ) )
-		{
-			if( *aligned_data_start != *aligned_data_index )
-			{
-				return( 0 );
-			}
-			aligned_data_start++;
-			aligned_data_index++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to classify data.",
+		 function );
 
-			data_size -= sizeof( libewf_aligned_t );
-		}
-		data_start = (uint8_t *) aligned_data_start;
-		data_index = (uint8_t *) aligned_data_index;
+		return( -1 );
 	}
-	while( data_size != 0 )
+	if( data_class == LIBEWF_CHUNK_DATA_CLASS_GENERAL )
 	{
-		if( *data_start != *data_index )
-		{
-			return( 0 );
-		}
-		data_start++;
-		data_index++;
-		data_size--;
+		return( 0 );
 	}
 	byte_stream_copy_to_uint64_little_endian(
 	 data,
@@ -1921,7 +2569,8 @@ int libewf_chunk_data_get_checksum(
 
 			return( -1 );
 		}
-		if( compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		if( ( compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		 || ( compression_method == LIBEWF_COMPRESSION_METHOD_LZ4 ) )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 &( ( chunk_data->data )[ chunk_data->data_size - 4 ] ),
@@ -2058,6 +2707,80 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
 	return( read_count );
 }
 
+/* Reads chunk data by means of the chunk read buffer
+ * Returns the number of bytes read, 0 if the chunk data was not buffered or -1 on error
+ */
+ssize_t libewf_chunk_data_read_from_chunk_read_buffer(
+         libewf_chunk_data_t *chunk_data,
+         libewf_chunk_read_buffer_t *chunk_read_buffer,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t chunk_data_offset,
+         size64_t chunk_data_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_read_from_chunk_read_buffer";
+	int result            = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size == (size64_t) 0 )
+	 || ( chunk_data_size > (size64_t) chunk_data->allocated_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          chunk_data_offset,
+	          chunk_data->data,
+	          (size_t) chunk_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO pool entry: %d from chunk read buffer.",
+		 function,
+		 chunk_data_offset,
+		 chunk_data_offset,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	chunk_data->data_size = (size_t) chunk_data_size;
+
+	chunk_data->range_flags = ( chunk_data_flags | LIBEWF_RANGE_FLAG_IS_PACKED )
+	                        & ~( LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED );
+
+	return( (ssize_t) chunk_data_size );
+}
+
 /* Reads chunk data
  * Callback function for the chunks list
  * Returns 1 if successful or -1 on error
@@ -2113,11 +2836,29 @@ int libewf_chunk_data_read_element_data(
 
 		return( -1 );
 	}
-	if( libewf_chunk_data_initialize(
-	     &chunk_data,
-	     io_handle->chunk_size,
-	     0,
-	     error ) != 1 )
+	if( io_handle->chunk_data_pool != NULL )
+	{
+		if( libewf_chunk_data_pool_get_chunk_data(
+		     io_handle->chunk_data_pool,
+		     io_handle->chunk_size,
+		     &chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk data from pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libewf_chunk_data_initialize(
+	          &chunk_data,
+	          io_handle->chunk_size,
+	          0,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2178,15 +2919,29 @@ int libewf_chunk_data_read_element_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	read_count = libewf_chunk_data_read_from_file_io_pool(
-		      chunk_data,
-		      file_io_pool,
-		      file_io_pool_entry,
-	              chunk_data_offset,
-		      chunk_data_size,
-		      chunk_data_flags,
-		      error );
-
+	if( io_handle->chunk_read_buffer != NULL )
+	{
+		read_count = libewf_chunk_data_read_from_chunk_read_buffer(
+			      chunk_data,
+			      io_handle->chunk_read_buffer,
+			      file_io_pool,
+			      file_io_pool_entry,
+			      chunk_data_offset,
+			      chunk_data_size,
+			      chunk_data_flags,
+			      error );
+	}
+	if( read_count == 0 )
+	{
+		read_count = libewf_chunk_data_read_from_file_io_pool(
+			      chunk_data,
+			      file_io_pool,
+			      file_io_pool_entry,
+			      chunk_data_offset,
+			      chunk_data_size,
+			      chunk_data_flags,
+			      error );
+	}
 	if( read_count < 0 )
 	{
 		libcerror_error_set(
@@ -25,10 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_chunk_read_buffer.h"
+#include "libewf_compression_context.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfdata.h"
+#include "libewf_simd.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -82,6 +85,14 @@ struct libewf_chunk_data
 	 */
 	uint32_t checksum;
 
+	/* The SHA256 digest of the (unpacked) data
+	 */
+	uint8_t digest[ 32 ];
+
+	/* Value to indicate if the digest was set
+	 */
+	uint8_t digest_set;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -97,6 +108,14 @@ struct libewf_chunk_data
 	/* The range end offset
 	 */
 	off64_t range_end_offset;
+
+	/* The spare data, a buffer of the allocated data size retained to unpack into
+	 */
+	uint8_t *spare_data;
+
+	/* The chunk data pool the chunk data is returned to when freed
+	 */
+	struct libewf_chunk_data_pool *chunk_data_pool;
 };
 
 int libewf_chunk_data_initialize(
@@ -109,12 +128,24 @@ int libewf_chunk_data_free(
      libewf_chunk_data_t **chunk_data,
      libcerror_error_t **error );
 
+int libewf_chunk_data_clone(
+     libewf_chunk_data_t **destination_chunk_data,
+     libewf_chunk_data_t *source_chunk_data,
+     libcerror_error_t **error );
+
 ssize_t libewf_chunk_data_read_buffer(
          libewf_chunk_data_t *chunk_data,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libewf_chunk_data_read_buffer_at_offset(
+         libewf_chunk_data_t *chunk_data,
+         off64_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 ssize_t libewf_chunk_data_write_buffer(
          libewf_chunk_data_t *chunk_data,
          const uint8_t *buffer,
@@ -144,11 +175,13 @@ int libewf_chunk_data_pack_with_empty_block_compression(
 int libewf_chunk_data_pack_with_compression(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
+     libewf_compression_context_t *compression_context,
      libcerror_error_t **error );
 
 int libewf_chunk_data_pack(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
+     libewf_compression_context_t *compression_context,
      const uint8_t *compressed_zero_byte_empty_block,
      size_t compressed_zero_byte_empty_block_size,
      uint8_t pack_flags,
@@ -159,6 +192,26 @@ int libewf_chunk_data_unpack(
      libewf_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+
+int libewf_chunk_data_compare_64_bit_pattern_sse2(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset );
+
+int libewf_chunk_data_compare_64_bit_pattern_avx2(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset );
+
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+int libewf_chunk_data_classify(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *data_class,
+     libcerror_error_t **error );
+
 int libewf_chunk_data_check_for_empty_block(
      const uint8_t *data,
      size_t data_size,
@@ -196,6 +249,16 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
          uint32_t chunk_data_flags,
          libcerror_error_t **error );
 
+ssize_t libewf_chunk_data_read_from_chunk_read_buffer(
+         libewf_chunk_data_t *chunk_data,
+         libewf_chunk_read_buffer_t *chunk_read_buffer,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t chunk_data_offset,
+         size64_t chunk_data_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error );
+
 int libewf_chunk_data_read_element_data(
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
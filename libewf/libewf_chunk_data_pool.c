@@ -0,0 +1,831 @@
+/*
+ * Chunk data pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_chunk_data_pool.h"
+#include "libewf_compression_context.h"
+#include "libewf_definitions.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+/* Creates a chunk data pool
+ * The chunk data pool retains freed chunk data, including their data buffers,
+ * and decompression state so that reading chunks does not need to allocate
+ * memory for every chunk
+ * Make sure the value chunk_data_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_initialize(
+     libewf_chunk_data_pool_t **chunk_data_pool,
+     int maximum_number_of_chunk_data_values,
+     int maximum_number_of_compression_contexts,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_pool_initialize";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_chunk_data_values <= 0 )
+	 || ( (size_t) maximum_number_of_chunk_data_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_chunk_data_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of chunk data values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_compression_contexts <= 0 )
+	 || ( (size_t) maximum_number_of_compression_contexts > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_compression_context_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of compression contexts value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_data_pool = memory_allocate_structure(
+	                    libewf_chunk_data_pool_t );
+
+	if( *chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_data_pool,
+	     0,
+	     sizeof( libewf_chunk_data_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk data pool.",
+		 function );
+
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+
+		return( -1 );
+	}
+	( *chunk_data_pool )->chunk_data_values = (libewf_chunk_data_t **) memory_allocate(
+	                                                                     sizeof( libewf_chunk_data_t * ) * maximum_number_of_chunk_data_values );
+
+	if( ( *chunk_data_pool )->chunk_data_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data values.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_data_pool )->compression_contexts = (libewf_compression_context_t **) memory_allocate(
+	                                                                                sizeof( libewf_compression_context_t * ) * maximum_number_of_compression_contexts );
+
+	if( ( *chunk_data_pool )->compression_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compression contexts.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_data_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *chunk_data_pool )->maximum_number_of_chunk_data_values    = maximum_number_of_chunk_data_values;
+	( *chunk_data_pool )->maximum_number_of_compression_contexts = maximum_number_of_compression_contexts;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_data_pool != NULL )
+	{
+		if( ( *chunk_data_pool )->compression_contexts != NULL )
+		{
+			memory_free(
+			 ( *chunk_data_pool )->compression_contexts );
+		}
+		if( ( *chunk_data_pool )->chunk_data_values != NULL )
+		{
+			memory_free(
+			 ( *chunk_data_pool )->chunk_data_values );
+		}
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk data pool
+ * Chunk data retrieved from the pool must be freed before the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_free(
+     libewf_chunk_data_pool_t **chunk_data_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_pool_free";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data_pool != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_data_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( value_index = 0;
+		     value_index < ( *chunk_data_pool )->number_of_chunk_data_values;
+		     value_index++ )
+		{
+			( ( *chunk_data_pool )->chunk_data_values )[ value_index ]->chunk_data_pool = NULL;
+
+			if( libewf_chunk_data_free(
+			     &( ( ( *chunk_data_pool )->chunk_data_values )[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk data: %d.",
+				 function,
+				 value_index );
+
+				result = -1;
+			}
+		}
+		for( value_index = 0;
+		     value_index < ( *chunk_data_pool )->number_of_compression_contexts;
+		     value_index++ )
+		{
+			if( libewf_compression_context_free(
+			     &( ( ( *chunk_data_pool )->compression_contexts )[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compression context: %d.",
+				 function,
+				 value_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *chunk_data_pool )->compression_contexts );
+
+		memory_free(
+		 ( *chunk_data_pool )->chunk_data_values );
+
+		memory_free(
+		 *chunk_data_pool );
+
+		*chunk_data_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves chunk data from the pool
+ * Chunk data of a different chunk size is freed and new chunk data is created
+ * when the pool has no chunk data available
+ * The chunk data is returned to the pool when it is freed by libewf_chunk_data_free
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_get_chunk_data(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     size32_t chunk_size,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *safe_chunk_data = NULL;
+	static char *function                = "libewf_chunk_data_pool_get_chunk_data";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( chunk_data_pool->number_of_chunk_data_values > 0 )
+	{
+		chunk_data_pool->number_of_chunk_data_values -= 1;
+
+		safe_chunk_data = chunk_data_pool->chunk_data_values[ chunk_data_pool->number_of_chunk_data_values ];
+
+		chunk_data_pool->chunk_data_values[ chunk_data_pool->number_of_chunk_data_values ] = NULL;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( ( safe_chunk_data != NULL )
+	 && ( safe_chunk_data->chunk_size != chunk_size ) )
+	{
+		safe_chunk_data->chunk_data_pool = NULL;
+
+		if( libewf_chunk_data_free(
+		     &safe_chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( safe_chunk_data == NULL )
+	{
+		if( libewf_chunk_data_initialize(
+		     &safe_chunk_data,
+		     chunk_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_chunk_data->chunk_data_pool = chunk_data_pool;
+	}
+	*chunk_data = safe_chunk_data;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunk_data != NULL )
+	{
+		safe_chunk_data->chunk_data_pool = NULL;
+
+		libewf_chunk_data_free(
+		 &safe_chunk_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Returns chunk data to the pool
+ * The chunk data is freed if the pool is full
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_release_chunk_data(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *safe_chunk_data = NULL;
+	static char *function                = "libewf_chunk_data_pool_release_chunk_data";
+	size_t allocated_data_size           = 0;
+	size32_t chunk_size                  = 0;
+	uint8_t *data                        = NULL;
+	uint8_t *spare_data                  = NULL;
+	int result                           = 0;
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunk_data = *chunk_data;
+
+	if( safe_chunk_data == NULL )
+	{
+		return( 1 );
+	}
+	*chunk_data = NULL;
+
+	if( ( safe_chunk_data->data != NULL )
+	 && ( ( safe_chunk_data->flags & LIBEWF_CHUNK_DATA_ITEM_FLAG_MANAGED_DATA ) != 0 ) )
+	{
+		/* The compressed data of chunk data that was unpacked is the buffer
+		 * the chunk was read into and hence has the same allocated size
+		 * as the data, it is retained to unpack the next chunk into
+		 */
+		spare_data = safe_chunk_data->spare_data;
+
+		if( safe_chunk_data->compressed_data != NULL )
+		{
+			if( spare_data == NULL )
+			{
+				spare_data = safe_chunk_data->compressed_data;
+			}
+			else
+			{
+				memory_free(
+				 safe_chunk_data->compressed_data );
+			}
+		}
+		data                = safe_chunk_data->data;
+		allocated_data_size = safe_chunk_data->allocated_data_size;
+		chunk_size          = safe_chunk_data->chunk_size;
+
+		if( memory_set(
+		     safe_chunk_data,
+		     0,
+		     sizeof( libewf_chunk_data_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk data.",
+			 function );
+
+			safe_chunk_data->data            = data;
+			safe_chunk_data->compressed_data = NULL;
+			safe_chunk_data->spare_data      = spare_data;
+
+			goto on_error;
+		}
+		safe_chunk_data->chunk_size          = chunk_size;
+		safe_chunk_data->allocated_data_size = allocated_data_size;
+		safe_chunk_data->data                = data;
+		safe_chunk_data->spare_data          = spare_data;
+		safe_chunk_data->flags               = LIBEWF_CHUNK_DATA_ITEM_FLAG_MANAGED_DATA;
+		safe_chunk_data->chunk_data_pool     = chunk_data_pool;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     chunk_data_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( chunk_data_pool->number_of_chunk_data_values < chunk_data_pool->maximum_number_of_chunk_data_values )
+		{
+			chunk_data_pool->chunk_data_values[ chunk_data_pool->number_of_chunk_data_values ] = safe_chunk_data;
+
+			chunk_data_pool->number_of_chunk_data_values += 1;
+
+			result = 1;
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     chunk_data_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			if( result == 1 )
+			{
+				/* The chunk data is owned by the pool
+				 */
+				return( -1 );
+			}
+			goto on_error;
+		}
+#endif
+		if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+	safe_chunk_data->chunk_data_pool = NULL;
+
+	if( libewf_chunk_data_free(
+	     &safe_chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	safe_chunk_data->chunk_data_pool = NULL;
+
+	libewf_chunk_data_free(
+	 &safe_chunk_data,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves a compression context from the pool
+ * A new compression context is created when the pool has none available
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_get_compression_context(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error )
+{
+	libewf_compression_context_t *safe_compression_context = NULL;
+	static char *function                                  = "libewf_chunk_data_pool_get_compression_context";
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compression_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compression context value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( chunk_data_pool->number_of_compression_contexts > 0 )
+	{
+		chunk_data_pool->number_of_compression_contexts -= 1;
+
+		safe_compression_context = chunk_data_pool->compression_contexts[ chunk_data_pool->number_of_compression_contexts ];
+
+		chunk_data_pool->compression_contexts[ chunk_data_pool->number_of_compression_contexts ] = NULL;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( safe_compression_context == NULL )
+	{
+		if( libewf_compression_context_initialize(
+		     &safe_compression_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compression context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*compression_context = safe_compression_context;
+
+	return( 1 );
+
+on_error:
+	if( safe_compression_context != NULL )
+	{
+		libewf_compression_context_free(
+		 &safe_compression_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Returns a compression context to the pool
+ * The compression context is freed if the pool is full
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pool_release_compression_context(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error )
+{
+	libewf_compression_context_t *safe_compression_context = NULL;
+	static char *function                                  = "libewf_chunk_data_pool_release_compression_context";
+	int result                                             = 0;
+
+	if( chunk_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compression_context = *compression_context;
+
+	if( safe_compression_context == NULL )
+	{
+		return( 1 );
+	}
+	*compression_context = NULL;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( chunk_data_pool->number_of_compression_contexts < chunk_data_pool->maximum_number_of_compression_contexts )
+	{
+		chunk_data_pool->compression_contexts[ chunk_data_pool->number_of_compression_contexts ] = safe_compression_context;
+
+		chunk_data_pool->number_of_compression_contexts += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chunk_data_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( result == 1 )
+		{
+			/* The compression context is owned by the pool
+			 */
+			return( -1 );
+		}
+		goto on_error;
+	}
+#endif
+	if( result == 1 )
+	{
+		return( 1 );
+	}
+	if( libewf_compression_context_free(
+	     &safe_compression_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compression context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+on_error:
+	libewf_compression_context_free(
+	 &safe_compression_context,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Chunk data pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_DATA_POOL_H )
+#define _LIBEWF_CHUNK_DATA_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_compression_context.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_chunk_data_pool libewf_chunk_data_pool_t;
+
+struct libewf_chunk_data_pool
+{
+	/* The chunk data that is available for reuse
+	 */
+	libewf_chunk_data_t **chunk_data_values;
+
+	/* The maximum number of chunk data values
+	 */
+	int maximum_number_of_chunk_data_values;
+
+	/* The number of chunk data values
+	 */
+	int number_of_chunk_data_values;
+
+	/* The compression contexts that are available for reuse
+	 */
+	libewf_compression_context_t **compression_contexts;
+
+	/* The maximum number of compression contexts
+	 */
+	int maximum_number_of_compression_contexts;
+
+	/* The number of compression contexts
+	 */
+	int number_of_compression_contexts;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_chunk_data_pool_initialize(
+     libewf_chunk_data_pool_t **chunk_data_pool,
+     int maximum_number_of_chunk_data_values,
+     int maximum_number_of_compression_contexts,
+     libcerror_error_t **error );
+
+int libewf_chunk_data_pool_free(
+     libewf_chunk_data_pool_t **chunk_data_pool,
+     libcerror_error_t **error );
+
+int libewf_chunk_data_pool_get_chunk_data(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     size32_t chunk_size,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_data_pool_release_chunk_data(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_chunk_data_pool_get_compression_context(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error );
+
+int libewf_chunk_data_pool_release_compression_context(
+     libewf_chunk_data_pool_t *chunk_data_pool,
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_DATA_POOL_H ) */
+
@@ -0,0 +1,985 @@
+/*
+ * Chunk pack pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_chunk_pack_pool.h"
+#include "libewf_definitions.h"
+#include "libewf_io_handle.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
+#include "libewf_write_io_handle.h"
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Creates a chunk pack pool
+ * The chunk pack pool packs chunk data on worker threads and returns
+ * the packed chunk data in the order it was pushed
+ * Make sure the value chunk_pack_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_pack_pool_initialize(
+     libewf_chunk_pack_pool_t **chunk_pack_pool,
+     int number_of_threads,
+     libewf_io_handle_t *io_handle,
+     libewf_write_io_handle_t *write_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function            = "libewf_chunk_pack_pool_initialize";
+	size_t compression_contexts_size = 0;
+	size_t entries_size              = 0;
+	int compression_context_index    = 0;
+
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_pack_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk pack pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEWF_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_pack_pool = memory_allocate_structure(
+	                    libewf_chunk_pack_pool_t );
+
+	if( *chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk pack pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_pack_pool,
+	     0,
+	     sizeof( libewf_chunk_pack_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk pack pool.",
+		 function );
+
+		memory_free(
+		 *chunk_pack_pool );
+
+		*chunk_pack_pool = NULL;
+
+		return( -1 );
+	}
+	/* Allow for twice the number of threads so that the workers
+	 * can continue packing while the packed chunks are written
+	 */
+	( *chunk_pack_pool )->maximum_number_of_entries = 2 * number_of_threads;
+
+	entries_size = sizeof( libewf_chunk_pack_pool_entry_t ) * ( *chunk_pack_pool )->maximum_number_of_entries;
+
+	( *chunk_pack_pool )->entries = (libewf_chunk_pack_pool_entry_t *) memory_allocate(
+	                                                                    entries_size );
+
+	if( ( *chunk_pack_pool )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_pack_pool )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* The worker threads of the thread pool are not identifiable hence every pack
+	 * takes a compression context from the free ones and returns it afterwards
+	 */
+	compression_contexts_size = sizeof( libewf_compression_context_t * ) * number_of_threads;
+
+	( *chunk_pack_pool )->compression_contexts = (libewf_compression_context_t **) memory_allocate(
+	                                                                                compression_contexts_size );
+
+	if( ( *chunk_pack_pool )->compression_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compression contexts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_pack_pool )->compression_contexts,
+	     0,
+	     compression_contexts_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compression contexts.",
+		 function );
+
+		memory_free(
+		 ( *chunk_pack_pool )->compression_contexts );
+
+		( *chunk_pack_pool )->compression_contexts = NULL;
+
+		goto on_error;
+	}
+	( *chunk_pack_pool )->free_compression_contexts = (libewf_compression_context_t **) memory_allocate(
+	                                                                                     compression_contexts_size );
+
+	if( ( *chunk_pack_pool )->free_compression_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free compression contexts.",
+		 function );
+
+		goto on_error;
+	}
+	for( compression_context_index = 0;
+	     compression_context_index < number_of_threads;
+	     compression_context_index++ )
+	{
+		if( libewf_compression_context_initialize(
+		     &( ( ( *chunk_pack_pool )->compression_contexts )[ compression_context_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compression context: %d.",
+			 function,
+			 compression_context_index );
+
+			goto on_error;
+		}
+		( ( *chunk_pack_pool )->free_compression_contexts )[ compression_context_index ] = ( ( *chunk_pack_pool )->compression_contexts )[ compression_context_index ];
+	}
+	( *chunk_pack_pool )->number_of_compression_contexts      = number_of_threads;
+	( *chunk_pack_pool )->number_of_free_compression_contexts = number_of_threads;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_pack_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *chunk_pack_pool )->entry_packed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry packed condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_pack_pool )->io_handle       = io_handle;
+	( *chunk_pack_pool )->write_io_handle = write_io_handle;
+
+	if( libcthreads_thread_pool_create(
+	     &( ( *chunk_pack_pool )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     ( *chunk_pack_pool )->maximum_number_of_entries,
+	     (int (*)(intptr_t *, void *)) &libewf_chunk_pack_pool_pack_entry_callback,
+	     (void *) *chunk_pack_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_pack_pool != NULL )
+	{
+		if( ( *chunk_pack_pool )->entry_packed_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *chunk_pack_pool )->entry_packed_condition ),
+			 NULL );
+		}
+		if( ( *chunk_pack_pool )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *chunk_pack_pool )->mutex ),
+			 NULL );
+		}
+		if( ( *chunk_pack_pool )->free_compression_contexts != NULL )
+		{
+			memory_free(
+			 ( *chunk_pack_pool )->free_compression_contexts );
+		}
+		if( ( *chunk_pack_pool )->compression_contexts != NULL )
+		{
+			for( compression_context_index = 0;
+			     compression_context_index < number_of_threads;
+			     compression_context_index++ )
+			{
+				if( ( ( *chunk_pack_pool )->compression_contexts )[ compression_context_index ] != NULL )
+				{
+					libewf_compression_context_free(
+					 &( ( ( *chunk_pack_pool )->compression_contexts )[ compression_context_index ] ),
+					 NULL );
+				}
+			}
+			memory_free(
+			 ( *chunk_pack_pool )->compression_contexts );
+		}
+		if( ( *chunk_pack_pool )->entries != NULL )
+		{
+			memory_free(
+			 ( *chunk_pack_pool )->entries );
+		}
+		memory_free(
+		 *chunk_pack_pool );
+
+		*chunk_pack_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk pack pool
+ * Waits for the worker threads to finish and frees chunk data that was not popped
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_pack_pool_free(
+     libewf_chunk_pack_pool_t **chunk_pack_pool,
+     libcerror_error_t **error )
+{
+	libewf_chunk_pack_pool_entry_t *entry = NULL;
+	static char *function                 = "libewf_chunk_pack_pool_free";
+	int compression_context_index         = 0;
+	int entry_index                       = 0;
+	int result                            = 1;
+
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_pack_pool != NULL )
+	{
+		/* The thread pool is joined first since the worker threads reference the entries
+		 */
+		if( ( *chunk_pack_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *chunk_pack_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( entry_index = 0;
+		     entry_index < ( *chunk_pack_pool )->maximum_number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( ( ( *chunk_pack_pool )->entries )[ entry_index ] );
+
+			if( entry->chunk_data != NULL )
+			{
+				if( libewf_chunk_data_free(
+				     &( entry->chunk_data ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free chunk data: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+		}
+		for( compression_context_index = 0;
+		     compression_context_index < ( *chunk_pack_pool )->number_of_compression_contexts;
+		     compression_context_index++ )
+		{
+			if( libewf_compression_context_free(
+			     &( ( ( *chunk_pack_pool )->compression_contexts )[ compression_context_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compression context: %d.",
+				 function,
+				 compression_context_index );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *chunk_pack_pool )->entry_packed_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry packed condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_pack_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *chunk_pack_pool )->free_compression_contexts );
+
+		memory_free(
+		 ( *chunk_pack_pool )->compression_contexts );
+
+		memory_free(
+		 ( *chunk_pack_pool )->entries );
+
+		memory_free(
+		 *chunk_pack_pool );
+
+		*chunk_pack_pool = NULL;
+	}
+	return( result );
+}
+
+/* Packs the chunk data of an entry
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_pack_pool_pack_entry_callback(
+     libewf_chunk_pack_pool_entry_t *entry,
+     libewf_chunk_pack_pool_t *chunk_pack_pool )
+{
+	libewf_compression_context_t *compression_context = NULL;
+	libcerror_error_t *error                          = NULL;
+	static char *function                             = "libewf_chunk_pack_pool_pack_entry_callback";
+	uint8_t state                                     = LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PACKED;
+	int result                                        = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* There are as many compression contexts as worker threads
+	 * if none is available the chunk is packed without one
+	 */
+	if( chunk_pack_pool->number_of_free_compression_contexts > 0 )
+	{
+		chunk_pack_pool->number_of_free_compression_contexts -= 1;
+
+		compression_context = chunk_pack_pool->free_compression_contexts[ chunk_pack_pool->number_of_free_compression_contexts ];
+	}
+	if( libcthreads_mutex_release(
+	     chunk_pack_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk data is owned by the entry until it is popped
+	 * hence it can be packed without holding the mutex
+	 */
+	if( libewf_chunk_data_pack(
+	     entry->chunk_data,
+	     chunk_pack_pool->io_handle,
+	     compression_context,
+	     chunk_pack_pool->write_io_handle->compressed_zero_byte_empty_block,
+	     chunk_pack_pool->write_io_handle->compressed_zero_byte_empty_block_size,
+	     chunk_pack_pool->write_io_handle->pack_flags,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to pack chunk: %" PRIu64 " data.",
+		 function,
+		 entry->chunk_index );
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		state  = LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_FAILED;
+		result = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( compression_context != NULL )
+	{
+		chunk_pack_pool->free_compression_contexts[ chunk_pack_pool->number_of_free_compression_contexts ] = compression_context;
+
+		chunk_pack_pool->number_of_free_compression_contexts += 1;
+	}
+	entry->state = state;
+
+	if( libcthreads_condition_broadcast(
+	     chunk_pack_pool->entry_packed_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast entry packed condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 chunk_pack_pool->mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_pack_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Determines if the chunk pack pool is full
+ * Returns 1 if full, 0 if not or -1 on error
+ */
+int libewf_chunk_pack_pool_is_full(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_pack_pool_is_full";
+	int result            = 0;
+
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_pack_pool->number_of_entries >= chunk_pack_pool->maximum_number_of_entries )
+	{
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Pushes chunk data onto the chunk pack pool to be packed by a worker thread
+ * The chunk pack pool takes over management of the chunk data if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_pack_pool_push_chunk_data(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     size_t input_data_size,
+     libcerror_error_t **error )
+{
+	libewf_chunk_pack_pool_entry_t *entry = NULL;
+	static char *function                 = "libewf_chunk_pack_pool_push_chunk_data";
+	int entry_index                       = 0;
+
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_pack_pool->number_of_entries >= chunk_pack_pool->maximum_number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk pack pool - number of entries value exceeds maximum.",
+		 function );
+
+		libcthreads_mutex_release(
+		 chunk_pack_pool->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	entry_index = ( chunk_pack_pool->first_entry_index + chunk_pack_pool->number_of_entries )
+	            % chunk_pack_pool->maximum_number_of_entries;
+
+	entry = &( ( chunk_pack_pool->entries )[ entry_index ] );
+
+	entry->chunk_index     = chunk_index;
+	entry->chunk_data      = chunk_data;
+	entry->input_data_size = input_data_size;
+	entry->state           = LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PENDING;
+
+	chunk_pack_pool->number_of_entries += 1;
+
+	if( libcthreads_mutex_release(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_push(
+	     chunk_pack_pool->thread_pool,
+	     (intptr_t *) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push entry onto thread pool queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* The entry was not queued, return management of the chunk data to the caller
+	 */
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     NULL ) == 1 )
+	{
+		entry->chunk_data = NULL;
+
+		chunk_pack_pool->number_of_entries -= 1;
+
+		libcthreads_mutex_release(
+		 chunk_pack_pool->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pops the oldest chunk data from the chunk pack pool once it has been packed
+ * If wait_for_entry is set the function blocks until the oldest chunk data has been packed
+ * The caller takes over management of the chunk data if successful
+ * Returns 1 if successful, 0 if no packed chunk data is available or -1 on error
+ */
+int libewf_chunk_pack_pool_pop_packed_chunk_data(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     uint8_t wait_for_entry,
+     uint64_t *chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     size_t *input_data_size,
+     libcerror_error_t **error )
+{
+	libewf_chunk_pack_pool_entry_t *entry = NULL;
+	static char *function                 = "libewf_chunk_pack_pool_pop_packed_chunk_data";
+	int result                            = 0;
+
+	if( chunk_pack_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk pack pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_pack_pool->number_of_entries > 0 )
+	{
+		entry = &( ( chunk_pack_pool->entries )[ chunk_pack_pool->first_entry_index ] );
+
+		while( ( wait_for_entry != 0 )
+		    && ( entry->state == LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PENDING ) )
+		{
+			if( libcthreads_condition_wait(
+			     chunk_pack_pool->entry_packed_condition,
+			     chunk_pack_pool->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for entry packed condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( ( result != -1 )
+		 && ( entry->state != LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PENDING ) )
+		{
+			if( entry->state == LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_FAILED )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to pack chunk: %" PRIu64 " data.",
+				 function,
+				 entry->chunk_index );
+
+				result = -1;
+			}
+			else
+			{
+				*chunk_index     = entry->chunk_index;
+				*chunk_data      = entry->chunk_data;
+				*input_data_size = entry->input_data_size;
+
+				entry->chunk_data = NULL;
+
+				chunk_pack_pool->first_entry_index = ( chunk_pack_pool->first_entry_index + 1 )
+				                                   % chunk_pack_pool->maximum_number_of_entries;
+
+				chunk_pack_pool->number_of_entries -= 1;
+
+				result = 1;
+			}
+		}
+	}
+	if( libcthreads_mutex_release(
+	     chunk_pack_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( result == 1 )
+		{
+			libewf_chunk_data_free(
+			 chunk_data,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,167 @@
+/*
+ * Chunk pack pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_PACK_POOL_H )
+#define _LIBEWF_CHUNK_PACK_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_compression_context.h"
+#include "libewf_io_handle.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_write_io_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+enum LIBEWF_CHUNK_PACK_POOL_ENTRY_STATES
+{
+	LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PENDING	= 0,
+	LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_PACKED	= 1,
+	LIBEWF_CHUNK_PACK_POOL_ENTRY_STATE_FAILED	= 2
+};
+
+typedef struct libewf_chunk_pack_pool_entry libewf_chunk_pack_pool_entry_t;
+
+struct libewf_chunk_pack_pool_entry
+{
+	/* The chunk index
+	 */
+	uint64_t chunk_index;
+
+	/* The chunk data
+	 */
+	libewf_chunk_data_t *chunk_data;
+
+	/* The (unpacked) input data size
+	 */
+	size_t input_data_size;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libewf_chunk_pack_pool libewf_chunk_pack_pool_t;
+
+struct libewf_chunk_pack_pool
+{
+	/* The IO handle
+	 */
+	libewf_io_handle_t *io_handle;
+
+	/* The write IO handle
+	 */
+	libewf_write_io_handle_t *write_io_handle;
+
+	/* The entries ring buffer
+	 */
+	libewf_chunk_pack_pool_entry_t *entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the first (oldest) entry
+	 */
+	int first_entry_index;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when an entry has been packed
+	 */
+	libcthreads_condition_t *entry_packed_condition;
+
+	/* The compression contexts, one per worker thread
+	 */
+	libewf_compression_context_t **compression_contexts;
+
+	/* The number of compression contexts
+	 */
+	int number_of_compression_contexts;
+
+	/* The compression contexts that are not in use by a worker thread
+	 */
+	libewf_compression_context_t **free_compression_contexts;
+
+	/* The number of free compression contexts
+	 */
+	int number_of_free_compression_contexts;
+};
+
+int libewf_chunk_pack_pool_initialize(
+     libewf_chunk_pack_pool_t **chunk_pack_pool,
+     int number_of_threads,
+     libewf_io_handle_t *io_handle,
+     libewf_write_io_handle_t *write_io_handle,
+     libcerror_error_t **error );
+
+int libewf_chunk_pack_pool_free(
+     libewf_chunk_pack_pool_t **chunk_pack_pool,
+     libcerror_error_t **error );
+
+int libewf_chunk_pack_pool_pack_entry_callback(
+     libewf_chunk_pack_pool_entry_t *entry,
+     libewf_chunk_pack_pool_t *chunk_pack_pool );
+
+int libewf_chunk_pack_pool_is_full(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     libcerror_error_t **error );
+
+int libewf_chunk_pack_pool_push_chunk_data(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     uint64_t chunk_index,
+     libewf_chunk_data_t *chunk_data,
+     size_t input_data_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_pack_pool_pop_packed_chunk_data(
+     libewf_chunk_pack_pool_t *chunk_pack_pool,
+     uint8_t wait_for_entry,
+     uint64_t *chunk_index,
+     libewf_chunk_data_t **chunk_data,
+     size_t *input_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_PACK_POOL_H ) */
+
@@ -0,0 +1,793 @@
+/*
+ * Chunk prefetcher functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_prefetcher.h"
+#include "libewf_chunk_table.h"
+#include "libewf_definitions.h"
+#include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+#include "libewf_segment_table.h"
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Creates a chunk prefetcher
+ * The chunk prefetcher reads and unpacks the chunks that follow sequential reads
+ * on worker threads into the (unpacked) chunk cache of the chunk table
+ * Make sure the value chunk_prefetcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_initialize(
+     libewf_chunk_prefetcher_t **chunk_prefetcher,
+     int number_of_threads,
+     int maximum_window,
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_prefetcher_initialize";
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_prefetcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk prefetcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEWF_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_window <= 0 )
+	 || ( maximum_window > LIBEWF_MAXIMUM_PREFETCH_WINDOW ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum window value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_prefetcher = memory_allocate_structure(
+	                     libewf_chunk_prefetcher_t );
+
+	if( *chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk prefetcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_prefetcher,
+	     0,
+	     sizeof( libewf_chunk_prefetcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk prefetcher.",
+		 function );
+
+		memory_free(
+		 *chunk_prefetcher );
+
+		*chunk_prefetcher = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_prefetcher )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_prefetcher )->chunk_table   = chunk_table;
+	( *chunk_prefetcher )->io_handle     = io_handle;
+	( *chunk_prefetcher )->file_io_pool  = file_io_pool;
+	( *chunk_prefetcher )->media_values  = media_values;
+	( *chunk_prefetcher )->segment_table = segment_table;
+
+	( *chunk_prefetcher )->maximum_window = maximum_window;
+
+	/* The number of queued chunks is bounded so that scheduling a prefetch
+	 * never blocks the reading thread on a full thread pool queue
+	 */
+	( *chunk_prefetcher )->maximum_number_of_queued_chunks = 2 * LIBEWF_MAXIMUM_PREFETCH_WINDOW;
+
+	if( libcthreads_thread_pool_create(
+	     &( ( *chunk_prefetcher )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     ( *chunk_prefetcher )->maximum_number_of_queued_chunks,
+	     (int (*)(intptr_t *, void *)) &libewf_chunk_prefetcher_prefetch_chunk_callback,
+	     (void *) *chunk_prefetcher,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_prefetcher != NULL )
+	{
+		if( ( *chunk_prefetcher )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *chunk_prefetcher )->mutex ),
+			 NULL );
+		}
+		memory_free(
+		 *chunk_prefetcher );
+
+		*chunk_prefetcher = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk prefetcher
+ * Chunks that are queued but not yet prefetched are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_free(
+     libewf_chunk_prefetcher_t **chunk_prefetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_prefetcher_free";
+	int result            = 1;
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_prefetcher != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     ( *chunk_prefetcher )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			( *chunk_prefetcher )->abort = 1;
+
+			if( libcthreads_mutex_release(
+			     ( *chunk_prefetcher )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The thread pool is joined first since the worker threads reference the chunk prefetcher
+		 */
+		if( ( *chunk_prefetcher )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *chunk_prefetcher )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_prefetcher )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *chunk_prefetcher );
+
+		*chunk_prefetcher = NULL;
+	}
+	return( result );
+}
+
+/* Prefetches a chunk
+ * Callback function for the thread pool
+ * Prefetching is best effort, a chunk that cannot be prefetched is read again by the consumer
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_prefetch_chunk_callback(
+     uint64_t *chunk_index,
+     libewf_chunk_prefetcher_t *chunk_prefetcher )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libewf_chunk_prefetcher_prefetch_chunk_callback";
+	int result               = 0;
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* Skip the chunk if the prefetcher is being freed or if the consumer
+	 * has already reached the chunk
+	 */
+	if( ( chunk_prefetcher->abort == 0 )
+	 && ( *chunk_index > chunk_prefetcher->last_chunk_index ) )
+	{
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		result = libewf_chunk_table_prefetch_chunk_data(
+		          chunk_prefetcher->chunk_table,
+		          chunk_prefetcher->io_handle,
+		          chunk_prefetcher->file_io_pool,
+		          chunk_prefetcher->media_values,
+		          chunk_prefetcher->segment_table,
+		          *chunk_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to prefetch chunk: %" PRIu64 " data.",
+			 function,
+			 *chunk_index );
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_prefetcher->number_of_queued_chunks -= 1;
+
+	if( result == 1 )
+	{
+		chunk_prefetcher->number_of_prefetched_chunks += 1;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 chunk_index );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	if( chunk_index != NULL )
+	{
+		memory_free(
+		 chunk_index );
+	}
+	return( -1 );
+}
+
+/* Sets the maximum number of chunks to prefetch ahead of the last read chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_set_maximum_window(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     int maximum_window,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_prefetcher_set_maximum_window";
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_window < 0 )
+	 || ( maximum_window > LIBEWF_MAXIMUM_PREFETCH_WINDOW ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum window value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_prefetcher->maximum_window = maximum_window;
+
+	if( chunk_prefetcher->window > maximum_window )
+	{
+		chunk_prefetcher->window = maximum_window;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of chunks that were prefetched
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_get_number_of_prefetched_chunks(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     uint64_t *number_of_prefetched_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_prefetcher_get_number_of_prefetched_chunks";
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_prefetched_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of prefetched chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_prefetched_chunks = chunk_prefetcher->number_of_prefetched_chunks;
+
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Notifies the chunk prefetcher that a range of chunks is about to be read
+ * The prefetch window is doubled, up to the maximum window, when the read continues
+ * where the previous read ended and is reset when it does not
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_prefetcher_read_chunks(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     uint64_t first_chunk_index,
+     uint64_t last_chunk_index,
+     libcerror_error_t **error )
+{
+	uint64_t *queued_chunk_index      = NULL;
+	static char *function             = "libewf_chunk_prefetcher_read_chunks";
+	uint64_t chunk_index              = 0;
+	uint64_t first_prefetch_index     = 0;
+	uint64_t last_prefetch_index      = 0;
+	uint64_t number_of_chunks         = 0;
+	int number_of_chunks_to_prefetch  = 0;
+
+	if( chunk_prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index > last_chunk_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = chunk_prefetcher->media_values->number_of_chunks;
+
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index == ( chunk_prefetcher->last_chunk_index + 1 ) )
+	{
+		if( chunk_prefetcher->window == 0 )
+		{
+			chunk_prefetcher->window = 2;
+		}
+		else
+		{
+			chunk_prefetcher->window *= 2;
+		}
+		if( chunk_prefetcher->window > chunk_prefetcher->maximum_window )
+		{
+			chunk_prefetcher->window = chunk_prefetcher->maximum_window;
+		}
+	}
+	else if( first_chunk_index != chunk_prefetcher->last_chunk_index )
+	{
+		chunk_prefetcher->window           = 0;
+		chunk_prefetcher->next_chunk_index = 0;
+	}
+	chunk_prefetcher->last_chunk_index = last_chunk_index;
+
+	if( chunk_prefetcher->next_chunk_index <= last_chunk_index )
+	{
+		chunk_prefetcher->next_chunk_index = last_chunk_index + 1;
+	}
+	first_prefetch_index = chunk_prefetcher->next_chunk_index;
+
+	if( ( chunk_prefetcher->window > 0 )
+	 && ( number_of_chunks > 0 ) )
+	{
+		last_prefetch_index = last_chunk_index + chunk_prefetcher->window;
+
+		if( last_prefetch_index >= number_of_chunks )
+		{
+			last_prefetch_index = number_of_chunks - 1;
+		}
+		while( ( chunk_prefetcher->next_chunk_index <= last_prefetch_index )
+		    && ( chunk_prefetcher->number_of_queued_chunks < chunk_prefetcher->maximum_number_of_queued_chunks ) )
+		{
+			chunk_prefetcher->next_chunk_index        += 1;
+			chunk_prefetcher->number_of_queued_chunks += 1;
+
+			number_of_chunks_to_prefetch++;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     chunk_prefetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunks are pushed onto the thread pool queue without holding the mutex
+	 * since the worker threads grab the mutex
+	 */
+	for( chunk_index = first_prefetch_index;
+	     number_of_chunks_to_prefetch > 0;
+	     chunk_index++ )
+	{
+		queued_chunk_index = (uint64_t *) memory_allocate(
+		                                   sizeof( uint64_t ) );
+
+		if( queued_chunk_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create queued chunk index.",
+			 function );
+
+			goto on_error;
+		}
+		*queued_chunk_index = chunk_index;
+
+		if( libcthreads_thread_pool_push(
+		     chunk_prefetcher->thread_pool,
+		     (intptr_t *) queued_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk: %" PRIu64 " onto thread pool queue.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		queued_chunk_index = NULL;
+
+		number_of_chunks_to_prefetch--;
+	}
+	return( 1 );
+
+on_error:
+	if( queued_chunk_index != NULL )
+	{
+		memory_free(
+		 queued_chunk_index );
+	}
+	/* The chunks that were not queued can be scheduled again by a next read
+	 */
+	if( libcthreads_mutex_grab(
+	     chunk_prefetcher->mutex,
+	     NULL ) == 1 )
+	{
+		chunk_prefetcher->number_of_queued_chunks -= number_of_chunks_to_prefetch;
+
+		if( chunk_prefetcher->next_chunk_index > chunk_index )
+		{
+			chunk_prefetcher->next_chunk_index = chunk_index;
+		}
+		libcthreads_mutex_release(
+		 chunk_prefetcher->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,150 @@
+/*
+ * Chunk prefetcher functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_PREFETCHER_H )
+#define _LIBEWF_CHUNK_PREFETCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_table.h"
+#include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+#include "libewf_segment_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+typedef struct libewf_chunk_prefetcher libewf_chunk_prefetcher_t;
+
+struct libewf_chunk_prefetcher
+{
+	/* The chunk table
+	 */
+	libewf_chunk_table_t *chunk_table;
+
+	/* The IO handle
+	 */
+	libewf_io_handle_t *io_handle;
+
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The media values
+	 */
+	libewf_media_values_t *media_values;
+
+	/* The segment table
+	 */
+	libewf_segment_table_t *segment_table;
+
+	/* The maximum number of chunks to prefetch ahead of the last read chunk
+	 */
+	int maximum_window;
+
+	/* The current number of chunks to prefetch ahead of the last read chunk
+	 * The window grows while the reads are sequential and is reset otherwise
+	 */
+	int window;
+
+	/* The maximum number of queued chunks
+	 */
+	int maximum_number_of_queued_chunks;
+
+	/* The number of queued chunks
+	 */
+	int number_of_queued_chunks;
+
+	/* The index of the last chunk that was read
+	 */
+	uint64_t last_chunk_index;
+
+	/* The index of the next chunk to prefetch
+	 */
+	uint64_t next_chunk_index;
+
+	/* The number of chunks that were prefetched
+	 */
+	uint64_t number_of_prefetched_chunks;
+
+	/* Value to indicate the queued chunks should no longer be prefetched
+	 */
+	uint8_t abort;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+};
+
+int libewf_chunk_prefetcher_initialize(
+     libewf_chunk_prefetcher_t **chunk_prefetcher,
+     int number_of_threads,
+     int maximum_window,
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libcerror_error_t **error );
+
+int libewf_chunk_prefetcher_free(
+     libewf_chunk_prefetcher_t **chunk_prefetcher,
+     libcerror_error_t **error );
+
+int libewf_chunk_prefetcher_prefetch_chunk_callback(
+     uint64_t *chunk_index,
+     libewf_chunk_prefetcher_t *chunk_prefetcher );
+
+int libewf_chunk_prefetcher_set_maximum_window(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     int maximum_window,
+     libcerror_error_t **error );
+
+int libewf_chunk_prefetcher_get_number_of_prefetched_chunks(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     uint64_t *number_of_prefetched_chunks,
+     libcerror_error_t **error );
+
+int libewf_chunk_prefetcher_read_chunks(
+     libewf_chunk_prefetcher_t *chunk_prefetcher,
+     uint64_t first_chunk_index,
+     uint64_t last_chunk_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_PREFETCHER_H ) */
+
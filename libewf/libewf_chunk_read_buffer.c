@@ -0,0 +1,579 @@
+/*
+ * Chunk read buffer functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_read_buffer.h"
+#include "libewf_definitions.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libfdata.h"
+
+/* Creates a chunk read buffer
+ * The chunk read buffer coalesces the reads of chunks that are stored
+ * adjacent to each other in a segment file into a single read
+ * A maximum read size of 0 disables coalescing
+ * Make sure the value chunk_read_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_buffer_initialize(
+     libewf_chunk_read_buffer_t **chunk_read_buffer,
+     size_t maximum_read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_buffer_initialize";
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk read buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_read_buffer = memory_allocate_structure(
+	                      libewf_chunk_read_buffer_t );
+
+	if( *chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_read_buffer,
+	     0,
+	     sizeof( libewf_chunk_read_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_read_buffer )->maximum_read_size       = maximum_read_size;
+	( *chunk_read_buffer )->file_io_pool_entry      = -1;
+	( *chunk_read_buffer )->last_file_io_pool_entry = -1;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_read_buffer != NULL )
+	{
+		memory_free(
+		 *chunk_read_buffer );
+
+		*chunk_read_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_buffer_free(
+     libewf_chunk_read_buffer_t **chunk_read_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_buffer_free";
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_buffer != NULL )
+	{
+		/* The chunks list is referenced and not managed by the chunk read buffer
+		 */
+		if( ( *chunk_read_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *chunk_read_buffer )->data );
+		}
+		memory_free(
+		 *chunk_read_buffer );
+
+		*chunk_read_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the chunk read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_buffer_clear(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_buffer_clear";
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_read_buffer->data_size               = 0;
+	chunk_read_buffer->file_io_pool_entry      = -1;
+	chunk_read_buffer->data_offset             = 0;
+	chunk_read_buffer->last_file_io_pool_entry = -1;
+	chunk_read_buffer->last_end_offset         = 0;
+
+	return( 1 );
+}
+
+/* Sets the maximum read size
+ * A maximum read size of 0 disables coalescing
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_buffer_set_maximum_read_size(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     size_t maximum_read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_buffer_set_maximum_read_size";
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_chunk_read_buffer_clear(
+	     chunk_read_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is reallocated on the next read if it no longer matches the maximum read size
+	 */
+	if( ( chunk_read_buffer->data != NULL )
+	 && ( chunk_read_buffer->allocated_data_size != maximum_read_size ) )
+	{
+		memory_free(
+		 chunk_read_buffer->data );
+
+		chunk_read_buffer->data                = NULL;
+		chunk_read_buffer->allocated_data_size = 0;
+	}
+	chunk_read_buffer->maximum_read_size = maximum_read_size;
+
+	return( 1 );
+}
+
+/* Reads the run of adjacent chunks that starts with a specific chunk from the file IO pool
+ * The run is determined from the data ranges of the elements in the chunks list,
+ * that follow the chunk, that are stored in the same file IO pool entry, directly
+ * after each other and fit within the maximum read size
+ * Returns 1 if successful, 0 if the run only consists of the chunk itself or -1 on error
+ */
+int libewf_chunk_read_buffer_read_from_file_io_pool(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_data_offset,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libewf_chunk_read_buffer_read_from_file_io_pool";
+	size64_t element_data_size     = 0;
+	size_t read_size               = 0;
+	ssize_t read_count             = 0;
+	off64_t element_data_offset    = 0;
+	uint32_t element_data_flags    = 0;
+	int element_file_io_pool_entry = 0;
+	int element_index              = 0;
+	int number_of_elements         = 0;
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_read_buffer->chunks_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk read buffer - missing chunks list.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid chunk data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size == 0 )
+	 || ( chunk_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size >= chunk_read_buffer->maximum_read_size )
+	{
+		return( 0 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     chunk_read_buffer->chunks_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from chunks list.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = chunk_data_size;
+
+	for( element_index = chunk_read_buffer->chunks_list_index + 1;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     chunk_read_buffer->chunks_list,
+		     element_index,
+		     &element_file_io_pool_entry,
+		     &element_data_offset,
+		     &element_data_size,
+		     &element_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from chunks list.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( ( ( element_data_flags & LIBEWF_RANGE_FLAG_IS_SPARSE ) != 0 )
+		 || ( element_file_io_pool_entry != file_io_pool_entry )
+		 || ( element_data_offset != ( chunk_data_offset + (off64_t) read_size ) )
+		 || ( element_data_size == 0 )
+		 || ( element_data_size > (size64_t) ( chunk_read_buffer->maximum_read_size - read_size ) ) )
+		{
+			break;
+		}
+		read_size += (size_t) element_data_size;
+	}
+	if( read_size == chunk_data_size )
+	{
+		return( 0 );
+	}
+	if( chunk_read_buffer->allocated_data_size < read_size )
+	{
+		if( chunk_read_buffer->data != NULL )
+		{
+			memory_free(
+			 chunk_read_buffer->data );
+
+			chunk_read_buffer->allocated_data_size = 0;
+		}
+		chunk_read_buffer->data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * chunk_read_buffer->maximum_read_size );
+
+		if( chunk_read_buffer->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_read_buffer->allocated_data_size = chunk_read_buffer->maximum_read_size;
+	}
+	/* Make sure the data is not used if the read fails
+	 */
+	chunk_read_buffer->data_size          = 0;
+	chunk_read_buffer->file_io_pool_entry = -1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading %d chunks at offset: 0x%08" PRIx64 " with size: %" PRIzd " in file IO pool entry: %d.\n",
+		 function,
+		 element_index - chunk_read_buffer->chunks_list_index,
+		 chunk_data_offset,
+		 read_size,
+		 file_io_pool_entry );
+	}
+#endif
+	read_count = libbfio_pool_read_buffer_at_offset(
+		      file_io_pool,
+		      file_io_pool_entry,
+		      chunk_read_buffer->data,
+		      read_size,
+	              chunk_data_offset,
+		      error );
+
+	/* A segment file can be truncated, hence the chunks that could be read
+	 * are retained and the remaining chunks are read individually
+	 */
+	if( read_count < (ssize_t) chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO pool entry: %d.",
+		 function,
+		 chunk_data_offset,
+		 chunk_data_offset,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	chunk_read_buffer->data_size          = (size_t) read_count;
+	chunk_read_buffer->file_io_pool_entry = file_io_pool_entry;
+	chunk_read_buffer->data_offset        = chunk_data_offset;
+
+	return( 1 );
+}
+
+/* Reads chunk data by means of the chunk read buffer
+ * The chunk data is copied from the buffered data if it contains the chunk data.
+ * Otherwise if the chunk directly follows the last chunk read, the run of adjacent
+ * chunks that starts with the chunk is read into the buffer
+ * Returns 1 if successful, 0 if the chunk data should be read directly or -1 on error
+ */
+int libewf_chunk_read_buffer_read_data(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_data_offset,
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_buffer_read_data";
+	size_t data_offset    = 0;
+	int result            = 0;
+
+	if( chunk_read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid chunk data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size == 0 )
+	 || ( chunk_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_read_buffer->data_size > 0 )
+	 && ( chunk_read_buffer->file_io_pool_entry == file_io_pool_entry )
+	 && ( chunk_data_size <= chunk_read_buffer->data_size )
+	 && ( chunk_data_offset >= chunk_read_buffer->data_offset )
+	 && ( (size64_t) ( chunk_data_offset - chunk_read_buffer->data_offset ) <= (size64_t) ( chunk_read_buffer->data_size - chunk_data_size ) ) )
+	{
+		result = 1;
+	}
+	else if( ( chunk_read_buffer->chunks_list != NULL )
+	      && ( chunk_read_buffer->last_file_io_pool_entry == file_io_pool_entry )
+	      && ( chunk_read_buffer->last_end_offset == chunk_data_offset ) )
+	{
+		/* Only sequential reads are coalesced to prevent reading data
+		 * that is not needed on random access
+		 */
+		result = libewf_chunk_read_buffer_read_from_file_io_pool(
+		          chunk_read_buffer,
+		          file_io_pool,
+		          file_io_pool_entry,
+		          chunk_data_offset,
+		          chunk_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunks at offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO pool entry: %d.",
+			 function,
+			 chunk_data_offset,
+			 chunk_data_offset,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		data_offset = (size_t) ( chunk_data_offset - chunk_read_buffer->data_offset );
+
+		if( memory_copy(
+		     chunk_data,
+		     &( ( chunk_read_buffer->data )[ data_offset ] ),
+		     chunk_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	chunk_read_buffer->last_file_io_pool_entry = file_io_pool_entry;
+	chunk_read_buffer->last_end_offset         = chunk_data_offset + (off64_t) chunk_data_size;
+
+	return( result );
+}
+
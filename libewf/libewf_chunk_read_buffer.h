@@ -0,0 +1,121 @@
+/*
+ * Chunk read buffer functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_READ_BUFFER_H )
+#define _LIBEWF_CHUNK_READ_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_chunk_read_buffer libewf_chunk_read_buffer_t;
+
+struct libewf_chunk_read_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The maximum read size
+	 */
+	size_t maximum_read_size;
+
+	/* The file IO pool entry the data was read from
+	 */
+	int file_io_pool_entry;
+
+	/* The offset the data was read from
+	 */
+	off64_t data_offset;
+
+	/* The chunks list of the chunk that is being read
+	 */
+	libfdata_list_t *chunks_list;
+
+	/* The index of the chunk that is being read in the chunks list
+	 */
+	int chunks_list_index;
+
+	/* The file IO pool entry of the last chunk read
+	 */
+	int last_file_io_pool_entry;
+
+	/* The end offset of the last chunk read
+	 */
+	off64_t last_end_offset;
+};
+
+int libewf_chunk_read_buffer_initialize(
+     libewf_chunk_read_buffer_t **chunk_read_buffer,
+     size_t maximum_read_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_buffer_free(
+     libewf_chunk_read_buffer_t **chunk_read_buffer,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_buffer_clear(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_buffer_set_maximum_read_size(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     size_t maximum_read_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_buffer_read_from_file_io_pool(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_data_offset,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_buffer_read_data(
+     libewf_chunk_read_buffer_t *chunk_read_buffer,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t chunk_data_offset,
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_READ_BUFFER_H ) */
+
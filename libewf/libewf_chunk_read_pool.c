@@ -0,0 +1,808 @@
+/*
+ * Chunk read pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_read_pool.h"
+#include "libewf_chunk_table.h"
+#include "libewf_definitions.h"
+#include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+#include "libewf_segment_table.h"
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Creates a chunk read pool
+ * The chunk read pool reads and unpacks the chunks of a single large read
+ * on worker threads, each chunk is copied into its position in the buffer of the read
+ * Make sure the value chunk_read_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_pool_initialize(
+     libewf_chunk_read_pool_t **chunk_read_pool,
+     int number_of_threads,
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_pool_initialize";
+
+	if( chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk read pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEWF_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_read_pool = memory_allocate_structure(
+	                    libewf_chunk_read_pool_t );
+
+	if( *chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk read pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_read_pool,
+	     0,
+	     sizeof( libewf_chunk_read_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk read pool.",
+		 function );
+
+		memory_free(
+		 *chunk_read_pool );
+
+		*chunk_read_pool = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_read_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *chunk_read_pool )->entry_read_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry read condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_read_pool )->chunk_table   = chunk_table;
+	( *chunk_read_pool )->io_handle     = io_handle;
+	( *chunk_read_pool )->file_io_pool  = file_io_pool;
+	( *chunk_read_pool )->media_values  = media_values;
+	( *chunk_read_pool )->segment_table = segment_table;
+
+	/* Allow for a multitude of the number of threads so that the workers
+	 * do not run idle while the entries of a read are being queued
+	 */
+	( *chunk_read_pool )->maximum_number_of_entries = 4 * number_of_threads;
+
+	if( libcthreads_thread_pool_create(
+	     &( ( *chunk_read_pool )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     ( *chunk_read_pool )->maximum_number_of_entries,
+	     (int (*)(intptr_t *, void *)) &libewf_chunk_read_pool_read_entry_callback,
+	     (void *) *chunk_read_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_read_pool != NULL )
+	{
+		if( ( *chunk_read_pool )->entry_read_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *chunk_read_pool )->entry_read_condition ),
+			 NULL );
+		}
+		if( ( *chunk_read_pool )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *chunk_read_pool )->mutex ),
+			 NULL );
+		}
+		memory_free(
+		 *chunk_read_pool );
+
+		*chunk_read_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk read pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_pool_free(
+     libewf_chunk_read_pool_t **chunk_read_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_read_pool_free";
+	int result            = 1;
+
+	if( chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_pool != NULL )
+	{
+		if( ( *chunk_read_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *chunk_read_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *chunk_read_pool )->entry_read_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry read condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_read_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *chunk_read_pool );
+
+		*chunk_read_pool = NULL;
+	}
+	return( result );
+}
+
+/* Reads the chunk data of an entry
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_pool_read_entry_callback(
+     libewf_chunk_read_pool_entry_t *entry,
+     libewf_chunk_read_pool_t *chunk_read_pool )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libewf_chunk_read_pool_read_entry_callback";
+	ssize_t read_count       = 0;
+	uint8_t state            = LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_READ;
+	int result               = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk table serializes the file IO and the chunk cache updates
+	 * hence the chunk data of different entries is unpacked concurrently
+	 */
+	if( chunk_read_pool->io_handle->abort == 0 )
+	{
+		read_count = libewf_chunk_table_read_buffer_at_offset(
+		              chunk_read_pool->chunk_table,
+		              chunk_read_pool->io_handle,
+		              chunk_read_pool->file_io_pool,
+		              chunk_read_pool->media_values,
+		              chunk_read_pool->segment_table,
+		              entry->buffer,
+		              entry->buffer_size,
+		              entry->offset,
+		              &error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry->offset,
+			 entry->offset );
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+
+			read_count = 0;
+			state      = LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_FAILED;
+			result     = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_read_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	entry->read_count = read_count;
+	entry->state      = state;
+
+	*( entry->number_of_pending_entries ) -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     chunk_read_pool->entry_read_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast entry read condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 chunk_read_pool->mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     chunk_read_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Waits until the queued entries of a read have been read
+ * The entries that were not queued are removed from the number of pending entries
+ * The worker threads reference the entries until they have been read, hence a failure
+ * to wait is retried and only reported after the queued entries have been read
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_read_pool_wait_for_entries(
+     libewf_chunk_read_pool_t *chunk_read_pool,
+     int *number_of_pending_entries,
+     int number_of_unqueued_entries,
+     libcerror_error_t **error )
+{
+	libcerror_error_t **wait_error = error;
+	static char *function          = "libewf_chunk_read_pool_wait_for_entries";
+	int remaining_entries          = 0;
+	int result                     = 1;
+
+	if( chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pending_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pending entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_unqueued_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of unqueued entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libcthreads_mutex_grab(
+		     chunk_read_pool->mutex,
+		     wait_error ) != 1 )
+		{
+			libcerror_error_set(
+			 wait_error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			/* Only the first failure is reported
+			 */
+			wait_error = NULL;
+			result     = -1;
+
+			remaining_entries = 1;
+
+			continue;
+		}
+		*number_of_pending_entries -= number_of_unqueued_entries;
+		number_of_unqueued_entries  = 0;
+
+		while( *number_of_pending_entries > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     chunk_read_pool->entry_read_condition,
+			     chunk_read_pool->mutex,
+			     wait_error ) != 1 )
+			{
+				libcerror_error_set(
+				 wait_error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for entry read condition.",
+				 function );
+
+				wait_error = NULL;
+				result     = -1;
+
+				break;
+			}
+		}
+		remaining_entries = *number_of_pending_entries;
+
+		if( libcthreads_mutex_release(
+		     chunk_read_pool->mutex,
+		     wait_error ) != 1 )
+		{
+			libcerror_error_set(
+			 wait_error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			wait_error = NULL;
+			result     = -1;
+		}
+	}
+	while( remaining_entries > 0 );
+
+	return( result );
+}
+
+/* Reads (media) data at a specific offset into a buffer
+ * The read is split at the chunk boundaries and the chunks are read by the worker threads
+ * The function returns once all the queued chunks have been read, hence multiple threads
+ * can read from the same chunk read pool concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_chunk_read_pool_read_buffer_at_offset(
+         libewf_chunk_read_pool_t *chunk_read_pool,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libewf_chunk_read_pool_entry_t *entries = NULL;
+	libewf_chunk_read_pool_entry_t *entry   = NULL;
+	static char *function                   = "libewf_chunk_read_pool_read_buffer_at_offset";
+	size_t buffer_offset                    = 0;
+	size_t entries_size                     = 0;
+	size_t read_size                        = 0;
+	ssize_t read_count                      = 0;
+	uint64_t number_of_chunks               = 0;
+	uint32_t chunk_size                     = 0;
+	int entry_index                         = 0;
+	int maximum_number_of_entries           = 0;
+	int number_of_entries                   = 0;
+	int number_of_pending_entries           = 0;
+	int number_of_queued_entries            = 0;
+	int result                              = 1;
+
+	if( chunk_read_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read pool.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_size = chunk_read_pool->media_values->chunk_size;
+
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk read pool - invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	number_of_chunks = ( ( (uint64_t) offset % chunk_size ) + buffer_size + chunk_size - 1 ) / chunk_size;
+
+	maximum_number_of_entries = chunk_read_pool->maximum_number_of_entries;
+
+	if( number_of_chunks < (uint64_t) maximum_number_of_entries )
+	{
+		maximum_number_of_entries = (int) number_of_chunks;
+	}
+	entries_size = sizeof( libewf_chunk_read_pool_entry_t ) * maximum_number_of_entries;
+
+	entries = (libewf_chunk_read_pool_entry_t *) memory_allocate(
+	                                              entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_size > 0 )
+	{
+		if( chunk_read_pool->io_handle->abort != 0 )
+		{
+			break;
+		}
+		/* The entries are not queued yet hence the worker threads do not reference
+		 * the number of pending entries
+		 */
+		number_of_entries = 0;
+
+		while( ( buffer_size > 0 )
+		    && ( number_of_entries < maximum_number_of_entries ) )
+		{
+			read_size = (size_t) ( chunk_size - ( (uint64_t) offset % chunk_size ) );
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+			entry = &( entries[ number_of_entries ] );
+
+			entry->offset                    = offset;
+			entry->buffer                    = &( buffer[ buffer_offset ] );
+			entry->buffer_size               = read_size;
+			entry->read_count                = 0;
+			entry->number_of_pending_entries = &number_of_pending_entries;
+			entry->state                     = LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_PENDING;
+
+			offset        += (off64_t) read_size;
+			buffer_offset += read_size;
+			buffer_size   -= read_size;
+
+			number_of_entries++;
+		}
+		number_of_pending_entries = number_of_entries;
+
+		for( number_of_queued_entries = 0;
+		     number_of_queued_entries < number_of_entries;
+		     number_of_queued_entries++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     chunk_read_pool->thread_pool,
+			     (intptr_t *) &( entries[ number_of_queued_entries ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push entry: %d onto thread pool queue.",
+				 function,
+				 number_of_queued_entries );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* The entries and the buffer are referenced by the worker threads
+		 * until all the queued entries have been read
+		 */
+		if( libewf_chunk_read_pool_wait_for_entries(
+		     chunk_read_pool,
+		     &number_of_pending_entries,
+		     number_of_entries - number_of_queued_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for queued entries.",
+			 function );
+
+			result = -1;
+		}
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_queued_entries;
+		     entry_index++ )
+		{
+			entry = &( entries[ entry_index ] );
+
+			if( entry->state == LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_FAILED )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 entry->offset,
+				 entry->offset );
+
+				goto on_error;
+			}
+			read_count += entry->read_count;
+
+			/* Stop at the first short read since the data that follows it is not contiguous
+			 */
+			if( (size_t) entry->read_count < entry->buffer_size )
+			{
+				buffer_size = 0;
+
+				break;
+			}
+		}
+	}
+	memory_free(
+	 entries );
+
+	return( read_count );
+
+on_error:
+	memory_free(
+	 entries );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,157 @@
+/*
+ * Chunk read pool functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_READ_POOL_H )
+#define _LIBEWF_CHUNK_READ_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_table.h"
+#include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+#include "libewf_segment_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+enum LIBEWF_CHUNK_READ_POOL_ENTRY_STATES
+{
+	LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_PENDING	= 0,
+	LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_READ		= 1,
+	LIBEWF_CHUNK_READ_POOL_ENTRY_STATE_FAILED	= 2
+};
+
+typedef struct libewf_chunk_read_pool_entry libewf_chunk_read_pool_entry_t;
+
+struct libewf_chunk_read_pool_entry
+{
+	/* The (media) offset
+	 */
+	off64_t offset;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The read count
+	 */
+	ssize_t read_count;
+
+	/* The number of pending entries of the read the entry is part of
+	 */
+	int *number_of_pending_entries;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libewf_chunk_read_pool libewf_chunk_read_pool_t;
+
+struct libewf_chunk_read_pool
+{
+	/* The chunk table
+	 */
+	libewf_chunk_table_t *chunk_table;
+
+	/* The IO handle
+	 */
+	libewf_io_handle_t *io_handle;
+
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The media values
+	 */
+	libewf_media_values_t *media_values;
+
+	/* The segment table
+	 */
+	libewf_segment_table_t *segment_table;
+
+	/* The maximum number of entries of a single read that are queued at the same time
+	 */
+	int maximum_number_of_entries;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when an entry has been read
+	 */
+	libcthreads_condition_t *entry_read_condition;
+};
+
+int libewf_chunk_read_pool_initialize(
+     libewf_chunk_read_pool_t **chunk_read_pool,
+     int number_of_threads,
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_pool_free(
+     libewf_chunk_read_pool_t **chunk_read_pool,
+     libcerror_error_t **error );
+
+int libewf_chunk_read_pool_read_entry_callback(
+     libewf_chunk_read_pool_entry_t *entry,
+     libewf_chunk_read_pool_t *chunk_read_pool );
+
+int libewf_chunk_read_pool_wait_for_entries(
+     libewf_chunk_read_pool_t *chunk_read_pool,
+     int *number_of_pending_entries,
+     int number_of_unqueued_entries,
+     libcerror_error_t **error );
+
+ssize_t libewf_chunk_read_pool_read_buffer_at_offset(
+         libewf_chunk_read_pool_t *chunk_read_pool,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_READ_POOL_H ) */
+
@@ -24,13 +24,17 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libewf_chunk_cache.h"
 #include "libewf_chunk_data.h"
+#include "libewf_chunk_data_pool.h"
 #include "libewf_chunk_group.h"
+#include "libewf_chunk_read_buffer.h"
 #include "libewf_chunk_table.h"
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
 #include "libewf_segment_file.h"
@@ -154,13 +158,101 @@ int libewf_chunk_table_initialize(
 
 		goto on_error;
 	}
+	if( libewf_chunk_cache_initialize(
+	     &( ( *chunk_table )->chunk_cache ),
+	     LIBEWF_DEFAULT_MAXIMUM_CHUNK_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_chunk_data_pool_initialize(
+	     &( ( *chunk_table )->chunk_data_pool ),
+	     LIBEWF_MAXIMUM_NUMBER_OF_POOLED_CHUNK_DATA,
+	     LIBEWF_MAXIMUM_NUMBER_OF_THREADS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk data pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_chunk_read_buffer_initialize(
+	     &( ( *chunk_table )->chunk_read_buffer ),
+	     LIBEWF_DEFAULT_MAXIMUM_COALESCED_READ_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk read buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *chunk_table )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *chunk_table )->io_handle = io_handle;
 
+	/* The chunk data read by the chunk groups is retrieved from the pool
+	 * and read by means of the chunk read buffer of the IO handle
+	 */
+	io_handle->chunk_data_pool   = ( *chunk_table )->chunk_data_pool;
+	io_handle->chunk_read_buffer = ( *chunk_table )->chunk_read_buffer;
+
 	return( 1 );
 
 on_error:
 	if( *chunk_table != NULL )
 	{
+		if( ( *chunk_table )->chunk_read_buffer != NULL )
+		{
+			libewf_chunk_read_buffer_free(
+			 &( ( *chunk_table )->chunk_read_buffer ),
+			 NULL );
+		}
+		if( ( *chunk_table )->chunk_data_pool != NULL )
+		{
+			libewf_chunk_data_pool_free(
+			 &( ( *chunk_table )->chunk_data_pool ),
+			 NULL );
+		}
+		if( ( *chunk_table )->chunk_cache != NULL )
+		{
+			libewf_chunk_cache_free(
+			 &( ( *chunk_table )->chunk_cache ),
+			 NULL );
+		}
+		if( ( *chunk_table )->single_chunk_data_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *chunk_table )->single_chunk_data_cache ),
+			 NULL );
+		}
 		if( ( *chunk_table )->chunk_data_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -198,6 +290,21 @@ int libewf_chunk_table_free(
 	}
 	if( *chunk_table != NULL )
 	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *chunk_table )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( libcdata_range_list_free(
 		     &( ( *chunk_table )->checksum_errors ),
 		     NULL,
@@ -238,6 +345,64 @@ int libewf_chunk_table_free(
 
 			result = -1;
 		}
+		if( libewf_chunk_cache_free(
+		     &( ( *chunk_table )->chunk_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk cache.",
+			 function );
+
+			result = -1;
+		}
+		/* The chunk data pool is freed after the caches since these return
+		 * the chunk data they contain to the pool
+		 */
+		if( ( *chunk_table )->chunk_data_pool != NULL )
+		{
+			if( ( ( *chunk_table )->io_handle != NULL )
+			 && ( ( *chunk_table )->io_handle->chunk_data_pool == ( *chunk_table )->chunk_data_pool ) )
+			{
+				( *chunk_table )->io_handle->chunk_data_pool = NULL;
+			}
+			if( libewf_chunk_data_pool_free(
+			     &( ( *chunk_table )->chunk_data_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk data pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunk_table )->chunk_read_buffer != NULL )
+		{
+			if( ( ( *chunk_table )->io_handle != NULL )
+			 && ( ( *chunk_table )->io_handle->chunk_read_buffer == ( *chunk_table )->chunk_read_buffer ) )
+			{
+				( *chunk_table )->io_handle->chunk_read_buffer = NULL;
+			}
+			if( libewf_chunk_read_buffer_free(
+			     &( ( *chunk_table )->chunk_read_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk read buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *chunk_table );
 
@@ -322,6 +487,17 @@ int libewf_chunk_table_clone(
 	( *destination_chunk_table )->checksum_errors         = NULL;
 	( *destination_chunk_table )->chunk_data_cache        = NULL;
 	( *destination_chunk_table )->single_chunk_data_cache = NULL;
+	( *destination_chunk_table )->chunk_cache             = NULL;
+
+	/* The destination shares the IO handle of the source and hence reads
+	 * chunk data without a chunk data pool and chunk read buffer of its own
+	 */
+	( *destination_chunk_table )->chunk_data_pool         = NULL;
+	( *destination_chunk_table )->chunk_read_buffer       = NULL;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	( *destination_chunk_table )->read_write_lock         = NULL;
+#endif
 
 	if( libcdata_range_list_clone(
 	     &( ( *destination_chunk_table )->checksum_errors ),
@@ -367,11 +543,52 @@ int libewf_chunk_table_clone(
 
 		goto on_error;
 	}
+	if( libewf_chunk_cache_clone(
+	     &( ( *destination_chunk_table )->chunk_cache ),
+	     source_chunk_table->chunk_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *destination_chunk_table )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *destination_chunk_table != NULL )
 	{
+		if( ( *destination_chunk_table )->chunk_cache != NULL )
+		{
+			libewf_chunk_cache_free(
+			 &( ( *destination_chunk_table )->chunk_cache ),
+			 NULL );
+		}
+		if( ( *destination_chunk_table )->single_chunk_data_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *destination_chunk_table )->single_chunk_data_cache ),
+			 NULL );
+		}
 		if( ( *destination_chunk_table )->chunk_data_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -393,16 +610,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of checksum errors
+/* Retrieves the maximum (unpacked) chunk cache size
  * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_number_of_checksum_errors(
+int libewf_chunk_table_get_maximum_cache_size(
      libewf_chunk_table_t *chunk_table,
-     uint32_t *number_of_errors,
+     size64_t *maximum_cache_size,
      libcerror_error_t **error )
 {
-	static char *function  = "libewf_chunk_table_get_number_of_checksum_errors";
-	int number_of_elements = 0;
+	static char *function = "libewf_chunk_table_get_maximum_cache_size";
+	int result            = 1;
 
 	if( chunk_table == NULL )
 	{
@@ -415,48 +632,63 @@ int libewf_chunk_table_get_number_of_checksum_errors(
 
 		return( -1 );
 	}
-	if( number_of_errors == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of errors.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_range_list_get_number_of_elements(
-	     chunk_table->checksum_errors,
-	     &number_of_elements,
+#endif
+	if( libewf_chunk_cache_get_maximum_cache_size(
+	     chunk_table->chunk_cache,
+	     maximum_cache_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from range list.",
+		 "%s: unable to retrieve maximum cache size.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	*number_of_errors = (uint32_t) number_of_elements;
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Retrieves a checksum error
+/* Sets the maximum (unpacked) chunk cache size
  * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_checksum_error(
+int libewf_chunk_table_set_maximum_cache_size(
      libewf_chunk_table_t *chunk_table,
-     uint32_t error_index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
+     size64_t maximum_cache_size,
      libcerror_error_t **error )
 {
-	static char *function = "libewf_chunk_table_get_checksum_error";
-	intptr_t *value       = NULL;
+	static char *function = "libewf_chunk_table_set_maximum_cache_size";
+	int result            = 1;
 
 	if( chunk_table == NULL )
 	{
@@ -469,93 +701,64 @@ int libewf_chunk_table_get_checksum_error(
 
 		return( -1 );
 	}
-	if( libcdata_range_list_get_range_by_index(
-	     chunk_table->checksum_errors,
-	     (int) error_index,
-	     start_sector,
-	     number_of_sectors,
-	     &value,
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve checksum error: %" PRIu32 " from range list.",
-		 function,
-		 error_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Appends a checksum error
- * Returns 1 if successful or -1 on error
- */
-int libewf_chunk_table_append_checksum_error(
-     libewf_chunk_table_t *chunk_table,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     libcerror_error_t **error )
-{
-	static char *function = "libewf_chunk_table_append_checksum_error";
-	int result            = 0;
-
-	if( chunk_table == NULL )
+#endif
+	if( libewf_chunk_cache_set_maximum_cache_size(
+	     chunk_table->chunk_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk table.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	result = libcdata_range_list_insert_range(
-	          chunk_table->checksum_errors,
-	          start_sector,
-	          number_of_sectors,
-	          NULL,
-	          NULL,
-	          NULL,
-	          error );
-
-	if( result == -1 )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert checksum error in range list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the chunk group in a segment file at a specific offset
- * Returns 1 if successful, 0 if not or -1 on error
+/* Sets the maximum size of a coalesced read of adjacent chunks
+ * A maximum read size of 0 disables coalescing
+ * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+int libewf_chunk_table_set_maximum_coalesced_read_size(
      libewf_chunk_table_t *chunk_table,
-     libbfio_pool_t *file_io_pool,
-     libewf_segment_table_t *segment_table,
-     off64_t offset,
-     uint32_t *segment_number,
-     int *chunk_groups_list_index,
-     off64_t *chunk_group_data_offset,
-     libewf_chunk_group_t **chunk_group,
+     size64_t maximum_read_size,
      libcerror_error_t **error )
 {
-	libewf_segment_file_t *segment_file  = NULL;
-	static char *function                = "libewf_chunk_table_get_segment_file_chunk_group_by_offset";
-	off64_t safe_chunk_group_data_offset = 0;
-	off64_t segment_file_data_offset     = 0;
-	uint32_t safe_segment_number         = 0;
-	int result                           = 0;
+	static char *function = "libewf_chunk_table_set_maximum_coalesced_read_size";
+	int result            = 1;
 
 	if( chunk_table == NULL )
 	{
@@ -568,161 +771,1389 @@ int libewf_chunk_table_get_segment_file_chunk_group_by_offset(
 
 		return( -1 );
 	}
-	if( segment_number == NULL )
+	if( maximum_read_size > (size64_t) LIBEWF_MAXIMUM_COALESCED_READ_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment number.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_groups_list_index == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk groups list index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_group_data_offset == NULL )
+#endif
+	if( chunk_table->chunk_read_buffer != NULL )
+	{
+		if( libewf_chunk_read_buffer_set_maximum_read_size(
+		     chunk_table->chunk_read_buffer,
+		     (size_t) maximum_read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum read size in chunk read buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk group data offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_group == NULL )
+#endif
+	return( result );
+}
+
+/* Retrieves the (unpacked) chunk cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_cache_statistics(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_get_cache_statistics";
+	int result            = 1;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_chunk_cache_get_statistics(
+	     chunk_table->chunk_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     number_of_evictions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of (unpacked) chunk cache hits of prefetched chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_number_of_prefetch_hits(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t *number_of_prefetch_hits,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_get_number_of_prefetch_hits";
+	int result            = 1;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_chunk_cache_get_number_of_prefetch_hits(
+	     chunk_table->chunk_cache,
+	     number_of_prefetch_hits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of prefetch hits.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of checksum errors
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_number_of_checksum_errors(
+     libewf_chunk_table_t *chunk_table,
+     uint32_t *number_of_errors,
+     libcerror_error_t **error )
+{
+	static char *function  = "libewf_chunk_table_get_number_of_checksum_errors";
+	int number_of_elements = 0;
+	int result             = 1;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of errors.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_range_list_get_number_of_elements(
+	     chunk_table->checksum_errors,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from range list.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_errors = (uint32_t) number_of_elements;
+	}
+	return( result );
+}
+
+/* Retrieves a checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_checksum_error(
+     libewf_chunk_table_t *chunk_table,
+     uint32_t error_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_get_checksum_error";
+	intptr_t *value       = NULL;
+	int result            = 1;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_range_list_get_range_by_index(
+	     chunk_table->checksum_errors,
+	     (int) error_index,
+	     start_sector,
+	     number_of_sectors,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checksum error: %" PRIu32 " from range list.",
+		 function,
+		 error_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends a checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_append_checksum_error(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_table_append_checksum_error";
+	int result            = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_range_list_insert_range(
+	          chunk_table->checksum_errors,
+	          start_sector,
+	          number_of_sectors,
+	          NULL,
+	          NULL,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert checksum error in range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the chunk group in a segment file at a specific offset
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     libbfio_pool_t *file_io_pool,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     uint32_t *segment_number,
+     int *chunk_groups_list_index,
+     off64_t *chunk_group_data_offset,
+     libewf_chunk_group_t **chunk_group,
+     libcerror_error_t **error )
+{
+	libewf_segment_file_t *segment_file  = NULL;
+	static char *function                = "libewf_chunk_table_get_segment_file_chunk_group_by_offset";
+	off64_t safe_chunk_group_data_offset = 0;
+	off64_t segment_file_data_offset     = 0;
+	uint32_t safe_segment_number         = 0;
+	int result                           = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment number.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_groups_list_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk groups list index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_table->current_chunk_group != NULL )
+	 && ( chunk_table->current_chunk_group->range_end_offset > 0 ) )
+	{
+		if( ( offset >= chunk_table->current_chunk_group->range_start_offset )
+		 && ( offset < chunk_table->current_chunk_group->range_end_offset ) )
+		{
+			safe_chunk_group_data_offset = offset - chunk_table->current_chunk_group->range_start_offset;
+
+			result = 1;
+		}
+	}
+	if( result == 0 )
+	{
+		result = libewf_segment_table_get_segment_file_at_offset(
+		          segment_table,
+		          offset,
+		          file_io_pool,
+		          &safe_segment_number,
+		          &segment_file_data_offset,
+		          &segment_file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+/* TODO handle missing segment file */
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: missing segment file for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else
+		{
+			result = libewf_segment_file_get_chunk_group_by_offset(
+				  segment_file,
+				  file_io_pool,
+				  segment_file_data_offset,
+				  &( chunk_table->current_chunk_group_index ),
+				  &safe_chunk_group_data_offset,
+				  &( chunk_table->current_chunk_group ),
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk group from segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 safe_segment_number,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		*segment_number          = safe_segment_number;
+		*chunk_groups_list_index = chunk_table->current_chunk_group_index;
+		*chunk_group_data_offset = safe_chunk_group_data_offset;
+		*chunk_group             = chunk_table->current_chunk_group;
+	}
+	return( result );
+}
+
+/* Retrieves the chunk data of a chunk at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_data_cache,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     off64_t *chunk_data_offset,
+     libewf_chunk_data_t **chunk_data,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libewf_chunk_group_t *chunk_group = NULL;
+	static char *function             = "libewf_chunk_table_get_segment_file_chunk_data_by_offset";
+	off64_t chunk_group_data_offset   = 0;
+	off64_t safe_chunk_data_offset    = 0;
+	uint64_t chunk_index              = 0;
+	uint32_t segment_number           = 0;
+	int chunk_groups_list_index       = 0;
+	int chunks_list_index             = 0;
+	int result                        = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_table->current_chunk_data != NULL )
+	 && ( chunk_table->current_chunk_data->range_end_offset > 0 ) )
+	{
+		if( ( offset >= chunk_table->current_chunk_data->range_start_offset )
+		 && ( offset < chunk_table->current_chunk_data->range_end_offset ) )
+		{
+			safe_chunk_data_offset = offset - chunk_table->current_chunk_data->range_start_offset;
+
+			result = 1;
+		}
+	}
+	if( result == 0 )
+	{
+		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+			  chunk_table,
+			  file_io_pool,
+			  segment_table,
+			  offset,
+			  &segment_number,
+			  &chunk_groups_list_index,
+			  &chunk_group_data_offset,
+			  &chunk_group,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file chunk group for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( result != 0 )
+		{
+			if( chunk_group == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk group: %d.",
+				 function,
+				 chunk_groups_list_index );
+
+				return( -1 );
+			}
+			chunk_index            = (uint64_t) offset / media_values->chunk_size;
+			chunks_list_index      = (int) ( chunk_group_data_offset / media_values->chunk_size );
+			safe_chunk_data_offset = chunk_group_data_offset - ( (off64_t) chunks_list_index * media_values->chunk_size );
+
+			/* The chunk read buffer is only used for images opened for reading only
+			 * since the chunks in a segment file can be rewritten
+			 */
+			if( ( chunk_table->chunk_read_buffer != NULL )
+			 && ( ( io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+			{
+				chunk_table->chunk_read_buffer->chunks_list       = chunk_group->chunks_list;
+				chunk_table->chunk_read_buffer->chunks_list_index = chunks_list_index;
+			}
+			result = libfdata_list_get_element_value_by_index(
+			          chunk_group->chunks_list,
+			          (intptr_t *) file_io_pool,
+			          (libfdata_cache_t *) chunk_data_cache,
+			          chunks_list_index,
+			          (intptr_t **) &( chunk_table->current_chunk_data ),
+			          read_flags,
+			          error );
+
+			if( chunk_table->chunk_read_buffer != NULL )
+			{
+				chunk_table->chunk_read_buffer->chunks_list = NULL;
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from chunk group: %d in segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_index,
+				 chunk_groups_list_index,
+				 segment_number,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			if( chunk_table->current_chunk_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk data: %" PRIu64 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			chunk_table->current_chunk_data->chunk_index = chunk_index;
+
+			if( libfdata_list_get_element_mapped_range(
+			     chunk_group->chunks_list,
+			     chunks_list_index,
+			     &( chunk_table->current_chunk_data->range_start_offset ),
+			     (size64_t *) &( chunk_table->current_chunk_data->range_end_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve list element: %d mapped range for chunk group: %d in segment file: %" PRIu32 ".",
+				 function,
+				 chunks_list_index,
+				 chunk_groups_list_index,
+				 segment_number );
+
+				return( -1 );
+			}
+			chunk_table->current_chunk_data->range_start_offset += chunk_table->current_chunk_group->range_start_offset;
+			chunk_table->current_chunk_data->range_end_offset   += chunk_table->current_chunk_data->range_start_offset;
+
+			if( (size64_t) chunk_table->current_chunk_data->range_end_offset > media_values->media_size )
+			{
+				chunk_table->current_chunk_data->range_end_offset = (off64_t) media_values->media_size;
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		*chunk_data_offset = safe_chunk_data_offset;
+		*chunk_data        = chunk_table->current_chunk_data;
+	}
+	return( result );
+}
+
+/* Retrieves the chunk data of a chunk at a specific offset
+ * Adds a checksum error if the data is corrupted
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_chunk_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     off64_t *chunk_data_offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *safe_chunk_data = NULL;
+	static char *function                = "libewf_chunk_table_get_chunk_data_by_offset";
+	off64_t safe_chunk_data_offset       = 0;
+	uint64_t chunk_index                 = 0;
+	uint64_t number_of_sectors           = 0;
+	uint64_t start_sector                = 0;
+	int result                           = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_segment_file_chunk_data_by_offset(
+		  chunk_table,
+		  io_handle,
+		  file_io_pool,
+	          chunk_table->chunk_data_cache,
+		  media_values,
+		  segment_table,
+		  offset,
+		  &safe_chunk_data_offset,
+		  &safe_chunk_data,
+		  0,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment file chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libewf_chunk_data_unpack(
+		     safe_chunk_data,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unpack chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( ( safe_chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			/* Add checksum error
+			 */
+			start_sector      = safe_chunk_data->range_start_offset / media_values->bytes_per_sector;
+			number_of_sectors = media_values->sectors_per_chunk;
+
+			if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
+			{
+				number_of_sectors = (uint64_t) media_values->number_of_sectors - start_sector;
+			}
+			if( libcdata_range_list_insert_range(
+			     chunk_table->checksum_errors,
+			     start_sector,
+			     number_of_sectors,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert checksum error in range list.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		*chunk_data_offset = safe_chunk_data_offset;
+		*chunk_data        = safe_chunk_data;
+	}
+	return( result );
+}
+
+/* Reads (media) data of the chunk at a specific offset into a buffer
+ * At most the remainder of the chunk from the offset is read
+ * Only the chunk cache lookup and update are done while holding the chunk table lock,
+ * a chunk that is not cached is read and unpacked without holding the lock so that
+ * decompression of different chunks by multiple threads can run concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_chunk_table_read_buffer_at_offset(
+         libewf_chunk_table_t *chunk_table,
+         libewf_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         libewf_media_values_t *media_values,
+         libewf_segment_table_t *segment_table,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data          = NULL;
+	libewf_chunk_data_t *unpacked_chunk_data = NULL;
+	static char *function                    = "libewf_chunk_table_read_buffer_at_offset";
+	off64_t chunk_data_offset                = 0;
+	ssize_t read_count                       = 0;
+	uint64_t chunk_index                     = 0;
+	uint64_t number_of_sectors               = 0;
+	uint64_t start_sector                    = 0;
+	int result                               = 0;
+
+	if( chunk_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk groups.",
+		 "%s: invalid chunk table.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( chunk_table->current_chunk_group != NULL )
-	 && ( chunk_table->current_chunk_group->range_end_offset > 0 ) )
+	if( media_values == NULL )
 	{
-		if( ( offset >= chunk_table->current_chunk_group->range_start_offset )
-		 && ( offset < chunk_table->current_chunk_group->range_end_offset ) )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = (uint64_t) offset / media_values->chunk_size;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_cache_get_chunk_data(
+	          chunk_table->chunk_cache,
+	          chunk_index,
+	          &chunk_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " data from cache.",
+		 function,
+		 chunk_index );
+	}
+	else if( result != 0 )
+	{
+		chunk_data_offset = offset - chunk_data->range_start_offset;
+
+		read_count = libewf_chunk_data_read_buffer_at_offset(
+		              chunk_data,
+		              chunk_data_offset,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
 		{
-			safe_chunk_group_data_offset = offset - chunk_table->current_chunk_group->range_start_offset;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
 
-			result = 1;
+			result = -1;
 		}
+		chunk_data = NULL;
 	}
-	if( result == 0 )
+	else
 	{
-		result = libewf_segment_table_get_segment_file_at_offset(
+		/* The chunk data is read without being cached by the chunk groups
+		 * and is managed here until it has been unpacked
+		 */
+		result = libewf_chunk_table_get_chunk_data_by_offset_no_cache(
+		          chunk_table,
+		          io_handle,
+		          file_io_pool,
+		          media_values,
 		          segment_table,
 		          offset,
-		          file_io_pool,
-		          &safe_segment_number,
-		          &segment_file_data_offset,
-		          &segment_file,
+		          &chunk_data_offset,
+		          &unpacked_chunk_data,
 		          error );
 
-		if( result == -1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment file for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to retrieve chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
 			 offset,
 			 offset );
 
-			return( -1 );
+			result = -1;
 		}
-		else if( result == 0 )
+		else if( unpacked_chunk_data == NULL )
 		{
-/* TODO handle missing segment file */
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: missing segment file for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
 			 offset,
 			 offset );
 
-			return( -1 );
+			result = -1;
 		}
-		else
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( unpacked_chunk_data == NULL )
+	{
+		return( read_count );
+	}
+	if( libewf_chunk_data_unpack(
+	     unpacked_chunk_data,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unpack chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              unpacked_chunk_data,
+	              chunk_data_offset,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( ( unpacked_chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		/* Add checksum error
+		 */
+		start_sector      = (uint64_t) unpacked_chunk_data->range_start_offset / media_values->bytes_per_sector;
+		number_of_sectors = media_values->sectors_per_chunk;
+
+		if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
 		{
-			result = libewf_segment_file_get_chunk_group_by_offset(
-				  segment_file,
-				  file_io_pool,
-				  segment_file_data_offset,
-				  &( chunk_table->current_chunk_group_index ),
-				  &safe_chunk_group_data_offset,
-				  &( chunk_table->current_chunk_group ),
-				  error );
+			number_of_sectors = (uint64_t) media_values->number_of_sectors - start_sector;
+		}
+		if( libcdata_range_list_insert_range(
+		     chunk_table->checksum_errors,
+		     start_sector,
+		     number_of_sectors,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert checksum error in range list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		/* Another thread could have inserted the same chunk in the meantime
+		 * in which case the chunk data is not inserted
+		 */
+		result = libewf_chunk_cache_insert_chunk_data(
+		          chunk_table->chunk_cache,
+		          chunk_index,
+		          unpacked_chunk_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert chunk: %" PRIu64 " data in cache.",
+			 function,
+			 chunk_index );
+		}
+		else if( result != 0 )
+		{
+			unpacked_chunk_data = NULL;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk group from segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 safe_segment_number,
-				 offset,
-				 offset );
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( unpacked_chunk_data != NULL )
+	{
+		if( libewf_chunk_data_free(
+		     &unpacked_chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unpacked chunk data.",
+			 function );
 
-				return( -1 );
-			}
+			goto on_error;
 		}
 	}
-	if( result != 0 )
+	return( read_count );
+
+on_error:
+	if( unpacked_chunk_data != NULL )
 	{
-		*segment_number          = safe_segment_number;
-		*chunk_groups_list_index = chunk_table->current_chunk_group_index;
-		*chunk_group_data_offset = safe_chunk_group_data_offset;
-		*chunk_group             = chunk_table->current_chunk_group;
+		libewf_chunk_data_free(
+		 &unpacked_chunk_data,
+		 NULL );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves the chunk data of a chunk at a specific offset
+/* Retrieves a view of the (unpacked) chunk data at a specific offset
+ * The view points into the chunk data cache and remains valid until it is released
+ * The size of the view is the remainder of the chunk data from the offset
  * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
+int libewf_chunk_table_get_chunk_view(
      libewf_chunk_table_t *chunk_table,
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
-     libfcache_cache_t *chunk_data_cache,
      libewf_media_values_t *media_values,
      libewf_segment_table_t *segment_table,
      off64_t offset,
-     off64_t *chunk_data_offset,
-     libewf_chunk_data_t **chunk_data,
-     uint8_t read_flags,
+     const uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
-	libewf_chunk_group_t *chunk_group = NULL;
-	static char *function             = "libewf_chunk_table_get_segment_file_chunk_data_by_offset";
-	off64_t chunk_group_data_offset   = 0;
-	off64_t safe_chunk_data_offset    = 0;
-	uint64_t chunk_index              = 0;
-	uint32_t segment_number           = 0;
-	int chunk_groups_list_index       = 0;
-	int chunks_list_index             = 0;
-	int result                        = 0;
+	libewf_chunk_data_t *chunk_data          = NULL;
+	libewf_chunk_data_t *unpacked_chunk_data = NULL;
+	static char *function                    = "libewf_chunk_table_get_chunk_view";
+	off64_t chunk_data_offset                = 0;
+	uint64_t chunk_index                     = 0;
+	uint64_t number_of_sectors               = 0;
+	uint64_t start_sector                    = 0;
+	int result                               = 0;
 
 	if( chunk_table == NULL )
 	{
@@ -735,211 +2166,360 @@ int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_values == NULL )
+	if( media_values->chunk_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media values.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_values->chunk_size == 0 )
+	if( media_values->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid media values - chunk size value out of bounds.",
+		 "%s: invalid media values - bytes per sector value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_data_offset == NULL )
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data offset.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_data == NULL )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data.",
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( chunk_table->current_chunk_data != NULL )
-	 && ( chunk_table->current_chunk_data->range_end_offset > 0 ) )
+	chunk_index = (uint64_t) offset / media_values->chunk_size;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
 	{
-		if( ( offset >= chunk_table->current_chunk_data->range_start_offset )
-		 && ( offset < chunk_table->current_chunk_data->range_end_offset ) )
-		{
-			safe_chunk_data_offset = offset - chunk_table->current_chunk_data->range_start_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			result = 1;
-		}
+		return( -1 );
 	}
-	if( result == 0 )
+#endif
+	result = libewf_chunk_cache_pin_chunk_data(
+	          chunk_table->chunk_cache,
+	          chunk_index,
+	          &chunk_data,
+	          error );
+
+	if( result == -1 )
 	{
-		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
-			  chunk_table,
-			  file_io_pool,
-			  segment_table,
-			  offset,
-			  &segment_number,
-			  &chunk_groups_list_index,
-			  &chunk_group_data_offset,
-			  &chunk_group,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pin chunk: %" PRIu64 " data in cache.",
+		 function,
+		 chunk_index );
+	}
+	else if( result == 0 )
+	{
+		/* The chunk data is read without being cached by the chunk groups
+		 * and is managed here until it has been unpacked
+		 */
+		result = libewf_chunk_table_get_chunk_data_by_offset_no_cache(
+		          chunk_table,
+		          io_handle,
+		          file_io_pool,
+		          media_values,
+		          segment_table,
+		          offset,
+		          &chunk_data_offset,
+		          &unpacked_chunk_data,
+		          error );
 
-		if( result == -1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment file chunk group for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to retrieve chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
 			 offset,
 			 offset );
 
-			return( -1 );
+			result = -1;
 		}
-		if( result != 0 )
+		else if( unpacked_chunk_data == NULL )
 		{
-			if( chunk_group == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing chunk group: %d.",
-				 function,
-				 chunk_groups_list_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
-				return( -1 );
-			}
-			chunk_index            = (uint64_t) offset / media_values->chunk_size;
-			chunks_list_index      = (int) ( chunk_group_data_offset / media_values->chunk_size );
-			safe_chunk_data_offset = chunk_group_data_offset - ( (off64_t) chunks_list_index * media_values->chunk_size );
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			if( libfdata_list_get_element_value_by_index(
-			     chunk_group->chunks_list,
-			     (intptr_t *) file_io_pool,
-			     (libfdata_cache_t *) chunk_data_cache,
-			     chunks_list_index,
-			     (intptr_t **) &( chunk_table->current_chunk_data ),
-			     read_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu64 " data from chunk group: %d in segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 chunk_index,
-				 chunk_groups_list_index,
-				 segment_number,
-				 offset,
-				 offset );
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( unpacked_chunk_data != NULL )
+	{
+		if( libewf_chunk_data_unpack(
+		     unpacked_chunk_data,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unpack chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
 
-				return( -1 );
+			goto on_error;
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     chunk_table->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* Another thread could have inserted the same chunk in the meantime
+		 * in which case that chunk data is pinned instead
+		 */
+		result = libewf_chunk_cache_pin_chunk_data(
+		          chunk_table->chunk_cache,
+		          chunk_index,
+		          &chunk_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pin chunk: %" PRIu64 " data in cache.",
+			 function,
+			 chunk_index );
+		}
+		else if( result == 0 )
+		{
+			if( ( unpacked_chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+			{
+				/* Add checksum error
+				 */
+				start_sector      = (uint64_t) unpacked_chunk_data->range_start_offset / media_values->bytes_per_sector;
+				number_of_sectors = media_values->sectors_per_chunk;
+
+				if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
+				{
+					number_of_sectors = (uint64_t) media_values->number_of_sectors - start_sector;
+				}
+				if( libcdata_range_list_insert_range(
+				     chunk_table->checksum_errors,
+				     start_sector,
+				     number_of_sectors,
+				     NULL,
+				     NULL,
+				     NULL,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert checksum error in range list.",
+					 function );
+
+					result = -1;
+				}
 			}
-			if( chunk_table->current_chunk_data == NULL )
+			if( result != -1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing chunk data: %" PRIu64 ".",
-				 function,
-				 chunk_index );
-
-				return( -1 );
+				result = libewf_chunk_cache_insert_pinned_chunk_data(
+				          chunk_table->chunk_cache,
+				          chunk_index,
+				          unpacked_chunk_data,
+				          error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert chunk: %" PRIu64 " data in cache.",
+					 function,
+					 chunk_index );
+
+					result = -1;
+				}
+				else
+				{
+					chunk_data          = unpacked_chunk_data;
+					unpacked_chunk_data = NULL;
+				}
 			}
-			chunk_table->current_chunk_data->chunk_index = chunk_index;
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     chunk_table->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
 
-			if( libfdata_list_get_element_mapped_range(
-			     chunk_group->chunks_list,
-			     chunks_list_index,
-			     &( chunk_table->current_chunk_data->range_start_offset ),
-			     (size64_t *) &( chunk_table->current_chunk_data->range_end_offset ),
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		if( unpacked_chunk_data != NULL )
+		{
+			if( libewf_chunk_data_free(
+			     &unpacked_chunk_data,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve list element: %d mapped range for chunk group: %d in segment file: %" PRIu32 ".",
-				 function,
-				 chunks_list_index,
-				 chunk_groups_list_index,
-				 segment_number );
-
-				return( -1 );
-			}
-			chunk_table->current_chunk_data->range_start_offset += chunk_table->current_chunk_group->range_start_offset;
-			chunk_table->current_chunk_data->range_end_offset   += chunk_table->current_chunk_data->range_start_offset;
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free unpacked chunk data.",
+				 function );
 
-			if( (size64_t) chunk_table->current_chunk_data->range_end_offset > media_values->media_size )
-			{
-				chunk_table->current_chunk_data->range_end_offset = (off64_t) media_values->media_size;
+				goto on_error;
 			}
 		}
 	}
-	if( result != 0 )
+	/* The chunk data is pinned and hence is not evicted while it is accessed here
+	 */
+	chunk_data_offset = offset - chunk_data->range_start_offset;
+
+	if( ( chunk_data_offset < 0 )
+	 || ( (size_t) chunk_data_offset >= chunk_data->data_size ) )
 	{
-		*chunk_data_offset = safe_chunk_data_offset;
-		*chunk_data        = chunk_table->current_chunk_data;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk: %" PRIu64 " data offset value out of bounds.",
+		 function,
+		 chunk_index );
+
+		libewf_chunk_table_release_chunk_view(
+		 chunk_table,
+		 chunk_data->data,
+		 NULL );
+
+		goto on_error;
 	}
-	return( result );
+	*data      = &( ( chunk_data->data )[ chunk_data_offset ] );
+	*data_size = chunk_data->data_size - (size_t) chunk_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( unpacked_chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &unpacked_chunk_data,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the chunk data of a chunk at a specific offset
- * Adds a checksum error if the data is corrupted
+/* Releases a view of the (unpacked) chunk data
  * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_chunk_data_by_offset(
+int libewf_chunk_table_release_chunk_view(
      libewf_chunk_table_t *chunk_table,
-     libewf_io_handle_t *io_handle,
-     libbfio_pool_t *file_io_pool,
-     libewf_media_values_t *media_values,
-     libewf_segment_table_t *segment_table,
-     off64_t offset,
-     off64_t *chunk_data_offset,
-     libewf_chunk_data_t **chunk_data,
+     const uint8_t *data,
      libcerror_error_t **error )
 {
-	libewf_chunk_data_t *safe_chunk_data = NULL;
-	static char *function                = "libewf_chunk_table_get_chunk_data_by_offset";
-	off64_t safe_chunk_data_offset       = 0;
-	uint64_t chunk_index                 = 0;
-	uint64_t number_of_sectors           = 0;
-	uint64_t start_sector                = 0;
-	int result                           = 0;
+	static char *function = "libewf_chunk_table_release_chunk_view";
+	int result            = 0;
 
 	if( chunk_table == NULL )
 	{
@@ -952,13 +2532,93 @@ int libewf_chunk_table_get_chunk_data_by_offset(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_cache_unpin_chunk_data(
+	          chunk_table->chunk_cache,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unpin chunk data.",
+		 function );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data value out of bounds - not part of a chunk view.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Prefetches the chunk data of a specific chunk into the (unpacked) chunk cache
+ * The chunk data is read and unpacked without holding the chunk table lock
+ * so that it can overlap with reads of other chunks
+ * Returns 1 if successful, 0 if the chunk data was already cached or -1 on error
+ */
+int libewf_chunk_table_prefetch_chunk_data(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     uint64_t chunk_index,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *unpacked_chunk_data = NULL;
+	static char *function                    = "libewf_chunk_table_prefetch_chunk_data";
+	off64_t chunk_data_offset                = 0;
+	off64_t offset                           = 0;
+	uint64_t number_of_sectors               = 0;
+	uint64_t start_sector                    = 0;
+	int result                               = 0;
+
+	if( chunk_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid chunk table.",
 		 function );
 
 		return( -1 );
@@ -985,40 +2645,49 @@ int libewf_chunk_table_get_chunk_data_by_offset(
 
 		return( -1 );
 	}
-	if( chunk_data_offset == NULL )
+	if( media_values->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - bytes per sector value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_data == NULL )
+	if( chunk_index >= media_values->number_of_chunks )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	result = libewf_chunk_table_get_segment_file_chunk_data_by_offset(
-		  chunk_table,
-		  io_handle,
-		  file_io_pool,
-	          chunk_table->chunk_data_cache,
-		  media_values,
-		  segment_table,
-		  offset,
-		  &safe_chunk_data_offset,
-		  &safe_chunk_data,
-		  0,
-		  error );
+	offset = (off64_t) ( chunk_index * media_values->chunk_size );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_cache_has_chunk_data(
+	          chunk_table->chunk_cache,
+	          chunk_index,
+	          error );
 
 	if( result == -1 )
 	{
@@ -1026,35 +2695,132 @@ int libewf_chunk_table_get_chunk_data_by_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment file chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to determine if chunk: %" PRIu64 " data is cached.",
 		 function,
-		 offset,
-		 offset );
-
-		return( -1 );
+		 chunk_index );
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libewf_chunk_data_unpack(
-		     safe_chunk_data,
-		     io_handle,
-		     error ) != 1 )
+		result = libewf_chunk_table_get_chunk_data_by_offset_no_cache(
+		          chunk_table,
+		          io_handle,
+		          file_io_pool,
+		          media_values,
+		          segment_table,
+		          offset,
+		          &chunk_data_offset,
+		          &unpacked_chunk_data,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to unpack chunk: %" PRIu64 " data.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 chunk_index );
+			 offset,
+			 offset );
 
-			return( -1 );
+			result = -1;
 		}
-		if( ( safe_chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+		else if( unpacked_chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( unpacked_chunk_data == NULL )
+	{
+		return( 0 );
+	}
+	if( libewf_chunk_data_unpack(
+	     unpacked_chunk_data,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unpack chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* A consumer could have read the same chunk in the meantime
+	 * in which case the chunk data is not inserted
+	 */
+	result = libewf_chunk_cache_has_chunk_data(
+	          chunk_table->chunk_cache,
+	          chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if chunk: %" PRIu64 " data is cached.",
+		 function,
+		 chunk_index );
+	}
+	else if( result == 0 )
+	{
+		if( ( unpacked_chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
 		{
 			/* Add checksum error
 			 */
-			start_sector      = safe_chunk_data->range_start_offset / media_values->bytes_per_sector;
+			start_sector      = (uint64_t) unpacked_chunk_data->range_start_offset / media_values->bytes_per_sector;
 			number_of_sectors = media_values->sectors_per_chunk;
 
 			if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
@@ -1077,16 +2843,82 @@ int libewf_chunk_table_get_chunk_data_by_offset(
 				 "%s: unable to insert checksum error in range list.",
 				 function );
 
-				return( -1 );
+				result = -1;
+			}
+		}
+		if( result != -1 )
+		{
+			result = libewf_chunk_cache_insert_prefetched_chunk_data(
+			          chunk_table->chunk_cache,
+			          chunk_index,
+			          unpacked_chunk_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert chunk: %" PRIu64 " data in cache.",
+				 function,
+				 chunk_index );
+			}
+			else if( result != 0 )
+			{
+				unpacked_chunk_data = NULL;
 			}
 		}
 	}
-	if( result != 0 )
+	else
 	{
-		*chunk_data_offset = safe_chunk_data_offset;
-		*chunk_data        = safe_chunk_data;
+		result = 0;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( unpacked_chunk_data != NULL )
+	{
+		if( libewf_chunk_data_free(
+		     &unpacked_chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unpacked chunk data.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( result );
+
+on_error:
+	if( unpacked_chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &unpacked_chunk_data,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the chunk data of a chunk at a specific offset
@@ -1117,6 +2949,11 @@ int libewf_chunk_table_get_chunk_data_by_offset_no_cache(
 
 		return( -1 );
 	}
+	/* Make sure the chunk data is not the current chunk data that is managed
+	 * by the chunk data cache
+	 */
+	chunk_table->current_chunk_data = NULL;
+
 	result = libewf_chunk_table_get_segment_file_chunk_data_by_offset(
 		  chunk_table,
 		  io_handle,
@@ -1159,6 +2996,12 @@ int libewf_chunk_table_get_chunk_data_by_offset_no_cache(
 
 			return( -1 );
 		}
+		/* The chunk data is no longer cached and is now managed by the caller
+		 * which can outlive the chunk data pool
+		 */
+		chunk_table->current_chunk_data = NULL;
+
+		( *chunk_data )->chunk_data_pool = NULL;
 	}
 	return( result );
 }
@@ -25,10 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_chunk_cache.h"
+#include "libewf_chunk_data_pool.h"
 #include "libewf_chunk_group.h"
+#include "libewf_chunk_read_buffer.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
 #include "libewf_segment_file.h"
@@ -81,6 +85,24 @@ struct libewf_chunk_table
 	/* The single chunk data cache
 	 */
 	libfcache_cache_t *single_chunk_data_cache;
+
+	/* The (unpacked) chunk cache
+	 */
+	libewf_chunk_cache_t *chunk_cache;
+
+	/* The chunk data pool
+	 */
+	libewf_chunk_data_pool_t *chunk_data_pool;
+
+	/* The chunk read buffer
+	 */
+	libewf_chunk_read_buffer_t *chunk_read_buffer;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libewf_chunk_table_initialize(
@@ -97,6 +119,33 @@ int libewf_chunk_table_clone(
      libewf_chunk_table_t *source_chunk_table,
      libcerror_error_t **error );
 
+int libewf_chunk_table_get_maximum_cache_size(
+     libewf_chunk_table_t *chunk_table,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_set_maximum_cache_size(
+     libewf_chunk_table_t *chunk_table,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_set_maximum_coalesced_read_size(
+     libewf_chunk_table_t *chunk_table,
+     size64_t maximum_read_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_cache_statistics(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_number_of_prefetch_hits(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t *number_of_prefetch_hits,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_get_number_of_checksum_errors(
      libewf_chunk_table_t *chunk_table,
      uint32_t *number_of_errors,
@@ -150,6 +199,42 @@ int libewf_chunk_table_get_chunk_data_by_offset(
      libewf_chunk_data_t **chunk_data,
      libcerror_error_t **error );
 
+ssize_t libewf_chunk_table_read_buffer_at_offset(
+         libewf_chunk_table_t *chunk_table,
+         libewf_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         libewf_media_values_t *media_values,
+         libewf_segment_table_t *segment_table,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libewf_chunk_table_get_chunk_view(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_release_chunk_view(
+     libewf_chunk_table_t *chunk_table,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_prefetch_chunk_data(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     uint64_t chunk_index,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_get_chunk_data_by_offset_no_cache(
      libewf_chunk_table_t *chunk_table,
      libewf_io_handle_t *io_handle,
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,12 +35,1274 @@
 #include <zlib.h>
 #endif
 
+#if defined( HAVE_ZSTD )
+#include <zstd.h>
+#include <zstd_errors.h>
+#endif
+
+#if defined( HAVE_LZ4 )
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+
+#include "libewf_checksum.h"
 #include "libewf_compression.h"
 #include "libewf_definitions.h"
 #include "libewf_deflate.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
 
+/* The compression backends
+ * Only the compression methods that are supported by the build are registered
+ */
+static const libewf_compression_backend_t libewf_compression_backends[] = {
+	{ LIBEWF_COMPRESSION_METHOD_DEFLATE,
+	  "deflate",
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL )
+	  libewf_compress_data_deflate,
+#else
+	  NULL,
+#endif
+	  libewf_decompress_data_deflate },
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	{ LIBEWF_COMPRESSION_METHOD_BZIP2,
+	  "bzip2",
+	  libewf_compress_data_bzip2,
+	  libewf_decompress_data_bzip2 },
+#endif
+#if defined( HAVE_ZSTD )
+	{ LIBEWF_COMPRESSION_METHOD_ZSTD,
+	  "zstd",
+	  libewf_compress_data_zstd,
+	  libewf_decompress_data_zstd },
+#endif
+#if defined( HAVE_LZ4 )
+	{ LIBEWF_COMPRESSION_METHOD_LZ4,
+	  "lz4",
+	  libewf_compress_data_lz4,
+	  libewf_decompress_data_lz4 },
+#endif
+	{ LIBEWF_COMPRESSION_METHOD_NONE,
+	  NULL,
+	  NULL,
+	  NULL } };
+
+/* Retrieves the compression backend of a specific compression method
+ * Returns 1 if successful, 0 if no backend is registered for the compression method or -1 on error
+ */
+int libewf_compression_get_backend(
+     uint16_t compression_method,
+     const libewf_compression_backend_t **backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_get_backend";
+	int backend_index     = 0;
+
+	if( backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid backend.",
+		 function );
+
+		return( -1 );
+	}
+	*backend = NULL;
+
+	if( compression_method == LIBEWF_COMPRESSION_METHOD_NONE )
+	{
+		return( 0 );
+	}
+	while( libewf_compression_backends[ backend_index ].compression_method != LIBEWF_COMPRESSION_METHOD_NONE )
+	{
+		if( libewf_compression_backends[ backend_index ].compression_method == compression_method )
+		{
+			*backend = &( libewf_compression_backends[ backend_index ] );
+
+			return( 1 );
+		}
+		backend_index++;
+	}
+	return( 0 );
+}
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL )
+
+/* Compresses data using deflate (zlib)
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_deflate(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libewf_compress_data_deflate";
+	uLongf zlib_compressed_data_size = 0;
+	int result                       = 0;
+	int zlib_compression_level       = 0;
+
+	if( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
+	{
+		zlib_compression_level = Z_DEFAULT_COMPRESSION;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST )
+	{
+		zlib_compression_level = Z_BEST_SPEED;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+	{
+		zlib_compression_level = Z_BEST_COMPRESSION;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_NONE )
+	{
+		zlib_compression_level = Z_NO_COMPRESSION;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+#if ULONG_MAX < SSIZE_MAX
+	if( *compressed_data_size > (size_t) ULONG_MAX )
+#else
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if ULONG_MAX < SSIZE_MAX
+	if( uncompressed_data_size > (size_t) ULONG_MAX )
+#else
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	zlib_compressed_data_size = (uLongf) *compressed_data_size;
+
+	result = compress2(
+		  (Bytef *) compressed_data,
+		  &zlib_compressed_data_size,
+		  (Bytef *) uncompressed_data,
+		  (uLong) uncompressed_data_size,
+		  zlib_compression_level );
+
+	if( result == Z_OK )
+	{
+		*compressed_data_size = (size_t) zlib_compressed_data_size;
+
+		result = 1;
+	}
+	else if( result == Z_BUF_ERROR )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+#if defined( HAVE_COMPRESS_BOUND ) || defined( WINAPI )
+		/* Use compressBound to determine the size of the uncompressed buffer
+		 */
+		zlib_compressed_data_size = compressBound( (uLong) uncompressed_data_size );
+		*compressed_data_size     = (size_t) zlib_compressed_data_size;
+#else
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*compressed_data_size *= 2;
+#endif
+		result = 0;
+	}
+	else if( result == Z_MEM_ERROR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to write compressed data: insufficient memory.",
+		 function );
+
+		*compressed_data_size = 0;
+
+		result = -1;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: zlib returned undefined error: %d.",
+		 function,
+		 result );
+
+		*compressed_data_size = 0;
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL ) */
+
+/* Decompresses data using deflate (zlib)
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_decompress_data_deflate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libewf_decompress_data_deflate";
+	int result                         = 0;
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
+	uLongf zlib_uncompressed_data_size = 0;
+
+#if ULONG_MAX < SSIZE_MAX
+	if( compressed_data_size > (size_t) ULONG_MAX )
+#else
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if ULONG_MAX < SSIZE_MAX
+	if( *uncompressed_data_size > (size_t) ULONG_MAX )
+#else
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	zlib_uncompressed_data_size = (uLongf) *uncompressed_data_size;
+
+	result = uncompress(
+		  (Bytef *) uncompressed_data,
+		  &zlib_uncompressed_data_size,
+		  (Bytef *) compressed_data,
+		  (uLong) compressed_data_size );
+
+	if( result == Z_OK )
+	{
+		*uncompressed_data_size = (size_t) zlib_uncompressed_data_size;
+
+		result = 1;
+	}
+	else if( result == Z_DATA_ERROR )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read compressed data: data error.\n",
+			 function );
+		}
+#endif
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+	else if( result == Z_BUF_ERROR )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*uncompressed_data_size *= 2;
+
+		result = 0;
+	}
+	else if( result == Z_MEM_ERROR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to read compressed data: insufficient memory.",
+		 function );
+
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: zlib returned undefined error: %d.",
+		 function,
+		 result );
+
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+#else
+	result = libewf_deflate_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decompress deflate compressed data.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) */
+
+	return( result );
+}
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+
+/* Compresses data using bzip2
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_bzip2(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libewf_compress_data_bzip2";
+	unsigned int bzip2_compressed_data_size = 0;
+	int bzip2_compression_level             = 0;
+	int result                              = 0;
+
+	if( ( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
+	 || ( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST ) )
+	{
+		bzip2_compression_level = 1;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+	{
+		bzip2_compression_level = 9;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bzip2_compressed_data_size = (unsigned int) *compressed_data_size;
+
+	result = BZ2_bzBuffToBuffCompress(
+		  (char *) compressed_data,
+		  &bzip2_compressed_data_size,
+		  (char *) uncompressed_data,
+		  (unsigned int) uncompressed_data_size,
+		  bzip2_compression_level,
+		  0,
+		  30 );
+
+	if( result == BZ_OK )
+	{
+		*compressed_data_size = (size_t) bzip2_compressed_data_size;
+
+		result = 1;
+	}
+	else if( result == BZ_OUTBUFF_FULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+		 	"%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*compressed_data_size *= 2;
+
+		result = 0;
+	}
+	else if( result == BZ_MEM_ERROR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to write compressed data: insufficient memory.",
+		 function );
+
+		*compressed_data_size = 0;
+
+		result = -1;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: libbz2 returned undefined error: %d.",
+		 function,
+		 result );
+
+		*compressed_data_size = 0;
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Decompresses data using bzip2
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_decompress_data_bzip2(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libewf_decompress_data_bzip2";
+	unsigned int bzip2_uncompressed_data_size = 0;
+	int result                                = 0;
+
+	if( compressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bzip2_uncompressed_data_size = (unsigned int) *uncompressed_data_size;
+
+	result = BZ2_bzBuffToBuffDecompress(
+		  (char *) uncompressed_data,
+		  &bzip2_uncompressed_data_size,
+		  (char *) compressed_data,
+		  (unsigned int) compressed_data_size,
+		  0,
+		  0 );
+
+	if( result == BZ_OK )
+	{
+		*uncompressed_data_size = (size_t) bzip2_uncompressed_data_size;
+
+		result = 1;
+	}
+	else if( ( result == BZ_DATA_ERROR )
+	      || ( result == BZ_DATA_ERROR_MAGIC ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read compressed data: data error.\n",
+			 function );
+		}
+#endif
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+	else if( result == BZ_OUTBUFF_FULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*uncompressed_data_size *= 2;
+
+		result = 0;
+	}
+	else if( result == BZ_MEM_ERROR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to read compressed data: insufficient memory.",
+		 function );
+
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: libbz2 returned undefined error: %d.",
+		 function,
+		 result );
+
+		*uncompressed_data_size = 0;
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
+
+#if defined( HAVE_ZSTD )
+
+/* Compresses data using zstd
+ * The zstd frame contains a content checksum of the uncompressed data
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_zstd(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_compress_data_zstd";
+	ZSTD_CCtx *zstd_context = NULL;
+	int result              = 0;
+
+	zstd_context = ZSTD_createCCtx();
+
+	if( zstd_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zstd context.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_compress_data_zstd_with_context(
+	          (void *) zstd_context,
+	          compressed_data,
+	          compressed_data_size,
+	          compression_level,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
+	ZSTD_freeCCtx(
+	 zstd_context );
+
+	return( result );
+}
+
+/* Compresses data using zstd and an existing zstd compression context (ZSTD_CCtx)
+ * The context is reused between calls hence its parameters are set on every call
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_zstd_with_context(
+     void *zstd_context,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_compress_data_zstd_with_context";
+	size_t zstd_result         = 0;
+	int zstd_compression_level = 0;
+
+	if( zstd_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd context.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
+	{
+		zstd_compression_level = ZSTD_CLEVEL_DEFAULT;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST )
+	{
+		zstd_compression_level = 1;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+	{
+		/* Levels above 19 require significantly more memory
+		 */
+		zstd_compression_level = 19;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	zstd_result = ZSTD_CCtx_setParameter(
+	               (ZSTD_CCtx *) zstd_context,
+	               ZSTD_c_compressionLevel,
+	               zstd_compression_level );
+
+	if( ZSTD_isError( zstd_result ) == 0 )
+	{
+		zstd_result = ZSTD_CCtx_setParameter(
+		               (ZSTD_CCtx *) zstd_context,
+		               ZSTD_c_checksumFlag,
+		               1 );
+	}
+	if( ZSTD_isError( zstd_result ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set zstd context parameter: %s.",
+		 function,
+		 ZSTD_getErrorName( zstd_result ) );
+
+		return( -1 );
+	}
+	zstd_result = ZSTD_compress2(
+	               (ZSTD_CCtx *) zstd_context,
+	               (void *) compressed_data,
+	               *compressed_data_size,
+	               (const void *) uncompressed_data,
+	               uncompressed_data_size );
+
+	if( ZSTD_isError( zstd_result ) == 0 )
+	{
+		*compressed_data_size = zstd_result;
+
+		return( 1 );
+	}
+	if( ZSTD_getErrorCode( zstd_result ) == ZSTD_error_dstSize_tooSmall )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		*compressed_data_size = ZSTD_compressBound( uncompressed_data_size );
+
+		return( 0 );
+	}
+	if( ZSTD_getErrorCode( zstd_result ) == ZSTD_error_memory_allocation )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to write compressed data: insufficient memory.",
+		 function );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: zstd returned error: %s.",
+		 function,
+		 ZSTD_getErrorName( zstd_result ) );
+	}
+	*compressed_data_size = 0;
+
+	return( -1 );
+}
+
+/* Decompresses data using zstd
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_decompress_data_zstd(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( libewf_decompress_data_zstd_with_context(
+	         NULL,
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses data using zstd and an existing zstd decompression context (ZSTD_DCtx)
+ * If the context is NULL ZSTD_decompress sets up a context for the call
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_decompress_data_zstd_with_context(
+     void *zstd_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_decompress_data_zstd_with_context";
+	size_t zstd_result    = 0;
+
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( zstd_context != NULL )
+	{
+		zstd_result = ZSTD_decompressDCtx(
+		               (ZSTD_DCtx *) zstd_context,
+		               (void *) uncompressed_data,
+		               *uncompressed_data_size,
+		               (const void *) compressed_data,
+		               compressed_data_size );
+	}
+	else
+	{
+		zstd_result = ZSTD_decompress(
+		               (void *) uncompressed_data,
+		               *uncompressed_data_size,
+		               (const void *) compressed_data,
+		               compressed_data_size );
+	}
+
+	if( ZSTD_isError( zstd_result ) == 0 )
+	{
+		*uncompressed_data_size = zstd_result;
+
+		return( 1 );
+	}
+	if( ZSTD_getErrorCode( zstd_result ) == ZSTD_error_dstSize_tooSmall )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*uncompressed_data_size *= 2;
+
+		return( 0 );
+	}
+	if( ZSTD_getErrorCode( zstd_result ) == ZSTD_error_memory_allocation )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to read compressed data: insufficient memory.",
+		 function );
+	}
+	else
+	{
+		/* This includes a mismatch of the content checksum
+		 */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: zstd returned error: %s.",
+		 function,
+		 ZSTD_getErrorName( zstd_result ) );
+	}
+	*uncompressed_data_size = 0;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_ZSTD ) */
+
+#if defined( HAVE_LZ4 )
+
+/* Compresses data using LZ4
+ * The LZ4 block is preceded by the 32-bit uncompressed data size and
+ * followed by the 32-bit Adler-32 checksum of the uncompressed data,
+ * both stored in little-endian
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_lz4(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( libewf_compress_data_lz4_with_state(
+	         NULL,
+	         compressed_data,
+	         compressed_data_size,
+	         compression_level,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Retrieves the size of the LZ4 compression state
+ * The state can be used for both the fast and high compression functions
+ */
+size_t libewf_compression_get_lz4_state_size(
+        void )
+{
+	int state_size = LZ4_sizeofState();
+
+	if( state_size < LZ4_sizeofStateHC() )
+	{
+		state_size = LZ4_sizeofStateHC();
+	}
+	return( (size_t) state_size );
+}
+
+/* Compresses data using LZ4 and an optional LZ4 compression state
+ * The state must be at least libewf_compression_get_lz4_state_size() bytes
+ * and allows LZ4 to reuse its hash table instead of setting up a new one,
+ * which for high compression is allocated on the heap, per call
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compress_data_lz4_with_state(
+     void *lz4_state,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compress_data_lz4_with_state";
+	size_t block_size     = 0;
+	uint32_t checksum     = 0;
+	int lz4_acceleration  = 1;
+	int lz4_result        = 0;
+
+	if( ( compression_level != LIBEWF_COMPRESSION_LEVEL_DEFAULT )
+	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_FAST )
+	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_BEST ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) LZ4_MAX_INPUT_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = *compressed_data_size;
+
+	if( block_size > 8 )
+	{
+		block_size -= 8;
+
+		if( block_size > (size_t) INT_MAX )
+		{
+			block_size = (size_t) INT_MAX;
+		}
+		if( ( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+		 && ( lz4_state != NULL ) )
+		{
+			lz4_result = LZ4_compress_HC_extStateHC(
+			              lz4_state,
+			              (const char *) uncompressed_data,
+			              (char *) &( compressed_data[ 4 ] ),
+			              (int) uncompressed_data_size,
+			              (int) block_size,
+			              LZ4HC_CLEVEL_MAX );
+		}
+		else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+		{
+			lz4_result = LZ4_compress_HC(
+			              (const char *) uncompressed_data,
+			              (char *) &( compressed_data[ 4 ] ),
+			              (int) uncompressed_data_size,
+			              (int) block_size,
+			              LZ4HC_CLEVEL_MAX );
+		}
+		else
+		{
+			/* An acceleration of 1 equals LZ4_compress_default
+			 */
+			if( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST )
+			{
+				lz4_acceleration = 8;
+			}
+			if( lz4_state != NULL )
+			{
+				lz4_result = LZ4_compress_fast_extState(
+				              lz4_state,
+				              (const char *) uncompressed_data,
+				              (char *) &( compressed_data[ 4 ] ),
+				              (int) uncompressed_data_size,
+				              (int) block_size,
+				              lz4_acceleration );
+			}
+			else
+			{
+				lz4_result = LZ4_compress_fast(
+				              (const char *) uncompressed_data,
+				              (char *) &( compressed_data[ 4 ] ),
+				              (int) uncompressed_data_size,
+				              (int) block_size,
+				              lz4_acceleration );
+			}
+		}
+	}
+	/* LZ4 returns 0 if the compressed data does not fit in the block
+	 */
+	if( lz4_result <= 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		*compressed_data_size = (size_t) LZ4_compressBound( (int) uncompressed_data_size ) + 8;
+
+		return( 0 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &checksum,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		*compressed_data_size = 0;
+
+		return( -1 );
+	}
+	block_size = (size_t) lz4_result;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 compressed_data,
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 4 + block_size ] ),
+	 checksum );
+
+	*compressed_data_size = block_size + 8;
+
+	return( 1 );
+}
+
+/* Decompresses data using LZ4
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_decompress_data_lz4(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libewf_decompress_data_lz4";
+	size_t block_size            = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+	uint32_t stored_data_size    = 0;
+	int lz4_result               = 0;
+
+	if( ( compressed_data_size < 8 )
+	 || ( compressed_data_size > (size_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 compressed_data,
+	 stored_data_size );
+
+	block_size = compressed_data_size - 8;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 4 + block_size ] ),
+	 stored_checksum );
+
+	if( stored_data_size > (uint32_t) LZ4_MAX_INPUT_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored data size value out of bounds.",
+		 function );
+
+		*uncompressed_data_size = 0;
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size < (size_t) stored_data_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		*uncompressed_data_size = (size_t) stored_data_size;
+
+		return( 0 );
+	}
+	lz4_result = LZ4_decompress_safe(
+	              (const char *) &( compressed_data[ 4 ] ),
+	              (char *) uncompressed_data,
+	              (int) block_size,
+	              (int) stored_data_size );
+
+	if( ( lz4_result < 0 )
+	 || ( (uint32_t) lz4_result != stored_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZ4 block.",
+		 function );
+
+		*uncompressed_data_size = 0;
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     uncompressed_data,
+	     (size_t) stored_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		*uncompressed_data_size = 0;
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		*uncompressed_data_size = 0;
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (size_t) stored_data_size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LZ4 ) */
+
 /* Compresses data using the compression method
  * Returns 1 on success, 0 if buffer is too small or -1 on error
  */
@@ -52,17 +1315,9 @@ int libewf_compress_data(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function                   = "libewf_compress_data";
-	int result                              = 0;
-
-#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
-	unsigned int bzip2_compressed_data_size = 0;
-	int bzip2_compression_level             = 0;
-#endif
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL )
-	uLongf zlib_compressed_data_size        = 0;
-	int zlib_compression_level              = 0;
-#endif
+	const libewf_compression_backend_t *backend = NULL;
+	static char *function                       = "libewf_compress_data";
+	int result                                  = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -108,265 +1363,62 @@ int libewf_compress_data(
 
 		return( -1 );
 	}
-	if( compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
-	{
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL )
-		if( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
-		{
-			zlib_compression_level = Z_DEFAULT_COMPRESSION;
-		}
-		else if( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST )
-		{
-			zlib_compression_level = Z_BEST_SPEED;
-		}
-		else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
-		{
-			zlib_compression_level = Z_BEST_COMPRESSION;
-		}
-		else if( compression_level == LIBEWF_COMPRESSION_LEVEL_NONE )
-		{
-			zlib_compression_level = Z_NO_COMPRESSION;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported compression level.",
-			 function );
-
-			return( -1 );
-		}
-#if ULONG_MAX < SSIZE_MAX
-		if( *compressed_data_size > (size_t) ULONG_MAX )
-#else
-		if( *compressed_data_size > (size_t) SSIZE_MAX )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid compressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if ULONG_MAX < SSIZE_MAX
-		if( uncompressed_data_size > (size_t) ULONG_MAX )
-#else
-		if( uncompressed_data_size > (size_t) SSIZE_MAX )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid uncompressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		zlib_compressed_data_size = (uLongf) *compressed_data_size;
-
-		result = compress2(
-			  (Bytef *) compressed_data,
-			  &zlib_compressed_data_size,
-			  (Bytef *) uncompressed_data,
-			  (uLong) uncompressed_data_size,
-			  zlib_compression_level );
-
-		if( result == Z_OK )
-		{
-			*compressed_data_size = (size_t) zlib_compressed_data_size;
-
-			result = 1;
-		}
-		else if( result == Z_BUF_ERROR )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to write compressed data: target buffer too small.\n",
-				 function );
-			}
-#endif
-#if defined( HAVE_COMPRESS_BOUND ) || defined( WINAPI )
-			/* Use compressBound to determine the size of the uncompressed buffer
-			 */
-			zlib_compressed_data_size = compressBound( (uLong) uncompressed_data_size );
-			*compressed_data_size     = (size_t) zlib_compressed_data_size;
-#else
-			/* Estimate that a factor 2 enlargement should suffice
-			 */
-			*compressed_data_size *= 2;
-#endif
-			result = 0;
-		}
-		else if( result == Z_MEM_ERROR )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to write compressed data: insufficient memory.",
-			 function );
-
-			*compressed_data_size = 0;
-
-			result = -1;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
-			 "%s: zlib returned undefined error: %d.",
-			 function,
-			 result );
-
-			*compressed_data_size = 0;
+	result = libewf_compression_get_backend(
+	          compression_method,
+	          &backend,
+	          error );
 
-			result = -1;
-		}
-#else
+	if( result == -1 )
+	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: missing support for deflate compression.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression backend.",
 		 function );
 
 		return( -1 );
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL ) */
 	}
-	else if( compression_method == LIBEWF_COMPRESSION_METHOD_BZIP2 )
+	else if( result == 0 )
 	{
-#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
-		if( ( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
-		 || ( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST ) )
-		{
-			bzip2_compression_level = 1;
-		}
-		else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
-		{
-			bzip2_compression_level = 9;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported compression level.",
-			 function );
-
-			return( -1 );
-		}
-		if( *compressed_data_size > (size_t) UINT_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid compressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		if( uncompressed_data_size > (size_t) UINT_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid uncompressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		bzip2_compressed_data_size = (unsigned int) *compressed_data_size;
-
-		result = BZ2_bzBuffToBuffCompress(
-			  (char *) compressed_data,
-			  &bzip2_compressed_data_size,
-			  (char *) uncompressed_data,
-			  (unsigned int) uncompressed_data_size,
-			  bzip2_compression_level,
-			  0,
-			  30 );
-
-		if( result == BZ_OK )
-		{
-			*compressed_data_size = (size_t) bzip2_compressed_data_size;
-
-			result = 1;
-		}
-		else if( result == BZ_OUTBUFF_FULL )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-			 	"%s: unable to write compressed data: target buffer too small.\n",
-				 function );
-			}
-#endif
-			/* Estimate that a factor 2 enlargement should suffice
-			 */
-			*compressed_data_size *= 2;
-
-			result = 0;
-		}
-		else if( result == BZ_MEM_ERROR )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to write compressed data: insufficient memory.",
-			 function );
-
-			*compressed_data_size = 0;
-
-			result = -1;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
-			 "%s: libbz2 returned undefined error: %d.",
-			 function,
-			 result );
-
-			*compressed_data_size = 0;
-
-			result = -1;
-		}
-#else
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: missing support for bzip2 compression.",
+		 "%s: unsupported compression method.",
 		 function );
 
 		return( -1 );
-#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
 	}
-	else
+	if( backend->compress == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression method.",
-		 function );
+		 "%s: missing support for %s compression.",
+		 function,
+		 backend->name );
+
+		return( -1 );
+	}
+	result = backend->compress(
+	          compressed_data,
+	          compressed_data_size,
+	          compression_level,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data using %s.",
+		 function,
+		 backend->name );
 
 		return( -1 );
 	}
@@ -384,15 +1436,9 @@ int libewf_decompress_data(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function                     = "libewf_decompress_data";
-	int result                                = 0;
-
-#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
-	unsigned int bzip2_uncompressed_data_size = 0;
-#endif
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
-	uLongf zlib_uncompressed_data_size        = 0;
-#endif
+	const libewf_compression_backend_t *backend = NULL;
+	static char *function                       = "libewf_decompress_data";
+	int result                                  = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -438,242 +1484,23 @@ int libewf_decompress_data(
 
 		return( -1 );
 	}
-	if( compression_method == LIBEWF_COMPRESSION_METHOD_DEFLATE )
-	{
-#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
-#if ULONG_MAX < SSIZE_MAX
-		if( compressed_data_size > (size_t) ULONG_MAX )
-#else
-		if( compressed_data_size > (size_t) SSIZE_MAX )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid compressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if ULONG_MAX < SSIZE_MAX
-		if( *uncompressed_data_size > (size_t) ULONG_MAX )
-#else
-		if( *uncompressed_data_size > (size_t) SSIZE_MAX )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid uncompressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		zlib_uncompressed_data_size = (uLongf) *uncompressed_data_size;
-
-		result = uncompress(
-			  (Bytef *) uncompressed_data,
-			  &zlib_uncompressed_data_size,
-			  (Bytef *) compressed_data,
-			  (uLong) compressed_data_size );
-
-		if( result == Z_OK )
-		{
-			*uncompressed_data_size = (size_t) zlib_uncompressed_data_size;
-
-			result = 1;
-		}
-		else if( result == Z_DATA_ERROR )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to read compressed data: data error.\n",
-				 function );
-			}
-#endif
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-		else if( result == Z_BUF_ERROR )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				"%s: unable to read compressed data: target buffer too small.\n",
-				 function );
-			}
-#endif
-			/* Estimate that a factor 2 enlargement should suffice
-			 */
-			*uncompressed_data_size *= 2;
-
-			result = 0;
-		}
-		else if( result == Z_MEM_ERROR )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to read compressed data: insufficient memory.",
-			 function );
-
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: zlib returned undefined error: %d.",
-			 function,
-			 result );
-
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-#else
-		result = libewf_deflate_decompress_zlib(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-			 "%s: unable to decompress deflate compressed data.",
-			 function );
+	result = libewf_compression_get_backend(
+	          compression_method,
+	          &backend,
+	          error );
 
-			return( -1 );
-		}
-#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) */
-	}
-	else if( compression_method == LIBEWF_COMPRESSION_METHOD_BZIP2 )
+	if( result == -1 )
 	{
-#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
-		if( compressed_data_size > (size_t) UINT_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid compressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		if( *uncompressed_data_size > (size_t) UINT_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid uncompressed data size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-		bzip2_uncompressed_data_size = (unsigned int) *uncompressed_data_size;
-
-		result = BZ2_bzBuffToBuffDecompress(
-			  (char *) uncompressed_data,
-			  &bzip2_uncompressed_data_size,
-			  (char *) compressed_data,
-			  (unsigned int) compressed_data_size,
-			  0,
-			  0 );
-
-		if( result == BZ_OK )
-		{
-			*uncompressed_data_size = (size_t) bzip2_uncompressed_data_size;
-
-			result = 1;
-		}
-		else if( ( result == BZ_DATA_ERROR )
-		      || ( result == BZ_DATA_ERROR_MAGIC ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to read compressed data: data error.\n",
-				 function );
-			}
-#endif
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-		else if( result == BZ_OUTBUFF_FULL )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				"%s: unable to read compressed data: target buffer too small.\n",
-				 function );
-			}
-#endif
-			/* Estimate that a factor 2 enlargement should suffice
-			 */
-			*uncompressed_data_size *= 2;
-
-			result = 0;
-		}
-		else if( result == BZ_MEM_ERROR )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to read compressed data: insufficient memory.",
-			 function );
-
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-		else
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: libbz2 returned undefined error: %d.",
-			 function,
-			 result );
-
-			*uncompressed_data_size = 0;
-
-			result = -1;
-		}
-#else
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: missing support for bzip2 compression.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression backend.",
 		 function );
 
 		return( -1 );
-#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
 	}
-	else
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -684,6 +1511,11 @@ int libewf_decompress_data(
 
 		return( -1 );
 	}
-	return( result );
+	return( backend->decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
 }
 
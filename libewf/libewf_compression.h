@@ -31,6 +31,148 @@
 extern "C" {
 #endif
 
+typedef struct libewf_compression_backend libewf_compression_backend_t;
+
+struct libewf_compression_backend
+{
+	/* The compression method
+	 */
+	uint16_t compression_method;
+
+	/* The name
+	 */
+	const char *name;
+
+	/* The compress function
+	 */
+	int (*compress)(
+	       uint8_t *compressed_data,
+	       size_t *compressed_data_size,
+	       int8_t compression_level,
+	       const uint8_t *uncompressed_data,
+	       size_t uncompressed_data_size,
+	       libcerror_error_t **error );
+
+	/* The decompress function
+	 */
+	int (*decompress)(
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       uint8_t *uncompressed_data,
+	       size_t *uncompressed_data_size,
+	       libcerror_error_t **error );
+};
+
+int libewf_compression_get_backend(
+     uint16_t compression_method,
+     const libewf_compression_backend_t **backend,
+     libcerror_error_t **error );
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL )
+
+int libewf_compress_data_deflate(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) ) || defined( ZLIB_DLL ) */
+
+int libewf_decompress_data_deflate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+
+int libewf_compress_data_bzip2(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libewf_decompress_data_bzip2(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
+
+#if defined( HAVE_ZSTD )
+
+int libewf_compress_data_zstd(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libewf_compress_data_zstd_with_context(
+     void *zstd_context,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libewf_decompress_data_zstd(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libewf_decompress_data_zstd_with_context(
+     void *zstd_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_ZSTD ) */
+
+#if defined( HAVE_LZ4 )
+
+int libewf_compress_data_lz4(
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+size_t libewf_compression_get_lz4_state_size(
+        void );
+
+int libewf_compress_data_lz4_with_state(
+     void *lz4_state,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libewf_decompress_data_lz4(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LZ4 ) */
+
 int libewf_compress_data(
      uint8_t *compressed_data,
      size_t *compressed_data_size,
@@ -0,0 +1,909 @@
+/*
+ * Compression context functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_ZSTD )
+#include <zstd.h>
+#endif
+
+#include "libewf_compression.h"
+#include "libewf_compression_context.h"
+#include "libewf_definitions.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+
+/* Creates a compression context
+ * The compression context retains the compression and decompression state
+ * between calls so that it does not need to be set up again for every chunk
+ * The states are created on first use and hence a context can be created
+ * before the compression method and level are known
+ * Make sure the value compression_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_initialize(
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_initialize";
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compression_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compression context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compression_context = memory_allocate_structure(
+	                        libewf_compression_context_t );
+
+	if( *compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compression context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compression_context,
+	     0,
+	     sizeof( libewf_compression_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compression context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *compression_context != NULL )
+	{
+		memory_free(
+		 *compression_context );
+
+		*compression_context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compression context
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compression_context_free(
+     libewf_compression_context_t **compression_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_free";
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compression_context != NULL )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		if( ( *compression_context )->deflate_stream != NULL )
+		{
+			/* deflateEnd returns Z_DATA_ERROR when the stream was not finished
+			 * which is the case when the last compression ran out of space
+			 */
+			deflateEnd(
+			 (z_stream *) ( *compression_context )->deflate_stream );
+
+			memory_free(
+			 ( *compression_context )->deflate_stream );
+		}
+		if( ( *compression_context )->inflate_stream != NULL )
+		{
+			inflateEnd(
+			 (z_stream *) ( *compression_context )->inflate_stream );
+
+			memory_free(
+			 ( *compression_context )->inflate_stream );
+		}
+#endif
+#if defined( HAVE_ZSTD )
+		if( ( *compression_context )->zstd_context != NULL )
+		{
+			ZSTD_freeCCtx(
+			 (ZSTD_CCtx *) ( *compression_context )->zstd_context );
+		}
+		if( ( *compression_context )->zstd_decompression_context != NULL )
+		{
+			ZSTD_freeDCtx(
+			 (ZSTD_DCtx *) ( *compression_context )->zstd_decompression_context );
+		}
+#endif
+		if( ( *compression_context )->lz4_state != NULL )
+		{
+			memory_free(
+			 ( *compression_context )->lz4_state );
+		}
+		memory_free(
+		 *compression_context );
+
+		*compression_context = NULL;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+/* Compresses data using deflate (zlib) and the deflate stream of the compression context
+ * The stream is reset instead of initialized for every call, which retains
+ * the allocated window and hash tables
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compression_context_compress_data_deflate(
+     libewf_compression_context_t *compression_context,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	z_stream *deflate_stream   = NULL;
+	static char *function      = "libewf_compression_context_compress_data_deflate";
+	int result                 = 0;
+	int zlib_compression_level = 0;
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == LIBEWF_COMPRESSION_LEVEL_DEFAULT )
+	{
+		zlib_compression_level = Z_DEFAULT_COMPRESSION;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_FAST )
+	{
+		zlib_compression_level = Z_BEST_SPEED;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_BEST )
+	{
+		zlib_compression_level = Z_BEST_COMPRESSION;
+	}
+	else if( compression_level == LIBEWF_COMPRESSION_LEVEL_NONE )
+	{
+		zlib_compression_level = Z_NO_COMPRESSION;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream = (z_stream *) compression_context->deflate_stream;
+
+	/* The compression level is fixed for the lifetime of the stream
+	 */
+	if( ( deflate_stream != NULL )
+	 && ( compression_context->deflate_compression_level != compression_level ) )
+	{
+		deflateEnd(
+		 deflate_stream );
+
+		memory_free(
+		 deflate_stream );
+
+		compression_context->deflate_stream = NULL;
+
+		deflate_stream = NULL;
+	}
+	if( deflate_stream == NULL )
+	{
+		deflate_stream = memory_allocate_structure(
+		                  z_stream );
+
+		if( deflate_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create deflate stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     deflate_stream,
+		     0,
+		     sizeof( z_stream ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear deflate stream.",
+			 function );
+
+			memory_free(
+			 deflate_stream );
+
+			return( -1 );
+		}
+		/* Uses the same window and memory level as compress2 so that
+		 * the compressed data is identical
+		 */
+		result = deflateInit(
+		          deflate_stream,
+		          zlib_compression_level );
+
+		if( result != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize deflate stream with error: %d.",
+			 function,
+			 result );
+
+			memory_free(
+			 deflate_stream );
+
+			return( -1 );
+		}
+		compression_context->deflate_stream            = (void *) deflate_stream;
+		compression_context->deflate_compression_level = compression_level;
+	}
+	else
+	{
+		result = deflateReset(
+		          deflate_stream );
+
+		if( result != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to reset deflate stream with error: %d.",
+			 function,
+			 result );
+
+			return( -1 );
+		}
+	}
+	deflate_stream->next_in   = (Bytef *) uncompressed_data;
+	deflate_stream->avail_in  = (uInt) uncompressed_data_size;
+	deflate_stream->next_out  = (Bytef *) compressed_data;
+	deflate_stream->avail_out = (uInt) *compressed_data_size;
+
+	result = deflate(
+	          deflate_stream,
+	          Z_FINISH );
+
+	if( result == Z_STREAM_END )
+	{
+		*compressed_data_size = (size_t) deflate_stream->total_out;
+
+		return( 1 );
+	}
+	/* The stream is not finished when the compressed data does not fit
+	 */
+	if( ( result == Z_OK )
+	 || ( result == Z_BUF_ERROR ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to write compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+#if defined( HAVE_COMPRESS_BOUND ) || defined( WINAPI )
+		/* Use compressBound to determine the size of the uncompressed buffer
+		 */
+		*compressed_data_size = (size_t) compressBound( (uLong) uncompressed_data_size );
+#else
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*compressed_data_size *= 2;
+#endif
+		return( 0 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+	 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+	 "%s: zlib returned undefined error: %d.",
+	 function,
+	 result );
+
+	*compressed_data_size = 0;
+
+	return( -1 );
+}
+
+/* Decompresses data using inflate (zlib) and the inflate stream of the compression context
+ * The stream is reset instead of initialized for every call, which retains
+ * the allocated window
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compression_context_decompress_data_deflate(
+     libewf_compression_context_t *compression_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	z_stream *inflate_stream = NULL;
+	static char *function    = "libewf_compression_context_decompress_data_deflate";
+	int result               = 0;
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) UINT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	inflate_stream = (z_stream *) compression_context->inflate_stream;
+
+	if( inflate_stream == NULL )
+	{
+		inflate_stream = memory_allocate_structure(
+		                  z_stream );
+
+		if( inflate_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inflate stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     inflate_stream,
+		     0,
+		     sizeof( z_stream ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear inflate stream.",
+			 function );
+
+			memory_free(
+			 inflate_stream );
+
+			return( -1 );
+		}
+		result = inflateInit(
+		          inflate_stream );
+
+		if( result != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize inflate stream with error: %d.",
+			 function,
+			 result );
+
+			memory_free(
+			 inflate_stream );
+
+			return( -1 );
+		}
+		compression_context->inflate_stream = (void *) inflate_stream;
+	}
+	else
+	{
+		result = inflateReset(
+		          inflate_stream );
+
+		if( result != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to reset inflate stream with error: %d.",
+			 function,
+			 result );
+
+			return( -1 );
+		}
+	}
+	inflate_stream->next_in   = (Bytef *) compressed_data;
+	inflate_stream->avail_in  = (uInt) compressed_data_size;
+	inflate_stream->next_out  = (Bytef *) uncompressed_data;
+	inflate_stream->avail_out = (uInt) *uncompressed_data_size;
+
+	result = inflate(
+	          inflate_stream,
+	          Z_FINISH );
+
+	if( result == Z_STREAM_END )
+	{
+		*uncompressed_data_size = (size_t) inflate_stream->total_out;
+
+		return( 1 );
+	}
+	/* Similar to uncompress the stream is considered too small for the
+	 * uncompressed data only when all the output space has been used
+	 */
+	if( ( ( result == Z_OK )
+	  || ( result == Z_BUF_ERROR ) )
+	 && ( inflate_stream->avail_out == 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			"%s: unable to read compressed data: target buffer too small.\n",
+			 function );
+		}
+#endif
+		/* Estimate that a factor 2 enlargement should suffice
+		 */
+		*uncompressed_data_size *= 2;
+
+		return( 0 );
+	}
+	if( result == Z_MEM_ERROR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to read compressed data: insufficient memory.",
+		 function );
+	}
+	else
+	{
+		/* This includes truncated compressed data and a mismatch of the Adler-32 checksum
+		 */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: zlib returned error: %d.",
+		 function,
+		 result );
+	}
+	*uncompressed_data_size = 0;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+/* Compresses data using the compression method and the state of the compression context
+ * The compressed data is identical to that of libewf_compress_data
+ * Compression methods that cannot retain their state, such as bzip2,
+ * are compressed using libewf_compress_data
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compression_context_compress_data(
+     libewf_compression_context_t *compression_context,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint16_t compression_method,
+     int8_t compression_level,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_compress_data";
+	int result            = 0;
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == uncompressed_data )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer equals compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		case LIBEWF_COMPRESSION_METHOD_DEFLATE:
+			result = libewf_compression_context_compress_data_deflate(
+			          compression_context,
+			          compressed_data,
+			          compressed_data_size,
+			          compression_level,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+#endif
+#if defined( HAVE_ZSTD )
+		case LIBEWF_COMPRESSION_METHOD_ZSTD:
+			if( compression_context->zstd_context == NULL )
+			{
+				compression_context->zstd_context = (void *) ZSTD_createCCtx();
+
+				if( compression_context->zstd_context == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create zstd context.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			result = libewf_compress_data_zstd_with_context(
+			          compression_context->zstd_context,
+			          compressed_data,
+			          compressed_data_size,
+			          compression_level,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+#endif
+#if defined( HAVE_LZ4 )
+		case LIBEWF_COMPRESSION_METHOD_LZ4:
+			if( compression_context->lz4_state == NULL )
+			{
+				compression_context->lz4_state = memory_allocate(
+				                                  libewf_compression_get_lz4_state_size() );
+
+				if( compression_context->lz4_state == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create LZ4 state.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			result = libewf_compress_data_lz4_with_state(
+			          compression_context->lz4_state,
+			          compressed_data,
+			          compressed_data_size,
+			          compression_level,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+#endif
+		default:
+			/* bzip2 has no means to reset a stream and
+			 * BZ2_bzBuffToBuffCompress sets up a new one for every call
+			 */
+			result = libewf_compress_data(
+			          compressed_data,
+			          compressed_data_size,
+			          compression_method,
+			          compression_level,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decompresses data using the compression method and the state of the compression context
+ * Compression methods that do not retain state between calls, such as bzip2 and LZ4,
+ * are decompressed using libewf_decompress_data
+ * Returns 1 on success, 0 if buffer is too small or -1 on error
+ */
+int libewf_compression_context_decompress_data(
+     libewf_compression_context_t *compression_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t compression_method,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compression_context_decompress_data";
+	int result            = 0;
+
+	if( compression_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression context.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == compressed_data )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer equals uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		case LIBEWF_COMPRESSION_METHOD_DEFLATE:
+			result = libewf_compression_context_decompress_data_deflate(
+			          compression_context,
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+#endif
+#if defined( HAVE_ZSTD )
+		case LIBEWF_COMPRESSION_METHOD_ZSTD:
+			if( compression_context->zstd_decompression_context == NULL )
+			{
+				compression_context->zstd_decompression_context = (void *) ZSTD_createDCtx();
+
+				if( compression_context->zstd_decompression_context == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create zstd decompression context.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			result = libewf_decompress_data_zstd_with_context(
+			          compression_context->zstd_decompression_context,
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+#endif
+		default:
+			/* LZ4 block decompression does not allocate and
+			 * BZ2_bzBuffToBuffDecompress sets up a new stream for every call
+			 */
+			result = libewf_decompress_data(
+			          compressed_data,
+			          compressed_data_size,
+			          compression_method,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
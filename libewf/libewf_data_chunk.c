@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libewf_compression_context.h"
 #include "libewf_data_chunk.h"
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
@@ -194,6 +195,22 @@ int libewf_data_chunk_free(
 
 			result = -1;
 		}
+		if( internal_data_chunk->compression_context != NULL )
+		{
+			if( libewf_compression_context_free(
+			     &( internal_data_chunk->compression_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compression context.",
+				 function );
+
+				result = -1;
+			}
+		}
 		/* The io_handle and write_io_handle references are freed elsewhere
 		 */
 		memory_free(
@@ -587,9 +604,29 @@ ssize_t libewf_data_chunk_write_buffer(
 	}
 	internal_data_chunk->data_size = buffer_size;
 
+	/* The data chunk has its own compression context since data chunks
+	 * can be packed concurrently
+	 */
+	if( internal_data_chunk->compression_context == NULL )
+	{
+		if( libewf_compression_context_initialize(
+		     &( internal_data_chunk->compression_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compression context.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libewf_chunk_data_pack(
 	     internal_data_chunk->chunk_data,
 	     internal_data_chunk->io_handle,
+	     internal_data_chunk->compression_context,
 	     internal_data_chunk->write_io_handle->compressed_zero_byte_empty_block,
 	     internal_data_chunk->write_io_handle->compressed_zero_byte_empty_block_size,
 	     internal_data_chunk->write_io_handle->pack_flags,
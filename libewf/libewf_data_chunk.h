@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libewf_chunk_data.h"
+#include "libewf_compression_context.h"
 #include "libewf_extern.h"
 #include "libewf_io_handle.h"
 #include "libewf_libcerror.h"
@@ -57,6 +58,10 @@ struct libewf_internal_data_chunk
 	 */
 	libewf_chunk_data_t *chunk_data;
 
+	/* The compression context
+	 */
+	libewf_compression_context_t *compression_context;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -0,0 +1,522 @@
+/*
+ * Data order index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_data_order_index.h"
+#include "libewf_definitions.h"
+#include "libewf_lef_file_entry.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+
+/* Compares two data order index entries
+ * Entries are ordered by the media offset of their data, an entry that
+ * duplicates data is ordered directly after the entry it duplicates
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL or LIBCDATA_COMPARE_GREATER
+ */
+int libewf_data_order_index_compare_entries(
+     const libewf_data_order_index_entry_t *first_entry,
+     const libewf_data_order_index_entry_t *second_entry )
+{
+	if( first_entry->data_offset < second_entry->data_offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_entry->data_offset > second_entry->data_offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_entry->is_duplicate < second_entry->is_duplicate )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_entry->is_duplicate > second_entry->is_duplicate )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_entry->ltree_entry_index < second_entry->ltree_entry_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_entry->ltree_entry_index > second_entry->ltree_entry_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Creates a data order index
+ * The data order index orders the file entries by the media offset of their data
+ * Make sure the value data_order_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_initialize(
+     libewf_data_order_index_t **data_order_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_data_order_index_initialize";
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_order_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data order index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries < 0 )
+	 || ( (size_t) maximum_number_of_entries > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_data_order_index_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_order_index = memory_allocate_structure(
+	                     libewf_data_order_index_t );
+
+	if( *data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data order index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_order_index,
+	     0,
+	     sizeof( libewf_data_order_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data order index.",
+		 function );
+
+		memory_free(
+		 *data_order_index );
+
+		*data_order_index = NULL;
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries > 0 )
+	{
+		( *data_order_index )->entries = (libewf_data_order_index_entry_t *) memory_allocate(
+		                                                                      sizeof( libewf_data_order_index_entry_t ) * maximum_number_of_entries );
+
+		if( ( *data_order_index )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *data_order_index )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *data_order_index != NULL )
+	{
+		libewf_data_order_index_free(
+		 data_order_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a data order index
+ * The nodes are not freed, they are owned by the file entry tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_free(
+     libewf_data_order_index_t **data_order_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_data_order_index_free";
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_order_index != NULL )
+	{
+		if( ( *data_order_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *data_order_index )->entries );
+		}
+		memory_free(
+		 *data_order_index );
+
+		*data_order_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a (file entry) node to the data order index
+ * The node value must be a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_append_node(
+     libewf_data_order_index_t *data_order_index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libewf_data_order_index_entry_t *entry  = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_data_order_index_append_node";
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_order_index->number_of_entries >= data_order_index->maximum_number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data order index - maximum number of entries reached.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing file entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( data_order_index->entries[ data_order_index->number_of_entries ] );
+
+	if( ( ( lef_file_entry->flags & LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA ) != 0 )
+	 && ( lef_file_entry->duplicate_data_offset >= 0 ) )
+	{
+		entry->data_offset  = lef_file_entry->duplicate_data_offset;
+		entry->is_duplicate = 1;
+	}
+	else
+	{
+		entry->data_offset  = lef_file_entry->data_offset;
+		entry->is_duplicate = 0;
+	}
+	entry->ltree_entry_index = lef_file_entry->ltree_entry_index;
+	entry->node              = node;
+
+	data_order_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Sorts the entries of the data order index
+ * This uses a bottom-up merge sort, which is stable and keeps the file entry tree order
+ * of entries that cannot be otherwise distinguished
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_sort(
+     libewf_data_order_index_t *data_order_index,
+     libcerror_error_t **error )
+{
+	libewf_data_order_index_entry_t *destination_entries = NULL;
+	libewf_data_order_index_entry_t *merge_entries       = NULL;
+	libewf_data_order_index_entry_t *source_entries      = NULL;
+	static char *function                                = "libewf_data_order_index_sort";
+	int entry_index                                      = 0;
+	int first_entry_index                                = 0;
+	int last_entry_index                                 = 0;
+	int left_entry_index                                 = 0;
+	int middle_entry_index                               = 0;
+	int number_of_entries                                = 0;
+	int right_entry_index                                = 0;
+	int run_size                                         = 0;
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = data_order_index->number_of_entries;
+
+	if( number_of_entries < 2 )
+	{
+		return( 1 );
+	}
+	merge_entries = (libewf_data_order_index_entry_t *) memory_allocate(
+	                                                     sizeof( libewf_data_order_index_entry_t ) * number_of_entries );
+
+	if( merge_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge entries.",
+		 function );
+
+		return( -1 );
+	}
+	source_entries      = data_order_index->entries;
+	destination_entries = merge_entries;
+
+	for( run_size = 1;
+	     run_size < number_of_entries;
+	     run_size *= 2 )
+	{
+		for( first_entry_index = 0;
+		     first_entry_index < number_of_entries;
+		     first_entry_index = last_entry_index )
+		{
+			if( run_size >= ( number_of_entries - first_entry_index ) )
+			{
+				middle_entry_index = number_of_entries;
+			}
+			else
+			{
+				middle_entry_index = first_entry_index + run_size;
+			}
+			if( run_size >= ( number_of_entries - middle_entry_index ) )
+			{
+				last_entry_index = number_of_entries;
+			}
+			else
+			{
+				last_entry_index = middle_entry_index + run_size;
+			}
+			left_entry_index  = first_entry_index;
+			right_entry_index = middle_entry_index;
+
+			for( entry_index = first_entry_index;
+			     entry_index < last_entry_index;
+			     entry_index++ )
+			{
+				if( ( left_entry_index < middle_entry_index )
+				 && ( ( right_entry_index >= last_entry_index )
+				  ||  ( libewf_data_order_index_compare_entries(
+				         &( source_entries[ left_entry_index ] ),
+				         &( source_entries[ right_entry_index ] ) ) != LIBCDATA_COMPARE_GREATER ) ) )
+				{
+					destination_entries[ entry_index ] = source_entries[ left_entry_index ];
+
+					left_entry_index++;
+				}
+				else
+				{
+					destination_entries[ entry_index ] = source_entries[ right_entry_index ];
+
+					right_entry_index++;
+				}
+			}
+		}
+		source_entries      = destination_entries;
+		destination_entries = ( destination_entries == merge_entries ) ? data_order_index->entries : merge_entries;
+
+		/* Prevent the run size from overflowing, all entries were merged in this pass
+		 */
+		if( run_size > ( number_of_entries / 2 ) )
+		{
+			break;
+		}
+	}
+	if( source_entries != data_order_index->entries )
+	{
+		if( memory_copy(
+		     data_order_index->entries,
+		     source_entries,
+		     sizeof( libewf_data_order_index_entry_t ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted entries.",
+			 function );
+
+			memory_free(
+			 merge_entries );
+
+			return( -1 );
+		}
+	}
+	memory_free(
+	 merge_entries );
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_get_number_of_entries(
+     libewf_data_order_index_t *data_order_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_data_order_index_get_number_of_entries";
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = data_order_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the node of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_data_order_index_get_node_by_index(
+     libewf_data_order_index_t *data_order_index,
+     int entry_index,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_data_order_index_get_node_by_index";
+
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= data_order_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	*node = data_order_index->entries[ entry_index ].node;
+
+	return( 1 );
+}
+
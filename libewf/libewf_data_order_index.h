@@ -0,0 +1,112 @@
+/*
+ * Data order index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_DATA_ORDER_INDEX_H )
+#define _LIBEWF_DATA_ORDER_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_data_order_index_entry libewf_data_order_index_entry_t;
+
+struct libewf_data_order_index_entry
+{
+	/* The media offset of the data
+	 * for duplicate data this is the offset of the data that is duplicated
+	 */
+	off64_t data_offset;
+
+	/* Value to indicate the entry duplicates the data of another entry
+	 */
+	uint8_t is_duplicate;
+
+	/* The ltree entry index
+	 */
+	int ltree_entry_index;
+
+	/* The (file entry) node
+	 */
+	libcdata_tree_node_t *node;
+};
+
+typedef struct libewf_data_order_index libewf_data_order_index_t;
+
+struct libewf_data_order_index
+{
+	/* The entries
+	 */
+	libewf_data_order_index_entry_t *entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libewf_data_order_index_compare_entries(
+     const libewf_data_order_index_entry_t *first_entry,
+     const libewf_data_order_index_entry_t *second_entry );
+
+int libewf_data_order_index_initialize(
+     libewf_data_order_index_t **data_order_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libewf_data_order_index_free(
+     libewf_data_order_index_t **data_order_index,
+     libcerror_error_t **error );
+
+int libewf_data_order_index_append_node(
+     libewf_data_order_index_t *data_order_index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libewf_data_order_index_sort(
+     libewf_data_order_index_t *data_order_index,
+     libcerror_error_t **error );
+
+int libewf_data_order_index_get_number_of_entries(
+     libewf_data_order_index_t *data_order_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libewf_data_order_index_get_node_by_index(
+     libewf_data_order_index_t *data_order_index,
+     int entry_index,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_DATA_ORDER_INDEX_H ) */
+
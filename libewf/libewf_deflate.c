@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libewf_bit_stream.h"
+#include "libewf_checksum.h"
 #include "libewf_deflate.h"
 #include "libewf_huffman_tree.h"
 #include "libewf_libcerror.h"
@@ -652,11 +653,6 @@ int libewf_deflate_calculate_adler32(
      libcerror_error_t **error )
 {
 	static char *function = "libewf_deflate_calculate_adler32";
-	size_t data_offset    = 0;
-	uint32_t lower_word   = 0;
-	uint32_t upper_word   = 0;
-	uint32_t value_32bit  = 0;
-	int block_index       = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -691,199 +687,11 @@ int libewf_deflate_calculate_adler32(
 
 		return( -1 );
 	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
-
-	while( data_size >= 0x15b0 )
-	{
-		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
-		 */
-		for( block_index = 0;
-		     block_index < 347;
-		     block_index++ )
-		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
-		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
-
-		if( lower_word > 65521 )
-		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( lower_word >= 65521 )
-		{
-			lower_word -= 65521;
-		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
-
-		if( upper_word > 65521 )
-		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( upper_word >= 65521 )
-		{
-			upper_word -= 65521;
-		}
-		data_size -= 0x15b0;
-	}
-	if( data_size > 0 )
-	{
-		while( data_size > 16 )
-		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			data_size -= 16;
-		}
-		while( data_size > 0 )
-		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			data_size--;
-		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
-		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
-
-		if( lower_word > 65521 )
-		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( lower_word >= 65521 )
-		{
-			lower_word -= 65521;
-		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
-
-		if( upper_word > 65521 )
-		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( upper_word >= 65521 )
-		{
-			upper_word -= 65521;
-		}
-	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	*checksum_value = libewf_checksum_calculate_adler32_with_kernel(
+	                   libewf_checksum_get_adler32_kernel(),
+	                   data,
+	                   data_size,
+	                   initial_value );
 
 	return( 1 );
 }
@@ -1221,6 +1029,16 @@ int libewf_deflate_read_block(
 
 				goto on_error;
 			}
+			/* Return the whole bytes that remain in the bit buffer to the byte stream
+			 */
+			while( bit_stream->bit_buffer_size >= 8 )
+			{
+				bit_stream->byte_stream_offset -= 1;
+				bit_stream->bit_buffer_size    -= 8;
+			}
+			bit_stream->bit_buffer      = 0;
+			bit_stream->bit_buffer_size = 0;
+
 			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
 			block_size     &= 0x0000ffffUL;
 
@@ -1536,7 +1354,8 @@ int libewf_deflate_decompress(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( libewf_deflate_read_block_header(
 		     bit_stream,
@@ -1821,7 +1640,8 @@ int libewf_deflate_decompress_zlib(
 
 		goto on_error;
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( libewf_deflate_read_block_header(
 		     bit_stream,
@@ -1913,13 +1733,15 @@ int libewf_deflate_decompress_zlib(
 			break;
 		}
 	}
+	/* Return the whole bytes that remain in the bit buffer to the byte stream
+	 */
+	while( bit_stream->bit_buffer_size >= 8 )
+	{
+		bit_stream->byte_stream_offset -= 1;
+		bit_stream->bit_buffer_size    -= 8;
+	}
 	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
 	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
 		byte_stream_copy_to_uint32_big_endian(
 		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
 		 stored_checksum );
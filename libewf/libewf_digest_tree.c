@@ -0,0 +1,760 @@
+/*
+ * Digest tree functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_digest_tree.h"
+#include "libewf_libcerror.h"
+#include "libewf_libhmac.h"
+
+/* Creates a digest tree
+ * Make sure the value digest_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_initialize(
+     libewf_digest_tree_t **digest_tree,
+     uint32_t number_of_chunks_per_leaf,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_initialize";
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks_per_leaf == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks per leaf value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_tree = memory_allocate_structure(
+	                libewf_digest_tree_t );
+
+	if( *digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_tree,
+	     0,
+	     sizeof( libewf_digest_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest tree.",
+		 function );
+
+		goto on_error;
+	}
+	( *digest_tree )->number_of_chunks_per_leaf = number_of_chunks_per_leaf;
+
+	return( 1 );
+
+on_error:
+	if( *digest_tree != NULL )
+	{
+		memory_free(
+		 *digest_tree );
+
+		*digest_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a digest tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_free(
+     libewf_digest_tree_t **digest_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_free";
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_tree != NULL )
+	{
+		if( ( *digest_tree )->leaves != NULL )
+		{
+			memory_free(
+			 ( *digest_tree )->leaves );
+		}
+		memory_free(
+		 *digest_tree );
+
+		*digest_tree = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones the digest tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_clone(
+     libewf_digest_tree_t **destination_digest_tree,
+     libewf_digest_tree_t *source_digest_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_clone";
+
+	if( destination_digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_digest_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination digest tree already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_digest_tree == NULL )
+	{
+		*destination_digest_tree = NULL;
+
+		return( 1 );
+	}
+	*destination_digest_tree = memory_allocate_structure(
+	                            libewf_digest_tree_t );
+
+	if( *destination_digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination digest tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_digest_tree,
+	     source_digest_tree,
+	     sizeof( libewf_digest_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination digest tree.",
+		 function );
+
+		memory_free(
+		 *destination_digest_tree );
+
+		*destination_digest_tree = NULL;
+
+		return( -1 );
+	}
+	( *destination_digest_tree )->leaves      = NULL;
+	( *destination_digest_tree )->leaves_size = 0;
+
+	if( source_digest_tree->leaves != NULL )
+	{
+		( *destination_digest_tree )->leaves = (uint8_t *) memory_allocate(
+		                                                    sizeof( uint8_t ) * source_digest_tree->leaves_size );
+
+		if( ( *destination_digest_tree )->leaves == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination leaves.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_digest_tree )->leaves,
+		     source_digest_tree->leaves,
+		     sizeof( uint8_t ) * source_digest_tree->leaves_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination leaves.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_digest_tree )->leaves_size = source_digest_tree->leaves_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_digest_tree != NULL )
+	{
+		if( ( *destination_digest_tree )->leaves != NULL )
+		{
+			memory_free(
+			 ( *destination_digest_tree )->leaves );
+		}
+		memory_free(
+		 *destination_digest_tree );
+
+		*destination_digest_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Resizes the leaves to contain at least the number of leaves
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_resize_leaves(
+     libewf_digest_tree_t *digest_tree,
+     uint32_t number_of_leaves,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libewf_digest_tree_resize_leaves";
+	size_t leaves_size    = 0;
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_leaves == 0 )
+	 || ( (size_t) number_of_leaves > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBEWF_DIGEST_TREE_DIGEST_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaves value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	leaves_size = (size_t) number_of_leaves * LIBEWF_DIGEST_TREE_DIGEST_SIZE;
+
+	if( leaves_size <= digest_tree->leaves_size )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                digest_tree->leaves,
+	                sizeof( uint8_t ) * leaves_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize leaves.",
+		 function );
+
+		return( -1 );
+	}
+	digest_tree->leaves      = (uint8_t *) reallocation;
+	digest_tree->leaves_size = leaves_size;
+
+	return( 1 );
+}
+
+/* Appends a leaf digest
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_append_leaf(
+     libewf_digest_tree_t *digest_tree,
+     const uint8_t *leaf_digest,
+     size_t leaf_digest_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libewf_digest_tree_append_leaf";
+	uint32_t number_of_leaves = 0;
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_digest_size < LIBEWF_DIGEST_TREE_DIGEST_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: leaf digest too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_tree->number_of_leaves == (uint32_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of leaves value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) digest_tree->number_of_leaves * LIBEWF_DIGEST_TREE_DIGEST_SIZE ) >= digest_tree->leaves_size )
+	{
+		/* Grow the leaves in steps to limit the number of reallocations
+		 */
+		number_of_leaves = digest_tree->number_of_leaves + 1;
+
+		if( number_of_leaves < 1024 )
+		{
+			number_of_leaves = 1024;
+		}
+		else if( number_of_leaves <= ( (uint32_t) UINT32_MAX / 2 ) )
+		{
+			number_of_leaves *= 2;
+		}
+		if( libewf_digest_tree_resize_leaves(
+		     digest_tree,
+		     number_of_leaves,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize leaves.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     &( digest_tree->leaves[ (size_t) digest_tree->number_of_leaves * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+	     leaf_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy leaf digest.",
+		 function );
+
+		return( -1 );
+	}
+	digest_tree->number_of_leaves += 1;
+
+	/* The root digest needs to be recalculated after a leaf was added
+	 */
+	digest_tree->root_digest_set = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a specific leaf digest
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_get_leaf(
+     libewf_digest_tree_t *digest_tree,
+     uint32_t leaf_index,
+     uint8_t *leaf_digest,
+     size_t leaf_digest_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_get_leaf";
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_index >= digest_tree->number_of_leaves )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_digest_size < LIBEWF_DIGEST_TREE_DIGEST_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: leaf digest too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     leaf_digest,
+	     &( digest_tree->leaves[ (size_t) leaf_index * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy leaf digest.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the root digest from the leaf digests
+ * Every node of the tree is the SHA256 of the concatenation of its 2 child digests,
+ * the last node of a level with an odd number of nodes is promoted to the next level
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_calculate_root_digest(
+     libewf_digest_tree_t *digest_tree,
+     libcerror_error_t **error )
+{
+	uint8_t node_digest[ LIBEWF_DIGEST_TREE_DIGEST_SIZE ];
+
+	uint8_t *level_data      = NULL;
+	static char *function    = "libewf_digest_tree_calculate_root_digest";
+	size_t level_data_size   = 0;
+	uint32_t node_index      = 0;
+	uint32_t number_of_nodes = 0;
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_tree->number_of_leaves == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest tree - missing leaves.",
+		 function );
+
+		return( -1 );
+	}
+	level_data_size = (size_t) digest_tree->number_of_leaves * LIBEWF_DIGEST_TREE_DIGEST_SIZE;
+
+	level_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * level_data_size );
+
+	if( level_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create level data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     level_data,
+	     digest_tree->leaves,
+	     level_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy leaves to level data.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_nodes = digest_tree->number_of_leaves;
+
+	/* The nodes of the next level are stored in-place since node N
+	 * only depends on the nodes 2 * N and 2 * N + 1 of the current level
+	 */
+	while( number_of_nodes > 1 )
+	{
+		for( node_index = 0;
+		     node_index < ( number_of_nodes / 2 );
+		     node_index++ )
+		{
+			if( libhmac_sha256_calculate(
+			     &( level_data[ (size_t) node_index * 2 * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+			     2 * LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+			     node_digest,
+			     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate node digest.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( level_data[ (size_t) node_index * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+			     node_digest,
+			     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy node digest.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( number_of_nodes % 2 ) != 0 )
+		{
+			if( memory_copy(
+			     &( level_data[ (size_t) node_index * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+			     &( level_data[ (size_t) ( number_of_nodes - 1 ) * LIBEWF_DIGEST_TREE_DIGEST_SIZE ] ),
+			     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy node digest.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		number_of_nodes = ( number_of_nodes / 2 ) + ( number_of_nodes % 2 );
+	}
+	if( memory_copy(
+	     digest_tree->root_digest,
+	     level_data,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root digest.",
+		 function );
+
+		goto on_error;
+	}
+	digest_tree->root_digest_set = 1;
+
+	memory_free(
+	 level_data );
+
+	return( 1 );
+
+on_error:
+	if( level_data != NULL )
+	{
+		memory_free(
+		 level_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the root digest
+ * The root digest is calculated if not set
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libewf_digest_tree_get_root_digest(
+     libewf_digest_tree_t *digest_tree,
+     uint8_t *root_digest,
+     size_t root_digest_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_get_root_digest";
+
+	if( digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_digest_size < LIBEWF_DIGEST_TREE_DIGEST_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: root digest too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_tree->number_of_leaves == 0 )
+	{
+		return( 0 );
+	}
+	if( digest_tree->root_digest_set == 0 )
+	{
+		if( libewf_digest_tree_calculate_root_digest(
+		     digest_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate root digest.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     root_digest,
+	     digest_tree->root_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root digest.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
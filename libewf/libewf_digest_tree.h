@@ -0,0 +1,117 @@
+/*
+ * Digest tree functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_DIGEST_TREE_H )
+#define _LIBEWF_DIGEST_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a leaf and root digest
+ */
+#define LIBEWF_DIGEST_TREE_DIGEST_SIZE		32
+
+typedef struct libewf_digest_tree libewf_digest_tree_t;
+
+/* The digest tree contains the SHA256 digests of consecutive ranges of chunks (leaves)
+ * and a root digest that is calculated from the leaves as a binary hash (Merkle) tree
+ */
+struct libewf_digest_tree
+{
+	/* The number of chunks per leaf
+	 */
+	uint32_t number_of_chunks_per_leaf;
+
+	/* The number of leaves
+	 */
+	uint32_t number_of_leaves;
+
+	/* The leaf digests
+	 */
+	uint8_t *leaves;
+
+	/* The allocated size of the leaf digests
+	 */
+	size_t leaves_size;
+
+	/* The root digest
+	 */
+	uint8_t root_digest[ LIBEWF_DIGEST_TREE_DIGEST_SIZE ];
+
+	/* Value to indicate if the root digest was set
+	 */
+	uint8_t root_digest_set;
+};
+
+int libewf_digest_tree_initialize(
+     libewf_digest_tree_t **digest_tree,
+     uint32_t number_of_chunks_per_leaf,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_free(
+     libewf_digest_tree_t **digest_tree,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_clone(
+     libewf_digest_tree_t **destination_digest_tree,
+     libewf_digest_tree_t *source_digest_tree,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_resize_leaves(
+     libewf_digest_tree_t *digest_tree,
+     uint32_t number_of_leaves,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_append_leaf(
+     libewf_digest_tree_t *digest_tree,
+     const uint8_t *leaf_digest,
+     size_t leaf_digest_size,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_get_leaf(
+     libewf_digest_tree_t *digest_tree,
+     uint32_t leaf_index,
+     uint8_t *leaf_digest,
+     size_t leaf_digest_size,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_calculate_root_digest(
+     libewf_digest_tree_t *digest_tree,
+     libcerror_error_t **error );
+
+int libewf_digest_tree_get_root_digest(
+     libewf_digest_tree_t *digest_tree,
+     uint8_t *root_digest,
+     size_t root_digest_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_DIGEST_TREE_H ) */
+
@@ -0,0 +1,816 @@
+/*
+ * Digest tree section functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_checksum.h"
+#include "libewf_definitions.h"
+#include "libewf_digest_tree.h"
+#include "libewf_digest_tree_section.h"
+#include "libewf_hash_sections.h"
+#include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_section.h"
+#include "libewf_section_descriptor.h"
+
+#include "ewf_digest_tree.h"
+#include "ewf_section.h"
+
+/* Reads a digest tree section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_section_read_data(
+     const uint8_t *data,
+     size_t data_size,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_root_digest[ LIBEWF_DIGEST_TREE_DIGEST_SIZE ];
+
+	libewf_digest_tree_t *digest_tree  = NULL;
+	const uint8_t *leaves_data         = NULL;
+	static char *function              = "libewf_digest_tree_section_read_data";
+	size_t leaves_data_size            = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t leaf_index                = 0;
+	uint32_t number_of_chunks_per_leaf = 0;
+	uint32_t number_of_leaves          = 0;
+	uint32_t stored_checksum           = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < (size_t) ( sizeof( ewf_digest_tree_header_t ) + 4 ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash sections.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+	 	 "%s: digest tree header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( ewf_digest_tree_header_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->number_of_chunks_per_leaf,
+	 number_of_chunks_per_leaf );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->number_of_leaves,
+	 number_of_leaves );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of chunks per leaf\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_chunks_per_leaf );
+
+		libcnotify_printf(
+		 "%s: number of leaves\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_leaves );
+
+		libcnotify_printf(
+		 "%s: root digest:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (ewf_digest_tree_header_t *) data )->root_digest,
+		 32,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: padding:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (ewf_digest_tree_header_t *) data )->padding,
+		 20,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     data,
+	     sizeof( ewf_digest_tree_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: header checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	if( number_of_chunks_per_leaf == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks per leaf value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_leaves == 0 )
+	 || ( (size_t) number_of_leaves > ( ( data_size - sizeof( ewf_digest_tree_header_t ) - 4 ) / sizeof( ewf_digest_tree_leaf_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaves value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	leaves_data      = &( data[ sizeof( ewf_digest_tree_header_t ) ] );
+	leaves_data_size = (size_t) number_of_leaves * sizeof( ewf_digest_tree_leaf_t );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( leaves_data[ leaves_data_size ] ),
+	 stored_checksum );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     leaves_data,
+	     leaves_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate leaves checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: leaves checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	/* Only the first digest tree section is used
+	 */
+	if( hash_sections->digest_tree != NULL )
+	{
+		return( 1 );
+	}
+	if( libewf_digest_tree_initialize(
+	     &digest_tree,
+	     number_of_chunks_per_leaf,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_digest_tree_resize_leaves(
+	     digest_tree,
+	     number_of_leaves,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize digest tree leaves.",
+		 function );
+
+		goto on_error;
+	}
+	for( leaf_index = 0;
+	     leaf_index < number_of_leaves;
+	     leaf_index++ )
+	{
+		if( libewf_digest_tree_append_leaf(
+		     digest_tree,
+		     ( (ewf_digest_tree_leaf_t *) leaves_data )[ leaf_index ].digest,
+		     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf: %" PRIu32 " to digest tree.",
+			 function,
+			 leaf_index );
+
+			goto on_error;
+		}
+	}
+	/* Make sure the leaves were not altered without updating the root digest
+	 */
+	if( libewf_digest_tree_get_root_digest(
+	     digest_tree,
+	     calculated_root_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve calculated root digest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     ( (ewf_digest_tree_header_t *) data )->root_digest,
+	     calculated_root_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: root digest does not match the leaves.",
+		 function );
+
+		goto on_error;
+	}
+	hash_sections->digest_tree = digest_tree;
+
+	return( 1 );
+
+on_error:
+	if( digest_tree != NULL )
+	{
+		libewf_digest_tree_free(
+		 &digest_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a digest tree section
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_digest_tree_section_read_file_io_pool(
+         libewf_section_descriptor_t *section_descriptor,
+         libewf_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         libewf_hash_sections_t *hash_sections,
+         libcerror_error_t **error )
+{
+	uint8_t *section_data    = NULL;
+	static char *function    = "libewf_digest_tree_section_read_file_io_pool";
+	size_t section_data_size = 0;
+	ssize_t read_count       = 0;
+
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libewf_section_read_data(
+	              section_descriptor,
+	              io_handle,
+	              file_io_pool,
+	              file_io_pool_entry,
+	              &section_data,
+	              &section_data_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read section data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( read_count != 0 )
+	{
+		if( libewf_digest_tree_section_read_data(
+		     section_data,
+		     section_data_size,
+		     hash_sections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read digest tree section.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 section_data );
+	}
+	return( read_count );
+
+on_error:
+	if( section_data != NULL )
+	{
+		memory_free(
+		 section_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the digest tree section data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_section_get_data_size(
+     libewf_hash_sections_t *hash_sections,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_digest_tree_section_get_data_size";
+
+	if( hash_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_sections->digest_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash sections - missing digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) hash_sections->digest_tree->number_of_leaves > ( ( (size_t) SSIZE_MAX - sizeof( ewf_digest_tree_header_t ) - 4 ) / sizeof( ewf_digest_tree_leaf_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash sections - invalid digest tree - number of leaves value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = sizeof( ewf_digest_tree_header_t )
+	           + ( (size_t) hash_sections->digest_tree->number_of_leaves * sizeof( ewf_digest_tree_leaf_t ) )
+	           + 4;
+
+	return( 1 );
+}
+
+/* Writes a digest tree section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_digest_tree_section_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error )
+{
+	uint8_t *leaves_data         = NULL;
+	static char *function        = "libewf_digest_tree_section_write_data";
+	size_t leaves_data_size      = 0;
+	size_t required_data_size    = 0;
+	uint32_t calculated_checksum = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_digest_tree_section_get_data_size(
+	     hash_sections,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest tree section data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->number_of_chunks_per_leaf,
+	 hash_sections->digest_tree->number_of_chunks_per_leaf );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->number_of_leaves,
+	 hash_sections->digest_tree->number_of_leaves );
+
+	if( libewf_digest_tree_get_root_digest(
+	     hash_sections->digest_tree,
+	     ( (ewf_digest_tree_header_t *) data )->root_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     data,
+	     sizeof( ewf_digest_tree_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_digest_tree_header_t *) data )->checksum,
+	 calculated_checksum );
+
+	leaves_data      = &( data[ sizeof( ewf_digest_tree_header_t ) ] );
+	leaves_data_size = (size_t) hash_sections->digest_tree->number_of_leaves * sizeof( ewf_digest_tree_leaf_t );
+
+	if( memory_copy(
+	     leaves_data,
+	     hash_sections->digest_tree->leaves,
+	     leaves_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy leaves.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     leaves_data,
+	     leaves_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate leaves checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( leaves_data[ leaves_data_size ] ),
+	 calculated_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: digest tree header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( ewf_digest_tree_header_t ),
+		 0 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Writes a digest tree section
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libewf_digest_tree_section_write_file_io_pool(
+         libewf_section_descriptor_t *section_descriptor,
+         libewf_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t section_offset,
+         libewf_hash_sections_t *hash_sections,
+         libcerror_error_t **error )
+{
+	uint8_t *section_data     = NULL;
+	static char *function     = "libewf_digest_tree_section_write_file_io_pool";
+	size_t section_data_size  = 0;
+	ssize_t total_write_count = 0;
+	ssize_t write_count       = 0;
+
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_digest_tree_section_get_data_size(
+	     hash_sections,
+	     &section_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( section_data_size == 0 )
+	 || ( section_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	section_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * section_data_size );
+
+	if( section_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create section data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_digest_tree_section_write_data(
+	     section_data,
+	     section_data_size,
+	     hash_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write section data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_section_descriptor_set(
+	     section_descriptor,
+	     0,
+	     (uint8_t *) "digesttree",
+	     10,
+	     section_offset,
+	     (size64_t) ( sizeof( ewf_section_descriptor_v1_t ) + section_data_size ),
+	     (size64_t) section_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set section descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libewf_section_descriptor_write_file_io_pool(
+	               section_descriptor,
+	               file_io_pool,
+	               file_io_pool_entry,
+	               1,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( ewf_section_descriptor_v1_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write section descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	total_write_count += write_count;
+
+	write_count = libewf_section_write_data(
+	               section_descriptor,
+	               io_handle,
+	               file_io_pool,
+	               file_io_pool_entry,
+	               section_data,
+	               section_data_size,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write section data.",
+		 function );
+
+		goto on_error;
+	}
+	total_write_count += write_count;
+
+	memory_free(
+	 section_data );
+
+	return( total_write_count );
+
+on_error:
+	if( section_data != NULL )
+	{
+		memory_free(
+		 section_data );
+	}
+	return( -1 );
+}
@@ -36,6 +36,7 @@
 #include "libewf_libcthreads.h"
 #include "libewf_permission_group.h"
 #include "libewf_single_file_tree.h"
+#include "libewf_single_files.h"
 #include "libewf_source.h"
 #include "libewf_types.h"
 
@@ -2252,7 +2253,7 @@ ssize_t libewf_internal_file_entry_read_buffer(
 	{
 		read_size = 1;
 	}
-	read_count = libewf_handle_read_buffer_at_offset(
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
 		      internal_file_entry->handle,
 		      buffer,
 		      read_size,
@@ -2703,6 +2704,121 @@ int libewf_file_entry_get_offset(
 	return( 1 );
 }
 
+/* Retrieves the parent file entry
+ * Returns 1 if successful, 0 if the file entry has no parent or -1 on error
+ */
+int libewf_file_entry_get_parent_file_entry(
+     libewf_file_entry_t *file_entry,
+     libewf_file_entry_t **parent_file_entry,
+     libcerror_error_t **error )
+{
+	libewf_internal_file_entry_t *internal_file_entry = NULL;
+	libcdata_tree_node_t *parent_node                 = NULL;
+	static char *function                             = "libewf_file_entry_get_parent_file_entry";
+	int result                                        = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libewf_internal_file_entry_t *) file_entry;
+
+	if( parent_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parent_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: parent file entry already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_tree_node_get_parent_node(
+	     internal_file_entry->file_entry_tree_node,
+	     &parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry tree node.",
+		 function );
+
+		result = -1;
+	}
+	else if( parent_node == NULL )
+	{
+		result = 0;
+	}
+	else if( libewf_file_entry_initialize(
+	          parent_file_entry,
+	          internal_file_entry->handle,
+	          internal_file_entry->single_files,
+	          parent_node,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize parent file entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the number of sub file entries
  * Returns 1 if successful or -1 on error
  */
@@ -2743,10 +2859,24 @@ int libewf_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #endif
-	if( libcdata_tree_node_get_number_of_sub_nodes(
+	if( libewf_single_files_read_sub_file_entries(
+	     internal_file_entry->single_files,
 	     internal_file_entry->file_entry_tree_node,
-	     number_of_sub_file_entries,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub file entries.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_tree_node_get_number_of_sub_nodes(
+	          internal_file_entry->file_entry_tree_node,
+	          number_of_sub_file_entries,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2839,11 +2969,25 @@ int libewf_file_entry_get_sub_file_entry(
 		return( -1 );
 	}
 #endif
-	if( libcdata_tree_node_get_sub_node_by_index(
+	if( libewf_single_files_read_sub_file_entries(
+	     internal_file_entry->single_files,
 	     internal_file_entry->file_entry_tree_node,
-             sub_file_entry_index,
-             &sub_node,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub file entries.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_tree_node_get_sub_node_by_index(
+	          internal_file_entry->file_entry_tree_node,
+	          sub_file_entry_index,
+	          &sub_node,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2954,14 +3098,22 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_name(
 		return( -1 );
 	}
 #endif
-	result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+	result = libewf_single_files_read_sub_file_entries(
+	          internal_file_entry->single_files,
 	          internal_file_entry->file_entry_tree_node,
-	          utf8_string,
-	          utf8_string_length,
-	          &sub_node,
-	          &sub_lef_file_entry,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+		          internal_file_entry->file_entry_tree_node,
+		          utf8_string,
+		          utf8_string_length,
+		          &sub_node,
+		          &sub_lef_file_entry,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -3149,6 +3301,20 @@ int libewf_file_entry_get_sub_file_entry_by_utf8_path(
 
 			goto on_error;
 		}
+		if( libewf_single_files_read_sub_file_entries(
+		     internal_file_entry->single_files,
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub file entries.",
+			 function );
+
+			goto on_error;
+		}
 		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
 			  node,
 			  utf8_string_segment,
@@ -3285,14 +3451,22 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_name(
 		return( -1 );
 	}
 #endif
-	result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+	result = libewf_single_files_read_sub_file_entries(
+	          internal_file_entry->single_files,
 	          internal_file_entry->file_entry_tree_node,
-	          utf16_string,
-	          utf16_string_length,
-	          &sub_node,
-	          &sub_lef_file_entry,
 	          error );
 
+	if( result == 1 )
+	{
+		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+		          internal_file_entry->file_entry_tree_node,
+		          utf16_string,
+		          utf16_string_length,
+		          &sub_node,
+		          &sub_lef_file_entry,
+		          error );
+	}
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -3480,6 +3654,20 @@ int libewf_file_entry_get_sub_file_entry_by_utf16_path(
 
 			goto on_error;
 		}
+		if( libewf_single_files_read_sub_file_entries(
+		     internal_file_entry->single_files,
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub file entries.",
+			 function );
+
+			goto on_error;
+		}
 		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
 			  node,
 			  utf16_string_segment,
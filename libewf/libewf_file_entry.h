@@ -288,6 +288,12 @@ int libewf_file_entry_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_file_entry_get_parent_file_entry(
+     libewf_file_entry_t *file_entry,
+     libewf_file_entry_t **parent_file_entry,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_file_entry_get_number_of_sub_file_entries(
      libewf_file_entry_t *file_entry,
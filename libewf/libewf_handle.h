@@ -27,6 +27,9 @@
 
 #include "libewf_chunk_data.h"
 #include "libewf_chunk_group.h"
+#include "libewf_chunk_pack_pool.h"
+#include "libewf_chunk_prefetcher.h"
+#include "libewf_chunk_read_pool.h"
 #include "libewf_chunk_table.h"
 #include "libewf_data_chunk.h"
 #include "libewf_extern.h"
@@ -41,6 +44,7 @@
 #include "libewf_io_handle.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
+#include "libewf_segment_index.h"
 #include "libewf_segment_table.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
@@ -94,6 +98,45 @@ struct libewf_internal_handle
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The maximum (unpacked) chunk cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The maximum size of a coalesced read of adjacent chunks
+	 */
+	size64_t maximum_coalesced_read_size;
+
+	/* The number of threads used to pack chunks on write, prefetch chunks on read
+	 * and read the chunks of large reads
+	 */
+	int number_of_threads;
+
+	/* The maximum number of chunks to prefetch ahead of sequential reads
+	 */
+	int prefetch_window;
+
+	/* Value to indicate the segment files between the first and last segment file are read on demand
+	 */
+	uint8_t read_segment_files_on_demand;
+
+	/* The segment index filename
+	 */
+	char *segment_index_filename;
+
+	/* The segment index filename size
+	 */
+	size_t segment_index_filename_size;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The segment index wide filename
+	 */
+	wchar_t *segment_index_filename_wide;
+
+	/* The segment index wide filename size
+	 */
+	size_t segment_index_filename_wide_size;
+#endif
+
 	/* The current (storage media) offset
 	 */
 	off64_t current_offset;
@@ -138,7 +181,23 @@ struct libewf_internal_handle
 	 */
 	libewf_single_files_t *single_files;
 
+	/* The single files data stream
+	 */
+	libfdata_stream_t *single_files_data_stream;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The chunk pack pool
+	 */
+	libewf_chunk_pack_pool_t *chunk_pack_pool;
+
+	/* The chunk prefetcher
+	 */
+	libewf_chunk_prefetcher_t *chunk_prefetcher;
+
+	/* The chunk read pool
+	 */
+	libewf_chunk_read_pool_t *chunk_read_pool;
+
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
@@ -193,12 +252,37 @@ int libewf_internal_handle_open_read_segment_file_section_data(
      int file_io_pool_entry,
      libcerror_error_t **error );
 
+int libewf_internal_handle_open_segment_index_file_io_handle(
+     libewf_internal_handle_t *internal_handle,
+     int bfio_access_flags,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_open_read_segment_index(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_segment_table_t *segment_table,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_write_segment_index(
+     libewf_internal_handle_t *internal_handle,
+     libewf_segment_index_t *segment_index,
+     libcerror_error_t **error );
+
 int libewf_internal_handle_open_read_segment_files(
      libewf_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
      libewf_segment_table_t *segment_table,
      libcerror_error_t **error );
 
+int libewf_internal_handle_open_read_segment_files_on_demand(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_segment_table_t *segment_table,
+     uint32_t number_of_segments,
+     size64_t first_storage_media_size,
+     libcerror_error_t **error );
+
 int libewf_internal_handle_open_read_device_information(
      libewf_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
@@ -206,6 +290,15 @@ int libewf_internal_handle_open_read_device_information(
      uint32_t number_of_segments,
      libcerror_error_t **error );
 
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+int libewf_internal_handle_initialize_chunk_prefetcher(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+#endif
+
 int libewf_internal_handle_open_file_io_pool(
      libewf_internal_handle_t *internal_handle,
      libbfio_pool_t *file_io_pool,
@@ -225,6 +318,14 @@ int libewf_handle_close(
      libewf_handle_t *handle,
      libcerror_error_t **error );
 
+ssize_t libewf_internal_handle_read_buffer_at_offset_from_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -247,6 +348,41 @@ ssize_t libewf_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+ssize_t libewf_handle_read_buffer_at_offset_concurrent(
+         libewf_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_chunk_view(
+     libewf_handle_t *handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_release_chunk_view(
+     libewf_handle_t *handle,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+ssize_t libewf_internal_handle_write_packed_chunk_to_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         uint8_t wait_for_chunk,
+         libcerror_error_t **error );
+
+ssize_t libewf_internal_handle_write_chunk_data_to_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         uint64_t chunk_index,
+         libewf_chunk_data_t **chunk_data,
+         libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_write_buffer_to_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -334,6 +470,93 @@ int libewf_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_maximum_cache_size(
+     libewf_handle_t *handle,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_cache_size(
+     libewf_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_cache_statistics(
+     libewf_handle_t *handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_maximum_coalesced_read_size(
+     libewf_handle_t *handle,
+     size64_t *maximum_coalesced_read_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_coalesced_read_size(
+     libewf_handle_t *handle,
+     size64_t maximum_coalesced_read_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_threads(
+     libewf_handle_t *handle,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_number_of_threads(
+     libewf_handle_t *handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_prefetch_window(
+     libewf_handle_t *handle,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_prefetch_window(
+     libewf_handle_t *handle,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_prefetch_statistics(
+     libewf_handle_t *handle,
+     uint64_t *number_of_prefetched_chunks,
+     uint64_t *number_of_prefetch_hits,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_segment_index_filename(
+     libewf_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEWF_EXTERN \
+int libewf_handle_set_segment_index_filename_wide(
+     libewf_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEWF_EXTERN \
+int libewf_handle_set_read_segment_files_on_demand(
+     libewf_handle_t *handle,
+     uint8_t read_on_demand,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_segment_files_corrupted(
      libewf_handle_t *handle,
@@ -489,6 +712,26 @@ int libewf_handle_get_file_entry_by_utf16_path(
      libewf_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_file_entries_memory_usage(
+     libewf_handle_t *handle,
+     int *number_of_file_entries,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_data_ordered_file_entries(
+     libewf_handle_t *handle,
+     int *number_of_file_entries,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_data_ordered_file_entry_by_index(
+     libewf_handle_t *handle,
+     int file_entry_index,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_sectors_per_chunk(
      libewf_handle_t *handle,
@@ -660,6 +903,39 @@ int libewf_handle_set_sha1_hash(
      size_t size,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_chunks_per_digest_tree_leaf(
+     libewf_handle_t *handle,
+     uint32_t *number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_number_of_chunks_per_digest_tree_leaf(
+     libewf_handle_t *handle,
+     uint32_t number_of_chunks,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_digest_tree_leaves(
+     libewf_handle_t *handle,
+     uint32_t *number_of_leaves,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_digest_tree_leaf(
+     libewf_handle_t *handle,
+     uint32_t leaf_index,
+     uint8_t *leaf_digest,
+     size_t size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_digest_tree_root_digest(
+     libewf_handle_t *handle,
+     uint8_t *root_digest,
+     size_t size,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_set_read_zero_chunk_on_error(
      libewf_handle_t *handle,
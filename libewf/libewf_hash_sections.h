@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_digest_tree.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfvalue.h"
 
@@ -87,6 +88,10 @@ struct libewf_hash_sections
 	/* Value to indicate if the SHA1 digest was set
 	 */
 	uint8_t sha1_digest_set;
+
+	/* The digest tree of the data as found in the digest tree section
+	 */
+	libewf_digest_tree_t *digest_tree;
 };
 
 int libewf_hash_sections_initialize(
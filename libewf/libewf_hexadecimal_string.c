@@ -0,0 +1,792 @@
+/*
+ * Hexadecimal string functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_definitions.h"
+#include "libewf_hexadecimal_string.h"
+#include "libewf_libcerror.h"
+#include "libewf_serialized_string.h"
+
+/* Clears a hexadecimal string
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_hexadecimal_string_clear(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_clear";
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		if( libewf_serialized_string_free(
+		     &( hexadecimal_string->serialized_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free serialized string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hexadecimal_string->data_size = 0;
+
+	return( 1 );
+}
+
+/* Clones the hexadecimal string
+ * Make sure the destination hexadecimal string does not contain a serialized string
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_hexadecimal_string_clone(
+     libewf_hexadecimal_string_t *destination_hexadecimal_string,
+     libewf_hexadecimal_string_t *source_hexadecimal_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_clone";
+
+	if( destination_hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_hexadecimal_string->serialized_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination hexadecimal string - serialized string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     destination_hexadecimal_string->data,
+	     source_hexadecimal_string->data,
+	     sizeof( uint8_t ) * 20 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_serialized_string_clone(
+	     &( destination_hexadecimal_string->serialized_string ),
+	     source_hexadecimal_string->serialized_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone destination serialized string.",
+		 function );
+
+		destination_hexadecimal_string->data_size = 0;
+
+		return( -1 );
+	}
+	destination_hexadecimal_string->data_size = source_hexadecimal_string->data_size;
+
+	return( 1 );
+}
+
+/* Reads a hexadecimal string
+ * Hexadecimal strings of an even number of characters that fit in the binary data
+ * are stored as binary data, other hexadecimal strings as a serialized string
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_hexadecimal_string_read_data(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     const uint8_t *data,
+     size_t data_size,
+     int data_type,
+     libcerror_error_t **error )
+{
+	static char *function       = "libewf_hexadecimal_string_read_data";
+	size_t character_index      = 0;
+	size_t number_of_characters = 0;
+	size_t string_size          = 0;
+	uint16_t character_value    = 0;
+	uint8_t nibble              = 0;
+	int zero_values_only        = 1;
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hexadecimal_string->data_size != 0 )
+	 || ( hexadecimal_string->serialized_string != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hexadecimal string - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string_size = data_size;
+
+	if( data_type == LIBEWF_VALUE_DATA_TYPE_UTF8 )
+	{
+		if( ( string_size >= 1 )
+		 && ( data[ string_size - 1 ] == 0 ) )
+		{
+			string_size -= 1;
+		}
+		number_of_characters = string_size;
+	}
+	else
+	{
+		if( ( string_size >= 2 )
+		 && ( data[ string_size - 2 ] == 0 )
+		 && ( data[ string_size - 1 ] == 0 ) )
+		{
+			string_size -= 2;
+		}
+		number_of_characters = string_size / 2;
+	}
+	if( ( ( number_of_characters % 2 ) != 0 )
+	 || ( number_of_characters > ( 2 * 20 ) )
+	 || ( ( data_type != LIBEWF_VALUE_DATA_TYPE_UTF8 )
+	  &&  ( ( string_size % 2 ) != 0 ) ) )
+	{
+		if( libewf_serialized_string_initialize(
+		     &( hexadecimal_string->serialized_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create serialized string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_serialized_string_read_hexadecimal_data(
+		     hexadecimal_string->serialized_string,
+		     data,
+		     data_size,
+		     data_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read serialized string.",
+			 function );
+
+			goto on_error;
+		}
+		/* A hexadecimal string that only contains zero values is not set
+		 */
+		if( hexadecimal_string->serialized_string->data == NULL )
+		{
+			if( libewf_serialized_string_free(
+			     &( hexadecimal_string->serialized_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free serialized string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		if( data_type == LIBEWF_VALUE_DATA_TYPE_UTF8 )
+		{
+			character_value = data[ character_index ];
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ character_index * 2 ] ),
+			 character_value );
+		}
+		if( character_value != (uint16_t) '0' )
+		{
+			zero_values_only = 0;
+		}
+		if( ( character_value >= (uint16_t) '0' )
+		 && ( character_value <= (uint16_t) '9' ) )
+		{
+			nibble = (uint8_t) ( character_value - (uint16_t) '0' );
+		}
+		else if( ( character_value >= (uint16_t) 'A' )
+		      && ( character_value <= (uint16_t) 'F' ) )
+		{
+			nibble = (uint8_t) ( character_value - (uint16_t) 'A' + 10 );
+		}
+		else if( ( character_value >= (uint16_t) 'a' )
+		      && ( character_value <= (uint16_t) 'f' ) )
+		{
+			nibble = (uint8_t) ( character_value - (uint16_t) 'a' + 10 );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in hexadecimal string at offset: %" PRIzd ".",
+			 function,
+			 ( data_type == LIBEWF_VALUE_DATA_TYPE_UTF8 ) ? character_index : character_index * 2 );
+
+			return( -1 );
+		}
+		if( ( character_index % 2 ) == 0 )
+		{
+			hexadecimal_string->data[ character_index / 2 ] = nibble << 4;
+		}
+		else
+		{
+			hexadecimal_string->data[ character_index / 2 ] |= nibble;
+		}
+	}
+	/* A hexadecimal string that only contains zero values is not set
+	 */
+	if( zero_values_only == 0 )
+	{
+		hexadecimal_string->data_size = (uint8_t) ( number_of_characters / 2 );
+	}
+	return( 1 );
+
+on_error:
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		libewf_serialized_string_free(
+		 &( hexadecimal_string->serialized_string ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the memory used by the hexadecimal string
+ * This does not include the size of the hexadecimal string structure itself
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_hexadecimal_string_get_memory_usage(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_get_memory_usage";
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage = 0;
+
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		*memory_usage = sizeof( libewf_serialized_string_t )
+		              + hexadecimal_string->serialized_string->data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if data is not set or -1 on error
+ */
+int libewf_hexadecimal_string_get_utf8_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_get_utf8_string_size";
+	int result            = 0;
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		result = libewf_serialized_string_get_utf8_string_size(
+		          hexadecimal_string->serialized_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of serialized string.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( hexadecimal_string->data_size == 0 )
+	{
+		*utf8_string_size = 0;
+
+		return( 0 );
+	}
+	*utf8_string_size = ( (size_t) hexadecimal_string->data_size * 2 ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded string value
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if data is not set or -1 on error
+ */
+int libewf_hexadecimal_string_get_utf8_string(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_get_utf8_string";
+	size_t data_offset    = 0;
+	size_t string_index   = 0;
+	uint8_t nibble        = 0;
+	int result            = 0;
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		result = libewf_serialized_string_get_utf8_string(
+		          hexadecimal_string->serialized_string,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy serialized string to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( hexadecimal_string->data_size == 0 )
+	{
+		if( utf8_string_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ 0 ] = 0;
+
+		return( 0 );
+	}
+	if( utf8_string_size < ( ( (size_t) hexadecimal_string->data_size * 2 ) + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < (size_t) hexadecimal_string->data_size;
+	     data_offset++ )
+	{
+		nibble = hexadecimal_string->data[ data_offset ] >> 4;
+
+		if( nibble <= 9 )
+		{
+			utf8_string[ string_index++ ] = (uint8_t) '0' + nibble;
+		}
+		else
+		{
+			utf8_string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
+		}
+		nibble = hexadecimal_string->data[ data_offset ] & 0x0f;
+
+		if( nibble <= 9 )
+		{
+			utf8_string[ string_index++ ] = (uint8_t) '0' + nibble;
+		}
+		else
+		{
+			utf8_string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
+		}
+	}
+	utf8_string[ string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if data is not set or -1 on error
+ */
+int libewf_hexadecimal_string_get_utf16_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_get_utf16_string_size";
+	int result            = 0;
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		result = libewf_serialized_string_get_utf16_string_size(
+		          hexadecimal_string->serialized_string,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of serialized string.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( hexadecimal_string->data_size == 0 )
+	{
+		*utf16_string_size = 0;
+
+		return( 0 );
+	}
+	*utf16_string_size = ( (size_t) hexadecimal_string->data_size * 2 ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded string value
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if data is not set or -1 on error
+ */
+int libewf_hexadecimal_string_get_utf16_string(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_hexadecimal_string_get_utf16_string";
+	size_t data_offset    = 0;
+	size_t string_index   = 0;
+	uint8_t nibble        = 0;
+	int result            = 0;
+
+	if( hexadecimal_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hexadecimal_string->serialized_string != NULL )
+	{
+		result = libewf_serialized_string_get_utf16_string(
+		          hexadecimal_string->serialized_string,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy serialized string to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( hexadecimal_string->data_size == 0 )
+	{
+		if( utf16_string_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ 0 ] = 0;
+
+		return( 0 );
+	}
+	if( utf16_string_size < ( ( (size_t) hexadecimal_string->data_size * 2 ) + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-16 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < (size_t) hexadecimal_string->data_size;
+	     data_offset++ )
+	{
+		nibble = hexadecimal_string->data[ data_offset ] >> 4;
+
+		if( nibble <= 9 )
+		{
+			utf16_string[ string_index++ ] = (uint16_t) '0' + nibble;
+		}
+		else
+		{
+			utf16_string[ string_index++ ] = (uint16_t) 'a' + nibble - 10;
+		}
+		nibble = hexadecimal_string->data[ data_offset ] & 0x0f;
+
+		if( nibble <= 9 )
+		{
+			utf16_string[ string_index++ ] = (uint16_t) '0' + nibble;
+		}
+		else
+		{
+			utf16_string[ string_index++ ] = (uint16_t) 'a' + nibble - 10;
+		}
+	}
+	utf16_string[ string_index ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,104 @@
+/*
+ * Hexadecimal string functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_HEXADECIMAL_STRING_H )
+#define _LIBEWF_HEXADECIMAL_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_serialized_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_hexadecimal_string libewf_hexadecimal_string_t;
+
+/* A hexadecimal string such as a GUID or a digest hash
+ * that is stored as binary data instead of as a string
+ */
+struct libewf_hexadecimal_string
+{
+	/* The binary data
+	 */
+	uint8_t data[ 20 ];
+
+	/* The binary data size
+	 */
+	uint8_t data_size;
+
+	/* The serialized string
+	 * used for hexadecimal strings that do not fit in the binary data
+	 */
+	libewf_serialized_string_t *serialized_string;
+};
+
+int libewf_hexadecimal_string_clear(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_clone(
+     libewf_hexadecimal_string_t *destination_hexadecimal_string,
+     libewf_hexadecimal_string_t *source_hexadecimal_string,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_read_data(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     const uint8_t *data,
+     size_t data_size,
+     int data_type,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_get_memory_usage(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *memory_usage,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_get_utf8_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_get_utf8_string(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_get_utf16_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libewf_hexadecimal_string_get_utf16_string(
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_HEXADECIMAL_STRING_H ) */
+
@@ -226,6 +226,11 @@ int libewf_huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -296,6 +301,8 @@ int libewf_huffman_tree_build(
 
 		return( -1 );
 	}
+	huffman_tree->lookup_table_bits = 0;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -437,6 +444,26 @@ int libewf_huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	if( huffman_tree->maximum_code_size <= LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE )
+	{
+		if( libewf_huffman_tree_build_lookup_table(
+		     huffman_tree,
+		     code_sizes_array,
+		     number_of_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -448,6 +475,271 @@ on_error:
 	return( -1 );
 }
 
+/* Builds the lookup table used to decode multiple bits at once
+ * The lookup table is indexed by the next bits of a byte back-to-front bit stream
+ * Huffman codes larger than the primary lookup table bits are resolved using a sub table
+ * Returns 1 on success or -1 on error
+ */
+int libewf_huffman_tree_build_lookup_table(
+     libewf_huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t first_codes[ LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE + 1 ];
+	uint32_t next_codes[ LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE + 1 ];
+	uint32_t sub_table_offsets[ 1 << LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS ];
+	uint8_t sub_table_bits[ 1 << LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS ];
+
+	static char *function      = "libewf_huffman_tree_build_lookup_table";
+	void *reallocation         = NULL;
+	uint32_t code              = 0;
+	uint32_t entry             = 0;
+	uint32_t entry_index       = 0;
+	uint32_t number_of_entries = 0;
+	uint32_t primary_index     = 0;
+	uint32_t primary_mask      = 0;
+	uint32_t reversed_code     = 0;
+	uint16_t symbol            = 0;
+	uint8_t bit_index          = 0;
+	uint8_t code_size          = 0;
+	uint8_t lookup_table_bits  = 0;
+	int pass_index             = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->maximum_code_size > LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid Huffman tree - unsupported maximum code size.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_code_sizes < 0 )
+	 || ( number_of_code_sizes > (int) INT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	huffman_tree->lookup_table_bits = 0;
+
+	if( huffman_tree->maximum_code_size == 0 )
+	{
+		return( 1 );
+	}
+	if( huffman_tree->maximum_code_size < LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+	{
+		lookup_table_bits = huffman_tree->maximum_code_size;
+	}
+	else
+	{
+		lookup_table_bits = LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+	}
+	primary_mask = ( (uint32_t) 1 << lookup_table_bits ) - 1;
+
+	/* Determine the first canonical Huffman code per code size
+	 */
+	code = 0;
+
+	first_codes[ 0 ] = 0;
+
+	for( bit_index = 1;
+	     bit_index <= huffman_tree->maximum_code_size;
+	     bit_index++ )
+	{
+		if( bit_index > 1 )
+		{
+			code += (uint32_t) huffman_tree->code_size_counts[ bit_index - 1 ];
+		}
+		code <<= 1;
+
+		first_codes[ bit_index ] = code;
+	}
+	if( memory_set(
+	     sub_table_bits,
+	     0,
+	     sizeof( uint8_t ) * ( 1 << LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub table bits.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass determines the size of the sub tables
+	 * the second pass fills the lookup table
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		if( pass_index == 1 )
+		{
+			number_of_entries = (uint32_t) 1 << lookup_table_bits;
+
+			for( primary_index = 0;
+			     primary_index <= primary_mask;
+			     primary_index++ )
+			{
+				sub_table_offsets[ primary_index ] = number_of_entries;
+
+				if( sub_table_bits[ primary_index ] > 0 )
+				{
+					number_of_entries += (uint32_t) 1 << sub_table_bits[ primary_index ];
+				}
+			}
+			if( (size_t) number_of_entries > huffman_tree->lookup_table_size )
+			{
+				reallocation = memory_reallocate(
+				                huffman_tree->lookup_table,
+				                sizeof( uint32_t ) * number_of_entries );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize lookup table.",
+					 function );
+
+					return( -1 );
+				}
+				huffman_tree->lookup_table      = (uint32_t *) reallocation;
+				huffman_tree->lookup_table_size = (size_t) number_of_entries;
+			}
+			if( memory_set(
+			     huffman_tree->lookup_table,
+			     0,
+			     sizeof( uint32_t ) * number_of_entries ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear lookup table.",
+				 function );
+
+				return( -1 );
+			}
+			for( primary_index = 0;
+			     primary_index <= primary_mask;
+			     primary_index++ )
+			{
+				if( sub_table_bits[ primary_index ] > 0 )
+				{
+					huffman_tree->lookup_table[ primary_index ] = ( sub_table_offsets[ primary_index ] << 16 )
+					                                            | LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_FLAG_SUB_TABLE
+					                                            | sub_table_bits[ primary_index ];
+				}
+			}
+		}
+		for( bit_index = 0;
+		     bit_index <= huffman_tree->maximum_code_size;
+		     bit_index++ )
+		{
+			next_codes[ bit_index ] = first_codes[ bit_index ];
+		}
+		for( symbol = 0;
+		     symbol < (uint16_t) number_of_code_sizes;
+		     symbol++ )
+		{
+			code_size = code_sizes_array[ symbol ];
+
+			if( code_size == 0 )
+			{
+				continue;
+			}
+			code = next_codes[ code_size ];
+
+			next_codes[ code_size ] += 1;
+
+			if( ( pass_index == 0 )
+			 && ( code_size <= lookup_table_bits ) )
+			{
+				continue;
+			}
+			/* The Huffman code is stored most significant bit first
+			 */
+			reversed_code = 0;
+
+			for( bit_index = 0;
+			     bit_index < code_size;
+			     bit_index++ )
+			{
+				reversed_code <<= 1;
+				reversed_code  |= ( code >> bit_index ) & 0x00000001UL;
+			}
+			primary_index = reversed_code & primary_mask;
+
+			if( pass_index == 0 )
+			{
+				if( (uint8_t) ( code_size - lookup_table_bits ) > sub_table_bits[ primary_index ] )
+				{
+					sub_table_bits[ primary_index ] = code_size - lookup_table_bits;
+				}
+				continue;
+			}
+			entry = ( (uint32_t) symbol << 16 ) | code_size;
+
+			if( code_size <= lookup_table_bits )
+			{
+				for( entry_index = reversed_code;
+				     entry_index <= primary_mask;
+				     entry_index += (uint32_t) 1 << code_size )
+				{
+					huffman_tree->lookup_table[ entry_index ] = entry;
+				}
+			}
+			else
+			{
+				for( entry_index = reversed_code >> lookup_table_bits;
+				     entry_index < ( (uint32_t) 1 << sub_table_bits[ primary_index ] );
+				     entry_index += (uint32_t) 1 << ( code_size - lookup_table_bits ) )
+				{
+					huffman_tree->lookup_table[ sub_table_offsets[ primary_index ] + entry_index ] = entry;
+				}
+			}
+		}
+	}
+	huffman_tree->lookup_table_bits = lookup_table_bits;
+
+	return( 1 );
+}
+
 /* Retrieves a symbol based on the Huffman code read from the bit-stream
  * Returns 1 on success or -1 on error
  */
@@ -457,15 +749,18 @@ int libewf_huffman_tree_get_symbol_from_bit_stream(
      uint16_t *symbol,
      libcerror_error_t **error )
 {
-	static char *function  = "libewf_huffman_tree_get_symbol_from_bit_stream";
-	uint32_t value_32bit   = 0;
-	uint16_t safe_symbol   = 0;
-	uint8_t bit_index      = 0;
-	int code_size_count    = 0;
-	int first_huffman_code = 0;
-	int first_index        = 0;
-	int huffman_code       = 0;
-	int result             = 0;
+	static char *function       = "libewf_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_table_entry = 0;
+	uint32_t sub_table_index    = 0;
+	uint32_t value_32bit        = 0;
+	uint16_t safe_symbol        = 0;
+	uint8_t bit_index           = 0;
+	uint8_t code_size           = 0;
+	int code_size_count         = 0;
+	int first_huffman_code      = 0;
+	int first_index             = 0;
+	int huffman_code            = 0;
+	int result                  = 0;
 
 	if( huffman_tree == NULL )
 	{
@@ -500,8 +795,56 @@ int libewf_huffman_tree_get_symbol_from_bit_stream(
 
 		return( -1 );
 	}
-/* TODO get maximum_code_size of bits into local bit buffer */
+	if( ( huffman_tree->lookup_table_bits > 0 )
+	 && ( bit_stream->storage_type == LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) )
+	{
+		if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+		{
+			if( libewf_bit_stream_fill_bit_buffer(
+			     bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill bit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		lookup_table_entry = huffman_tree->lookup_table[ bit_stream->bit_buffer & ( ( (uint32_t) 1 << huffman_tree->lookup_table_bits ) - 1 ) ];
 
+		if( ( lookup_table_entry & LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_FLAG_SUB_TABLE ) != 0 )
+		{
+			sub_table_index = (uint32_t) ( bit_stream->bit_buffer >> huffman_tree->lookup_table_bits )
+			                & ( ( (uint32_t) 1 << ( lookup_table_entry & 0x000000ffUL ) ) - 1 );
+
+			lookup_table_entry = huffman_tree->lookup_table[ ( lookup_table_entry >> 16 ) + sub_table_index ];
+		}
+		code_size = (uint8_t) ( lookup_table_entry & 0x000000ffUL );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx64 ".",
+			 function,
+			 bit_stream->bit_buffer );
+
+			return( -1 );
+		}
+		bit_stream->bit_buffer    >>= code_size;
+		bit_stream->bit_buffer_size -= code_size;
+
+		*symbol = (uint16_t) ( lookup_table_entry >> 16 );
+
+		return( 1 );
+	}
 	for( bit_index = 1;
 	     bit_index <= huffman_tree->maximum_code_size;
 	     bit_index++ )
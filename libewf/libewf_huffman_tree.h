@@ -32,6 +32,18 @@
 extern "C" {
 #endif
 
+/* The number of bits used to index the primary lookup table
+ */
+#define LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS			10
+
+/* The maximum code size for which a lookup table is built
+ */
+#define LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE	15
+
+/* Flag that indicates a lookup table entry refers to a sub table
+ */
+#define LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_FLAG_SUB_TABLE		0x00000100UL
+
 typedef struct libewf_huffman_tree libewf_huffman_tree_t;
 
 struct libewf_huffman_tree
@@ -47,6 +59,22 @@ struct libewf_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The lookup table
+	 * An entry contains the code size in bits 0 - 7 and the symbol in bits 16 - 31
+	 * or the sub table flag, the number of sub table bits in bits 0 - 7
+	 * and the sub table offset in bits 16 - 31
+	 */
+	uint32_t *lookup_table;
+
+	/* The number of lookup table entries allocated
+	 */
+	size_t lookup_table_size;
+
+	/* The number of bits used to index the primary lookup table
+	 * 0 if the lookup table is not available
+	 */
+	uint8_t lookup_table_bits;
 };
 
 int libewf_huffman_tree_initialize(
@@ -65,6 +93,12 @@ int libewf_huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error );
 
+int libewf_huffman_tree_build_lookup_table(
+     libewf_huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error );
+
 int libewf_huffman_tree_get_symbol_from_bit_stream(
      libewf_huffman_tree_t *huffman_tree,
      libewf_bit_stream_t *bit_stream,
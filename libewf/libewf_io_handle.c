@@ -27,6 +27,7 @@
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
 #include "libewf_libcerror.h"
+#include "libewf_segment_index.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -174,6 +175,22 @@ int libewf_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->segment_index != NULL )
+	{
+		if( libewf_segment_index_free(
+		     &( io_handle->segment_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segment index.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -266,8 +283,25 @@ int libewf_io_handle_clone(
 
 		goto on_error;
 	}
-	( *destination_io_handle )->zero_on_error = source_io_handle->zero_on_error;
+	( *destination_io_handle )->zero_on_error     = source_io_handle->zero_on_error;
+	( *destination_io_handle )->segment_index     = NULL;
+	( *destination_io_handle )->chunk_data_pool   = NULL;
+	( *destination_io_handle )->chunk_read_buffer = NULL;
+
+	if( libewf_segment_index_clone(
+	     &( ( *destination_io_handle )->segment_index ),
+	     source_io_handle->segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination segment index.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
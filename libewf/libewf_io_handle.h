@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libewf_libcerror.h"
+#include "libewf_segment_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -83,9 +84,21 @@ struct libewf_io_handle
 	 */
 	int header_codepage;
 
+	/* The segment index
+	 */
+	libewf_segment_index_t *segment_index;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The chunk data pool, which is managed by the chunk table
+	 */
+	struct libewf_chunk_data_pool *chunk_data_pool;
+
+	/* The chunk read buffer, which is managed by the chunk table
+	 */
+	struct libewf_chunk_read_buffer *chunk_read_buffer;
 };
 
 int libewf_io_handle_initialize(
@@ -25,6 +25,7 @@
 
 #include "libewf_debug.h"
 #include "libewf_definitions.h"
+#include "libewf_hexadecimal_string.h"
 #include "libewf_lef_extended_attribute.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_libcdata.h"
@@ -33,6 +34,7 @@
 #include "libewf_libfguid.h"
 #include "libewf_libfvalue.h"
 #include "libewf_libuna.h"
+#include "libewf_name_index.h"
 #include "libewf_serialized_string.h"
 #include "libewf_value_reader.h"
 
@@ -106,72 +108,6 @@ int libewf_lef_file_entry_initialize(
 
 		return( -1 );
 	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->guid ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->short_name ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create short name string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->md5_hash ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create MD5 hash string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->sha1_hash ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create SHA1 hash string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_initialize(
-	     &( ( *lef_file_entry )->extended_attributes ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extended attributes array.",
-		 function );
-
-		goto on_error;
-	}
 	( *lef_file_entry )->data_offset            = -1;
 	( *lef_file_entry )->duplicate_data_offset  = -1;
 	( *lef_file_entry )->permission_group_index = 0;
@@ -181,30 +117,6 @@ int libewf_lef_file_entry_initialize(
 on_error:
 	if( *lef_file_entry != NULL )
 	{
-		if( ( *lef_file_entry )->sha1_hash != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->sha1_hash ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->md5_hash != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->md5_hash ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->short_name != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->short_name ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->guid != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->guid ),
-			 NULL );
-		}
 		memory_free(
 		 *lef_file_entry );
 
@@ -236,21 +148,18 @@ int libewf_lef_file_entry_free(
 	}
 	if( *lef_file_entry != NULL )
 	{
-		if( ( *lef_file_entry )->guid != NULL )
+		if( libewf_hexadecimal_string_clear(
+		     &( ( *lef_file_entry )->guid ),
+		     error ) != 1 )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->guid ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free GUID string.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear GUID.",
+			 function );
 
-				result = -1;
-			}
+			result = -1;
 		}
 		if( ( *lef_file_entry )->name_data != NULL )
 		{
@@ -273,50 +182,60 @@ int libewf_lef_file_entry_free(
 				result = -1;
 			}
 		}
-		if( ( *lef_file_entry )->md5_hash != NULL )
+		if( libewf_hexadecimal_string_clear(
+		     &( ( *lef_file_entry )->md5_hash ),
+		     error ) != 1 )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->md5_hash ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free MD5 hash string.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear MD5 hash.",
+			 function );
 
-				result = -1;
-			}
+			result = -1;
+		}
+		if( libewf_hexadecimal_string_clear(
+		     &( ( *lef_file_entry )->sha1_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear SHA1 hash.",
+			 function );
+
+			result = -1;
 		}
-		if( ( *lef_file_entry )->sha1_hash != NULL )
+		if( ( *lef_file_entry )->extended_attributes != NULL )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->sha1_hash ),
+			if( libcdata_array_free(
+			     &( ( *lef_file_entry )->extended_attributes ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free SHA1 hash string.",
+				 "%s: unable to free extended attributes array.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( ( *lef_file_entry )->extended_attributes != NULL )
+		if( ( *lef_file_entry )->sub_file_entries_name_index != NULL )
 		{
-			if( libcdata_array_free(
-			     &( ( *lef_file_entry )->extended_attributes ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
+			if( libewf_name_index_free(
+			     &( ( *lef_file_entry )->sub_file_entries_name_index ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free extended attributes array.",
+				 "%s: unable to free sub file entries name index.",
 				 function );
 
 				result = -1;
@@ -401,23 +320,30 @@ int libewf_lef_file_entry_clone(
 
 		return( -1 );
 	}
-	( *destination_lef_file_entry )->guid                = NULL;
-	( *destination_lef_file_entry )->name_data           = NULL;
-	( *destination_lef_file_entry )->short_name          = NULL;
-	( *destination_lef_file_entry )->md5_hash            = NULL;
-	( *destination_lef_file_entry )->sha1_hash           = NULL;
-	( *destination_lef_file_entry )->extended_attributes = NULL;
+	( *destination_lef_file_entry )->guid.serialized_string      = NULL;
+	( *destination_lef_file_entry )->guid.data_size              = 0;
+	( *destination_lef_file_entry )->name_data                   = NULL;
+	( *destination_lef_file_entry )->short_name                  = NULL;
+	( *destination_lef_file_entry )->md5_hash.serialized_string  = NULL;
+	( *destination_lef_file_entry )->md5_hash.data_size          = 0;
+	( *destination_lef_file_entry )->sha1_hash.serialized_string = NULL;
+	( *destination_lef_file_entry )->sha1_hash.data_size         = 0;
+	( *destination_lef_file_entry )->extended_attributes         = NULL;
 
-	if( libewf_serialized_string_clone(
+	/* The name index references the nodes of the source file entry tree
+	 */
+	( *destination_lef_file_entry )->sub_file_entries_name_index = NULL;
+
+	if( libewf_hexadecimal_string_clone(
 	     &( ( *destination_lef_file_entry )->guid ),
-	     source_lef_file_entry->guid,
+	     &( source_lef_file_entry->guid ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination GUID string.",
+		 "%s: unable to clone destination GUID.",
 		 function );
 
 		goto on_error;
@@ -464,49 +390,52 @@ int libewf_lef_file_entry_clone(
 
 		goto on_error;
 	}
-	if( libewf_serialized_string_clone(
+	if( libewf_hexadecimal_string_clone(
 	     &( ( *destination_lef_file_entry )->md5_hash ),
-	     source_lef_file_entry->md5_hash,
+	     &( source_lef_file_entry->md5_hash ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination MD5 hash string.",
+		 "%s: unable to clone destination MD5 hash.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_serialized_string_clone(
+	if( libewf_hexadecimal_string_clone(
 	     &( ( *destination_lef_file_entry )->sha1_hash ),
-	     source_lef_file_entry->sha1_hash,
+	     &( source_lef_file_entry->sha1_hash ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination SHA1 hash string.",
+		 "%s: unable to clone destination SHA1 hash.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_array_clone(
-	     &( ( *destination_lef_file_entry )->extended_attributes ),
-	     source_lef_file_entry->extended_attributes,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_lef_extended_attribute_clone,
-	     error ) != 1 )
+	if( source_lef_file_entry->extended_attributes != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination extended attributes array.",
-		 function );
+		if( libcdata_array_clone(
+		     &( ( *destination_lef_file_entry )->extended_attributes ),
+		     source_lef_file_entry->extended_attributes,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
+		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_lef_extended_attribute_clone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination extended attributes array.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	return( 1 );
 
@@ -816,6 +745,23 @@ int libewf_lef_file_entry_read_extended_attributes(
 
 		if( lef_extended_attribute->is_branch == 0 )
 		{
+			if( lef_file_entry->extended_attributes == NULL )
+			{
+				if( libcdata_array_initialize(
+				     &( lef_file_entry->extended_attributes ),
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create extended attributes array.",
+					 function );
+
+					goto on_error;
+				}
+			}
 			if( libcdata_array_append_entry(
 			     lef_file_entry->extended_attributes,
 			     &entry_index,
@@ -994,6 +940,22 @@ int libewf_lef_file_entry_read_short_name(
 	if( ( value_string != NULL )
 	 && ( value_string_size > 0 ) )
 	{
+		if( lef_file_entry->short_name == NULL )
+		{
+			if( libewf_serialized_string_initialize(
+			     &( lef_file_entry->short_name ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create short name string.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libewf_serialized_string_read_data(
 		     lef_file_entry->short_name,
 		     value_string,
@@ -1227,9 +1189,9 @@ int libewf_lef_file_entry_read_data(
 			      && ( type_string[ 1 ] == (uint8_t) 'i' )
 			      && ( type_string[ 2 ] == (uint8_t) 'd' ) )
 			{
-				result = libewf_value_reader_read_serialized_string_base16(
+				result = libewf_value_reader_read_hexadecimal_string(
 				          value_reader,
-				          lef_file_entry->guid,
+				          &( lef_file_entry->guid ),
 				          error );
 
 				if( result == -1 )
@@ -1251,8 +1213,8 @@ int libewf_lef_file_entry_read_data(
 					 function,
 					 (char *) type_string );
 					libcnotify_print_data(
-					 lef_file_entry->guid->data,
-					 lef_file_entry->guid->data_size,
+					 lef_file_entry->guid.data,
+					 lef_file_entry->guid.data_size,
 					 0 );
 				}
 #endif
@@ -1428,9 +1390,9 @@ int libewf_lef_file_entry_read_data(
 			      && ( type_string[ 1 ] == (uint8_t) 'h' )
 			      && ( type_string[ 2 ] == (uint8_t) 'a' ) )
 			{
-				result = libewf_value_reader_read_serialized_string_base16(
+				result = libewf_value_reader_read_hexadecimal_string(
 				          value_reader,
-				          lef_file_entry->sha1_hash,
+				          &( lef_file_entry->sha1_hash ),
 				          error );
 
 				if( result == -1 )
@@ -1452,8 +1414,8 @@ int libewf_lef_file_entry_read_data(
 					 function,
 					 (char *) type_string );
 					libcnotify_print_data(
-					 lef_file_entry->sha1_hash->data,
-					 lef_file_entry->sha1_hash->data_size,
+					 lef_file_entry->sha1_hash.data,
+					 lef_file_entry->sha1_hash.data_size,
 					 0 );
 				}
 #endif
@@ -1792,9 +1754,9 @@ int libewf_lef_file_entry_read_data(
 			else if( ( type_string[ 0 ] == (uint8_t) 'h' )
 			      && ( type_string[ 1 ] == (uint8_t) 'a' ) )
 			{
-				result = libewf_value_reader_read_serialized_string_base16(
+				result = libewf_value_reader_read_hexadecimal_string(
 				          value_reader,
-				          lef_file_entry->md5_hash,
+				          &( lef_file_entry->md5_hash ),
 				          error );
 
 				if( result == -1 )
@@ -1816,8 +1778,8 @@ int libewf_lef_file_entry_read_data(
 					 function,
 					 (char *) type_string );
 					libcnotify_print_data(
-					 lef_file_entry->md5_hash->data,
-					 lef_file_entry->md5_hash->data_size,
+					 lef_file_entry->md5_hash.data,
+					 lef_file_entry->md5_hash.data_size,
 					 0 );
 				}
 #endif
@@ -2318,6 +2280,154 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the memory used by the file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_lef_file_entry_get_memory_usage(
+     libewf_lef_file_entry_t *lef_file_entry,
+     size_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libewf_lef_extended_attribute_t *lef_extended_attribute = NULL;
+	static char *function                                   = "libewf_lef_file_entry_get_memory_usage";
+	size_t hexadecimal_string_memory_usage                  = 0;
+	size_t safe_memory_usage                                = 0;
+	int extended_attribute_index                            = 0;
+	int number_of_extended_attributes                       = 0;
+
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libewf_lef_file_entry_t ) + lef_file_entry->name_data_size;
+
+	if( libewf_hexadecimal_string_get_memory_usage(
+	     &( lef_file_entry->guid ),
+	     &hexadecimal_string_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve GUID memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage += hexadecimal_string_memory_usage;
+
+	if( libewf_hexadecimal_string_get_memory_usage(
+	     &( lef_file_entry->md5_hash ),
+	     &hexadecimal_string_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MD5 hash memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage += hexadecimal_string_memory_usage;
+
+	if( libewf_hexadecimal_string_get_memory_usage(
+	     &( lef_file_entry->sha1_hash ),
+	     &hexadecimal_string_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve SHA1 hash memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage += hexadecimal_string_memory_usage;
+
+	if( lef_file_entry->short_name != NULL )
+	{
+		safe_memory_usage += sizeof( libewf_serialized_string_t ) + lef_file_entry->short_name->data_size;
+	}
+	if( lef_file_entry->extended_attributes != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     lef_file_entry->extended_attributes,
+		     &number_of_extended_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from extended attributes array.",
+			 function );
+
+			return( -1 );
+		}
+		for( extended_attribute_index = 0;
+		     extended_attribute_index < number_of_extended_attributes;
+		     extended_attribute_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     lef_file_entry->extended_attributes,
+			     extended_attribute_index,
+			     (intptr_t **) &lef_extended_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from extended attributes array.",
+				 function,
+				 extended_attribute_index );
+
+				return( -1 );
+			}
+			if( lef_extended_attribute == NULL )
+			{
+				continue;
+			}
+			safe_memory_usage += sizeof( intptr_t * )
+			                   + sizeof( libewf_lef_extended_attribute_t )
+			                   + lef_extended_attribute->name_size
+			                   + lef_extended_attribute->value_size;
+		}
+	}
+	if( lef_file_entry->sub_file_entries_name_index != NULL )
+	{
+		safe_memory_usage += sizeof( libewf_name_index_t )
+		                   + ( sizeof( libewf_name_index_entry_t ) * (size_t) lef_file_entry->sub_file_entries_name_index->maximum_number_of_entries )
+		                   + ( 2 * sizeof( int ) * (size_t) lef_file_entry->sub_file_entries_name_index->number_of_buckets );
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
 /* Retrieves the identifier
  * Returns 1 if successful or -1 on error
  */
@@ -2637,8 +2747,8 @@ int libewf_lef_file_entry_get_utf8_guid_size(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf8_string_size(
-	          lef_file_entry->guid,
+	result = libewf_hexadecimal_string_get_utf8_string_size(
+	          &( lef_file_entry->guid ),
 	          utf8_string_size,
 	          error );
 
@@ -2680,8 +2790,8 @@ int libewf_lef_file_entry_get_utf8_guid(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->guid,
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          &( lef_file_entry->guid ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -2723,8 +2833,8 @@ int libewf_lef_file_entry_get_utf16_guid_size(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf16_string_size(
-	          lef_file_entry->guid,
+	result = libewf_hexadecimal_string_get_utf16_string_size(
+	          &( lef_file_entry->guid ),
 	          utf16_string_size,
 	          error );
 
@@ -2766,8 +2876,8 @@ int libewf_lef_file_entry_get_utf16_guid(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->guid,
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          &( lef_file_entry->guid ),
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3107,6 +3217,23 @@ int libewf_lef_file_entry_get_utf8_short_name_size(
 
 		return( -1 );
 	}
+	if( lef_file_entry->short_name == NULL )
+	{
+		if( utf8_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_size = 0;
+
+		return( 1 );
+	}
 	result = libewf_serialized_string_get_utf8_string_size(
 	          lef_file_entry->short_name,
 	          utf8_string_size,
@@ -3150,6 +3277,35 @@ int libewf_lef_file_entry_get_utf8_short_name(
 
 		return( -1 );
 	}
+	if( lef_file_entry->short_name == NULL )
+	{
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ 0 ] = 0;
+
+		return( 1 );
+	}
 	result = libewf_serialized_string_get_utf8_string(
 	          lef_file_entry->short_name,
 	          utf8_string,
@@ -3193,6 +3349,23 @@ int libewf_lef_file_entry_get_utf16_short_name_size(
 
 		return( -1 );
 	}
+	if( lef_file_entry->short_name == NULL )
+	{
+		if( utf16_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf16_string_size = 0;
+
+		return( 1 );
+	}
 	result = libewf_serialized_string_get_utf16_string_size(
 	          lef_file_entry->short_name,
 	          utf16_string_size,
@@ -3236,6 +3409,35 @@ int libewf_lef_file_entry_get_utf16_short_name(
 
 		return( -1 );
 	}
+	if( lef_file_entry->short_name == NULL )
+	{
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( utf16_string_size == 0 )
+		 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ 0 ] = 0;
+
+		return( 1 );
+	}
 	result = libewf_serialized_string_get_utf16_string(
 	          lef_file_entry->short_name,
 	          utf16_string,
@@ -3612,8 +3814,8 @@ int libewf_lef_file_entry_get_utf8_hash_value_md5(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->md5_hash,
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          &( lef_file_entry->md5_hash ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -3655,8 +3857,8 @@ int libewf_lef_file_entry_get_utf16_hash_value_md5(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->md5_hash,
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          &( lef_file_entry->md5_hash ),
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3698,8 +3900,8 @@ int libewf_lef_file_entry_get_utf8_hash_value_sha1(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->sha1_hash,
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          &( lef_file_entry->sha1_hash ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -3741,8 +3943,8 @@ int libewf_lef_file_entry_get_utf16_hash_value_sha1(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->sha1_hash,
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          &( lef_file_entry->sha1_hash ),
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3782,6 +3984,23 @@ int libewf_lef_file_entry_get_number_of_extended_attributes(
 
 		return( -1 );
 	}
+	if( lef_file_entry->extended_attributes == NULL )
+	{
+		if( number_of_extended_attributes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of extended attributes.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_extended_attributes = 0;
+
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     lef_file_entry->extended_attributes,
 	     number_of_extended_attributes,
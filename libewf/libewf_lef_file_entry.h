@@ -25,10 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_hexadecimal_string.h"
 #include "libewf_lef_extended_attribute.h"
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfvalue.h"
+#include "libewf_name_index.h"
 #include "libewf_serialized_string.h"
 
 #if defined( __cplusplus )
@@ -59,9 +61,9 @@ struct libewf_lef_file_entry
 	 */
 	size64_t data_size;
 
-	/* The GUID string
+	/* The GUID
 	 */
-	libewf_serialized_string_t *guid;
+	libewf_hexadecimal_string_t guid;
 
 	/* The name data
 	 */
@@ -72,6 +74,7 @@ struct libewf_lef_file_entry
 	size_t name_data_size;
 
 	/* The short name string
+	 * only created if the file entry has a short name
 	 */
 	libewf_serialized_string_t *short_name;
 
@@ -132,17 +135,26 @@ struct libewf_lef_file_entry
 	 */
 	int64_t deletion_time;
 
-	/* The MD5 digest hash string
+	/* The MD5 digest hash
 	 */
-	libewf_serialized_string_t *md5_hash;
+	libewf_hexadecimal_string_t md5_hash;
 
-	/* The SHA1 digest hash string
+	/* The SHA1 digest hash
 	 */
-	libewf_serialized_string_t *sha1_hash;
+	libewf_hexadecimal_string_t sha1_hash;
 
 	/* The extended attributes array
+	 * only created if the file entry has extended attributes
 	 */
 	libcdata_array_t *extended_attributes;
+
+	/* The index of the entry in the single files ltree index
+	 */
+	int ltree_entry_index;
+
+	/* The name index of the sub file entries
+	 */
+	libewf_name_index_t *sub_file_entries_name_index;
 };
 
 int libewf_lef_file_entry_initialize(
@@ -183,6 +195,11 @@ int libewf_lef_file_entry_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libewf_lef_file_entry_get_memory_usage(
+     libewf_lef_file_entry_t *lef_file_entry,
+     size_t *memory_usage,
+     libcerror_error_t **error );
+
 int libewf_lef_file_entry_get_identifier(
      libewf_lef_file_entry_t *lef_file_entry,
      uint64_t *identifier,
@@ -0,0 +1,571 @@
+/*
+ * Single files (ltree) entry index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_ltree_index.h"
+
+/* Creates a ltree index
+ * The ltree index maps the entries of the single files entry category,
+ * in the order they are stored, to the location of their data
+ * Make sure the value ltree_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_initialize(
+     libewf_ltree_index_t **ltree_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_initialize";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ltree_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ltree index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*ltree_index = memory_allocate_structure(
+	                libewf_ltree_index_t );
+
+	if( *ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ltree index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *ltree_index,
+	     0,
+	     sizeof( libewf_ltree_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ltree index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *ltree_index != NULL )
+	{
+		memory_free(
+		 *ltree_index );
+
+		*ltree_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a ltree index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_free(
+     libewf_ltree_index_t **ltree_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_free";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ltree_index != NULL )
+	{
+		if( ( *ltree_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *ltree_index )->entries );
+		}
+		memory_free(
+		 *ltree_index );
+
+		*ltree_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones the ltree index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_clone(
+     libewf_ltree_index_t **destination_ltree_index,
+     libewf_ltree_index_t *source_ltree_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_clone";
+	size_t entries_size   = 0;
+
+	if( destination_ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_ltree_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination ltree index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_ltree_index == NULL )
+	{
+		*destination_ltree_index = NULL;
+
+		return( 1 );
+	}
+	if( libewf_ltree_index_initialize(
+	     destination_ltree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination ltree index.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_ltree_index->number_of_entries > 0 )
+	{
+		entries_size = sizeof( libewf_ltree_index_entry_t ) * source_ltree_index->number_of_entries;
+
+		( *destination_ltree_index )->entries = (libewf_ltree_index_entry_t *) memory_allocate(
+		                                                                         entries_size );
+
+		if( ( *destination_ltree_index )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_ltree_index )->entries,
+		     source_ltree_index->entries,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination entries.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_ltree_index )->number_of_allocated_entries = source_ltree_index->number_of_entries;
+		( *destination_ltree_index )->number_of_entries           = source_ltree_index->number_of_entries;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_ltree_index != NULL )
+	{
+		libewf_ltree_index_free(
+		 destination_ltree_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_append_entry(
+     libewf_ltree_index_t *ltree_index,
+     off64_t data_offset,
+     size_t data_size,
+     int number_of_sub_entries,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libewf_ltree_index_entry_t *entry = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "libewf_ltree_index_append_entry";
+	int number_of_allocated_entries   = 0;
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of sub entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ltree_index->number_of_entries >= ltree_index->number_of_allocated_entries )
+	{
+		/* Grow the entries exponentially to keep the number of reallocations small
+		 */
+		if( ltree_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		else if( ltree_index->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = ltree_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		if( ( number_of_allocated_entries <= ltree_index->number_of_entries )
+		 || ( (size_t) number_of_allocated_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_ltree_index_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                ltree_index->entries,
+		                sizeof( libewf_ltree_index_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		ltree_index->entries                     = (libewf_ltree_index_entry_t *) reallocation;
+		ltree_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( ltree_index->entries[ ltree_index->number_of_entries ] );
+
+	entry->data_offset           = data_offset;
+	entry->data_size             = (uint32_t) data_size;
+	entry->number_of_sub_entries = number_of_sub_entries;
+	entry->next_entry_index      = ltree_index->number_of_entries + 1;
+
+	*entry_index = ltree_index->number_of_entries;
+
+	ltree_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Sets the next entry index of an entry to the index of the entry that will be appended next
+ * This function should be called after all the sub entries of the entry have been appended
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_set_next_entry_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_set_next_entry_index";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= ltree_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	ltree_index->entries[ entry_index ].next_entry_index = ltree_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_get_number_of_entries(
+     libewf_ltree_index_t *ltree_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_get_number_of_entries";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = ltree_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_get_entry_by_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     off64_t *data_offset,
+     size_t *data_size,
+     int *number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_get_entry_by_index";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= ltree_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	*data_offset           = ltree_index->entries[ entry_index ].data_offset;
+	*data_size             = (size_t) ltree_index->entries[ entry_index ].data_size;
+	*number_of_sub_entries = ltree_index->entries[ entry_index ].number_of_sub_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry that follows the sub entries of a specific entry
+ * For a sub entry this is the index of its next sibling entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_ltree_index_get_next_entry_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_ltree_index_get_next_entry_index";
+
+	if( ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ltree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= ltree_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry index.",
+		 function );
+
+		return( -1 );
+	}
+	*next_entry_index = ltree_index->entries[ entry_index ].next_entry_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Single files (ltree) entry index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_LTREE_INDEX_H )
+#define _LIBEWF_LTREE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_ltree_index_entry libewf_ltree_index_entry_t;
+
+struct libewf_ltree_index_entry
+{
+	/* The offset of the entry data in the single files data stream
+	 */
+	off64_t data_offset;
+
+	/* The size of the entry data
+	 */
+	uint32_t data_size;
+
+	/* The number of sub entries
+	 */
+	int number_of_sub_entries;
+
+	/* The index of the entry that follows the sub entries
+	 */
+	int next_entry_index;
+};
+
+typedef struct libewf_ltree_index libewf_ltree_index_t;
+
+struct libewf_ltree_index
+{
+	/* The entries
+	 */
+	libewf_ltree_index_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libewf_ltree_index_initialize(
+     libewf_ltree_index_t **ltree_index,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_free(
+     libewf_ltree_index_t **ltree_index,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_clone(
+     libewf_ltree_index_t **destination_ltree_index,
+     libewf_ltree_index_t *source_ltree_index,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_append_entry(
+     libewf_ltree_index_t *ltree_index,
+     off64_t data_offset,
+     size_t data_size,
+     int number_of_sub_entries,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_set_next_entry_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_get_number_of_entries(
+     libewf_ltree_index_t *ltree_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_get_entry_by_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     off64_t *data_offset,
+     size_t *data_size,
+     int *number_of_sub_entries,
+     libcerror_error_t **error );
+
+int libewf_ltree_index_get_next_entry_index(
+     libewf_ltree_index_t *ltree_index,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_LTREE_INDEX_H ) */
+
@@ -0,0 +1,861 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_lef_file_entry.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libuna.h"
+#include "libewf_name_index.h"
+
+/* The number of UTF-16 characters of an UTF-8 name that are converted without allocating memory
+ */
+#define LIBEWF_NAME_INDEX_MAXIMUM_STACK_NAME_LENGTH	256
+
+/* Folds the case of an UTF-16 character
+ * This uses a simple case folding of the Latin, Greek and Cyrillic upper case characters
+ * Returns the case folded character
+ */
+uint16_t libewf_name_index_fold_character(
+          uint16_t character )
+{
+	if( ( character >= 0x0041 )
+	 && ( character <= 0x005a ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( character < 0x00c0 )
+	{
+		return( character );
+	}
+	if( ( character <= 0x00de )
+	 && ( character != 0x00d7 ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( ( character >= 0x0100 )
+	 && ( character <= 0x017f ) )
+	{
+		if( character == 0x0178 )
+		{
+			return( 0x00ff );
+		}
+		if( ( ( character >= 0x0139 )
+		  &&  ( character <= 0x0148 ) )
+		 || ( ( character >= 0x0179 )
+		  &&  ( character <= 0x017e ) ) )
+		{
+			if( ( character & 1 ) != 0 )
+			{
+				return( character + 1 );
+			}
+		}
+		else if( ( character != 0x0130 )
+		      && ( character != 0x0131 )
+		      && ( character != 0x0138 )
+		      && ( character != 0x0149 )
+		      && ( character != 0x017f ) )
+		{
+			if( ( character & 1 ) == 0 )
+			{
+				return( character + 1 );
+			}
+		}
+		return( character );
+	}
+	if( ( character >= 0x0391 )
+	 && ( character <= 0x03ab )
+	 && ( character != 0x03a2 ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( ( character >= 0x0400 )
+	 && ( character <= 0x040f ) )
+	{
+		return( character + 0x0050 );
+	}
+	if( ( character >= 0x0410 )
+	 && ( character <= 0x042f ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( ( character >= 0xff21 )
+	 && ( character <= 0xff3a ) )
+	{
+		return( character + 0x0020 );
+	}
+	return( character );
+}
+
+/* Calculates the name hashes of a little-endian UTF-16 stream
+ * The name ends at the first end of string character or at the end of the stream
+ */
+void libewf_name_index_calculate_utf16_stream_hashes(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      uint32_t *name_hash,
+      uint32_t *case_folded_name_hash )
+{
+	size_t utf16_stream_offset = 0;
+	uint32_t safe_hash         = 2166136261UL;
+	uint32_t safe_folded_hash  = 2166136261UL;
+	uint16_t character         = 0;
+
+	if( utf16_stream != NULL )
+	{
+		while( ( utf16_stream_offset + 1 ) < utf16_stream_size )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_offset ] ),
+			 character );
+
+			if( character == 0 )
+			{
+				break;
+			}
+			safe_hash ^= character;
+			safe_hash *= 16777619UL;
+
+			safe_folded_hash ^= libewf_name_index_fold_character(
+			                     character );
+			safe_folded_hash *= 16777619UL;
+
+			utf16_stream_offset += 2;
+		}
+	}
+	*name_hash             = safe_hash;
+	*case_folded_name_hash = safe_folded_hash;
+}
+
+/* Calculates the name hash of an UTF-16 string
+ * The name ends at the first end of string character or at the end of the string
+ * Returns the name hash
+ */
+uint32_t libewf_name_index_calculate_utf16_string_hash(
+          const uint16_t *utf16_string,
+          size_t utf16_string_length,
+          uint8_t use_case_folding )
+{
+	size_t utf16_string_index = 0;
+	uint32_t hash             = 2166136261UL;
+	uint16_t character        = 0;
+
+	while( utf16_string_index < utf16_string_length )
+	{
+		character = utf16_string[ utf16_string_index++ ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( use_case_folding != 0 )
+		{
+			character = libewf_name_index_fold_character(
+			             character );
+		}
+		hash ^= character;
+		hash *= 16777619UL;
+	}
+	return( hash );
+}
+
+/* Compares a little-endian UTF-16 stream with an UTF-16 string
+ * Returns 1 if equal or 0 if not
+ */
+int libewf_name_index_compare_utf16_stream_with_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding )
+{
+	size_t utf16_stream_offset = 0;
+	size_t utf16_string_index  = 0;
+	uint16_t stream_character  = 0;
+	uint16_t string_character  = 0;
+
+	if( utf16_stream == NULL )
+	{
+		utf16_stream_size = 0;
+	}
+	do
+	{
+		stream_character = 0;
+		string_character = 0;
+
+		if( ( utf16_stream_offset + 1 ) < utf16_stream_size )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_offset ] ),
+			 stream_character );
+
+			utf16_stream_offset += 2;
+		}
+		if( utf16_string_index < utf16_string_length )
+		{
+			string_character = utf16_string[ utf16_string_index++ ];
+		}
+		if( use_case_folding != 0 )
+		{
+			stream_character = libewf_name_index_fold_character(
+			                    stream_character );
+			string_character = libewf_name_index_fold_character(
+			                    string_character );
+		}
+		if( stream_character != string_character )
+		{
+			return( 0 );
+		}
+	}
+	while( stream_character != 0 );
+
+	return( 1 );
+}
+
+/* Creates a name index
+ * The name index maps the names of the sub file entries of a directory to their nodes
+ * Make sure the value name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_name_index_initialize(
+     libewf_name_index_t **name_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_name_index_initialize";
+	size_t buckets_size        = 0;
+	uint32_t bucket_index      = 0;
+	uint32_t number_of_buckets = 16;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries < 0 )
+	 || ( (size_t) maximum_number_of_entries > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_name_index_entry_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least twice as many buckets as entries to keep the chains short
+	 */
+	while( ( number_of_buckets / 2 ) < (uint32_t) maximum_number_of_entries )
+	{
+		number_of_buckets *= 2;
+	}
+	buckets_size = sizeof( int ) * number_of_buckets;
+
+	if( buckets_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buckets size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = memory_allocate_structure(
+	               libewf_name_index_t );
+
+	if( *name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_index,
+	     0,
+	     sizeof( libewf_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name index.",
+		 function );
+
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries > 0 )
+	{
+		( *name_index )->entries = (libewf_name_index_entry_t *) memory_allocate(
+		                                                          sizeof( libewf_name_index_entry_t ) * maximum_number_of_entries );
+
+		if( ( *name_index )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *name_index )->buckets = (int *) memory_allocate(
+	                                    buckets_size );
+
+	if( ( *name_index )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_index )->case_folded_buckets = (int *) memory_allocate(
+	                                                buckets_size );
+
+	if( ( *name_index )->case_folded_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *name_index )->buckets[ bucket_index ]             = -1;
+		( *name_index )->case_folded_buckets[ bucket_index ] = -1;
+	}
+	( *name_index )->maximum_number_of_entries = maximum_number_of_entries;
+	( *name_index )->number_of_buckets         = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		libewf_name_index_free(
+		 name_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a name index
+ * The nodes are not freed, they are owned by the file entry tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_name_index_free(
+     libewf_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_name_index_free";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		if( ( *name_index )->case_folded_buckets != NULL )
+		{
+			memory_free(
+			 ( *name_index )->case_folded_buckets );
+		}
+		if( ( *name_index )->buckets != NULL )
+		{
+			memory_free(
+			 ( *name_index )->buckets );
+		}
+		if( ( *name_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *name_index )->entries );
+		}
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a (file entry) node to the name index
+ * The node value must be a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_name_index_append_node(
+     libewf_name_index_t *name_index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libewf_name_index_entry_t *entry        = NULL;
+	static char *function                   = "libewf_name_index_append_node";
+	uint32_t bucket_index                   = 0;
+	int entry_index                         = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->number_of_entries >= name_index->maximum_number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index - maximum number of entries reached.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing file entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = name_index->number_of_entries;
+	entry       = &( name_index->entries[ entry_index ] );
+
+	libewf_name_index_calculate_utf16_stream_hashes(
+	 lef_file_entry->name_data,
+	 lef_file_entry->name_data_size,
+	 &( entry->name_hash ),
+	 &( entry->case_folded_name_hash ) );
+
+	entry->node = node;
+
+	bucket_index = entry->name_hash & ( name_index->number_of_buckets - 1 );
+
+	entry->next_entry_index             = name_index->buckets[ bucket_index ];
+	name_index->buckets[ bucket_index ] = entry_index;
+
+	bucket_index = entry->case_folded_name_hash & ( name_index->number_of_buckets - 1 );
+
+	entry->next_case_folded_entry_index             = name_index->case_folded_buckets[ bucket_index ];
+	name_index->case_folded_buckets[ bucket_index ] = entry_index;
+
+	name_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the node for the specific UTF-16 formatted name
+ * Returns 1 if successful, 0 if no such node or -1 on error
+ */
+int libewf_name_index_get_node_by_utf16_name(
+     libewf_name_index_t *name_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libewf_name_index_entry_t *entry        = NULL;
+	static char *function                   = "libewf_name_index_get_node_by_utf16_name";
+	uint32_t bucket_index                   = 0;
+	uint32_t name_hash                      = 0;
+	int entry_index                         = 0;
+	int result                              = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	*node = NULL;
+
+	name_hash = libewf_name_index_calculate_utf16_string_hash(
+	             utf16_string,
+	             utf16_string_length,
+	             use_case_folding );
+
+	bucket_index = name_hash & ( name_index->number_of_buckets - 1 );
+
+	if( use_case_folding == 0 )
+	{
+		entry_index = name_index->buckets[ bucket_index ];
+	}
+	else
+	{
+		entry_index = name_index->case_folded_buckets[ bucket_index ];
+	}
+	while( entry_index != -1 )
+	{
+		entry = &( name_index->entries[ entry_index ] );
+
+		if( use_case_folding == 0 )
+		{
+			entry_index = entry->next_entry_index;
+
+			if( entry->name_hash != name_hash )
+			{
+				continue;
+			}
+		}
+		else
+		{
+			entry_index = entry->next_case_folded_entry_index;
+
+			if( entry->case_folded_name_hash != name_hash )
+			{
+				continue;
+			}
+		}
+		if( libcdata_tree_node_get_value(
+		     entry->node,
+		     (intptr_t **) &lef_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry from node.",
+			 function );
+
+			return( -1 );
+		}
+		if( lef_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( libewf_name_index_compare_utf16_stream_with_utf16_string(
+		     lef_file_entry->name_data,
+		     lef_file_entry->name_data_size,
+		     utf16_string,
+		     utf16_string_length,
+		     use_case_folding ) != 0 )
+		{
+			/* The entries are pushed onto the head of the bucket chain,
+			 * hence a later match has a lower entry index. Keep the last match
+			 * so that duplicate names resolve to the first sub node, like the
+			 * linear sub node search does
+			 */
+			*node  = entry->node;
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the node for the specific UTF-8 formatted name
+ * Returns 1 if successful, 0 if no such node or -1 on error
+ */
+int libewf_name_index_get_node_by_utf8_name(
+     libewf_name_index_t *name_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	uint16_t stack_utf16_string[ LIBEWF_NAME_INDEX_MAXIMUM_STACK_NAME_LENGTH ];
+
+	uint16_t *utf16_string   = NULL;
+	static char *function    = "libewf_name_index_get_node_by_utf8_name";
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	*node = NULL;
+
+	if( utf8_string_length == 0 )
+	{
+		stack_utf16_string[ 0 ] = 0;
+
+		return( libewf_name_index_get_node_by_utf16_name(
+		         name_index,
+		         stack_utf16_string,
+		         0,
+		         use_case_folding,
+		         node,
+		         error ) );
+	}
+	/* The name is converted to UTF-16 since that is how the names are stored
+	 */
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf16_string_size <= LIBEWF_NAME_INDEX_MAXIMUM_STACK_NAME_LENGTH )
+	{
+		utf16_string = stack_utf16_string;
+	}
+	else
+	{
+		if( utf16_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf16_string = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * utf16_string_size );
+
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     utf16_string,
+	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	result = libewf_name_index_get_node_by_utf16_name(
+	          name_index,
+	          utf16_string,
+	          utf16_string_size,
+	          use_case_folding,
+	          node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node by UTF-16 name.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf16_string != stack_utf16_string )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( result );
+
+on_error:
+	if( ( utf16_string != NULL )
+	 && ( utf16_string != stack_utf16_string ) )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
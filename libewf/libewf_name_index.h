@@ -0,0 +1,145 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_NAME_INDEX_H )
+#define _LIBEWF_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_name_index_entry libewf_name_index_entry_t;
+
+struct libewf_name_index_entry
+{
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The case folded name hash
+	 */
+	uint32_t case_folded_name_hash;
+
+	/* The index of the next entry in the same name hash bucket
+	 */
+	int next_entry_index;
+
+	/* The index of the next entry in the same case folded name hash bucket
+	 */
+	int next_case_folded_entry_index;
+
+	/* The (file entry) node
+	 */
+	libcdata_tree_node_t *node;
+};
+
+typedef struct libewf_name_index libewf_name_index_t;
+
+struct libewf_name_index
+{
+	/* The entries
+	 */
+	libewf_name_index_entry_t *entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The name hash buckets
+	 */
+	int *buckets;
+
+	/* The case folded name hash buckets
+	 */
+	int *case_folded_buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+};
+
+uint16_t libewf_name_index_fold_character(
+          uint16_t character );
+
+void libewf_name_index_calculate_utf16_stream_hashes(
+      const uint8_t *utf16_stream,
+      size_t utf16_stream_size,
+      uint32_t *name_hash,
+      uint32_t *case_folded_name_hash );
+
+uint32_t libewf_name_index_calculate_utf16_string_hash(
+          const uint16_t *utf16_string,
+          size_t utf16_string_length,
+          uint8_t use_case_folding );
+
+int libewf_name_index_compare_utf16_stream_with_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding );
+
+int libewf_name_index_initialize(
+     libewf_name_index_t **name_index,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libewf_name_index_free(
+     libewf_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libewf_name_index_append_node(
+     libewf_name_index_t *name_index,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libewf_name_index_get_node_by_utf8_name(
+     libewf_name_index_t *name_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error );
+
+int libewf_name_index_get_node_by_utf16_name(
+     libewf_name_index_t *name_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_NAME_INDEX_H ) */
+
@@ -36,6 +36,7 @@
 #include "libewf_definitions.h"
 #include "libewf_device_information.h"
 #include "libewf_digest_section.h"
+#include "libewf_digest_tree_section.h"
 #include "libewf_error2_section.h"
 #include "libewf_hash_values.h"
 #include "libewf_header_values.h"
@@ -53,6 +54,8 @@
 #include "libewf_section.h"
 #include "libewf_section_descriptor.h"
 #include "libewf_segment_file.h"
+#include "libewf_segment_index.h"
+#include "libewf_segment_index_entry.h"
 #include "libewf_segment_table.h"
 #include "libewf_session_section.h"
 #include "libewf_sha1_hash_section.h"
@@ -4868,6 +4871,80 @@ ssize_t libewf_segment_file_write_hash_sections(
 			goto on_error;
 		}
 	}
+	/* Write the digest tree section if required
+	 */
+	if( ( segment_file->major_version == 1 )
+	 && ( hash_sections->digest_tree != NULL )
+	 && ( hash_sections->digest_tree->number_of_leaves > 0 ) )
+	{
+		if( libewf_section_descriptor_initialize(
+		     &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		write_count = libewf_digest_tree_section_write_file_io_pool(
+			       section_descriptor,
+			       segment_file->io_handle,
+			       file_io_pool,
+			       file_io_pool_entry,
+			       segment_file->current_offset,
+			       hash_sections,
+			       error );
+
+		if( write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write digest tree section.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_list_append_element(
+		     segment_file->sections_list,
+		     &element_index,
+		     file_io_pool_entry,
+		     segment_file->current_offset,
+		     sizeof( ewf_section_descriptor_v1_t ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element to sections list.",
+			 function );
+
+			goto on_error;
+		}
+		segment_file->current_offset += write_count;
+		total_write_count            += write_count;
+
+		if( libewf_section_descriptor_free(
+		     &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( total_write_count );
 
 on_error:
@@ -6121,203 +6198,546 @@ on_error:
 	return( -1 );
 }
 
-/* Reads a segment file
- * Callback function for the segment files list
+/* Retrieves a segment index entry of the segment file
+ * The segment index entry contains the values needed to set the segment file
+ * without reading the section descriptors and table sections
  * Returns 1 if successful or -1 on error
  */
-int libewf_segment_file_read_element_data(
-     libewf_io_handle_t *io_handle,
-     libbfio_pool_t *file_io_pool,
-     libfdata_list_element_t *element,
-     libfdata_cache_t *segment_file_cache,
-     int file_io_pool_entry,
-     off64_t segment_file_offset,
-     size64_t segment_file_size,
-     uint32_t element_flags LIBEWF_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBEWF_ATTRIBUTE_UNUSED,
+int libewf_segment_file_get_segment_index_entry(
+     libewf_segment_file_t *segment_file,
+     libewf_segment_index_entry_t *segment_index_entry,
      libcerror_error_t **error )
 {
-	libewf_section_descriptor_t *section_descriptor = NULL;
-	libewf_segment_file_t *segment_file             = NULL;
-	libfcache_cache_t *sections_cache               = NULL;
-	static char *function                           = "libewf_segment_file_read_element_data";
-	ssize_t read_count                              = 0;
-	off64_t section_data_offset                     = 0;
-	int element_index                               = 0;
-	int last_section                                = 0;
-	int number_of_sections                          = 0;
-	int result                                      = 0;
-	int section_index                               = 0;
-
-	LIBEWF_UNREFERENCED_PARAMETER( element_flags )
-	LIBEWF_UNREFERENCED_PARAMETER( read_flags )
+	static char *function       = "libewf_segment_file_get_segment_index_entry";
+	size64_t list_element_size  = 0;
+	size64_t mapped_size        = 0;
+	off64_t list_element_offset = 0;
+	uint32_t list_element_flags = 0;
+	int list_element_file_index = 0;
+	int list_element_index      = 0;
+	int number_of_chunk_groups  = 0;
+	int number_of_sections      = 0;
 
-	if( io_handle == NULL )
+	if( segment_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid segment file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libewf_segment_file_initialize(
-	     &segment_file,
-	     io_handle,
-	     error ) != 1 )
+	if( segment_index_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create segment file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
 		 function );
 
-		goto on_error;
-	}
-	if( segment_file_size == 0 )
-	{
-		/* segment_file_size is 0 on write correction
-		 */
-		if( libbfio_pool_get_size(
-		     file_io_pool,
-		     file_io_pool_entry,
-		     &segment_file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment file size.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	read_count = libewf_segment_file_read_file_header_file_io_pool(
-		      segment_file,
-		      file_io_pool,
-		      file_io_pool_entry,
-		      error );
-
-/* TODO deal with corrupted header ? */
-	if( read_count == -1 )
+	if( libfdata_list_get_number_of_elements(
+	     segment_file->sections_list,
+	     &number_of_sections,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of elements from sections list.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1 )
-	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL )
-	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
-	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
-	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	if( libfdata_list_get_number_of_elements(
+	     segment_file->chunk_groups_list,
+	     &number_of_chunk_groups,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported segment file type.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of elements from chunk groups list.",
 		 function );
 
-		goto on_error;
-	}
-	if( ( io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
-	 && ( segment_file->type == LIBEWF_SEGMENT_FILE_TYPE_EWF1 ) )
-	{
-		segment_file->type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
+		return( -1 );
 	}
-	else if( ( io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_UNDEFINED )
-	      && ( io_handle->segment_file_type != segment_file->type ) )
+	if( libewf_segment_index_entry_resize(
+	     segment_index_entry,
+	     number_of_sections,
+	     number_of_chunk_groups,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-		 "%s: segment file type value mismatch.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize segment index entry.",
 		 function );
 
-		goto on_error;
-	}
-	if( segment_file->major_version == 2 )
-	{
-		if( ( segment_file->compression_method != LIBEWF_COMPRESSION_METHOD_DEFLATE )
-		 && ( segment_file->compression_method != LIBEWF_COMPRESSION_METHOD_BZIP2 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported compression method.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	/* Read the section descriptors:
-	 * EWF version 1 read from front to back
-	 * EWF version 2 read from back to front
-	 */
-	if( segment_file->major_version == 1 )
-	{
-		segment_file_offset = (off64_t) read_count;
-	}
-	else if( segment_file->major_version == 2 )
-	{
-		segment_file_offset = (off64_t) segment_file_size - sizeof( ewf_section_descriptor_v2_t );
+		return( -1 );
 	}
-	last_section = 0;
+	segment_index_entry->segment_number                   = segment_file->segment_number;
+	segment_index_entry->type                             = segment_file->type;
+	segment_index_entry->major_version                    = segment_file->major_version;
+	segment_index_entry->minor_version                    = segment_file->minor_version;
+	segment_index_entry->flags                            = segment_file->flags;
+	segment_index_entry->compression_method               = segment_file->compression_method;
+	segment_index_entry->device_information_section_index = segment_file->device_information_section_index;
+	segment_index_entry->last_section_offset              = segment_file->last_section_offset;
+	segment_index_entry->storage_media_size               = segment_file->storage_media_size;
+	segment_index_entry->number_of_chunks                 = segment_file->number_of_chunks;
+	segment_index_entry->previous_last_chunk_filled       = segment_file->previous_last_chunk_filled;
+	segment_index_entry->last_chunk_filled                = segment_file->last_chunk_filled;
+	segment_index_entry->last_chunk_compared              = segment_file->last_chunk_compared;
 
-	if( libewf_section_descriptor_initialize(
-	     &section_descriptor,
-	     error ) != 1 )
+	if( memory_copy(
+	     segment_index_entry->set_identifier,
+	     segment_file->set_identifier,
+	     16 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create section descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( ( segment_file_offset > 0 )
-	    && ( (size64_t) segment_file_offset < segment_file_size ) )
+	for( list_element_index = 0;
+	     list_element_index < number_of_sections;
+	     list_element_index++ )
 	{
-		read_count = libewf_section_descriptor_read_file_io_pool(
-			      section_descriptor,
-			      file_io_pool,
-			      file_io_pool_entry,
-			      segment_file_offset,
-			      segment_file->major_version,
-			      error );
-
-		if( read_count == -1 )
+		if( libfdata_list_get_element_by_index(
+		     segment_file->sections_list,
+		     list_element_index,
+		     &list_element_file_index,
+		     &list_element_offset,
+		     &list_element_size,
+		     &list_element_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read section descriptor.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from sections list.",
+			 function,
+			 list_element_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
+			return( -1 );
+		}
+		if( libewf_segment_index_entry_set_section_by_index(
+		     segment_index_entry,
+		     list_element_index,
+		     list_element_offset,
+		     list_element_size,
+		     (uint8_t) list_element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set section: %d in segment index entry.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+	}
+	for( list_element_index = 0;
+	     list_element_index < number_of_chunk_groups;
+	     list_element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     segment_file->chunk_groups_list,
+		     list_element_index,
+		     &list_element_file_index,
+		     &list_element_offset,
+		     &list_element_size,
+		     &list_element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from chunk groups list.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+		if( libfdata_list_get_mapped_size_by_index(
+		     segment_file->chunk_groups_list,
+		     list_element_index,
+		     &mapped_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped size: %d from chunk groups list.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+		if( libewf_segment_index_entry_set_chunk_group_by_index(
+		     segment_index_entry,
+		     list_element_index,
+		     list_element_offset,
+		     list_element_size,
+		     mapped_size,
+		     list_element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk group: %d in segment index entry.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the segment file from a segment index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_set_segment_index_entry(
+     libewf_segment_file_t *segment_file,
+     libewf_segment_index_entry_t *segment_index_entry,
+     int file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function  = "libewf_segment_file_set_segment_index_entry";
+	size64_t mapped_size   = 0;
+	size64_t size          = 0;
+	off64_t offset         = 0;
+	uint32_t range_flags   = 0;
+	uint8_t section_flags  = 0;
+	int element_index      = 0;
+	int list_element_index = 0;
+
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	segment_file->segment_number                   = segment_index_entry->segment_number;
+	segment_file->type                             = segment_index_entry->type;
+	segment_file->major_version                    = segment_index_entry->major_version;
+	segment_file->minor_version                    = segment_index_entry->minor_version;
+	segment_file->flags                            = segment_index_entry->flags;
+	segment_file->compression_method               = segment_index_entry->compression_method;
+	segment_file->device_information_section_index = segment_index_entry->device_information_section_index;
+	segment_file->last_section_offset              = segment_index_entry->last_section_offset;
+	segment_file->current_offset                   = segment_index_entry->last_section_offset;
+	segment_file->storage_media_size               = segment_index_entry->storage_media_size;
+	segment_file->number_of_chunks                 = segment_index_entry->number_of_chunks;
+	segment_file->previous_last_chunk_filled       = segment_index_entry->previous_last_chunk_filled;
+	segment_file->last_chunk_filled                = segment_index_entry->last_chunk_filled;
+	segment_file->last_chunk_compared              = segment_index_entry->last_chunk_compared;
+
+	if( memory_copy(
+	     segment_file->set_identifier,
+	     segment_index_entry->set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	for( list_element_index = 0;
+	     list_element_index < segment_index_entry->number_of_sections;
+	     list_element_index++ )
+	{
+		if( libewf_segment_index_entry_get_section_by_index(
+		     segment_index_entry,
+		     list_element_index,
+		     &offset,
+		     &size,
+		     &section_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d from segment index entry.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+		if( libfdata_list_append_element(
+		     segment_file->sections_list,
+		     &element_index,
+		     file_io_pool_entry,
+		     offset,
+		     size,
+		     (uint32_t) section_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element: %d to sections list.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+	}
+	for( list_element_index = 0;
+	     list_element_index < segment_index_entry->number_of_chunk_groups;
+	     list_element_index++ )
+	{
+		if( libewf_segment_index_entry_get_chunk_group_by_index(
+		     segment_index_entry,
+		     list_element_index,
+		     &offset,
+		     &size,
+		     &mapped_size,
+		     &range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk group: %d from segment index entry.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+		if( libfdata_list_append_element_with_mapped_size(
+		     segment_file->chunk_groups_list,
+		     &( segment_file->current_chunk_group_index ),
+		     file_io_pool_entry,
+		     offset,
+		     size,
+		     range_flags,
+		     mapped_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element: %d with mapped size to chunk groups list.",
+			 function,
+			 list_element_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the file header, the section descriptors and the table sections of a segment file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_read_file_io_pool(
+     libewf_segment_file_t *segment_file,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     size64_t segment_file_size,
+     libcerror_error_t **error )
+{
+	libewf_section_descriptor_t *section_descriptor = NULL;
+	libfcache_cache_t *sections_cache               = NULL;
+	static char *function                           = "libewf_segment_file_read_file_io_pool";
+	ssize_t read_count                              = 0;
+	off64_t section_data_offset                     = 0;
+	off64_t segment_file_offset                     = 0;
+	int element_index                               = 0;
+	int last_section                                = 0;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libewf_segment_file_read_file_header_file_io_pool(
+		      segment_file,
+		      file_io_pool,
+		      file_io_pool_entry,
+		      error );
+
+/* TODO deal with corrupted header ? */
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1 )
+	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL )
+	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
+	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 && ( segment_file->type != LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported segment file type.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( segment_file->io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
+	 && ( segment_file->type == LIBEWF_SEGMENT_FILE_TYPE_EWF1 ) )
+	{
+		segment_file->type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
+	}
+	else if( ( segment_file->io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_UNDEFINED )
+	      && ( segment_file->io_handle->segment_file_type != segment_file->type ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: segment file type value mismatch.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_file->major_version == 2 )
+	{
+		if( ( segment_file->compression_method != LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		 && ( segment_file->compression_method != LIBEWF_COMPRESSION_METHOD_BZIP2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Read the section descriptors:
+	 * EWF version 1 read from front to back
+	 * EWF version 2 read from back to front
+	 */
+	if( segment_file->major_version == 1 )
+	{
+		segment_file_offset = (off64_t) read_count;
+	}
+	else if( segment_file->major_version == 2 )
+	{
+		segment_file_offset = (off64_t) segment_file_size - sizeof( ewf_section_descriptor_v2_t );
+	}
+	last_section = 0;
+
+	if( libewf_section_descriptor_initialize(
+	     &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( segment_file_offset > 0 )
+	    && ( (size64_t) segment_file_offset < segment_file_size ) )
+	{
+		read_count = libewf_section_descriptor_read_file_io_pool(
+			      section_descriptor,
+			      file_io_pool,
+			      file_io_pool_entry,
+			      segment_file_offset,
+			      segment_file->major_version,
+			      error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read section descriptor.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
 			}
 #endif
 			libcerror_error_free(
@@ -6501,7 +6921,7 @@ int libewf_segment_file_read_element_data(
 			                                               - segment_file->device_information_section_index;
 		}
 	}
-	if( io_handle->chunk_size != 0 )
+	if( segment_file->io_handle->chunk_size != 0 )
 	{
 		if( libfcache_cache_initialize(
 		     &sections_cache,
@@ -6595,7 +7015,7 @@ int libewf_segment_file_read_element_data(
 					      section_descriptor,
 					      file_io_pool,
 					      file_io_pool_entry,
-					      io_handle->chunk_size,
+					      segment_file->io_handle->chunk_size,
 					      error );
 
 				if( read_count == -1 )
@@ -6688,6 +7108,191 @@ int libewf_segment_file_read_element_data(
 			goto on_error;
 		}
 	}
+	return( 1 );
+
+on_error:
+	if( sections_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &sections_cache,
+		 NULL );
+	}
+	if( section_descriptor != NULL )
+	{
+		libewf_section_descriptor_free(
+		 &section_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a segment file
+ * If the segment index contains a matching entry for the segment file the sections
+ * and chunk groups are set from the entry instead of being read from the segment file
+ * Callback function for the segment files list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_file_read_element_data(
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libfdata_list_element_t *element,
+     libfdata_cache_t *segment_file_cache,
+     int file_io_pool_entry,
+     off64_t segment_file_offset LIBEWF_ATTRIBUTE_UNUSED,
+     size64_t segment_file_size,
+     uint32_t element_flags LIBEWF_ATTRIBUTE_UNUSED,
+     uint8_t read_flags LIBEWF_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libewf_segment_file_t *segment_file               = NULL;
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	static char *function                             = "libewf_segment_file_read_element_data";
+	int element_index                                 = 0;
+	int number_of_entries                             = 0;
+
+	LIBEWF_UNREFERENCED_PARAMETER( segment_file_offset )
+	LIBEWF_UNREFERENCED_PARAMETER( element_flags )
+	LIBEWF_UNREFERENCED_PARAMETER( read_flags )
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_segment_file_initialize(
+	     &segment_file,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment file.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_file_size == 0 )
+	{
+		/* segment_file_size is 0 on write correction
+		 */
+		if( libbfio_pool_get_size(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     &segment_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( io_handle->segment_index != NULL )
+	{
+		if( libfdata_list_element_get_element_index(
+		     element,
+		     &element_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_segment_index_get_number_of_entries(
+		     io_handle->segment_index,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segment index entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( element_index >= 0 )
+		 && ( element_index < number_of_entries ) )
+		{
+			if( libewf_segment_index_get_entry_by_index(
+			     io_handle->segment_index,
+			     element_index,
+			     &segment_index_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment index entry: %d.",
+				 function,
+				 element_index );
+
+				goto on_error;
+			}
+			if( ( segment_index_entry != NULL )
+			 && ( segment_index_entry->segment_file_size != segment_file_size ) )
+			{
+				segment_index_entry = NULL;
+			}
+		}
+	}
+	if( segment_index_entry != NULL )
+	{
+		if( libewf_segment_file_set_segment_index_entry(
+		     segment_file,
+		     segment_index_entry,
+		     file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment file from segment index entry: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libewf_segment_file_read_file_io_pool(
+		     segment_file,
+		     file_io_pool,
+		     file_io_pool_entry,
+		     segment_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment file.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_pool,
@@ -6709,18 +7314,6 @@ int libewf_segment_file_read_element_data(
 	return( 1 );
 
 on_error:
-	if( sections_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &sections_cache,
-		 NULL );
-	}
-	if( section_descriptor != NULL )
-	{
-		libewf_section_descriptor_free(
-		 &section_descriptor,
-		 NULL );
-	}
 	if( segment_file != NULL )
 	{
 		libewf_segment_file_free(
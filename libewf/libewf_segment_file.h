@@ -44,6 +44,7 @@
 #include "libewf_libfvalue.h"
 #include "libewf_media_values.h"
 #include "libewf_section_descriptor.h"
+#include "libewf_segment_index_entry.h"
 #include "libewf_single_files.h"
 
 #include "ewf_data.h"
@@ -387,6 +388,24 @@ int libewf_segment_file_write_sections_correction(
      ewf_data_t **data_section,
      libcerror_error_t **error );
 
+int libewf_segment_file_get_segment_index_entry(
+     libewf_segment_file_t *segment_file,
+     libewf_segment_index_entry_t *segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_file_set_segment_index_entry(
+     libewf_segment_file_t *segment_file,
+     libewf_segment_index_entry_t *segment_index_entry,
+     int file_io_pool_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_file_read_file_io_pool(
+     libewf_segment_file_t *segment_file,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     size64_t segment_file_size,
+     libcerror_error_t **error );
+
 int libewf_segment_file_read_element_data(
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
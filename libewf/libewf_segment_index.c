@@ -0,0 +1,880 @@
+/*
+ * Segment index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_checksum.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_segment_index.h"
+#include "libewf_segment_index_entry.h"
+
+#include "ewf_segment_index.h"
+
+const uint8_t ewf_segment_index_file_signature[ 8 ] = { 0x45, 0x57, 0x46, 0x49, 0x44, 0x58, 0x0d, 0x0a };
+
+/* Creates a segment index
+ * Make sure the value segment_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_initialize(
+     libewf_segment_index_t **segment_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_initialize";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_index = memory_allocate_structure(
+	                  libewf_segment_index_t );
+
+	if( *segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segment_index,
+	     0,
+	     sizeof( libewf_segment_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment index.",
+		 function );
+
+		memory_free(
+		 *segment_index );
+
+		*segment_index = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *segment_index )->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *segment_index != NULL )
+	{
+		memory_free(
+		 *segment_index );
+
+		*segment_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segment index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_free(
+     libewf_segment_index_t **segment_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_free";
+	int result            = 1;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *segment_index )->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_index_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *segment_index );
+
+		*segment_index = NULL;
+	}
+	return( result );
+}
+
+/* Clones the segment index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_clone(
+     libewf_segment_index_t **destination_segment_index,
+     libewf_segment_index_t *source_segment_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_clone";
+
+	if( destination_segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_segment_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination segment index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_segment_index == NULL )
+	{
+		*destination_segment_index = NULL;
+
+		return( 1 );
+	}
+	*destination_segment_index = memory_allocate_structure(
+	                              libewf_segment_index_t );
+
+	if( *destination_segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination segment index.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_segment_index )->entries_array = NULL;
+
+	if( libcdata_array_clone(
+	     &( ( *destination_segment_index )->entries_array ),
+	     source_segment_index->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_index_entry_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_segment_index_entry_clone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination entries array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_segment_index != NULL )
+	{
+		memory_free(
+		 *destination_segment_index );
+
+		*destination_segment_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_get_number_of_entries(
+     libewf_segment_index_t *segment_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_get_number_of_entries";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     segment_index->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_get_entry_by_index(
+     libewf_segment_index_t *segment_index,
+     int entry_index,
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_get_entry_by_index";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     segment_index->entries_array,
+	     entry_index,
+	     (intptr_t **) segment_index_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * The segment index takes over management of the entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_append_entry(
+     libewf_segment_index_t *segment_index,
+     int *entry_index,
+     libewf_segment_index_entry_t *segment_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_append_entry";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     segment_index->entries_array,
+	     entry_index,
+	     (intptr_t *) segment_index_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a segment index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_read_file_io_handle(
+     libewf_segment_index_t *segment_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_segment_index_file_header_t file_header;
+
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	static char *function                             = "libewf_segment_index_read_file_io_handle";
+	ssize_t read_count                                = 0;
+	off64_t file_offset                               = 0;
+	uint32_t calculated_checksum                      = 0;
+	uint32_t format_version                           = 0;
+	uint32_t number_of_segments                       = 0;
+	uint32_t segment_number                           = 0;
+	uint32_t stored_checksum                          = 0;
+	int entry_index                                   = 0;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( ewf_segment_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( ewf_segment_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     ewf_segment_index_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_segments,
+	 number_of_segments );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.checksum,
+	 stored_checksum );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     (uint8_t *) &file_header,
+	     sizeof( ewf_segment_index_file_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( number_of_segments > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( ewf_segment_index_file_header_t );
+
+	for( segment_number = 1;
+	     segment_number <= number_of_segments;
+	     segment_number++ )
+	{
+		if( libewf_segment_index_entry_initialize(
+		     &segment_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment index entry.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libewf_segment_index_entry_read_file_io_handle(
+		              segment_index_entry,
+		              file_io_handle,
+		              file_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment index entry: %" PRIu32 ".",
+			 function,
+			 segment_number );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		if( segment_index_entry->segment_number != segment_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: segment number mismatch ( stored: %" PRIu32 ", expected: %" PRIu32 " ).",
+			 function,
+			 segment_index_entry->segment_number,
+			 segment_number );
+
+			goto on_error;
+		}
+		if( libewf_segment_index_append_entry(
+		     segment_index,
+		     &entry_index,
+		     segment_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment index entry: %" PRIu32 ".",
+			 function,
+			 segment_number );
+
+			goto on_error;
+		}
+		segment_index_entry = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( segment_index_entry != NULL )
+	{
+		libewf_segment_index_entry_free(
+		 &segment_index_entry,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 segment_index->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_segment_index_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes a segment index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_write_file_io_handle(
+     libewf_segment_index_t *segment_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_segment_index_file_header_t file_header;
+
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	static char *function                             = "libewf_segment_index_write_file_io_handle";
+	ssize_t write_count                               = 0;
+	uint32_t calculated_checksum                      = 0;
+	int entry_index                                   = 0;
+	int number_of_entries                             = 0;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     segment_index->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( ewf_segment_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     ewf_segment_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_segments,
+	 (uint32_t) number_of_entries );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     (uint8_t *) &file_header,
+	     sizeof( ewf_segment_index_file_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.checksum,
+	 calculated_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( ewf_segment_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( ewf_segment_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     segment_index->entries_array,
+		     entry_index,
+		     (intptr_t **) &segment_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		write_count = libewf_segment_index_entry_write_file_io_handle(
+		               segment_index_entry,
+		               file_io_handle,
+		               error );
+
+		if( write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the checksums of the data at the start and end of a segment file
+ * These are used together with the segment file size to detect if a segment file was changed
+ * after the segment index was written
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_calculate_segment_file_checksums(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     size64_t segment_file_size,
+     uint32_t *head_checksum,
+     uint32_t *tail_checksum,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBEWF_SEGMENT_INDEX_CHECKSUM_DATA_SIZE ];
+
+	static char *function = "libewf_segment_index_calculate_segment_file_checksums";
+	size_t read_size      = LIBEWF_SEGMENT_INDEX_CHECKSUM_DATA_SIZE;
+	ssize_t read_count    = 0;
+
+	if( head_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid head checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( tail_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tail checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_size < (size64_t) read_size )
+	{
+		read_size = (size_t) segment_file_size;
+	}
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool,
+	              file_io_pool_entry,
+	              data,
+	              read_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at start of file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     head_checksum,
+	     data,
+	     read_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate head checksum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool,
+	              file_io_pool_entry,
+	              data,
+	              read_size,
+	              (off64_t) ( segment_file_size - read_size ),
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at end of file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     tail_checksum,
+	     data,
+	     read_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate tail checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Segment index functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SEGMENT_INDEX_H )
+#define _LIBEWF_SEGMENT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libbfio.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_segment_index_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of bytes at the start and end of a segment file that are used to detect changes
+ */
+#define LIBEWF_SEGMENT_INDEX_CHECKSUM_DATA_SIZE		512
+
+extern const uint8_t ewf_segment_index_file_signature[ 8 ];
+
+typedef struct libewf_segment_index libewf_segment_index_t;
+
+struct libewf_segment_index
+{
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+};
+
+int libewf_segment_index_initialize(
+     libewf_segment_index_t **segment_index,
+     libcerror_error_t **error );
+
+int libewf_segment_index_free(
+     libewf_segment_index_t **segment_index,
+     libcerror_error_t **error );
+
+int libewf_segment_index_clone(
+     libewf_segment_index_t **destination_segment_index,
+     libewf_segment_index_t *source_segment_index,
+     libcerror_error_t **error );
+
+int libewf_segment_index_get_number_of_entries(
+     libewf_segment_index_t *segment_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libewf_segment_index_get_entry_by_index(
+     libewf_segment_index_t *segment_index,
+     int entry_index,
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_index_append_entry(
+     libewf_segment_index_t *segment_index,
+     int *entry_index,
+     libewf_segment_index_entry_t *segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_index_read_file_io_handle(
+     libewf_segment_index_t *segment_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_segment_index_write_file_io_handle(
+     libewf_segment_index_t *segment_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_segment_index_calculate_segment_file_checksums(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     size64_t segment_file_size,
+     uint32_t *head_checksum,
+     uint32_t *tail_checksum,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SEGMENT_INDEX_H ) */
+
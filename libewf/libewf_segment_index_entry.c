@@ -0,0 +1,1319 @@
+/*
+ * Segment index entry functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_checksum.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_segment_index_entry.h"
+
+#include "ewf_segment_index.h"
+
+/* The maximum number of sections or chunk groups in a segment index entry
+ */
+#define LIBEWF_SEGMENT_INDEX_ENTRY_MAXIMUM_NUMBER_OF_ELEMENTS	( (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( ewf_segment_index_chunk_group_entry_t ) ) )
+
+/* Creates a segment index entry
+ * Make sure the value segment_index_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_initialize(
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_initialize";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment index entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_index_entry = memory_allocate_structure(
+	                        libewf_segment_index_entry_t );
+
+	if( *segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment index entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segment_index_entry,
+	     0,
+	     sizeof( libewf_segment_index_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment index entry.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_index_entry )->device_information_section_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *segment_index_entry != NULL )
+	{
+		memory_free(
+		 *segment_index_entry );
+
+		*segment_index_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segment index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_free(
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_free";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index_entry != NULL )
+	{
+		if( ( *segment_index_entry )->sections != NULL )
+		{
+			memory_free(
+			 ( *segment_index_entry )->sections );
+		}
+		if( ( *segment_index_entry )->chunk_groups != NULL )
+		{
+			memory_free(
+			 ( *segment_index_entry )->chunk_groups );
+		}
+		memory_free(
+		 *segment_index_entry );
+
+		*segment_index_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones the segment index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_clone(
+     libewf_segment_index_entry_t **destination_segment_index_entry,
+     libewf_segment_index_entry_t *source_segment_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_clone";
+
+	if( destination_segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_segment_index_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination segment index entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_segment_index_entry == NULL )
+	{
+		*destination_segment_index_entry = NULL;
+
+		return( 1 );
+	}
+	*destination_segment_index_entry = memory_allocate_structure(
+	                                    libewf_segment_index_entry_t );
+
+	if( *destination_segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination segment index entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_segment_index_entry,
+	     source_segment_index_entry,
+	     sizeof( libewf_segment_index_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination segment index entry.",
+		 function );
+
+		memory_free(
+		 *destination_segment_index_entry );
+
+		*destination_segment_index_entry = NULL;
+
+		return( -1 );
+	}
+	( *destination_segment_index_entry )->sections               = NULL;
+	( *destination_segment_index_entry )->number_of_sections     = 0;
+	( *destination_segment_index_entry )->chunk_groups           = NULL;
+	( *destination_segment_index_entry )->number_of_chunk_groups = 0;
+
+	if( libewf_segment_index_entry_resize(
+	     *destination_segment_index_entry,
+	     source_segment_index_entry->number_of_sections,
+	     source_segment_index_entry->number_of_chunk_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize destination segment index entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_segment_index_entry->number_of_sections > 0 )
+	{
+		if( memory_copy(
+		     ( *destination_segment_index_entry )->sections,
+		     source_segment_index_entry->sections,
+		     sizeof( libewf_segment_index_section_t ) * source_segment_index_entry->number_of_sections ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sections.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( source_segment_index_entry->number_of_chunk_groups > 0 )
+	{
+		if( memory_copy(
+		     ( *destination_segment_index_entry )->chunk_groups,
+		     source_segment_index_entry->chunk_groups,
+		     sizeof( libewf_segment_index_chunk_group_t ) * source_segment_index_entry->number_of_chunk_groups ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk groups.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_segment_index_entry != NULL )
+	{
+		libewf_segment_index_entry_free(
+		 destination_segment_index_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resizes the sections and chunk groups of the segment index entry
+ * Existing sections and chunk groups are not preserved
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_resize(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int number_of_sections,
+     int number_of_chunk_groups,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_resize";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sections < 0 )
+	 || ( number_of_sections > LIBEWF_SEGMENT_INDEX_ENTRY_MAXIMUM_NUMBER_OF_ELEMENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sections value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunk_groups < 0 )
+	 || ( number_of_chunk_groups > LIBEWF_SEGMENT_INDEX_ENTRY_MAXIMUM_NUMBER_OF_ELEMENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunk groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index_entry->sections != NULL )
+	{
+		memory_free(
+		 segment_index_entry->sections );
+
+		segment_index_entry->sections = NULL;
+	}
+	segment_index_entry->number_of_sections = 0;
+
+	if( segment_index_entry->chunk_groups != NULL )
+	{
+		memory_free(
+		 segment_index_entry->chunk_groups );
+
+		segment_index_entry->chunk_groups = NULL;
+	}
+	segment_index_entry->number_of_chunk_groups = 0;
+
+	if( number_of_sections > 0 )
+	{
+		segment_index_entry->sections = (libewf_segment_index_section_t *) memory_allocate(
+		                                 sizeof( libewf_segment_index_section_t ) * number_of_sections );
+
+		if( segment_index_entry->sections == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sections.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     segment_index_entry->sections,
+		     0,
+		     sizeof( libewf_segment_index_section_t ) * number_of_sections ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sections.",
+			 function );
+
+			return( -1 );
+		}
+		segment_index_entry->number_of_sections = number_of_sections;
+	}
+	if( number_of_chunk_groups > 0 )
+	{
+		segment_index_entry->chunk_groups = (libewf_segment_index_chunk_group_t *) memory_allocate(
+		                                     sizeof( libewf_segment_index_chunk_group_t ) * number_of_chunk_groups );
+
+		if( segment_index_entry->chunk_groups == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk groups.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     segment_index_entry->chunk_groups,
+		     0,
+		     sizeof( libewf_segment_index_chunk_group_t ) * number_of_chunk_groups ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk groups.",
+			 function );
+
+			return( -1 );
+		}
+		segment_index_entry->number_of_chunk_groups = number_of_chunk_groups;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_get_section_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int section_index,
+     off64_t *offset,
+     size64_t *size,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_get_section_by_index";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= segment_index_entry->number_of_sections ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = segment_index_entry->sections[ section_index ].offset;
+	*size   = segment_index_entry->sections[ section_index ].size;
+	*flags  = segment_index_entry->sections[ section_index ].flags;
+
+	return( 1 );
+}
+
+/* Sets a specific section
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_set_section_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int section_index,
+     off64_t offset,
+     size64_t size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_set_section_by_index";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= segment_index_entry->number_of_sections ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	segment_index_entry->sections[ section_index ].offset = offset;
+	segment_index_entry->sections[ section_index ].size   = size;
+	segment_index_entry->sections[ section_index ].flags  = flags;
+
+	return( 1 );
+}
+
+/* Retrieves a specific chunk group
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_get_chunk_group_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int chunk_group_index,
+     off64_t *offset,
+     size64_t *size,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_get_chunk_group_by_index";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_group_index < 0 )
+	 || ( chunk_group_index >= segment_index_entry->number_of_chunk_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range flags.",
+		 function );
+
+		return( -1 );
+	}
+	*offset      = segment_index_entry->chunk_groups[ chunk_group_index ].offset;
+	*size        = segment_index_entry->chunk_groups[ chunk_group_index ].size;
+	*mapped_size = segment_index_entry->chunk_groups[ chunk_group_index ].mapped_size;
+	*range_flags = segment_index_entry->chunk_groups[ chunk_group_index ].range_flags;
+
+	return( 1 );
+}
+
+/* Sets a specific chunk group
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_index_entry_set_chunk_group_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int chunk_group_index,
+     off64_t offset,
+     size64_t size,
+     size64_t mapped_size,
+     uint32_t range_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_index_entry_set_chunk_group_by_index";
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_group_index < 0 )
+	 || ( chunk_group_index >= segment_index_entry->number_of_chunk_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_index_entry->chunk_groups[ chunk_group_index ].offset      = offset;
+	segment_index_entry->chunk_groups[ chunk_group_index ].size        = size;
+	segment_index_entry->chunk_groups[ chunk_group_index ].mapped_size = mapped_size;
+	segment_index_entry->chunk_groups[ chunk_group_index ].range_flags = range_flags;
+
+	return( 1 );
+}
+
+/* Reads a segment index entry
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_segment_index_entry_read_file_io_handle(
+         libewf_segment_index_entry_t *segment_index_entry,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	ewf_segment_index_entry_header_t entry_header;
+
+	uint8_t *data                   = NULL;
+	uint8_t *element_data           = NULL;
+	static char *function           = "libewf_segment_index_entry_read_file_io_handle";
+	size_t data_offset              = 0;
+	size_t data_size                = 0;
+	ssize_t read_count              = 0;
+	uint64_t value_64bit            = 0;
+	uint32_t calculated_checksum    = 0;
+	uint32_t number_of_chunk_groups = 0;
+	uint32_t number_of_sections     = 0;
+	uint32_t stored_checksum        = 0;
+	uint32_t value_32bit            = 0;
+	int element_index               = 0;
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &entry_header,
+	              sizeof( ewf_segment_index_entry_header_t ),
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( ewf_segment_index_entry_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment index entry header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.number_of_sections,
+	 number_of_sections );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.number_of_chunk_groups,
+	 number_of_chunk_groups );
+
+	if( ( number_of_sections > (uint32_t) LIBEWF_SEGMENT_INDEX_ENTRY_MAXIMUM_NUMBER_OF_ELEMENTS )
+	 || ( number_of_chunk_groups > (uint32_t) LIBEWF_SEGMENT_INDEX_ENTRY_MAXIMUM_NUMBER_OF_ELEMENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of elements value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_segment_index_entry_resize(
+	     segment_index_entry,
+	     (int) number_of_sections,
+	     (int) number_of_chunk_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize segment index entry.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = sizeof( ewf_segment_index_entry_header_t )
+	          + ( sizeof( ewf_segment_index_section_entry_t ) * number_of_sections )
+	          + ( sizeof( ewf_segment_index_chunk_group_entry_t ) * number_of_chunk_groups )
+	          + 4;
+
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     &entry_header,
+	     sizeof( ewf_segment_index_entry_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy segment index entry header.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( ewf_segment_index_entry_header_t );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              &( data[ data_offset ] ),
+	              data_size - data_offset,
+	              file_offset + (off64_t) data_offset,
+	              error );
+
+	if( read_count != (ssize_t) ( data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment index entry data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ data_size - 4 ] ),
+	 stored_checksum );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     data,
+	     data_size - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.segment_number,
+	 segment_index_entry->segment_number );
+
+	segment_index_entry->type          = entry_header.type;
+	segment_index_entry->major_version = entry_header.major_version;
+	segment_index_entry->minor_version = entry_header.minor_version;
+	segment_index_entry->flags         = entry_header.flags;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.segment_file_size,
+	 segment_index_entry->segment_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.head_checksum,
+	 segment_index_entry->head_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.tail_checksum,
+	 segment_index_entry->tail_checksum );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 entry_header.compression_method,
+	 segment_index_entry->compression_method );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header.device_information_section_index,
+	 value_32bit );
+
+	segment_index_entry->device_information_section_index = (int) (int32_t) value_32bit;
+
+	if( memory_copy(
+	     segment_index_entry->set_identifier,
+	     entry_header.set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.last_section_offset,
+	 value_64bit );
+
+	segment_index_entry->last_section_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.storage_media_size,
+	 segment_index_entry->storage_media_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.number_of_chunks,
+	 segment_index_entry->number_of_chunks );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.previous_last_chunk_filled,
+	 value_64bit );
+
+	segment_index_entry->previous_last_chunk_filled = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.last_chunk_filled,
+	 value_64bit );
+
+	segment_index_entry->last_chunk_filled = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 entry_header.last_chunk_compared,
+	 value_64bit );
+
+	segment_index_entry->last_chunk_compared = (int64_t) value_64bit;
+
+	for( element_index = 0;
+	     element_index < segment_index_entry->number_of_sections;
+	     element_index++ )
+	{
+		element_data = &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_segment_index_section_entry_t *) element_data )->offset,
+		 value_64bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ewf_segment_index_section_entry_t *) element_data )->size,
+		 value_32bit );
+
+		if( value_64bit > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid section: %d offset value out of bounds.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		segment_index_entry->sections[ element_index ].offset = (off64_t) value_64bit;
+		segment_index_entry->sections[ element_index ].size   = (size64_t) value_32bit;
+		segment_index_entry->sections[ element_index ].flags  = ( (ewf_segment_index_section_entry_t *) element_data )->flags;
+
+		data_offset += sizeof( ewf_segment_index_section_entry_t );
+	}
+	for( element_index = 0;
+	     element_index < segment_index_entry->number_of_chunk_groups;
+	     element_index++ )
+	{
+		element_data = &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->offset,
+		 value_64bit );
+
+		if( value_64bit > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk group: %d offset value out of bounds.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		segment_index_entry->chunk_groups[ element_index ].offset = (off64_t) value_64bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->size,
+		 segment_index_entry->chunk_groups[ element_index ].size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->mapped_size,
+		 segment_index_entry->chunk_groups[ element_index ].mapped_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->range_flags,
+		 segment_index_entry->chunk_groups[ element_index ].range_flags );
+
+		data_offset += sizeof( ewf_segment_index_chunk_group_entry_t );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: segment: %" PRIu32 " number of sections\t: %d\n",
+		 function,
+		 segment_index_entry->segment_number,
+		 segment_index_entry->number_of_sections );
+
+		libcnotify_printf(
+		 "%s: segment: %" PRIu32 " number of chunk groups\t: %d\n",
+		 function,
+		 segment_index_entry->segment_number,
+		 segment_index_entry->number_of_chunk_groups );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	memory_free(
+	 data );
+
+	return( (ssize_t) data_size );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Writes a segment index entry
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libewf_segment_index_entry_write_file_io_handle(
+         libewf_segment_index_entry_t *segment_index_entry,
+         libbfio_handle_t *file_io_handle,
+         libcerror_error_t **error )
+{
+	uint8_t *data                = NULL;
+	uint8_t *element_data        = NULL;
+	static char *function        = "libewf_segment_index_entry_write_file_io_handle";
+	size_t data_offset           = 0;
+	size_t data_size             = 0;
+	ssize_t write_count          = 0;
+	uint32_t calculated_checksum = 0;
+	int element_index            = 0;
+
+	if( segment_index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index entry.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = sizeof( ewf_segment_index_entry_header_t )
+	          + ( sizeof( ewf_segment_index_section_entry_t ) * segment_index_entry->number_of_sections )
+	          + ( sizeof( ewf_segment_index_chunk_group_entry_t ) * segment_index_entry->number_of_chunk_groups )
+	          + 4;
+
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->segment_number,
+	 segment_index_entry->segment_number );
+
+	( (ewf_segment_index_entry_header_t *) data )->type          = segment_index_entry->type;
+	( (ewf_segment_index_entry_header_t *) data )->major_version = segment_index_entry->major_version;
+	( (ewf_segment_index_entry_header_t *) data )->minor_version = segment_index_entry->minor_version;
+	( (ewf_segment_index_entry_header_t *) data )->flags         = segment_index_entry->flags;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->segment_file_size,
+	 segment_index_entry->segment_file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->head_checksum,
+	 segment_index_entry->head_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->tail_checksum,
+	 segment_index_entry->tail_checksum );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->compression_method,
+	 segment_index_entry->compression_method );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->device_information_section_index,
+	 (uint32_t) segment_index_entry->device_information_section_index );
+
+	if( memory_copy(
+	     ( (ewf_segment_index_entry_header_t *) data )->set_identifier,
+	     segment_index_entry->set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->last_section_offset,
+	 (uint64_t) segment_index_entry->last_section_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->storage_media_size,
+	 segment_index_entry->storage_media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->number_of_chunks,
+	 segment_index_entry->number_of_chunks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->previous_last_chunk_filled,
+	 (uint64_t) segment_index_entry->previous_last_chunk_filled );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->last_chunk_filled,
+	 (uint64_t) segment_index_entry->last_chunk_filled );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->last_chunk_compared,
+	 (uint64_t) segment_index_entry->last_chunk_compared );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->number_of_sections,
+	 (uint32_t) segment_index_entry->number_of_sections );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (ewf_segment_index_entry_header_t *) data )->number_of_chunk_groups,
+	 (uint32_t) segment_index_entry->number_of_chunk_groups );
+
+	data_offset = sizeof( ewf_segment_index_entry_header_t );
+
+	for( element_index = 0;
+	     element_index < segment_index_entry->number_of_sections;
+	     element_index++ )
+	{
+		element_data = &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_segment_index_section_entry_t *) element_data )->offset,
+		 (uint64_t) segment_index_entry->sections[ element_index ].offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (ewf_segment_index_section_entry_t *) element_data )->size,
+		 (uint32_t) segment_index_entry->sections[ element_index ].size );
+
+		( (ewf_segment_index_section_entry_t *) element_data )->flags = segment_index_entry->sections[ element_index ].flags;
+
+		data_offset += sizeof( ewf_segment_index_section_entry_t );
+	}
+	for( element_index = 0;
+	     element_index < segment_index_entry->number_of_chunk_groups;
+	     element_index++ )
+	{
+		element_data = &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->offset,
+		 (uint64_t) segment_index_entry->chunk_groups[ element_index ].offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->size,
+		 segment_index_entry->chunk_groups[ element_index ].size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->mapped_size,
+		 segment_index_entry->chunk_groups[ element_index ].mapped_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (ewf_segment_index_chunk_group_entry_t *) element_data )->range_flags,
+		 segment_index_entry->chunk_groups[ element_index ].range_flags );
+
+		data_offset += sizeof( ewf_segment_index_chunk_group_entry_t );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     data,
+	     data_offset,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ data_offset ] ),
+	 calculated_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write segment index entry data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( write_count );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,231 @@
+/*
+ * Segment index entry functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SEGMENT_INDEX_ENTRY_H )
+#define _LIBEWF_SEGMENT_INDEX_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_segment_index_section libewf_segment_index_section_t;
+
+struct libewf_segment_index_section
+{
+	/* The section descriptor offset
+	 */
+	off64_t offset;
+
+	/* The section descriptor size
+	 */
+	size64_t size;
+
+	/* The section flags
+	 */
+	uint8_t flags;
+};
+
+typedef struct libewf_segment_index_chunk_group libewf_segment_index_chunk_group_t;
+
+struct libewf_segment_index_chunk_group
+{
+	/* The chunk group (table) offset
+	 */
+	off64_t offset;
+
+	/* The chunk group (table) size
+	 */
+	size64_t size;
+
+	/* The storage media size of the chunks in the chunk group
+	 */
+	size64_t mapped_size;
+
+	/* The range flags
+	 */
+	uint32_t range_flags;
+};
+
+typedef struct libewf_segment_index_entry libewf_segment_index_entry_t;
+
+struct libewf_segment_index_entry
+{
+	/* The segment number
+	 */
+	uint32_t segment_number;
+
+	/* The segment file type
+	 */
+	uint8_t type;
+
+	/* The major version number
+	 */
+	uint8_t major_version;
+
+	/* The minor version number
+	 */
+	uint8_t minor_version;
+
+	/* The segment file flags
+	 */
+	uint8_t flags;
+
+	/* The segment file size
+	 */
+	size64_t segment_file_size;
+
+	/* The checksum of the data at the start of the segment file
+	 */
+	uint32_t head_checksum;
+
+	/* The checksum of the data at the end of the segment file
+	 */
+	uint32_t tail_checksum;
+
+	/* The compression method
+	 */
+	uint16_t compression_method;
+
+	/* The device information section index
+	 */
+	int device_information_section_index;
+
+	/* The set identifier
+	 */
+	uint8_t set_identifier[ 16 ];
+
+	/* The last section offset
+	 */
+	off64_t last_section_offset;
+
+	/* The storage media size (in the segment file)
+	 */
+	size64_t storage_media_size;
+
+	/* The number of chunks (in the segment file)
+	 */
+	uint64_t number_of_chunks;
+
+	/* The previous last chunk that was filled
+	 */
+	int64_t previous_last_chunk_filled;
+
+	/* The last chunk that was filled
+	 */
+	int64_t last_chunk_filled;
+
+	/* The last chunk that was compared
+	 */
+	int64_t last_chunk_compared;
+
+	/* The sections
+	 */
+	libewf_segment_index_section_t *sections;
+
+	/* The number of sections
+	 */
+	int number_of_sections;
+
+	/* The chunk groups
+	 */
+	libewf_segment_index_chunk_group_t *chunk_groups;
+
+	/* The number of chunk groups
+	 */
+	int number_of_chunk_groups;
+};
+
+int libewf_segment_index_entry_initialize(
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_free(
+     libewf_segment_index_entry_t **segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_clone(
+     libewf_segment_index_entry_t **destination_segment_index_entry,
+     libewf_segment_index_entry_t *source_segment_index_entry,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_resize(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int number_of_sections,
+     int number_of_chunk_groups,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_get_section_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int section_index,
+     off64_t *offset,
+     size64_t *size,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_set_section_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int section_index,
+     off64_t offset,
+     size64_t size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_get_chunk_group_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int chunk_group_index,
+     off64_t *offset,
+     size64_t *size,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+int libewf_segment_index_entry_set_chunk_group_by_index(
+     libewf_segment_index_entry_t *segment_index_entry,
+     int chunk_group_index,
+     off64_t offset,
+     size64_t size,
+     size64_t mapped_size,
+     uint32_t range_flags,
+     libcerror_error_t **error );
+
+ssize_t libewf_segment_index_entry_read_file_io_handle(
+         libewf_segment_index_entry_t *segment_index_entry,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
+ssize_t libewf_segment_index_entry_write_file_io_handle(
+         libewf_segment_index_entry_t *segment_index_entry,
+         libbfio_handle_t *file_io_handle,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SEGMENT_INDEX_ENTRY_H ) */
+
@@ -291,10 +291,13 @@ int libewf_segment_table_clear(
 
 		return( -1 );
 	}
-	segment_table->maximum_segment_size = 0;
-	segment_table->number_of_segments   = 0;
-	segment_table->current_segment_file = NULL;
-	segment_table->flags                = 0;
+	segment_table->maximum_segment_size          = 0;
+	segment_table->number_of_segments            = 0;
+	segment_table->current_segment_file          = NULL;
+	segment_table->unscanned_segment_number      = 0;
+	segment_table->last_unscanned_segment_number = 0;
+	segment_table->unscanned_storage_media_size  = 0;
+	segment_table->flags                         = 0;
 
 	return( 1 );
 }
@@ -430,7 +433,11 @@ int libewf_segment_table_clone(
 
 		goto on_error;
 	}
-	( *destination_segment_table )->maximum_segment_size = source_segment_table->maximum_segment_size;
+	( *destination_segment_table )->maximum_segment_size          = source_segment_table->maximum_segment_size;
+	( *destination_segment_table )->unscanned_segment_number      = source_segment_table->unscanned_segment_number;
+	( *destination_segment_table )->last_unscanned_segment_number = source_segment_table->last_unscanned_segment_number;
+	( *destination_segment_table )->unscanned_storage_media_size  = source_segment_table->unscanned_storage_media_size;
+	( *destination_segment_table )->flags                         = source_segment_table->flags;
 
 	return( 1 );
 
@@ -1703,6 +1710,223 @@ int libewf_segment_table_set_segment_storage_media_size_by_index(
 	return( 1 );
 }
 
+/* Sets the segment files that have not been scanned
+ * The storage media size of these segment files is assigned to the first
+ * segment file, so that the mapped ranges of the segment files that follow
+ * remain correct, and is redistributed when the segment files are scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_table_set_unscanned_segments(
+     libewf_segment_table_t *segment_table,
+     uint32_t first_segment_number,
+     uint32_t last_segment_number,
+     size64_t storage_media_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_table_set_unscanned_segments";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_segment_number > last_segment_number )
+	 || ( last_segment_number >= segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_segment_table_set_segment_storage_media_size_by_index(
+	     segment_table,
+	     first_segment_number,
+	     storage_media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set storage media size of segment: %" PRIu32 ".",
+		 function,
+		 first_segment_number );
+
+		return( -1 );
+	}
+	segment_table->unscanned_segment_number      = first_segment_number;
+	segment_table->last_unscanned_segment_number = last_segment_number;
+	segment_table->unscanned_storage_media_size  = storage_media_size;
+	segment_table->flags                        |= LIBEWF_SEGMENT_TABLE_FLAG_HAS_UNSCANNED_SEGMENTS;
+
+	return( 1 );
+}
+
+/* Marks the first segment file that has not been scanned as scanned
+ * This sets the storage media size of the segment file and assigns the remaining
+ * storage media size of the segment files that have not been scanned to the next segment file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_table_set_segment_file_scanned(
+     libewf_segment_table_t *segment_table,
+     uint32_t segment_number,
+     libewf_segment_file_t *segment_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_table_set_segment_file_scanned";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_HAS_UNSCANNED_SEGMENTS ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment table - missing unscanned segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_number != segment_table->unscanned_segment_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file->io_handle != NULL )
+	{
+		/* The segment files read at open are validated by the handle
+		 */
+		if( ( segment_file->major_version != segment_file->io_handle->major_version )
+		 || ( segment_file->minor_version != segment_file->io_handle->minor_version ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: segment file: %" PRIu32 " format version value mismatch.",
+			 function,
+			 segment_file->segment_number );
+
+			return( -1 );
+		}
+		if( ( segment_file->major_version == 2 )
+		 && ( segment_file->compression_method != segment_file->io_handle->compression_method ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: segment file: %" PRIu32 " compression method value mismatch.",
+			 function,
+			 segment_file->segment_number );
+
+			return( -1 );
+		}
+	}
+	if( ( segment_file->flags & LIBEWF_SEGMENT_FILE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		segment_table->flags |= LIBEWF_SEGMENT_TABLE_FLAG_IS_CORRUPTED;
+	}
+	if( libewf_segment_table_set_segment_storage_media_size_by_index(
+	     segment_table,
+	     segment_number,
+	     segment_file->storage_media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set storage media size of segment: %" PRIu32 ".",
+		 function,
+		 segment_number );
+
+		return( -1 );
+	}
+	if( segment_file->storage_media_size > segment_table->unscanned_storage_media_size )
+	{
+		/* The segment files contain more chunks than the media values indicate
+		 * the segment files that have not been scanned are no longer mapped
+		 */
+		segment_table->unscanned_storage_media_size = 0;
+		segment_table->flags                       |= LIBEWF_SEGMENT_TABLE_FLAG_IS_CORRUPTED;
+	}
+	else
+	{
+		segment_table->unscanned_storage_media_size -= segment_file->storage_media_size;
+	}
+	segment_number++;
+
+	if( segment_number > segment_table->last_unscanned_segment_number )
+	{
+		if( segment_table->unscanned_storage_media_size != 0 )
+		{
+			segment_table->flags |= LIBEWF_SEGMENT_TABLE_FLAG_IS_CORRUPTED;
+		}
+		segment_table->unscanned_storage_media_size = 0;
+		segment_table->flags                       &= ~( LIBEWF_SEGMENT_TABLE_FLAG_HAS_UNSCANNED_SEGMENTS );
+	}
+	else
+	{
+		if( libewf_segment_table_set_segment_storage_media_size_by_index(
+		     segment_table,
+		     segment_number,
+		     segment_table->unscanned_storage_media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set storage media size of segment: %" PRIu32 ".",
+			 function,
+			 segment_number );
+
+			return( -1 );
+		}
+	}
+	segment_table->unscanned_segment_number = segment_number;
+
+	return( 1 );
+}
+
 /* Retrieves a specific segment file from the segment table
  * Returns 1 if successful or -1 on error
  */
@@ -1879,15 +2103,22 @@ int libewf_segment_table_get_segment_file_at_offset(
 	if( ( segment_table->current_segment_file != NULL )
 	 && ( segment_table->current_segment_file->range_end_offset > 0 ) )
 	{
-		if( ( offset >= segment_table->current_segment_file->range_start_offset )
-		 && ( offset < segment_table->current_segment_file->range_end_offset ) )
+		/* The mapped range of a segment file that has not been scanned is not final
+		 */
+		if( ( ( segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_HAS_UNSCANNED_SEGMENTS ) == 0 )
+		 || ( segment_table->current_segment_file->segment_number <= segment_table->unscanned_segment_number )
+		 || ( segment_table->current_segment_file->segment_number > ( segment_table->last_unscanned_segment_number + 1 ) ) )
 		{
-			safe_segment_file_data_offset = offset - segment_table->current_segment_file->range_start_offset;
+			if( ( offset >= segment_table->current_segment_file->range_start_offset )
+			 && ( offset < segment_table->current_segment_file->range_end_offset ) )
+			{
+				safe_segment_file_data_offset = offset - segment_table->current_segment_file->range_start_offset;
 
-			result = 1;
+				result = 1;
+			}
 		}
 	}
-	if( result == 0 )
+	while( result == 0 )
 	{
 		result = libfdata_list_get_element_value_at_offset(
 		          segment_table->segment_files_list,
@@ -1913,49 +2144,81 @@ int libewf_segment_table_get_segment_file_at_offset(
 
 			return( -1 );
 		}
-		else if( result != 0 )
+		else if( result == 0 )
 		{
-			if( segment_table->current_segment_file == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing segment file.",
-				 function );
+			break;
+		}
+		if( segment_table->current_segment_file == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing segment file.",
+			 function );
 
-				return( -1 );
-			}
-			if( ( (int64_t) segment_files_list_index + 1 ) != (int64_t) segment_table->current_segment_file->segment_number )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid segment number value out of bounds.",
-				 function );
+			return( -1 );
+		}
+		if( ( (int64_t) segment_files_list_index + 1 ) != (int64_t) segment_table->current_segment_file->segment_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment number value out of bounds.",
+			 function );
 
-				return( -1 );
-			}
-			if( libfdata_list_get_element_mapped_range(
-			     segment_table->segment_files_list,
-			     segment_files_list_index,
-			     &( segment_table->current_segment_file->range_start_offset ),
-			     (size64_t *) &( segment_table->current_segment_file->range_end_offset ),
+			return( -1 );
+		}
+		/* The offset maps into the segment files that have not been scanned,
+		 * the segment file has now been read so its actual storage media size
+		 * is known and the offset needs to be mapped again
+		 */
+		if( ( ( segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_HAS_UNSCANNED_SEGMENTS ) != 0 )
+		 && ( (uint32_t) segment_files_list_index == segment_table->unscanned_segment_number ) )
+		{
+			if( libewf_segment_table_set_segment_file_scanned(
+			     segment_table,
+			     (uint32_t) segment_files_list_index,
+			     segment_table->current_segment_file,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve segment files list element: %d mapped range.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment file: %d scanned.",
 				 function,
 				 segment_files_list_index );
 
+				segment_table->current_segment_file = NULL;
+
 				return( -1 );
 			}
-			segment_table->current_segment_file->range_end_offset += segment_table->current_segment_file->range_start_offset;
+			segment_table->current_segment_file = NULL;
+
+			result = 0;
+
+			continue;
+		}
+		if( libfdata_list_get_element_mapped_range(
+		     segment_table->segment_files_list,
+		     segment_files_list_index,
+		     &( segment_table->current_segment_file->range_start_offset ),
+		     (size64_t *) &( segment_table->current_segment_file->range_end_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment files list element: %d mapped range.",
+			 function,
+			 segment_files_list_index );
+
+			return( -1 );
 		}
+		segment_table->current_segment_file->range_end_offset += segment_table->current_segment_file->range_start_offset;
 	}
 	if( result != 0 )
 	{
@@ -68,6 +68,18 @@ struct libewf_segment_table
 	 */
 	libewf_segment_file_t *current_segment_file;
 
+	/* The index of the first segment file that has not been scanned
+	 */
+	uint32_t unscanned_segment_number;
+
+	/* The index of the last segment file that has not been scanned
+	 */
+	uint32_t last_unscanned_segment_number;
+
+	/* The storage media size of the segment files that have not been scanned
+	 */
+	size64_t unscanned_storage_media_size;
+
 	/* Flags
 	 */
 	uint8_t flags;
@@ -166,6 +178,19 @@ int libewf_segment_table_set_segment_storage_media_size_by_index(
      size64_t storage_media_size,
      libcerror_error_t **error );
 
+int libewf_segment_table_set_unscanned_segments(
+     libewf_segment_table_t *segment_table,
+     uint32_t first_segment_number,
+     uint32_t last_segment_number,
+     size64_t storage_media_size,
+     libcerror_error_t **error );
+
+int libewf_segment_table_set_segment_file_scanned(
+     libewf_segment_table_t *segment_table,
+     uint32_t segment_number,
+     libewf_segment_file_t *segment_file,
+     libcerror_error_t **error );
+
 int libewf_segment_table_get_segment_file_by_index(
      libewf_segment_table_t *segment_table,
      uint32_t segment_number,
@@ -0,0 +1,110 @@
+/*
+ * SIMD support functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#include "libewf_simd.h"
+
+/* The instruction set, where -1 represents not yet determined
+ */
+static int libewf_simd_instruction_set = -1;
+
+/* Retrieves the most capable SIMD instruction set supported by the CPU
+ * Returns a LIBEWF_SIMD_INSTRUCTION_SET value
+ */
+int libewf_simd_get_instruction_set(
+     void )
+{
+#if defined( LIBEWF_SIMD_HAVE_X86 ) && defined( _MSC_VER )
+	int cpu_information[ 4 ];
+
+	int maximum_function = 0;
+#endif
+	int instruction_set  = LIBEWF_SIMD_INSTRUCTION_SET_NONE;
+
+	/* The instruction set is determined once, concurrent callers determine the same instruction set
+	 */
+	if( libewf_simd_instruction_set != -1 )
+	{
+		return( libewf_simd_instruction_set );
+	}
+#if defined( LIBEWF_SIMD_HAVE_X86 )
+#if defined( _MSC_VER )
+	__cpuid(
+	 cpu_information,
+	 0 );
+
+	maximum_function = cpu_information[ 0 ];
+
+	__cpuid(
+	 cpu_information,
+	 1 );
+
+	/* SSE2 support is indicated by EDX bit 26
+	 */
+	if( ( cpu_information[ 3 ] & ( 1 << 26 ) ) != 0 )
+	{
+		instruction_set = LIBEWF_SIMD_INSTRUCTION_SET_SSE2;
+	}
+	/* AVX2 also requires the operating system to save the YMM registers
+	 * which is indicated by ECX bit 27 (OSXSAVE) and bit 28 (AVX)
+	 */
+	if( ( maximum_function >= 7 )
+	 && ( ( cpu_information[ 2 ] & ( 1 << 27 ) ) != 0 )
+	 && ( ( cpu_information[ 2 ] & ( 1 << 28 ) ) != 0 )
+	 && ( ( _xgetbv( 0 ) & 0x06 ) == 0x06 ) )
+	{
+		__cpuidex(
+		 cpu_information,
+		 7,
+		 0 );
+
+		/* AVX2 support is indicated by EBX bit 5
+		 */
+		if( ( cpu_information[ 1 ] & ( 1 << 5 ) ) != 0 )
+		{
+			instruction_set = LIBEWF_SIMD_INSTRUCTION_SET_AVX2;
+		}
+	}
+#else
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		instruction_set = LIBEWF_SIMD_INSTRUCTION_SET_AVX2;
+	}
+	else if( __builtin_cpu_supports( "sse2" ) )
+	{
+		instruction_set = LIBEWF_SIMD_INSTRUCTION_SET_SSE2;
+	}
+#endif /* defined( _MSC_VER ) */
+#endif /* defined( LIBEWF_SIMD_HAVE_X86 ) */
+
+	libewf_simd_instruction_set = instruction_set;
+
+	return( instruction_set );
+}
+
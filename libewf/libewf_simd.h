@@ -0,0 +1,66 @@
+/*
+ * SIMD support functions
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SIMD_H )
+#define _LIBEWF_SIMD_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SSE2 and AVX2 functions are available on x86 with compilers
+ * that support per function target instruction sets
+ */
+#if ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBEWF_SIMD_HAVE_X86		1
+
+#define LIBEWF_SIMD_TARGET_SSE2		__attribute__ (( target( "sse2" ) ))
+#define LIBEWF_SIMD_TARGET_AVX2		__attribute__ (( target( "avx2" ) ))
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1700 ) && defined( _M_X64 )
+#define LIBEWF_SIMD_HAVE_X86		1
+
+#define LIBEWF_SIMD_TARGET_SSE2
+#define LIBEWF_SIMD_TARGET_AVX2
+
+#endif
+
+/* The SIMD instruction sets
+ */
+enum LIBEWF_SIMD_INSTRUCTION_SETS
+{
+	LIBEWF_SIMD_INSTRUCTION_SET_NONE	= 0,
+	LIBEWF_SIMD_INSTRUCTION_SET_SSE2	= 1,
+	LIBEWF_SIMD_INSTRUCTION_SET_AVX2	= 2
+};
+
+int libewf_simd_get_instruction_set(
+     void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SIMD_H ) */
+
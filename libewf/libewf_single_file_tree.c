@@ -26,6 +26,7 @@
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libuna.h"
+#include "libewf_name_index.h"
 #include "libewf_single_file_tree.h"
 
 /* Retrieves the file entry sub node for the specific UTF-8 formatted name
@@ -40,6 +41,7 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *safe_sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry          = NULL;
 	libewf_lef_file_entry_t *safe_sub_lef_file_entry = NULL;
 	static char *function                            = "libewf_single_file_tree_get_sub_node_by_utf8_name";
 	int compare_result                               = LIBUNA_COMPARE_GREATER;
@@ -83,6 +85,63 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
 	*sub_node           = NULL;
 	*sub_lef_file_entry = NULL;
 
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->sub_file_entries_name_index != NULL ) )
+	{
+		result = libewf_name_index_get_node_by_utf8_name(
+		          lef_file_entry->sub_file_entries_name_index,
+		          utf8_string,
+		          utf8_string_length,
+		          0,
+		          &safe_sub_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node by UTF-8 name from name index.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_tree_node_get_value(
+			     safe_sub_node,
+			     (intptr_t **) &safe_sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node.",
+				 function );
+
+				return( -1 );
+			}
+			*sub_node           = safe_sub_node;
+			*sub_lef_file_entry = safe_sub_lef_file_entry;
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
@@ -189,6 +248,7 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *safe_sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry          = NULL;
 	libewf_lef_file_entry_t *safe_sub_lef_file_entry = NULL;
 	static char *function                            = "libewf_single_file_tree_get_sub_node_by_utf16_name";
 	int compare_result                               = LIBUNA_COMPARE_GREATER;
@@ -232,6 +292,63 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
 	*sub_node           = NULL;
 	*sub_lef_file_entry = NULL;
 
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->sub_file_entries_name_index != NULL ) )
+	{
+		result = libewf_name_index_get_node_by_utf16_name(
+		          lef_file_entry->sub_file_entries_name_index,
+		          utf16_string,
+		          utf16_string_length,
+		          0,
+		          &safe_sub_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node by UTF-16 name from name index.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_tree_node_get_value(
+			     safe_sub_node,
+			     (intptr_t **) &safe_sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node.",
+				 function );
+
+				return( -1 );
+			}
+			*sub_node           = safe_sub_node;
+			*sub_lef_file_entry = safe_sub_lef_file_entry;
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
@@ -24,6 +24,7 @@
 #include <narrow_string.h>
 #include <types.h>
 
+#include "libewf_data_order_index.h"
 #include "libewf_definitions.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_lef_permission.h"
@@ -33,10 +34,13 @@
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
 #include "libewf_libuna.h"
 #include "libewf_line_reader.h"
+#include "libewf_ltree_index.h"
+#include "libewf_name_index.h"
 #include "libewf_permission_group.h"
 #include "libewf_single_files.h"
 
@@ -133,11 +137,33 @@ int libewf_single_files_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *single_files )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *single_files != NULL )
 	{
+		if( ( *single_files )->sources != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *single_files )->sources ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_source_free,
+			 NULL );
+		}
 		if( ( *single_files )->permission_groups != NULL )
 		{
 			libcdata_array_free(
@@ -176,6 +202,23 @@ int libewf_single_files_free(
 	}
 	if( *single_files != NULL )
 	{
+		/* The data stream and file IO pool references are freed elsewhere
+		 */
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *single_files )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( ( *single_files )->file_entry_tree_root_node != NULL )
 		{
 			if( libcdata_tree_node_free(
@@ -221,6 +264,59 @@ int libewf_single_files_free(
 
 			result = -1;
 		}
+		if( ( *single_files )->ltree_index != NULL )
+		{
+			if( libewf_ltree_index_free(
+			     &( ( *single_files )->ltree_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free ltree index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *single_files )->data_order_index != NULL )
+		{
+			if( libewf_data_order_index_free(
+			     &( ( *single_files )->data_order_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data order index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *single_files )->entry_types != NULL )
+		{
+			if( libfvalue_split_utf8_string_free(
+			     &( ( *single_files )->entry_types ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry types.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *single_files )->entry_data != NULL )
+		{
+			memory_free(
+			 ( *single_files )->entry_data );
+		}
 		memory_free(
 		 *single_files );
 
@@ -237,7 +333,9 @@ int libewf_single_files_clone(
      libewf_single_files_t *source_single_files,
      libcerror_error_t **error )
 {
-	static char *function = "libewf_single_files_clone";
+	uint8_t *types_string    = NULL;
+	static char *function    = "libewf_single_files_clone";
+	size_t types_string_size = 0;
 
 	if( destination_single_files == NULL )
 	{
@@ -281,9 +379,25 @@ int libewf_single_files_clone(
 
 		goto on_error;
 	}
-	( *destination_single_files )->permission_groups         = NULL;
-	( *destination_single_files )->sources                   = NULL;
-	( *destination_single_files )->file_entry_tree_root_node = NULL;
+	if( memory_set(
+	     *destination_single_files,
+	     0,
+	     sizeof( libewf_single_files_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination single files.",
+		 function );
+
+		memory_free(
+		 *destination_single_files );
+
+		*destination_single_files = NULL;
+
+		return( -1 );
+	}
 
 	if( libcdata_array_clone(
 	     &( ( *destination_single_files )->permission_groups ),
@@ -333,6 +447,88 @@ int libewf_single_files_clone(
 
 		goto on_error;
 	}
+	if( ( *destination_single_files )->file_entry_tree_root_node != NULL )
+	{
+		if( libewf_single_files_build_name_indexes(
+		     ( *destination_single_files )->file_entry_tree_root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build destination name indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_ltree_index_clone(
+	     &( ( *destination_single_files )->ltree_index ),
+	     source_single_files->ltree_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination ltree index.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_single_files->entry_types != NULL )
+	{
+		if( libfvalue_split_utf8_string_get_string(
+		     source_single_files->entry_types,
+		     &types_string,
+		     &types_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source entry types string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_utf8_string_split(
+		     types_string,
+		     types_string_size,
+		     (uint8_t) '\t',
+		     &( ( *destination_single_files )->entry_types ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination entry types.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *destination_single_files )->data_stream  = source_single_files->data_stream;
+	( *destination_single_files )->file_io_pool = source_single_files->file_io_pool;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *destination_single_files )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -2672,6 +2868,8 @@ on_error:
 }
 
 /* Parses the "entry" category
+ * The entries are indexed on the first pass, only the root entry is read,
+ * the sub entries are read on demand by libewf_single_files_read_sub_file_entries
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_entry_category(
@@ -2680,11 +2878,13 @@ int libewf_single_files_parse_entry_category(
      uint8_t *format,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *types = NULL;
-	uint8_t *line_string                 = NULL;
-	static char *function                = "libewf_single_files_parse_entry_category";
-	size_t line_string_size              = 0;
-	int number_of_sub_entries            = 0;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libfvalue_split_utf8_string_t *types    = NULL;
+	uint8_t *line_string                    = NULL;
+	static char *function                   = "libewf_single_files_parse_entry_category";
+	size_t line_string_size                 = 0;
+	int number_of_sub_entries               = 0;
+	int root_entry_index                    = 0;
 
 	if( single_files == NULL )
 	{
@@ -2708,6 +2908,28 @@ int libewf_single_files_parse_entry_category(
 
 		return( -1 );
 	}
+	if( single_files->ltree_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid single files - ltree index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_files->entry_types != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid single files - entry types value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( line_reader == NULL )
 	{
 		libcerror_error_set(
@@ -2797,15 +3019,15 @@ int libewf_single_files_parse_entry_category(
 
 		goto on_error;
 	}
-	if( libcdata_tree_node_initialize(
-	     &( single_files->file_entry_tree_root_node ),
+	if( libewf_ltree_index_initialize(
+	     &( single_files->ltree_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry tree root node.",
+		 "%s: unable to create ltree index.",
 		 function );
 
 		goto on_error;
@@ -2813,8 +3035,7 @@ int libewf_single_files_parse_entry_category(
 	if( libewf_single_files_parse_file_entry(
 	     single_files,
 	     line_reader,
-	     single_files->file_entry_tree_root_node,
-	     types,
+	     &root_entry_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2857,15 +3078,50 @@ int libewf_single_files_parse_entry_category(
 
 		goto on_error;
 	}
-	if( libfvalue_split_utf8_string_free(
-	     &types,
+	single_files->entry_types  = types;
+	single_files->data_stream  = line_reader->data_stream;
+	single_files->file_io_pool = line_reader->file_io_pool;
+
+	types = NULL;
+
+	if( libewf_single_files_read_file_entry(
+	     single_files,
+	     root_entry_index,
+	     &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_tree_node_initialize(
+	     &( single_files->file_entry_tree_root_node ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split types.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     single_files->file_entry_tree_root_node,
+	     (intptr_t *) lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set root file entry in node.",
 		 function );
 
 		goto on_error;
@@ -2880,6 +3136,27 @@ on_error:
 		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
 		 NULL );
 	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	if( single_files->entry_types != NULL )
+	{
+		libfvalue_split_utf8_string_free(
+		 &( single_files->entry_types ),
+		 NULL );
+	}
+	if( single_files->ltree_index != NULL )
+	{
+		libewf_ltree_index_free(
+		 &( single_files->ltree_index ),
+		 NULL );
+	}
+	single_files->data_stream  = NULL;
+	single_files->file_io_pool = NULL;
+
 	if( types != NULL )
 	{
 		libfvalue_split_utf8_string_free(
@@ -2889,24 +3166,23 @@ on_error:
 	return( -1 );
 }
 
-/* Parses a file entry string for the values
+/* Parses a file entry string and its sub file entries into the ltree index
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_file_entry(
      libewf_single_files_t *single_files,
      libewf_line_reader_t *line_reader,
-     libcdata_tree_node_t *parent_file_entry_node,
-     libfvalue_split_utf8_string_t *types,
+     int *entry_index,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *file_entry_node   = NULL;
-	libewf_lef_file_entry_t *lef_file_entry = NULL;
-	libfvalue_split_utf8_string_t *values   = NULL;
-	const uint8_t *line_data                = NULL;
-	static char *function                   = "libewf_single_files_parse_file_entry";
-	size_t line_data_size                   = 0;
-	int number_of_sub_entries               = 0;
-	int sub_entry_index                     = 0;
+	const uint8_t *line_data  = NULL;
+	static char *function     = "libewf_single_files_parse_file_entry";
+	size_t line_data_size     = 0;
+	off64_t line_data_offset  = 0;
+	int number_of_sub_entries = 0;
+	int safe_entry_index      = 0;
+	int sub_entry_index       = 0;
+	int sub_entry_iterator    = 0;
 
 	if( single_files == NULL )
 	{
@@ -2919,6 +3195,17 @@ int libewf_single_files_parse_file_entry(
 
 		return( -1 );
 	}
+	if( single_files->ltree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid single files - missing ltree index.",
+		 function );
+
+		return( -1 );
+	}
 	if( line_reader == NULL )
 	{
 		libcerror_error_set(
@@ -2930,13 +3217,13 @@ int libewf_single_files_parse_file_entry(
 
 		return( -1 );
 	}
-	if( parent_file_entry_node == NULL )
+	if( entry_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid parent file entry node.",
+		 "%s: invalid entry index.",
 		 function );
 
 		return( -1 );
@@ -2954,8 +3241,10 @@ int libewf_single_files_parse_file_entry(
 		 "%s: unable to parse file entry number of sub entries.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	line_data_offset = line_reader->line_offset;
+
 	if( libewf_line_reader_read_data(
 	     line_reader,
 	     &line_data,
@@ -2970,76 +3259,35 @@ int libewf_single_files_parse_file_entry(
 		 function,
 		 line_reader->line_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libewf_lef_file_entry_initialize(
-	     &lef_file_entry,
+	/* The file entry values are not parsed here, only the location of the line data is retained
+	 */
+	if( libewf_ltree_index_append_entry(
+	     single_files->ltree_index,
+	     line_data_offset,
+	     line_data_size,
+	     number_of_sub_entries,
+	     &safe_entry_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file entry to ltree index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libewf_lef_file_entry_read_data(
-	     lef_file_entry,
-	     types,
-	     line_data,
-	     line_data_size,
-	     error ) != 1 )
+	for( sub_entry_iterator = 0;
+	     sub_entry_iterator < number_of_sub_entries;
+	     sub_entry_iterator++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file entry",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_tree_node_set_value(
-	     parent_file_entry_node,
-	     (intptr_t *) lef_file_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set file entry in node.",
-		 function );
-
-		goto on_error;
-	}
-	lef_file_entry = NULL;
-
-	for( sub_entry_index = 0;
-	     sub_entry_index < number_of_sub_entries;
-	     sub_entry_index++ )
-	{
-		if( libcdata_tree_node_initialize(
-		     &file_entry_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub file entry: %d node.",
-			 function,
-			 sub_entry_index );
-
-			goto on_error;
-		}
 		if( libewf_single_files_parse_file_entry(
 		     single_files,
 		     line_reader,
-		     file_entry_node,
-		     types,
+		     &sub_entry_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3048,50 +3296,29 @@ int libewf_single_files_parse_file_entry(
 			 LIBCERROR_CONVERSION_ERROR_GENERIC,
 			 "%s: unable to parse sub file entry: %d.",
 			 function,
-			 sub_entry_index );
-
-			goto on_error;
-		}
-		if( libcdata_tree_node_append_node(
-		     parent_file_entry_node,
-		     file_entry_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sub file entry: %d node to parent.",
-			 function,
-			 sub_entry_index );
+			 sub_entry_iterator );
 
-			goto on_error;
+			return( -1 );
 		}
-		file_entry_node = NULL;
-	}
-	return( 1 );
-
-on_error:
-	if( file_entry_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &file_entry_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
-		 NULL );
-	}
-	if( lef_file_entry != NULL )
-	{
-		libewf_lef_file_entry_free(
-		 &lef_file_entry,
-		 NULL );
 	}
-	if( values != NULL )
+	if( libewf_ltree_index_set_next_entry_index(
+	     single_files->ltree_index,
+	     safe_entry_index,
+	     error ) != 1 )
 	{
-		libfvalue_split_utf8_string_free(
-		 &values,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set next entry index of file entry: %d.",
+		 function,
+		 safe_entry_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	*entry_index = safe_entry_index;
+
+	return( 1 );
 }
 
 /* Parses a file entry string for the number of sub entries
@@ -3346,6 +3573,8 @@ on_error:
 }
 
 /* Reads the single files
+ * The data stream and file IO pool are referenced by the single files to read
+ * the file entries on demand and must remain valid until the single files are freed
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_read_data_stream(
@@ -3512,6 +3741,1218 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a specific file entry from the data stream using the ltree index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_read_file_entry(
+     libewf_single_files_t *single_files,
+     int entry_index,
+     libewf_lef_file_entry_t **lef_file_entry,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *safe_lef_file_entry = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libewf_single_files_read_file_entry";
+	size_t entry_data_size                       = 0;
+	ssize_t read_count                           = 0;
+	off64_t entry_data_offset                    = 0;
+	int number_of_sub_entries                    = 0;
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_files->data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid single files - missing data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_ltree_index_get_entry_by_index(
+	     single_files->ltree_index,
+	     entry_index,
+	     &entry_data_offset,
+	     &entry_data_size,
+	     &number_of_sub_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ltree index entry: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	if( entry_data_size > single_files->entry_data_size )
+	{
+		reallocation = memory_reallocate(
+		                single_files->entry_data,
+		                sizeof( uint8_t ) * entry_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entry data.",
+			 function );
+
+			goto on_error;
+		}
+		single_files->entry_data      = (uint8_t *) reallocation;
+		single_files->entry_data_size = entry_data_size;
+	}
+	if( entry_data_size > 0 )
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+			      single_files->data_stream,
+			      (intptr_t *) single_files->file_io_pool,
+			      single_files->entry_data,
+			      entry_data_size,
+			      entry_data_offset,
+			      0,
+			      error );
+
+		if( read_count != (ssize_t) entry_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry_index,
+			 entry_data_offset,
+			 entry_data_offset );
+
+			goto on_error;
+		}
+	}
+	if( libewf_lef_file_entry_initialize(
+	     &safe_lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_lef_file_entry_read_data(
+	     safe_lef_file_entry,
+	     single_files->entry_types,
+	     single_files->entry_data,
+	     entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file entry: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	safe_lef_file_entry->ltree_entry_index = entry_index;
+
+	*lef_file_entry = safe_lef_file_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &safe_lef_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the sub file entries of a file entry tree node if they were not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_read_sub_file_entries(
+     libewf_single_files_t *single_files,
+     libcdata_tree_node_t *file_entry_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry     = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	libewf_name_index_t *name_index             = NULL;
+	static char *function                       = "libewf_single_files_read_sub_file_entries";
+	size_t entry_data_size                      = 0;
+	off64_t entry_data_offset                   = 0;
+	int number_of_sub_entries                   = 0;
+	int number_of_sub_nodes                     = 0;
+	int sub_entry_index                         = 0;
+	int sub_entry_iterator                      = 0;
+	int sub_nodes_appended                      = 0;
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_files->ltree_index == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     file_entry_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		if( libcdata_tree_node_get_value(
+		     file_entry_tree_node,
+		     (intptr_t **) &lef_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry from node.",
+			 function );
+
+			goto on_error;
+		}
+		if( lef_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_ltree_index_get_entry_by_index(
+		     single_files->ltree_index,
+		     lef_file_entry->ltree_entry_index,
+		     &entry_data_offset,
+		     &entry_data_size,
+		     &number_of_sub_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ltree index entry: %d.",
+			 function,
+			 lef_file_entry->ltree_entry_index );
+
+			goto on_error;
+		}
+		/* Wide directories get a name index to speed up lookups by name
+		 */
+		if( number_of_sub_entries >= LIBEWF_MINIMUM_NUMBER_OF_NAME_INDEXED_SUB_FILE_ENTRIES )
+		{
+			if( libewf_name_index_initialize(
+			     &name_index,
+			     number_of_sub_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub file entries name index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The sub entries are stored directly after the entry
+		 */
+		sub_entry_index = lef_file_entry->ltree_entry_index + 1;
+
+		for( sub_entry_iterator = 0;
+		     sub_entry_iterator < number_of_sub_entries;
+		     sub_entry_iterator++ )
+		{
+			if( libewf_single_files_read_file_entry(
+			     single_files,
+			     sub_entry_index,
+			     &sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub file entry: %d.",
+				 function,
+				 sub_entry_iterator );
+
+				goto on_error;
+			}
+			if( libcdata_tree_node_initialize(
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub file entry: %d node.",
+				 function,
+				 sub_entry_iterator );
+
+				goto on_error;
+			}
+			if( libcdata_tree_node_set_value(
+			     sub_node,
+			     (intptr_t *) sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sub file entry: %d in node.",
+				 function,
+				 sub_entry_iterator );
+
+				goto on_error;
+			}
+			sub_lef_file_entry = NULL;
+
+			if( name_index != NULL )
+			{
+				if( libewf_name_index_append_node(
+				     name_index,
+				     sub_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sub file entry: %d node to name index.",
+					 function,
+					 sub_entry_iterator );
+
+					goto on_error;
+				}
+			}
+			if( libcdata_tree_node_append_node(
+			     file_entry_tree_node,
+			     sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub file entry: %d node to parent.",
+				 function,
+				 sub_entry_iterator );
+
+				goto on_error;
+			}
+			sub_node           = NULL;
+			sub_nodes_appended = 1;
+
+			if( libewf_ltree_index_get_next_entry_index(
+			     single_files->ltree_index,
+			     sub_entry_index,
+			     &sub_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next entry index of sub file entry: %d.",
+				 function,
+				 sub_entry_iterator );
+
+				goto on_error;
+			}
+		}
+		lef_file_entry->sub_file_entries_name_index = name_index;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( sub_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &sub_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	if( sub_lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &sub_lef_file_entry,
+		 NULL );
+	}
+	if( name_index != NULL )
+	{
+		libewf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	/* Remove the sub nodes that were read so that a next call starts over
+	 */
+	if( sub_nodes_appended != 0 )
+	{
+		libcdata_tree_node_empty(
+		 file_entry_tree_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 single_files->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Builds the name indexes of the sub file entries that were read before
+ * This is used to rebuild the name indexes of a cloned file entry tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_build_name_indexes(
+     libcdata_tree_node_t *file_entry_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node          = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libewf_name_index_t *name_index         = NULL;
+	static char *function                   = "libewf_single_files_build_name_indexes";
+	int number_of_sub_nodes                 = 0;
+	int sub_node_index                      = 0;
+
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     file_entry_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     file_entry_tree_node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry from node.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->sub_file_entries_name_index == NULL )
+	 && ( number_of_sub_nodes >= LIBEWF_MINIMUM_NUMBER_OF_NAME_INDEXED_SUB_FILE_ENTRIES ) )
+	{
+		if( libewf_name_index_initialize(
+		     &name_index,
+		     number_of_sub_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub file entries name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     file_entry_tree_node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( name_index != NULL )
+		{
+			if( libewf_name_index_append_node(
+			     name_index,
+			     sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub node: %d to name index.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+		}
+		if( libewf_single_files_build_name_indexes(
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build name indexes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+	}
+	if( name_index != NULL )
+	{
+		lef_file_entry->sub_file_entries_name_index = name_index;
+	}
+	return( 1 );
+
+on_error:
+	if( name_index != NULL )
+	{
+		libewf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the file entries of a file entry tree node and its sub nodes to a data order index
+ * The sub file entries are read if they were not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_append_data_ordered_file_entries(
+     libewf_single_files_t *single_files,
+     libcdata_tree_node_t *file_entry_tree_node,
+     libewf_data_order_index_t *data_order_index,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node          = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_files_append_data_ordered_file_entries";
+	int number_of_sub_nodes                 = 0;
+	int sub_node_index                      = 0;
+
+	if( libcdata_tree_node_get_value(
+	     file_entry_tree_node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry->type == LIBEWF_FILE_ENTRY_TYPE_FILE )
+	{
+		if( libewf_data_order_index_append_node(
+		     data_order_index,
+		     file_entry_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file entry to data order index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libewf_single_files_read_sub_file_entries(
+	     single_files,
+	     file_entry_tree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     file_entry_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     file_entry_tree_node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_files_append_data_ordered_file_entries(
+		     single_files,
+		     sub_node,
+		     data_order_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file entries of sub node: %d to data order index.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the data order index
+ * The data order index is built on first use, which reads all file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_get_data_order_index(
+     libewf_single_files_t *single_files,
+     libewf_data_order_index_t **data_order_index,
+     libcerror_error_t **error )
+{
+	libewf_data_order_index_t *safe_data_order_index = NULL;
+	static char *function                            = "libewf_single_files_get_data_order_index";
+	int number_of_entries                            = 0;
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_order_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data order index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_data_order_index = single_files->data_order_index;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_data_order_index != NULL )
+	{
+		*data_order_index = safe_data_order_index;
+
+		return( 1 );
+	}
+	/* The ltree index contains an entry for every file entry
+	 * and as such bounds the number of file entries
+	 */
+	if( single_files->ltree_index != NULL )
+	{
+		if( libewf_ltree_index_get_number_of_entries(
+		     single_files->ltree_index,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of ltree index entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_data_order_index_initialize(
+	     &safe_data_order_index,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data order index.",
+		 function );
+
+		goto on_error;
+	}
+	if( single_files->file_entry_tree_root_node != NULL )
+	{
+		if( libewf_single_files_append_data_ordered_file_entries(
+		     single_files,
+		     single_files->file_entry_tree_root_node,
+		     safe_data_order_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file entries to data order index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_data_order_index_sort(
+	     safe_data_order_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort data order index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have built the data order index in the meantime
+	 */
+	if( single_files->data_order_index == NULL )
+	{
+		single_files->data_order_index = safe_data_order_index;
+
+		safe_data_order_index = NULL;
+	}
+	*data_order_index = single_files->data_order_index;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( safe_data_order_index != NULL )
+	{
+		libewf_data_order_index_free(
+		 &safe_data_order_index,
+		 NULL );
+	}
+	return( 1 );
+
+on_error:
+	if( safe_data_order_index != NULL )
+	{
+		libewf_data_order_index_free(
+		 &safe_data_order_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the memory used by the file entries of a file entry tree node and its sub nodes
+ * Only the file entries that were read before are included
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_get_file_entry_tree_memory_usage(
+     libcdata_tree_node_t *file_entry_tree_node,
+     int *number_of_file_entries,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node          = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_files_get_file_entry_tree_memory_usage";
+	size_t file_entry_memory_usage          = 0;
+	int number_of_sub_nodes                 = 0;
+	int sub_node_index                      = 0;
+
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     file_entry_tree_node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( lef_file_entry != NULL )
+	{
+		if( libewf_lef_file_entry_get_memory_usage(
+		     lef_file_entry,
+		     &file_entry_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry memory usage.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_file_entries += 1;
+		*memory_usage           += (size64_t) file_entry_memory_usage;
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     file_entry_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     file_entry_tree_node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_files_get_file_entry_tree_memory_usage(
+		     sub_node,
+		     number_of_file_entries,
+		     memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the memory used by the file entries
+ * This includes the ltree index and the file entries that were read before
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_get_memory_usage(
+     libewf_single_files_t *single_files,
+     int *number_of_file_entries,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_single_files_get_memory_usage";
+	size64_t safe_memory_usage = 0;
+	int result                 = 1;
+	int safe_number_of_entries = 0;
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( single_files->ltree_index != NULL )
+	{
+		safe_memory_usage = sizeof( libewf_ltree_index_t )
+		                  + ( (size64_t) single_files->ltree_index->number_of_allocated_entries * sizeof( libewf_ltree_index_entry_t ) );
+	}
+	if( single_files->data_order_index != NULL )
+	{
+		safe_memory_usage += sizeof( libewf_data_order_index_t )
+		                   + ( (size64_t) single_files->data_order_index->maximum_number_of_entries * sizeof( libewf_data_order_index_entry_t ) );
+	}
+	if( single_files->file_entry_tree_root_node != NULL )
+	{
+		if( libewf_single_files_get_file_entry_tree_memory_usage(
+		     single_files->file_entry_tree_root_node,
+		     &safe_number_of_entries,
+		     &safe_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry tree memory usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     single_files->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_file_entries = safe_number_of_entries;
+		*memory_usage           = safe_memory_usage;
+	}
+	return( result );
+}
+
 /* Retrieves the file entry tree root node
  * Returns 1 if successful or -1 on error
  */
@@ -25,15 +25,18 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_data_order_index.h"
 #include "libewf_extern.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_lef_source.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
 #include "libewf_line_reader.h"
+#include "libewf_ltree_index.h"
 #include "libewf_permission_group.h"
 #include "libewf_types.h"
 
@@ -56,6 +59,40 @@ struct libewf_single_files
 	/* The file entry tree root node
 	 */
 	libcdata_tree_node_t *file_entry_tree_root_node;
+
+	/* The ltree index
+	 */
+	libewf_ltree_index_t *ltree_index;
+
+	/* The data order index
+	 */
+	libewf_data_order_index_t *data_order_index;
+
+	/* The entry types
+	 */
+	libfvalue_split_utf8_string_t *entry_types;
+
+	/* The data stream the entries are read from
+	 */
+	libfdata_stream_t *data_stream;
+
+	/* The file IO pool the entries are read from
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The entry data
+	 */
+	uint8_t *entry_data;
+
+	/* The entry data size
+	 */
+	size_t entry_data_size;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libewf_single_files_initialize(
@@ -137,8 +174,7 @@ int libewf_single_files_parse_entry_category(
 int libewf_single_files_parse_file_entry(
      libewf_single_files_t *single_files,
      libewf_line_reader_t *line_reader,
-     libcdata_tree_node_t *parent_file_entry_node,
-     libfvalue_split_utf8_string_t *types,
+     int *entry_index,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_file_entry_number_of_sub_entries(
@@ -155,6 +191,44 @@ int libewf_single_files_read_data_stream(
      uint8_t *format,
      libcerror_error_t **error );
 
+int libewf_single_files_read_file_entry(
+     libewf_single_files_t *single_files,
+     int entry_index,
+     libewf_lef_file_entry_t **lef_file_entry,
+     libcerror_error_t **error );
+
+int libewf_single_files_read_sub_file_entries(
+     libewf_single_files_t *single_files,
+     libcdata_tree_node_t *file_entry_tree_node,
+     libcerror_error_t **error );
+
+int libewf_single_files_build_name_indexes(
+     libcdata_tree_node_t *file_entry_tree_node,
+     libcerror_error_t **error );
+
+int libewf_single_files_append_data_ordered_file_entries(
+     libewf_single_files_t *single_files,
+     libcdata_tree_node_t *file_entry_tree_node,
+     libewf_data_order_index_t *data_order_index,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_data_order_index(
+     libewf_single_files_t *single_files,
+     libewf_data_order_index_t **data_order_index,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_file_entry_tree_memory_usage(
+     libcdata_tree_node_t *file_entry_tree_node,
+     int *number_of_file_entries,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_memory_usage(
+     libewf_single_files_t *single_files,
+     int *number_of_file_entries,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 int libewf_single_files_get_file_entry_tree_root_node(
      libewf_single_files_t *single_files,
      libcdata_tree_node_t **root_node,
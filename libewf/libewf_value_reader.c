@@ -29,6 +29,7 @@
 #endif
 
 #include "libewf_definitions.h"
+#include "libewf_hexadecimal_string.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
 #include "libewf_libfvalue.h"
@@ -869,6 +870,69 @@ int libewf_value_reader_read_serialized_string_base16(
 	return( 1 );
 }
 
+/* Reads a base-16 encoded value as a hexadecimal string
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libewf_value_reader_read_hexadecimal_string(
+     libewf_value_reader_t *value_reader,
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "libewf_value_reader_read_hexadecimal_string";
+	size_t value_data_size    = 0;
+
+	if( value_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_value_reader_read_data(
+	     value_reader,
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value: %d data.",
+		 function,
+		 value_reader->value_index );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 || ( value_data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libewf_hexadecimal_string_read_data(
+	     hexadecimal_string,
+	     value_data,
+	     value_data_size,
+	     value_reader->data_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads a value as UTF-8 string
  * Returns 1 if successful or -1 on error
  */
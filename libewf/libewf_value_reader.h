@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_hexadecimal_string.h"
 #include "libewf_libcerror.h"
 #include "libewf_serialized_string.h"
 
@@ -118,6 +119,11 @@ int libewf_value_reader_read_serialized_string_base16(
      libewf_serialized_string_t *serialized_string,
      libcerror_error_t **error );
 
+int libewf_value_reader_read_hexadecimal_string(
+     libewf_value_reader_t *value_reader,
+     libewf_hexadecimal_string_t *hexadecimal_string,
+     libcerror_error_t **error );
+
 int libewf_value_reader_read_utf8_string(
      libewf_value_reader_t *value_reader,
      uint8_t **utf8_string,
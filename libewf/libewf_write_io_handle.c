@@ -35,7 +35,9 @@
 #include "libewf_chunk_descriptor.h"
 #include "libewf_chunk_table.h"
 #include "libewf_compression.h"
+#include "libewf_compression_context.h"
 #include "libewf_definitions.h"
+#include "libewf_digest_tree.h"
 #include "libewf_filename.h"
 #include "libewf_header_sections.h"
 #include "libewf_header_values.h"
@@ -47,6 +49,7 @@
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
+#include "libewf_libhmac.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
 #include "libewf_section.h"
@@ -221,6 +224,38 @@ int libewf_write_io_handle_free(
 			memory_free(
 			 ( *write_io_handle )->compressed_zero_byte_empty_block );
 		}
+		if( ( *write_io_handle )->digest_tree_leaf_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *write_io_handle )->digest_tree_leaf_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest tree leaf context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *write_io_handle )->compression_context != NULL )
+		{
+			if( libewf_compression_context_free(
+			     &( ( *write_io_handle )->compression_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compression context.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( ( *write_io_handle )->chunks_section ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_descriptor_free,
@@ -340,6 +375,15 @@ int libewf_write_io_handle_clone(
 	( *destination_write_io_handle )->current_segment_file       = NULL;
 	( *destination_write_io_handle )->managed_segment_file       = NULL;
 
+	/* The digests of the chunks in the current digest tree leaf cannot be cloned
+	 */
+	( *destination_write_io_handle )->digest_tree_leaf_context             = NULL;
+	( *destination_write_io_handle )->number_of_chunks_in_digest_tree_leaf = 0;
+
+	/* The compression context is created on first use
+	 */
+	( *destination_write_io_handle )->compression_context = NULL;
+
 	if( source_write_io_handle->case_data != NULL )
 	{
 		( *destination_write_io_handle )->case_data = (uint8_t *) memory_allocate(
@@ -638,6 +682,17 @@ int libewf_write_io_handle_initialize_values(
 	{
 		io_handle->segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
 	}
+	/* The digest tree section is only defined for the EWF version 1 format
+	 */
+	if( ( io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 || ( io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		write_io_handle->number_of_chunks_per_digest_tree_leaf = 0;
+	}
+	if( write_io_handle->number_of_chunks_per_digest_tree_leaf != 0 )
+	{
+		write_io_handle->pack_flags |= LIBEWF_PACK_FLAG_CALCULATE_DIGEST;
+	}
 	if( io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
 	{
 		/* Leave space for the a table entry in the table section
@@ -3819,6 +3874,25 @@ ssize_t libewf_write_io_handle_write_new_chunk(
 	}
 	total_write_count += write_count;
 
+	if( write_io_handle->number_of_chunks_per_digest_tree_leaf != 0 )
+	{
+		if( libewf_write_io_handle_update_digest_tree(
+		     write_io_handle,
+		     hash_sections,
+		     chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest tree with chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
 	/* Reserve space in the segment file for the chunk table entries
 	 */
 	write_io_handle->remaining_segment_file_size -= write_io_handle->chunk_table_entries_reserved_size;
@@ -3985,6 +4059,269 @@ on_error:
 	return( -1 );
 }
 
+/* Appends the digest of the current digest tree leaf to the digest tree
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_write_io_handle_append_digest_tree_leaf(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error )
+{
+	uint8_t leaf_digest[ LIBEWF_DIGEST_TREE_DIGEST_SIZE ];
+
+	static char *function = "libewf_write_io_handle_append_digest_tree_leaf";
+
+	if( write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_io_handle->digest_tree_leaf_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid write IO handle - missing digest tree leaf context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_sections->digest_tree == NULL )
+	{
+		if( libewf_digest_tree_initialize(
+		     &( hash_sections->digest_tree ),
+		     write_io_handle->number_of_chunks_per_digest_tree_leaf,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libhmac_sha256_finalize(
+	     write_io_handle->digest_tree_leaf_context,
+	     leaf_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digest tree leaf context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_free(
+	     &( write_io_handle->digest_tree_leaf_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free digest tree leaf context.",
+		 function );
+
+		return( -1 );
+	}
+	write_io_handle->number_of_chunks_in_digest_tree_leaf = 0;
+
+	if( libewf_digest_tree_append_leaf(
+	     hash_sections->digest_tree,
+	     leaf_digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append leaf to digest tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the digest tree with the digest of a chunk
+ * The leaf digest is the SHA256 of the concatenated SHA256 digests of the chunks of the leaf
+ * The chunks must be provided in order
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_write_io_handle_update_digest_tree(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_write_io_handle_update_digest_tree";
+
+	if( write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_io_handle->number_of_chunks_per_digest_tree_leaf == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid write IO handle - missing number of chunks per digest tree leaf.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->digest_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_io_handle->digest_tree_leaf_context == NULL )
+	{
+		if( libhmac_sha256_initialize(
+		     &( write_io_handle->digest_tree_leaf_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest tree leaf context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libhmac_sha256_update(
+	     write_io_handle->digest_tree_leaf_context,
+	     chunk_data->digest,
+	     LIBEWF_DIGEST_TREE_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest tree leaf context.",
+		 function );
+
+		return( -1 );
+	}
+	write_io_handle->number_of_chunks_in_digest_tree_leaf += 1;
+
+	if( write_io_handle->number_of_chunks_in_digest_tree_leaf >= write_io_handle->number_of_chunks_per_digest_tree_leaf )
+	{
+		if( libewf_write_io_handle_append_digest_tree_leaf(
+		     write_io_handle,
+		     hash_sections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append digest tree leaf.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the digest tree
+ * Appends the last leaf if it contains less than the number of chunks per leaf
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_write_io_handle_finalize_digest_tree(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_write_io_handle_finalize_digest_tree";
+
+	if( write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_io_handle->number_of_chunks_in_digest_tree_leaf == 0 )
+	{
+		return( 1 );
+	}
+	if( libewf_write_io_handle_append_digest_tree_leaf(
+	     write_io_handle,
+	     hash_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append last digest tree leaf.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Corrects sections after streamed write
  * Returns 1 if successful or -1 on error
  */
@@ -34,12 +34,15 @@
 #include "libewf_chunk_data.h"
 #include "libewf_chunk_group.h"
 #include "libewf_chunk_table.h"
+#include "libewf_compression_context.h"
+#include "libewf_hash_sections.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcdata.h"
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
+#include "libewf_libhmac.h"
 #include "libewf_io_handle.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
@@ -220,6 +223,23 @@ struct libewf_write_io_handle
 	/* The size of the compressed zero byte empty block
 	 */
 	size_t compressed_zero_byte_empty_block_size;
+
+	/* The number of chunks per digest tree leaf
+	 * 0 represents no digest tree is written
+	 */
+	uint32_t number_of_chunks_per_digest_tree_leaf;
+
+	/* The SHA256 context of the current digest tree leaf
+	 */
+	libhmac_sha256_context_t *digest_tree_leaf_context;
+
+	/* The number of chunks in the current digest tree leaf
+	 */
+	uint32_t number_of_chunks_in_digest_tree_leaf;
+
+	/* The compression context used to pack chunks on the calling thread
+	 */
+	libewf_compression_context_t *compression_context;
 };
 
 int libewf_write_io_handle_initialize(
@@ -370,6 +390,22 @@ ssize_t libewf_write_io_handle_write_new_chunk(
          size_t input_data_size,
          libcerror_error_t **error );
 
+int libewf_write_io_handle_append_digest_tree_leaf(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error );
+
+int libewf_write_io_handle_update_digest_tree(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+int libewf_write_io_handle_finalize_digest_tree(
+     libewf_write_io_handle_t *write_io_handle,
+     libewf_hash_sections_t *hash_sections,
+     libcerror_error_t **error );
+
 int libewf_write_io_handle_finalize_write_sections_corrections(
      libewf_write_io_handle_t *write_io_handle,
      libbfio_pool_t *file_io_pool,
@@ -0,0 +1,138 @@
+dnl Checks for lz4 required headers and functions
+dnl
+dnl Version: 20251016
+
+dnl Function to detect if lz4 is available
+AC_DEFUN([AX_LZ4_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_lz4" = xno],
+    [ac_cv_lz4=no],
+    [ac_cv_lz4=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-lz4 which returns "yes" and --with-lz4= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_lz4" != x && test "x$ac_cv_with_lz4" != xauto-detect && test "x$ac_cv_with_lz4" != xyes],
+      [AS_IF(
+        [test -d "$ac_cv_with_lz4"],
+        [CFLAGS="$CFLAGS -I${ac_cv_with_lz4}/include"
+        LDFLAGS="$LDFLAGS -L${ac_cv_with_lz4}/lib"],
+        [AC_MSG_FAILURE(
+          [no such directory: $ac_cv_with_lz4],
+          [1])
+        ])
+      ],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [lz4],
+          [liblz4 >= 1.8.0],
+          [ac_cv_lz4=lz4],
+          [ac_cv_lz4=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_lz4" = xlz4],
+        [ac_cv_lz4_CPPFLAGS="$pkg_cv_lz4_CFLAGS"
+        ac_cv_lz4_LIBADD="$pkg_cv_lz4_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_lz4" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([lz4.h lz4hc.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_lz4_h" = xno || test "x$ac_cv_header_lz4hc_h" = xno],
+        [ac_cv_lz4=no],
+        [dnl Check for the individual functions
+        ac_cv_lz4=lz4
+
+        AC_CHECK_LIB(
+          lz4,
+          LZ4_compress_HC,
+          [],
+          [ac_cv_lz4=no])
+
+        AS_IF(
+          [test "x$ac_cv_lz4" = xlz4],
+          [ac_cv_lz4_LIBADD="-llz4"])
+        ])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_lz4" != xlz4 && test "x$ac_cv_with_lz4" != x && test "x$ac_cv_with_lz4" != xauto-detect && test "x$ac_cv_with_lz4" != xyes],
+      [AC_MSG_FAILURE(
+        [unable to find supported lz4 in directory: $ac_cv_with_lz4],
+        [1])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_lz4" = xlz4],
+    [AC_DEFINE(
+      [HAVE_LZ4],
+      [1],
+      [Define to 1 if you have the 'lz4' library (-llz4).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_lz4" != xno],
+    [AC_SUBST(
+      [HAVE_LZ4],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LZ4],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable lz4
+AC_DEFUN([AX_LZ4_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [lz4],
+    [lz4],
+    [search for lz4 in includedir and libdir or in the specified DIR, or no if not to use lz4],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LZ4_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_lz4_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LZ4_CPPFLAGS],
+      [$ac_cv_lz4_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_lz4_LIBADD" != "x"],
+    [AC_SUBST(
+      [LZ4_LIBADD],
+      [$ac_cv_lz4_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_lz4" = xlz4],
+    [AC_SUBST(
+      [ax_lz4_pc_libs_private],
+      [-llz4])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_lz4" = xlz4],
+    [AC_SUBST(
+      [ax_lz4_spec_requires],
+      [lz4-libs])
+    AC_SUBST(
+      [ax_lz4_spec_build_requires],
+      [lz4-devel])
+    AC_SUBST(
+      [ax_lz4_static_spec_requires],
+      [lz4-static])
+    AC_SUBST(
+      [ax_lz4_static_spec_build_requires],
+      [lz4-static])
+    ])
+  ])
+
@@ -22,12 +22,16 @@
 #include <common.h>
 #include <memory.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include <time.h>
+
+#include "ewf_test_getopt.h"
 #include "ewf_test_libcerror.h"
 #include "ewf_test_libcnotify.h"
 #include "ewf_test_libewf.h"
@@ -41,6 +45,14 @@
 #define EWF_TEST_CHECKSUM
  */
 
+/* The size of the benchmark data
+ */
+#define EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the data of which the checksum is calculated at once, which is the default chunk size
+ */
+#define EWF_TEST_CHECKSUM_BENCHMARK_CHUNK_SIZE		( 32 * 1024 )
+
 uint8_t ewf_test_checksum_uncompressed_byte_stream[ 7640 ] = {
 	0x09, 0x09, 0x20, 0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x45, 0x53, 0x53, 0x45, 0x52, 0x20,
 	0x47, 0x45, 0x4e, 0x45, 0x52, 0x41, 0x4c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x4c,
@@ -626,23 +638,319 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_checksum_get_adler32_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_checksum_get_adler32_kernel(
+     void )
+{
+	int kernel = 0;
+	int result = 0;
+
+	kernel = libewf_checksum_get_adler32_kernel();
+
+	EWF_TEST_ASSERT_GREATER_THAN_INT(
+	 "kernel",
+	 kernel,
+	 -1 );
+
+	EWF_TEST_ASSERT_LESS_THAN_INT(
+	 "kernel",
+	 kernel,
+	 LIBEWF_CHECKSUM_ADLER32_KERNEL_AVX2 + 1 );
+
+	/* The kernel is determined once
+	 */
+	result = libewf_checksum_get_adler32_kernel();
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 kernel );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libewf_checksum_calculate_adler32_with_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_checksum_calculate_adler32_with_kernel(
+     void )
+{
+	uint8_t data[ 8192 ];
+
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	int kernel                 = 0;
+	int maximum_kernel         = 0;
+
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		/* Use values near the maximum byte value to test the intermediate sums
+		 */
+		if( ( data_offset % 3 ) == 0 )
+		{
+			data[ data_offset ] = 0xff;
+		}
+		else
+		{
+			data[ data_offset ] = (uint8_t) ( ( data_offset * 251 ) >> 3 );
+		}
+	}
+	maximum_kernel = libewf_checksum_get_adler32_kernel();
+
+	for( kernel = LIBEWF_CHECKSUM_ADLER32_KERNEL_SCALAR;
+	     kernel <= maximum_kernel;
+	     kernel++ )
+	{
+		/* Test regular cases
+		 */
+		checksum = libewf_checksum_calculate_adler32_with_kernel(
+		            kernel,
+		            ewf_test_checksum_uncompressed_byte_stream,
+		            7640,
+		            1 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 (uint32_t) 0x304a56a4UL );
+
+		checksum = libewf_checksum_calculate_adler32_with_kernel(
+		            kernel,
+		            ewf_test_checksum_uncompressed_byte_stream,
+		            0,
+		            1 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 (uint32_t) 1 );
+
+		/* Test unaligned data and sizes that are not a multiple of the block size
+		 * against the scalar kernel
+		 */
+		for( data_offset = 0;
+		     data_offset < 33;
+		     data_offset++ )
+		{
+			for( data_size = 0;
+			     data_size < ( 8192 - 33 );
+			     data_size += 67 + data_offset )
+			{
+				expected_checksum = libewf_checksum_calculate_adler32_scalar(
+				                     &( data[ data_offset ] ),
+				                     data_size,
+				                     0xfff0fff0UL );
+
+				checksum = libewf_checksum_calculate_adler32_with_kernel(
+				            kernel,
+				            &( data[ data_offset ] ),
+				            data_size,
+				            0xfff0fff0UL );
+
+				EWF_TEST_ASSERT_EQUAL_UINT32(
+				 "checksum",
+				 checksum,
+				 expected_checksum );
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Prints the throughput
+ */
+void ewf_test_checksum_benchmark_print_throughput(
+      const char *name,
+      size_t data_size,
+      clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%s: %.1f MB/s\n",
+	 name,
+	 ( (double) data_size / ( 1024.0 * 1024.0 ) ) / number_of_seconds );
+}
+
+/* Runs the Adler-32 benchmark
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_checksum_benchmark(
+     void )
+{
+	const char *kernel_names[ 3 ] = {
+		"libewf_checksum_calculate_adler32_scalar",
+		"libewf_checksum_calculate_adler32_sse2",
+		"libewf_checksum_calculate_adler32_avx2" };
+
+	libcerror_error_t *error      = NULL;
+	uint8_t *data                 = NULL;
+	clock_t start_clock           = 0;
+	size_t data_offset            = 0;
+	uint32_t checksum             = 0;
+	uint32_t expected_checksum    = 0;
+	uint32_t seed                 = 0x12345678UL;
+	int kernel                    = 0;
+	int maximum_kernel            = 0;
+	int result                    = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE;
+	     data_offset++ )
+	{
+		/* Use a linear congruential generator to have reproducible data
+		 */
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( seed >> 16 );
+	}
+	maximum_kernel = libewf_checksum_get_adler32_kernel();
+
+	/* Calculate the checksums per chunk as they are verified when reading
+	 */
+	for( kernel = LIBEWF_CHECKSUM_ADLER32_KERNEL_SCALAR;
+	     kernel <= maximum_kernel;
+	     kernel++ )
+	{
+		start_clock = clock();
+
+		for( data_offset = 0;
+		     data_offset < EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE;
+		     data_offset += EWF_TEST_CHECKSUM_BENCHMARK_CHUNK_SIZE )
+		{
+			checksum ^= libewf_checksum_calculate_adler32_with_kernel(
+			             kernel,
+			             &( data[ data_offset ] ),
+			             EWF_TEST_CHECKSUM_BENCHMARK_CHUNK_SIZE,
+			             1 );
+		}
+		ewf_test_checksum_benchmark_print_throughput(
+		 kernel_names[ kernel ],
+		 EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE,
+		 clock() - start_clock );
+
+		if( kernel == LIBEWF_CHECKSUM_ADLER32_KERNEL_SCALAR )
+		{
+			expected_checksum = checksum;
+		}
+		EWF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 expected_checksum );
+
+		checksum = 0;
+	}
+	start_clock = clock();
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE;
+	     data_offset += EWF_TEST_CHECKSUM_BENCHMARK_CHUNK_SIZE )
+	{
+		result = libewf_checksum_calculate_adler32(
+		          &checksum,
+		          &( data[ data_offset ] ),
+		          EWF_TEST_CHECKSUM_BENCHMARK_CHUNK_SIZE,
+		          1,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ewf_test_checksum_benchmark_print_throughput(
+	 "libewf_checksum_calculate_adler32",
+	 EWF_TEST_CHECKSUM_BENCHMARK_DATA_SIZE,
+	 clock() - start_clock );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	EWF_TEST_UNREFERENCED_PARAMETER( argc )
-	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+	system_integer_t option = 0;
+	int run_benchmark       = 0;
 
+	while( ( option = ewf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'b':
+				run_benchmark = 1;
+
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT ) && defined( EWF_TEST_DEFLATE )
 	libcnotify_verbose_set(
 	 1 );
@@ -657,6 +965,23 @@ int main(
 	 "libewf_checksum_calculate_adler32",
 	 ewf_test_checksum_calculate_adler32 );
 
+	EWF_TEST_RUN(
+	 "libewf_checksum_get_adler32_kernel",
+	 ewf_test_checksum_get_adler32_kernel );
+
+	EWF_TEST_RUN(
+	 "libewf_checksum_calculate_adler32_with_kernel",
+	 ewf_test_checksum_calculate_adler32_with_kernel );
+
+	if( run_benchmark != 0 )
+	{
+		EWF_TEST_RUN(
+		 "libewf_checksum_calculate_adler32 benchmark",
+		 ewf_test_checksum_benchmark );
+	}
+#else
+	EWF_TEST_UNREFERENCED_PARAMETER( run_benchmark )
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
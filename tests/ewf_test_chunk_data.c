@@ -23,13 +23,17 @@
 #include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include <time.h>
+
 #include "ewf_test_functions.h"
+#include "ewf_test_getopt.h"
 #include "ewf_test_libbfio.h"
 #include "ewf_test_libcerror.h"
 #include "ewf_test_libbfio.h"
@@ -39,9 +43,18 @@
 #include "ewf_test_unused.h"
 
 #include "../libewf/libewf_chunk_data.h"
+#include "../libewf/libewf_chunk_data_pool.h"
 #include "../libewf/libewf_definitions.h"
 #include "../libewf/libewf_io_handle.h"
 
+/* The size of the benchmark data
+ */
+#define EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the data that is classified at once, which is the default chunk size
+ */
+#define EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE	( 32 * 1024 )
+
 uint8_t ewf_test_chunk_data_deflate_compressed_data1[ 52 ] = {
 	0x78, 0x9c, 0xed, 0xc1, 0x01, 0x01, 0x00, 0x00, 0x00, 0x80, 0x90, 0xfe, 0xaf, 0xee, 0x08, 0x0a,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -339,6 +352,224 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_chunk_data_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_clone(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libewf_chunk_data_t *destination_chunk_data = NULL;
+	libewf_chunk_data_t *source_chunk_data      = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_data_initialize(
+	          &source_chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "source_chunk_data",
+	 source_chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_chunk_data->data_size = 512;
+
+	/* Test regular cases
+	 */
+	result = libewf_chunk_data_clone(
+	          &destination_chunk_data,
+	          source_chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_chunk_data",
+	 destination_chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_chunk_data->data_size",
+	 destination_chunk_data->data_size,
+	 source_chunk_data->data_size );
+
+	result = libewf_chunk_data_free(
+	          &destination_chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_chunk_data",
+	 destination_chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_data_clone(
+	          &destination_chunk_data,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_chunk_data",
+	 destination_chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_data_clone(
+	          NULL,
+	          source_chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_chunk_data = (libewf_chunk_data_t *) 0x12345678UL;
+
+	result = libewf_chunk_data_clone(
+	          &destination_chunk_data,
+	          source_chunk_data,
+	          &error );
+
+	destination_chunk_data = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_chunk_data_clone with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_chunk_data_clone(
+	          &destination_chunk_data,
+	          source_chunk_data,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		if( destination_chunk_data != NULL )
+		{
+			libewf_chunk_data_free(
+			 &destination_chunk_data,
+			 NULL );
+		}
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "destination_chunk_data",
+		 destination_chunk_data );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &source_chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "source_chunk_data",
+	 source_chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &destination_chunk_data,
+		 NULL );
+	}
+	if( source_chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &source_chunk_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_chunk_data_read_buffer function
  * Returns 1 if successful or 0 if not
  */
@@ -559,18 +790,17 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libewf_chunk_data_write_buffer function
+/* Tests the libewf_chunk_data_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_chunk_data_write_buffer(
+int ewf_test_chunk_data_read_buffer_at_offset(
      void )
 {
 	uint8_t buffer[ 512 ];
 
 	libcerror_error_t *error        = NULL;
 	libewf_chunk_data_t *chunk_data = NULL;
-	uint8_t *data                   = NULL;
-	ssize_t write_count             = 0;
+	ssize_t read_count              = 0;
 	int result                      = 0;
 
 	/* Initialize test
@@ -598,32 +828,66 @@ int ewf_test_chunk_data_write_buffer(
 
 	/* Test regular cases
 	 */
-	write_count = libewf_chunk_data_write_buffer(
-	               chunk_data,
-	               buffer,
-	               512,
-	               &error );
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              0,
+	              buffer,
+	              512,
+	              &error );
 
 	EWF_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) 512 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              448,
+	              buffer,
+	              512,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              512,
+	              buffer,
+	              512,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	write_count = libewf_chunk_data_write_buffer(
-	               NULL,
-	               buffer,
-	               512,
-	               &error );
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              NULL,
+	              0,
+	              buffer,
+	              512,
+	              &error );
 
 	EWF_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
@@ -633,21 +897,16 @@ int ewf_test_chunk_data_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	data = chunk_data->data;
-
-	chunk_data->data = NULL;
-
-	write_count = libewf_chunk_data_write_buffer(
-	               chunk_data,
-	               buffer,
-	               512,
-	               &error );
-
-	chunk_data->data = data;
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              -1,
+	              buffer,
+	              512,
+	              &error );
 
 	EWF_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
@@ -657,9 +916,181 @@ int ewf_test_chunk_data_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libewf_chunk_data_write_buffer(
-	               chunk_data,
-	               NULL,
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              0,
+	              NULL,
+	              512,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_chunk_data_read_buffer_at_offset(
+	              chunk_data,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_data_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_write_buffer(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error        = NULL;
+	libewf_chunk_data_t *chunk_data = NULL;
+	uint8_t *data                   = NULL;
+	ssize_t write_count             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_data_initialize(
+	          &chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_data->data_size = 512;
+
+	/* Test regular cases
+	 */
+	write_count = libewf_chunk_data_write_buffer(
+	               chunk_data,
+	               buffer,
+	               512,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 512 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libewf_chunk_data_write_buffer(
+	               NULL,
+	               buffer,
+	               512,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data = chunk_data->data;
+
+	chunk_data->data = NULL;
+
+	write_count = libewf_chunk_data_write_buffer(
+	               chunk_data,
+	               buffer,
+	               512,
+	               &error );
+
+	chunk_data->data = data;
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libewf_chunk_data_write_buffer(
+	               chunk_data,
+	               NULL,
 	               512,
 	               &error );
 
@@ -1980,6 +2411,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2049,6 +2481,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	chunk_data->chunk_size = 512;
@@ -2109,6 +2542,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          NULL,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2128,6 +2562,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	chunk_data->compressed_data = NULL;
@@ -2149,6 +2584,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	chunk_data->chunk_size = 512;
@@ -2170,6 +2606,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	chunk_data->chunk_size = 512;
@@ -2189,6 +2626,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          NULL,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2212,6 +2650,7 @@ int ewf_test_chunk_data_pack_with_compression(
 	result = libewf_chunk_data_pack_with_compression(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          &error );
 
 	if( ewf_test_malloc_attempts_before_fail != -1 )
@@ -2367,6 +2806,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2400,6 +2840,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          LIBEWF_PACK_FLAG_CALCULATE_CHECKSUM,
@@ -2475,6 +2916,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2552,6 +2994,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2638,6 +3081,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2715,6 +3159,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING,
@@ -2790,6 +3235,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          NULL,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2814,6 +3260,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2836,6 +3283,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          NULL,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2860,6 +3308,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          0,
@@ -2892,6 +3341,7 @@ int ewf_test_chunk_data_pack(
 	result = libewf_chunk_data_pack(
 	          chunk_data,
 	          io_handle,
+	          NULL,
 	          compressed_zero_byte_empty_block,
 	          32,
 	          LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING,
@@ -3483,18 +3933,618 @@ int ewf_test_chunk_data_unpack(
 	 "memcpy_result",
 	 memcpy_result );
 
-	chunk_data->data_size   = 52;
-	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
+	chunk_data->data_size   = 52;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
+
+	chunk_data->compressed_data = (uint8_t *) 0x12345678UL;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	chunk_data->compressed_data = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libewf_chunk_data_unpack with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	chunk_data->data_size   = 52;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libewf_chunk_data_unpack with memset failing
+	 */
+	ewf_test_memset_attempts_before_fail = 0;
+
+	chunk_data->data_size   = 52;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	if( ewf_test_memset_attempts_before_fail != -1 )
+	{
+		ewf_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_data_unpack function with chunk data of a chunk data pool
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_unpack_with_pool(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libewf_chunk_data_t *chunk_data           = NULL;
+	libewf_chunk_data_t *pooled_chunk_data    = NULL;
+	libewf_chunk_data_pool_t *chunk_data_pool = NULL;
+	libewf_io_handle_t *io_handle             = NULL;
+	uint8_t *compressed_data                  = NULL;
+	void *memcpy_result                       = NULL;
+	int iterator                              = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->compression_method = LIBEWF_COMPRESSION_METHOD_DEFLATE;
+
+	result = libewf_chunk_data_pool_initialize(
+	          &chunk_data_pool,
+	          1,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data_pool",
+	 chunk_data_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		result = libewf_chunk_data_pool_get_chunk_data(
+		          chunk_data_pool,
+		          32768,
+		          &chunk_data,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "chunk_data",
+		 chunk_data );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( iterator > 0 )
+		{
+			/* The chunk data and its buffers are reused
+			 */
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "chunk_data == pooled_chunk_data",
+			 (int) ( chunk_data == pooled_chunk_data ),
+			 1 );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "chunk_data->spare_data == compressed_data",
+			 (int) ( chunk_data->spare_data == compressed_data ),
+			 1 );
+		}
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "chunk_data->data_size",
+		 chunk_data->data_size,
+		 (size_t) 0 );
+
+		memcpy_result = memory_copy(
+		                 chunk_data->data,
+		                 ewf_test_chunk_data_deflate_compressed_data1,
+		                 52 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "memcpy_result",
+		 memcpy_result );
+
+		chunk_data->data_size   = 52;
+		chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
+
+		result = libewf_chunk_data_unpack(
+		          chunk_data,
+		          io_handle,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_UINT32(
+		 "chunk_data->range_flags",
+		 chunk_data->range_flags,
+		 (uint32_t) LIBEWF_RANGE_FLAG_IS_COMPRESSED );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "chunk_data->data_size",
+		 chunk_data->data_size,
+		 (size_t) 32768 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "chunk_data->spare_data",
+		 chunk_data->spare_data );
+
+		pooled_chunk_data = chunk_data;
+		compressed_data   = chunk_data->compressed_data;
+
+		/* The chunk data is returned to the pool
+		 */
+		result = libewf_chunk_data_free(
+		          &chunk_data,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "chunk_data",
+		 chunk_data );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "chunk_data_pool->number_of_chunk_data_values",
+		 chunk_data_pool->number_of_chunk_data_values,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "chunk_data_pool->number_of_compression_contexts",
+		 chunk_data_pool->number_of_compression_contexts,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libewf_chunk_data_pool_free(
+	          &chunk_data_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data_pool",
+	 chunk_data_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( chunk_data_pool != NULL )
+	{
+		libewf_chunk_data_pool_free(
+		 &chunk_data_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_data_classify function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_classify(
+     void )
+{
+	uint8_t buffer[ 520 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	size_t buffer_index      = 0;
+	uint8_t data_class       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 520 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libewf_chunk_data_classify(
+	          buffer,
+	          512,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_ZERO );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unaligned data
+	 */
+	result = libewf_chunk_data_classify(
+	          &( buffer[ 1 ] ),
+	          512 - 1,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_ZERO );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a difference at every offset to make sure every block is compared
+	 */
+	for( buffer_index = 1;
+	     buffer_index < 520;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = 0xff;
+
+		result = libewf_chunk_data_classify(
+		          buffer,
+		          520,
+		          &data_class,
+		          &error );
+
+		buffer[ buffer_index ] = 0;
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT8(
+		 "data_class",
+		 data_class,
+		 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_GENERAL );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	memset_result = memory_set(
+	                 buffer,
+	                 'X',
+	                 520 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libewf_chunk_data_classify(
+	          buffer,
+	          520,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_SINGLE_BYTE_FILL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 520;
+	     buffer_index += 8 )
+	{
+		buffer[ buffer_index + 5 ] = (uint8_t) 'A';
+	}
+	result = libewf_chunk_data_classify(
+	          &( buffer[ 0 ] ),
+	          520,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_64_BIT_PATTERN );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unaligned data with a size that is not a multiple of 8
+	 */
+	result = libewf_chunk_data_classify(
+	          &( buffer[ 3 ] ),
+	          517,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_64_BIT_PATTERN );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer[ 516 ] = (uint8_t) 'A';
+
+	result = libewf_chunk_data_classify(
+	          &( buffer[ 3 ] ),
+	          517,
+	          &data_class,
+	          &error );
+
+	buffer[ 516 ] = (uint8_t) 'X';
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_GENERAL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_data_classify(
+	          buffer,
+	          0,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "data_class",
+	 data_class,
+	 (uint8_t) LIBEWF_CHUNK_DATA_CLASS_GENERAL );
 
-	chunk_data->compressed_data = (uint8_t *) 0x12345678UL;
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libewf_chunk_data_unpack(
-	          chunk_data,
-	          io_handle,
+	/* Test error cases
+	 */
+	result = libewf_chunk_data_classify(
+	          NULL,
+	          512,
+	          &data_class,
 	          &error );
 
-	chunk_data->compressed_data = NULL;
-
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -3507,106 +4557,42 @@ int ewf_test_chunk_data_unpack(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_EWF_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
-
-	/* Test libewf_chunk_data_unpack with malloc failing
-	 */
-	ewf_test_malloc_attempts_before_fail = 0;
-
-	chunk_data->data_size   = 52;
-	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
-
-	result = libewf_chunk_data_unpack(
-	          chunk_data,
-	          io_handle,
-	          &error );
-
-	if( ewf_test_malloc_attempts_before_fail != -1 )
-	{
-		ewf_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		EWF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EWF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libewf_chunk_data_unpack with memset failing
-	 */
-	ewf_test_memset_attempts_before_fail = 0;
-
-	chunk_data->data_size   = 52;
-	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_COMPRESSED;
-
-	result = libewf_chunk_data_unpack(
-	          chunk_data,
-	          io_handle,
-	          &error );
-
-	if( ewf_test_memset_attempts_before_fail != -1 )
-	{
-		ewf_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		EWF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EWF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_EWF_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
-
-	/* Clean up
-	 */
-	result = libewf_chunk_data_free(
-	          &chunk_data,
+	result = libewf_chunk_data_classify(
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_class,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_IS_NULL(
-	 "chunk_data",
-	 chunk_data );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libewf_io_handle_free(
-	          &io_handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_data_classify(
+	          buffer,
+	          512,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -3615,18 +4601,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( chunk_data != NULL )
-	{
-		libewf_chunk_data_free(
-		 &chunk_data,
-		 NULL );
-	}
-	if( io_handle != NULL )
-	{
-		libewf_io_handle_free(
-		 &io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -5199,23 +6173,261 @@ on_error:
 	return( 0 );
 }
 
+/* Prints the throughput
+ */
+void ewf_test_chunk_data_benchmark_print_throughput(
+      const char *name,
+      size_t data_size,
+      clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%s: %.1f MB/s\n",
+	 name,
+	 ( (double) data_size / ( 1024.0 * 1024.0 ) ) / number_of_seconds );
+}
+
+/* Classifies the benchmark data per chunk
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_benchmark_classify(
+     const char *name,
+     const uint8_t *data,
+     uint8_t expected_data_class )
+{
+	libcerror_error_t *error = NULL;
+	clock_t start_clock      = 0;
+	size_t data_offset       = 0;
+	uint8_t data_class       = 0;
+	int result               = 0;
+
+	/* Read the data once so that every measurement starts with the same cache state
+	 */
+	result = libewf_chunk_data_classify(
+	          data,
+	          EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE,
+	          &data_class,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	start_clock = clock();
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE;
+	     data_offset += EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE )
+	{
+		result = libewf_chunk_data_classify(
+		          &( data[ data_offset ] ),
+		          EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE,
+		          &data_class,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT8(
+		 "data_class",
+		 data_class,
+		 expected_data_class );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ewf_test_chunk_data_benchmark_print_throughput(
+	 name,
+	 EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE,
+	 clock() - start_clock );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Runs the chunk data classification benchmark
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_benchmark(
+     void )
+{
+	uint8_t *data       = NULL;
+	clock_t start_clock = 0;
+	size_t data_offset  = 0;
+	uint32_t seed       = 0x12345678UL;
+	int number_of_empty = 0;
+	int result          = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Empty-block data, which is the most common case when acquiring mostly unused media
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	result = ewf_test_chunk_data_benchmark_classify(
+	          "libewf_chunk_data_classify zero",
+	          data,
+	          LIBEWF_CHUNK_DATA_CLASS_ZERO );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The overlapping memory compare that was used to detect empty-blocks, for reference
+	 */
+	start_clock = clock();
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE;
+	     data_offset += EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE )
+	{
+		if( memory_compare(
+		     &( data[ data_offset ] ),
+		     &( data[ data_offset + 1 ] ),
+		     EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE - 1 ) == 0 )
+		{
+			number_of_empty++;
+		}
+	}
+	ewf_test_chunk_data_benchmark_print_throughput(
+	 "memory_compare zero",
+	 EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE,
+	 clock() - start_clock );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_empty",
+	 number_of_empty,
+	 EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE / EWF_TEST_CHUNK_DATA_BENCHMARK_CHUNK_SIZE );
+
+	/* 64-bit pattern fill data
+	 */
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE;
+	     data_offset += 8 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 0x0123456789abcdefUL );
+	}
+	result = ewf_test_chunk_data_benchmark_classify(
+	          "libewf_chunk_data_classify 64-bit pattern",
+	          data,
+	          LIBEWF_CHUNK_DATA_CLASS_64_BIT_PATTERN );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* General data, which is expected to be classified after the first bytes
+	 */
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_CHUNK_DATA_BENCHMARK_DATA_SIZE;
+	     data_offset++ )
+	{
+		/* Use a linear congruential generator to have reproducible data
+		 */
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( seed >> 16 );
+	}
+	result = ewf_test_chunk_data_benchmark_classify(
+	          "libewf_chunk_data_classify general",
+	          data,
+	          LIBEWF_CHUNK_DATA_CLASS_GENERAL );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	EWF_TEST_UNREFERENCED_PARAMETER( argc )
-	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+	system_integer_t option = 0;
+	int run_benchmark       = 0;
+
+	while( ( option = ewf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'b':
+				run_benchmark = 1;
 
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
 	EWF_TEST_RUN(
@@ -5226,10 +6438,18 @@ int main(
 	 "libewf_chunk_data_free",
 	 ewf_test_chunk_data_free );
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_clone",
+	 ewf_test_chunk_data_clone );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_read_buffer",
 	 ewf_test_chunk_data_read_buffer );
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_read_buffer_at_offset",
+	 ewf_test_chunk_data_read_buffer_at_offset );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_write_buffer",
 	 ewf_test_chunk_data_write_buffer );
@@ -5266,6 +6486,14 @@ int main(
 	 "libewf_chunk_data_unpack",
 	 ewf_test_chunk_data_unpack );
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_unpack with pool",
+	 ewf_test_chunk_data_unpack_with_pool );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_classify",
+	 ewf_test_chunk_data_classify );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_check_for_empty_block",
 	 ewf_test_chunk_data_check_for_empty_block );
@@ -5294,6 +6522,15 @@ int main(
 	 "libewf_chunk_data_read_element_data",
 	 ewf_test_chunk_data_read_element_data );
 
+	if( run_benchmark != 0 )
+	{
+		EWF_TEST_RUN(
+		 "libewf_chunk_data_classify benchmark",
+		 ewf_test_chunk_data_benchmark );
+	}
+#else
+	EWF_TEST_UNREFERENCED_PARAMETER( run_benchmark )
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
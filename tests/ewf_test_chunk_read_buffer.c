@@ -0,0 +1,836 @@
+/*
+ * Library chunk_read_buffer type test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_functions.h"
+#include "ewf_test_libbfio.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_libfdata.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_chunk_read_buffer.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_chunk_read_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_read_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libewf_chunk_read_buffer_t *chunk_read_buffer = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_chunk_read_buffer_initialize(
+	          &chunk_read_buffer,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_read_buffer_free(
+	          &chunk_read_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_read_buffer_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_read_buffer = (libewf_chunk_read_buffer_t *) 0x12345678UL;
+
+	result = libewf_chunk_read_buffer_initialize(
+	          &chunk_read_buffer,
+	          1024 * 1024,
+	          &error );
+
+	chunk_read_buffer = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_read_buffer_initialize(
+	          &chunk_read_buffer,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_chunk_read_buffer_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_chunk_read_buffer_initialize(
+		          &chunk_read_buffer,
+		          1024 * 1024,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( chunk_read_buffer != NULL )
+			{
+				libewf_chunk_read_buffer_free(
+				 &chunk_read_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "chunk_read_buffer",
+			 chunk_read_buffer );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_chunk_read_buffer_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_chunk_read_buffer_initialize(
+		          &chunk_read_buffer,
+		          1024 * 1024,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( chunk_read_buffer != NULL )
+			{
+				libewf_chunk_read_buffer_free(
+				 &chunk_read_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "chunk_read_buffer",
+			 chunk_read_buffer );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_read_buffer != NULL )
+	{
+		libewf_chunk_read_buffer_free(
+		 &chunk_read_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_read_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_read_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_read_buffer_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_read_buffer_set_maximum_read_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_read_buffer_set_maximum_read_size(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libewf_chunk_read_buffer_t *chunk_read_buffer = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_read_buffer_initialize(
+	          &chunk_read_buffer,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_chunk_read_buffer_set_maximum_read_size(
+	          chunk_read_buffer,
+	          64 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_read_buffer->maximum_read_size",
+	 chunk_read_buffer->maximum_read_size,
+	 (size_t) 64 * 1024 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_read_buffer->data_size",
+	 chunk_read_buffer->data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_read_buffer_set_maximum_read_size(
+	          NULL,
+	          64 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_read_buffer_set_maximum_read_size(
+	          chunk_read_buffer,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_read_buffer_free(
+	          &chunk_read_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_read_buffer != NULL )
+	{
+		libewf_chunk_read_buffer_free(
+		 &chunk_read_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_read_buffer_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_read_buffer_read_data(
+     void )
+{
+	uint8_t chunk_data[ 128 ];
+	uint8_t file_data[ 512 ];
+
+	libbfio_pool_t *file_io_pool                  = NULL;
+	libcerror_error_t *error                      = NULL;
+	libewf_chunk_read_buffer_t *chunk_read_buffer = NULL;
+	libfdata_list_t *chunks_list                  = NULL;
+	size_t data_offset                            = 0;
+	int element_index                             = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = ewf_test_open_file_io_pool(
+	          &file_io_pool,
+	          file_data,
+	          512,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_initialize(
+	          &chunks_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunks_list",
+	 chunks_list );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset += 128 )
+	{
+		result = libfdata_list_append_element(
+		          chunks_list,
+		          &element_index,
+		          0,
+		          (off64_t) data_offset,
+		          128,
+		          0,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libewf_chunk_read_buffer_initialize(
+	          &chunk_read_buffer,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	chunk_read_buffer->chunks_list       = chunks_list;
+	chunk_read_buffer->chunks_list_index = 0;
+
+	/* The first chunk is read directly since it does not follow a previous read
+	 */
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          0,
+	          chunk_data,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second chunk is read together with the chunks that follow it
+	 */
+	chunk_read_buffer->chunks_list_index = 1;
+
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          128,
+	          chunk_data,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_read_buffer->data_size",
+	 chunk_read_buffer->data_size,
+	 (size_t) 384 );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 128 ] ),
+	          128 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The third chunk is copied from the buffered data
+	 */
+	chunk_read_buffer->chunks_list       = NULL;
+	chunk_read_buffer->chunks_list_index = 2;
+
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          256,
+	          chunk_data,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          chunk_data,
+	          &( file_data[ 256 ] ),
+	          128 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_read_buffer_read_data(
+	          NULL,
+	          file_io_pool,
+	          0,
+	          256,
+	          chunk_data,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          -1,
+	          chunk_data,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          256,
+	          NULL,
+	          128,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_read_buffer_read_data(
+	          chunk_read_buffer,
+	          file_io_pool,
+	          0,
+	          256,
+	          chunk_data,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_read_buffer_free(
+	          &chunk_read_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_read_buffer",
+	 chunk_read_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_free(
+	          &chunks_list,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_close_file_io_pool(
+	          &file_io_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_read_buffer != NULL )
+	{
+		libewf_chunk_read_buffer_free(
+		 &chunk_read_buffer,
+		 NULL );
+	}
+	if( chunks_list != NULL )
+	{
+		libfdata_list_free(
+		 &chunks_list,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		ewf_test_close_file_io_pool(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_read_buffer_initialize",
+	 ewf_test_chunk_read_buffer_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_read_buffer_free",
+	 ewf_test_chunk_read_buffer_free );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_read_buffer_set_maximum_read_size",
+	 ewf_test_chunk_read_buffer_set_maximum_read_size );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_read_buffer_read_data",
+	 ewf_test_chunk_read_buffer_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
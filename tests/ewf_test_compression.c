@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,7 @@
 #include "ewf_test_unused.h"
 
 #include "../libewf/libewf_compression.h"
+#include "../libewf/libewf_definitions.h"
 
 uint8_t ewf_test_compression_deflate_compressed_data1[ 2627 ] = {
 	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9,
@@ -1253,6 +1255,309 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_compression_get_backend function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_get_backend(
+     void )
+{
+	const libewf_compression_backend_t *backend = NULL;
+	libcerror_error_t *error                    = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_compression_get_backend(
+	          LIBEWF_COMPRESSION_METHOD_DEFLATE,
+	          &backend,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "backend",
+	 backend );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "backend->compression_method",
+	 backend->compression_method,
+	 (uint16_t) LIBEWF_COMPRESSION_METHOD_DEFLATE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "backend->decompress",
+	 backend->decompress );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_compression_get_backend(
+	          LIBEWF_COMPRESSION_METHOD_NONE,
+	          &backend,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "backend",
+	 backend );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_compression_get_backend(
+	          0xffff,
+	          &backend,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_compression_get_backend(
+	          LIBEWF_COMPRESSION_METHOD_DEFLATE,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WRITE_SUPPORT )
+
+/* Tests compressing and decompressing data with a specific compression method
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_round_trip(
+     uint16_t compression_method )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	int8_t compression_levels[ 3 ] = {
+		LIBEWF_COMPRESSION_LEVEL_DEFAULT, LIBEWF_COMPRESSION_LEVEL_FAST, LIBEWF_COMPRESSION_LEVEL_BEST };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int level_index               = 0;
+	int result                    = 0;
+
+	for( level_index = 0;
+	     level_index < 3;
+	     level_index++ )
+	{
+		compressed_data_size = 8192;
+
+		result = libewf_compress_data(
+		          compressed_data,
+		          &compressed_data_size,
+		          compression_method,
+		          compression_levels[ level_index ],
+		          ewf_test_compression_uncompressed_data1,
+		          7640,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = 8192;
+
+		result = libewf_decompress_data(
+		          compressed_data,
+		          compressed_data_size,
+		          compression_method,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          ewf_test_compression_uncompressed_data1,
+		          7640 );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test compressing with a compressed data buffer that is too small
+	 */
+	compressed_data_size = 16;
+
+	result = libewf_compress_data(
+	          compressed_data,
+	          &compressed_data_size,
+	          compression_method,
+	          LIBEWF_COMPRESSION_LEVEL_DEFAULT,
+	          ewf_test_compression_uncompressed_data1,
+	          7640,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decompressing with an uncompressed data buffer that is too small
+	 */
+	compressed_data_size = 8192;
+
+	result = libewf_compress_data(
+	          compressed_data,
+	          &compressed_data_size,
+	          compression_method,
+	          LIBEWF_COMPRESSION_LEVEL_DEFAULT,
+	          ewf_test_compression_uncompressed_data1,
+	          7640,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	uncompressed_data_size = 1024;
+
+	result = libewf_decompress_data(
+	          compressed_data,
+	          compressed_data_size,
+	          compression_method,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decompressing corrupted data
+	 */
+	compressed_data[ compressed_data_size / 2 ] ^= 0xff;
+
+	uncompressed_data_size = 8192;
+
+	result = libewf_decompress_data(
+	          compressed_data,
+	          compressed_data_size,
+	          compression_method,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_ZSTD )
+
+/* Tests compressing and decompressing data using zstd
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_zstd(
+     void )
+{
+	return( ewf_test_compression_round_trip(
+	         LIBEWF_COMPRESSION_METHOD_ZSTD ) );
+}
+
+#endif /* defined( HAVE_ZSTD ) */
+
+#if defined( HAVE_LZ4 )
+
+/* Tests compressing and decompressing data using LZ4
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_lz4(
+     void )
+{
+	return( ewf_test_compression_round_trip(
+	         LIBEWF_COMPRESSION_METHOD_LZ4 ) );
+}
+
+#endif /* defined( HAVE_LZ4 ) */
+
+#endif /* defined( HAVE_WRITE_SUPPORT ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
@@ -1272,6 +1577,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
+	EWF_TEST_RUN(
+	 "libewf_compression_get_backend",
+	 ewf_test_compression_get_backend );
+
 #if defined( HAVE_WRITE_SUPPORT )
 
 	EWF_TEST_RUN(
@@ -1284,6 +1593,23 @@ int main(
 	 "libewf_decompress_data",
 	 ewf_test_decompress_data );
 
+#if defined( HAVE_WRITE_SUPPORT )
+#if defined( HAVE_ZSTD )
+
+	EWF_TEST_RUN(
+	 "libewf_compress_data_zstd",
+	 ewf_test_compression_zstd );
+
+#endif /* defined( HAVE_ZSTD ) */
+#if defined( HAVE_LZ4 )
+
+	EWF_TEST_RUN(
+	 "libewf_compress_data_lz4",
+	 ewf_test_compression_lz4 );
+
+#endif /* defined( HAVE_LZ4 ) */
+#endif /* defined( HAVE_WRITE_SUPPORT ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
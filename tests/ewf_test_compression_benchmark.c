@@ -0,0 +1,764 @@
+/*
+ * Library compression methods benchmark program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#if !defined( WINAPI )
+#include <sys/resource.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_compression.h"
+#include "../libewf/libewf_compression_context.h"
+#include "../libewf/libewf_definitions.h"
+
+/* The size of the uncompressed benchmark data, which is the size of 2048 chunks of 64 sectors
+ */
+#define EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE	( 32 * 1024 * 1024 )
+
+/* The size of the data that is compressed and decompressed at once, which is the default chunk size
+ */
+#define EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE	( 32 * 1024 )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_WRITE_SUPPORT )
+
+/* Fills the buffer with compressible text-like data
+ */
+void ewf_test_compression_benchmark_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *words[ 8 ] = {
+		"acquired ", "chunk ", "evidence ", "file ", "media ", "sector ", "segment ", "\n" };
+
+	const char *word    = NULL;
+	size_t data_offset  = 0;
+	size_t word_length  = 0;
+	uint32_t seed       = 0x12345678UL;
+
+	while( data_offset < data_size )
+	{
+		/* Use a linear congruential generator to have reproducible data
+		 */
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		word        = words[ ( seed >> 16 ) & 0x07 ];
+		word_length = narrow_string_length(
+		               word );
+
+		if( word_length > ( data_size - data_offset ) )
+		{
+			word_length = data_size - data_offset;
+		}
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 word,
+		 word_length );
+
+		data_offset += word_length;
+	}
+}
+
+/* Determines the throughput in MiB/s
+ */
+double ewf_test_compression_benchmark_get_throughput(
+        size_t data_size,
+        clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	return( ( (double) data_size / ( 1024.0 * 1024.0 ) ) / number_of_seconds );
+}
+
+/* Retrieves the number of page faults of the process
+ * Returns the number of page faults or 0 if not available
+ */
+uint64_t ewf_test_compression_benchmark_get_number_of_page_faults(
+          void )
+{
+#if !defined( WINAPI )
+	struct rusage resource_usage;
+
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) == 0 )
+	{
+		return( (uint64_t) resource_usage.ru_minflt + (uint64_t) resource_usage.ru_majflt );
+	}
+#endif
+	return( 0 );
+}
+
+/* Retrieves the number of malloc calls of the process
+ * Returns the number of malloc calls or 0 if not available
+ */
+uint64_t ewf_test_compression_benchmark_get_number_of_malloc_calls(
+          void )
+{
+#if defined( HAVE_EWF_TEST_MEMORY )
+	return( (uint64_t) ewf_test_number_of_malloc_calls );
+#else
+	return( 0 );
+#endif
+}
+
+/* Determines the number of events per second
+ */
+double ewf_test_compression_benchmark_get_rate(
+        uint64_t number_of_events,
+        clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	return( (double) number_of_events / number_of_seconds );
+}
+
+/* Runs the benchmark of a specific compression method and level
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_benchmark_method(
+     const char *method_name,
+     uint16_t compression_method,
+     const char *level_name,
+     int8_t compression_level,
+     uint8_t *verification_data,
+     uint8_t *uncompressed_data,
+     uint8_t *compressed_data,
+     size_t *compressed_chunk_sizes,
+     size_t maximum_chunk_size )
+{
+	libcerror_error_t *error       = NULL;
+	clock_t compress_clocks        = 0;
+	clock_t decompress_clocks      = 0;
+	clock_t start_clock            = 0;
+	size_t chunk_offset            = 0;
+	size_t compressed_data_offset  = 0;
+	size_t compressed_data_size    = 0;
+	size_t uncompressed_chunk_size = 0;
+	int chunk_index                = 0;
+	int number_of_chunks           = 0;
+	int result                     = 0;
+
+	number_of_chunks = EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE / EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+
+	/* Compress the data per chunk as an EWF writer would
+	 */
+	start_clock = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset           = (size_t) chunk_index * EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset = (size_t) chunk_index * maximum_chunk_size;
+
+		compressed_chunk_sizes[ chunk_index ] = maximum_chunk_size;
+
+		result = libewf_compress_data(
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &( compressed_chunk_sizes[ chunk_index ] ),
+		          compression_method,
+		          compression_level,
+		          &( verification_data[ chunk_offset ] ),
+		          EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_size += compressed_chunk_sizes[ chunk_index ];
+	}
+	compress_clocks = clock() - start_clock;
+
+	/* Decompress the data per chunk as an EWF reader would
+	 */
+	start_clock = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset            = (size_t) chunk_index * EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset  = (size_t) chunk_index * maximum_chunk_size;
+		uncompressed_chunk_size = EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+
+		result = libewf_decompress_data(
+		          &( compressed_data[ compressed_data_offset ] ),
+		          compressed_chunk_sizes[ chunk_index ],
+		          compression_method,
+		          &( uncompressed_data[ chunk_offset ] ),
+		          &uncompressed_chunk_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_chunk_size",
+		 uncompressed_chunk_size,
+		 (size_t) EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE );
+	}
+	decompress_clocks = clock() - start_clock;
+
+	result = memory_compare(
+	          uncompressed_data,
+	          verification_data,
+	          EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	fprintf(
+	 stdout,
+	 "| %-8s | %-8s | %6.2f%% | %10.1f | %10.1f |\n",
+	 method_name,
+	 level_name,
+	 ( 100.0 * (double) compressed_data_size ) / (double) EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	 ewf_test_compression_benchmark_get_throughput(
+	  EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	  compress_clocks ),
+	 ewf_test_compression_benchmark_get_throughput(
+	  EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	  decompress_clocks ) );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Runs the benchmark of compressing per chunk with and without reusing a compression context
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_benchmark_context(
+     const char *method_name,
+     uint16_t compression_method,
+     const char *level_name,
+     int8_t compression_level,
+     uint8_t *verification_data,
+     uint8_t *compressed_data,
+     uint8_t *context_compressed_data,
+     size_t *compressed_chunk_sizes,
+     size_t maximum_chunk_size )
+{
+	libewf_compression_context_t *compression_context = NULL;
+	libcerror_error_t *error                          = NULL;
+	clock_t context_clocks                            = 0;
+	clock_t per_call_clocks                           = 0;
+	clock_t start_clock                               = 0;
+	uint64_t context_malloc_calls                     = 0;
+	uint64_t context_page_faults                      = 0;
+	uint64_t per_call_malloc_calls                    = 0;
+	uint64_t per_call_page_faults                     = 0;
+	size_t chunk_offset                               = 0;
+	size_t compressed_chunk_size                      = 0;
+	size_t compressed_data_offset                     = 0;
+	int chunk_index                                   = 0;
+	int number_of_chunks                              = 0;
+	int result                                        = 0;
+
+	number_of_chunks = EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE / EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+
+	/* Compress the data per chunk setting up the compression state per call
+	 */
+	per_call_malloc_calls = ewf_test_compression_benchmark_get_number_of_malloc_calls();
+	per_call_page_faults  = ewf_test_compression_benchmark_get_number_of_page_faults();
+	start_clock           = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset           = (size_t) chunk_index * EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset = (size_t) chunk_index * maximum_chunk_size;
+
+		compressed_chunk_sizes[ chunk_index ] = maximum_chunk_size;
+
+		result = libewf_compress_data(
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &( compressed_chunk_sizes[ chunk_index ] ),
+		          compression_method,
+		          compression_level,
+		          &( verification_data[ chunk_offset ] ),
+		          EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	per_call_clocks       = clock() - start_clock;
+	per_call_page_faults  = ewf_test_compression_benchmark_get_number_of_page_faults() - per_call_page_faults;
+	per_call_malloc_calls = ewf_test_compression_benchmark_get_number_of_malloc_calls() - per_call_malloc_calls;
+
+	/* Compress the data per chunk reusing the compression state of the context
+	 * the set up of the state on first use is included in the measurement
+	 */
+	result = libewf_compression_context_initialize(
+	          &compression_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compression_context",
+	 compression_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	context_malloc_calls = ewf_test_compression_benchmark_get_number_of_malloc_calls();
+	context_page_faults  = ewf_test_compression_benchmark_get_number_of_page_faults();
+	start_clock          = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset           = (size_t) chunk_index * EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset = (size_t) chunk_index * maximum_chunk_size;
+		compressed_chunk_size  = maximum_chunk_size;
+
+		result = libewf_compression_context_compress_data(
+		          compression_context,
+		          &( context_compressed_data[ compressed_data_offset ] ),
+		          &compressed_chunk_size,
+		          compression_method,
+		          compression_level,
+		          &( verification_data[ chunk_offset ] ),
+		          EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "compressed_chunk_size",
+		 compressed_chunk_size,
+		 compressed_chunk_sizes[ chunk_index ] );
+	}
+	context_clocks       = clock() - start_clock;
+	context_page_faults  = ewf_test_compression_benchmark_get_number_of_page_faults() - context_page_faults;
+	context_malloc_calls = ewf_test_compression_benchmark_get_number_of_malloc_calls() - context_malloc_calls;
+
+	result = libewf_compression_context_free(
+	          &compression_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reusing the compression state should not change the compressed data
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		compressed_data_offset = (size_t) chunk_index * maximum_chunk_size;
+
+		result = memory_compare(
+		          &( context_compressed_data[ compressed_data_offset ] ),
+		          &( compressed_data[ compressed_data_offset ] ),
+		          compressed_chunk_sizes[ chunk_index ] );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	fprintf(
+	 stdout,
+	 "| %-8s | %-8s | %10.1f | %10.1f | %14.0f | %14.0f | %11" PRIu64 " | %11" PRIu64 " |\n",
+	 method_name,
+	 level_name,
+	 ewf_test_compression_benchmark_get_throughput(
+	  EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	  per_call_clocks ),
+	 ewf_test_compression_benchmark_get_throughput(
+	  EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE,
+	  context_clocks ),
+	 ewf_test_compression_benchmark_get_rate(
+	  per_call_malloc_calls,
+	  per_call_clocks ),
+	 ewf_test_compression_benchmark_get_rate(
+	  context_malloc_calls,
+	  context_clocks ),
+	 per_call_page_faults,
+	 context_page_faults );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compression_context != NULL )
+	{
+		libewf_compression_context_free(
+		 &compression_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Runs the compression methods benchmark
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compression_benchmark(
+     void )
+{
+	const char *level_names[ 3 ] = {
+		"fast", "default", "best" };
+
+	int8_t compression_levels[ 3 ] = {
+		LIBEWF_COMPRESSION_LEVEL_FAST, LIBEWF_COMPRESSION_LEVEL_DEFAULT, LIBEWF_COMPRESSION_LEVEL_BEST };
+
+	uint16_t compression_methods[ 4 ] = {
+		LIBEWF_COMPRESSION_METHOD_DEFLATE, LIBEWF_COMPRESSION_METHOD_BZIP2, LIBEWF_COMPRESSION_METHOD_ZSTD, LIBEWF_COMPRESSION_METHOD_LZ4 };
+
+	const libewf_compression_backend_t *backend = NULL;
+	libcerror_error_t *error                    = NULL;
+	uint8_t *compressed_data                    = NULL;
+	uint8_t *context_compressed_data            = NULL;
+	uint8_t *uncompressed_data                  = NULL;
+	uint8_t *verification_data                  = NULL;
+	size_t *compressed_chunk_sizes              = NULL;
+	size_t maximum_chunk_size                   = 0;
+	int level_index                             = 0;
+	int method_index                            = 0;
+	int number_of_chunks                        = 0;
+	int result                                  = 0;
+
+	number_of_chunks = EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE / EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+
+	/* A factor 2 of the chunk size suffices for the bounds of all compression methods
+	 */
+	maximum_chunk_size = 2 * EWF_TEST_COMPRESSION_BENCHMARK_CHUNK_SIZE;
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	verification_data = (uint8_t *) memory_allocate(
+	                                 EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "verification_data",
+	 verification_data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               maximum_chunk_size * number_of_chunks );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	context_compressed_data = (uint8_t *) memory_allocate(
+	                                       maximum_chunk_size * number_of_chunks );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context_compressed_data",
+	 context_compressed_data );
+
+	compressed_chunk_sizes = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_chunks );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_sizes",
+	 compressed_chunk_sizes );
+
+	ewf_test_compression_benchmark_fill_data(
+	 verification_data,
+	 EWF_TEST_COMPRESSION_BENCHMARK_DATA_SIZE );
+
+	/* Touch the compressed data buffers so that their page faults are not measured
+	 * a non-zero value is used since clearing could be optimized into calloc
+	 */
+	memory_set(
+	 compressed_data,
+	 0xff,
+	 maximum_chunk_size * number_of_chunks );
+
+	memory_set(
+	 context_compressed_data,
+	 0xff,
+	 maximum_chunk_size * number_of_chunks );
+
+	fprintf(
+	 stdout,
+	 "| Method   | Level    | Ratio   | Comp MiB/s | Deco MiB/s |\n"
+	 "|----------|----------|---------|------------|------------|\n" );
+
+	for( method_index = 0;
+	     method_index < 4;
+	     method_index++ )
+	{
+		result = libewf_compression_get_backend(
+		          compression_methods[ method_index ],
+		          &backend,
+		          &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Skip the compression methods that are not supported by the build
+		 */
+		if( ( result == 0 )
+		 || ( backend->compress == NULL ) )
+		{
+			continue;
+		}
+		for( level_index = 0;
+		     level_index < 3;
+		     level_index++ )
+		{
+			result = ewf_test_compression_benchmark_method(
+			          backend->name,
+			          compression_methods[ method_index ],
+			          level_names[ level_index ],
+			          compression_levels[ level_index ],
+			          verification_data,
+			          uncompressed_data,
+			          compressed_data,
+			          compressed_chunk_sizes,
+			          maximum_chunk_size );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\n"
+	 "| Method   | Level    | Call MiB/s | Ctxt MiB/s | Call mallocs/s | Ctxt mallocs/s | Call faults | Ctxt faults |\n"
+	 "|----------|----------|------------|------------|----------------|----------------|-------------|-------------|\n" );
+
+	for( method_index = 0;
+	     method_index < 4;
+	     method_index++ )
+	{
+		result = libewf_compression_get_backend(
+		          compression_methods[ method_index ],
+		          &backend,
+		          &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result == 0 )
+		 || ( backend->compress == NULL ) )
+		{
+			continue;
+		}
+		for( level_index = 0;
+		     level_index < 3;
+		     level_index++ )
+		{
+			result = ewf_test_compression_benchmark_context(
+			          backend->name,
+			          compression_methods[ method_index ],
+			          level_names[ level_index ],
+			          compression_levels[ level_index ],
+			          verification_data,
+			          compressed_data,
+			          context_compressed_data,
+			          compressed_chunk_sizes,
+			          maximum_chunk_size );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 compressed_chunk_sizes );
+
+	memory_free(
+	 context_compressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	memory_free(
+	 verification_data );
+
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_sizes != NULL )
+	{
+		memory_free(
+		 compressed_chunk_sizes );
+	}
+	if( context_compressed_data != NULL )
+	{
+		memory_free(
+		 context_compressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( verification_data != NULL )
+	{
+		memory_free(
+		 verification_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_WRITE_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_WRITE_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_compress_data",
+	 ewf_test_compression_benchmark );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+
+#else
+	fprintf(
+	 stdout,
+	 "Benchmark requires write support.\n" );
+
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_WRITE_SUPPORT ) */
+}
+
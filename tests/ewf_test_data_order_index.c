@@ -0,0 +1,763 @@
+/*
+ * Library data_order_index type test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcdata.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_data_order_index.h"
+#include "../libewf/libewf_definitions.h"
+#include "../libewf/libewf_lef_file_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Appends a sub node with a file entry of the specific data offset
+ * A duplicate data offset of -1 indicates the file entry does not duplicate data
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_data_order_index_append_sub_node(
+     libcdata_tree_node_t *node,
+     int ltree_entry_index,
+     off64_t data_offset,
+     off64_t duplicate_data_offset,
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_sub_node     = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+
+	if( libewf_lef_file_entry_initialize(
+	     &lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	lef_file_entry->type                  = LIBEWF_FILE_ENTRY_TYPE_FILE;
+	lef_file_entry->ltree_entry_index     = ltree_entry_index;
+	lef_file_entry->data_offset           = data_offset;
+	lef_file_entry->data_size             = 512;
+	lef_file_entry->duplicate_data_offset = duplicate_data_offset;
+
+	if( duplicate_data_offset >= 0 )
+	{
+		lef_file_entry->flags |= LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA;
+	}
+	if( libcdata_tree_node_initialize(
+	     &safe_sub_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     safe_sub_node,
+	     (intptr_t *) lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	lef_file_entry = NULL;
+
+	if( libcdata_tree_node_append_node(
+	     node,
+	     safe_sub_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*sub_node = safe_sub_node;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &safe_sub_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libewf_data_order_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_data_order_index_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libewf_data_order_index_t *data_order_index = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 2;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_data_order_index_initialize(
+	          &data_order_index,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_order_index",
+	 data_order_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "data_order_index->maximum_number_of_entries",
+	 data_order_index->maximum_number_of_entries,
+	 100 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "data_order_index->number_of_entries",
+	 data_order_index->number_of_entries,
+	 0 );
+
+	result = libewf_data_order_index_free(
+	          &data_order_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_order_index",
+	 data_order_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_data_order_index_initialize(
+	          NULL,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_order_index = (libewf_data_order_index_t *) 0x12345678UL;
+
+	result = libewf_data_order_index_initialize(
+	          &data_order_index,
+	          100,
+	          &error );
+
+	data_order_index = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_data_order_index_initialize(
+	          &data_order_index,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_order_index",
+	 data_order_index );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_data_order_index_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_data_order_index_initialize(
+		          &data_order_index,
+		          100,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( data_order_index != NULL )
+			{
+				libewf_data_order_index_free(
+				 &data_order_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "data_order_index",
+			 data_order_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_data_order_index_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_data_order_index_initialize(
+		          &data_order_index,
+		          100,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( data_order_index != NULL )
+			{
+				libewf_data_order_index_free(
+				 &data_order_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "data_order_index",
+			 data_order_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_order_index != NULL )
+	{
+		libewf_data_order_index_free(
+		 &data_order_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_data_order_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_data_order_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_data_order_index_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_data_order_index_append_node, libewf_data_order_index_sort
+ * and libewf_data_order_index_get_node_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_data_order_index_sort(
+     void )
+{
+	libcdata_tree_node_t *node                  = NULL;
+	libcdata_tree_node_t *sub_node              = NULL;
+	libcerror_error_t *error                    = NULL;
+	libewf_data_order_index_t *data_order_index = NULL;
+	libewf_lef_file_entry_t *lef_file_entry     = NULL;
+	off64_t data_offset                         = 0;
+	off64_t duplicate_data_offset               = 0;
+	off64_t previous_data_offset                = -1;
+	int number_of_entries                       = 0;
+	int previous_ltree_entry_index              = -1;
+	int result                                  = 0;
+	int sub_node_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_initialize(
+	          &node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_data_order_index_initialize(
+	          &data_order_index,
+	          110,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_order_index",
+	 data_order_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last 10 file entries duplicate the data of file entries stored earlier in the tree
+	 */
+	for( sub_node_index = 0;
+	     sub_node_index < 110;
+	     sub_node_index++ )
+	{
+		if( sub_node_index >= 100 )
+		{
+			data_offset           = 0;
+			duplicate_data_offset = (off64_t) ( ( sub_node_index * 37 ) % 100 ) * 512;
+		}
+		else
+		{
+			data_offset           = (off64_t) ( ( sub_node_index * 37 ) % 100 ) * 512;
+			duplicate_data_offset = -1;
+		}
+		result = ewf_test_data_order_index_append_sub_node(
+		          node,
+		          sub_node_index,
+		          data_offset,
+		          duplicate_data_offset,
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_data_order_index_append_node(
+		          data_order_index,
+		          sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libewf_data_order_index_get_number_of_entries(
+	          data_order_index,
+	          &number_of_entries,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 110 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_data_order_index_append_node(
+	          data_order_index,
+	          sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libewf_data_order_index_sort(
+	          data_order_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_node_index = 0;
+	     sub_node_index < 110;
+	     sub_node_index++ )
+	{
+		result = libewf_data_order_index_get_node_by_index(
+		          data_order_index,
+		          sub_node_index,
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_tree_node_get_value(
+		          sub_node,
+		          (intptr_t **) &lef_file_entry,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "lef_file_entry",
+		 lef_file_entry );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A duplicate directly follows the file entry it duplicates
+		 */
+		if( lef_file_entry->duplicate_data_offset >= 0 )
+		{
+			EWF_TEST_ASSERT_EQUAL_INT64(
+			 "lef_file_entry->duplicate_data_offset",
+			 (int64_t) lef_file_entry->duplicate_data_offset,
+			 (int64_t) previous_data_offset );
+
+			EWF_TEST_ASSERT_LESS_THAN_INT(
+			 "previous_ltree_entry_index",
+			 previous_ltree_entry_index,
+			 lef_file_entry->ltree_entry_index );
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "lef_file_entry->data_offset",
+			 (int) ( lef_file_entry->data_offset > previous_data_offset ),
+			 1 );
+
+			previous_data_offset = lef_file_entry->data_offset;
+		}
+		previous_ltree_entry_index = lef_file_entry->ltree_entry_index;
+	}
+	/* Test error cases
+	 */
+	result = libewf_data_order_index_sort(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_data_order_index_get_node_by_index(
+	          data_order_index,
+	          110,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_data_order_index_get_node_by_index(
+	          data_order_index,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_data_order_index_free(
+	          &data_order_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_order_index",
+	 data_order_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_free(
+	          &node,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_order_index != NULL )
+	{
+		libewf_data_order_index_free(
+		 &data_order_index,
+		 NULL );
+	}
+	if( node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_data_order_index_initialize",
+	 ewf_test_data_order_index_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_data_order_index_free",
+	 ewf_test_data_order_index_free );
+
+	EWF_TEST_RUN(
+	 "libewf_data_order_index_sort",
+	 ewf_test_data_order_index_sort );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
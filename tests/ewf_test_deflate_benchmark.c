@@ -0,0 +1,350 @@
+/*
+ * Library DEFLATE decompression benchmark program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_deflate.h"
+
+/* The size of the uncompressed benchmark data, which is the size of 2048 chunks of 64 sectors
+ */
+#define EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE		( 32 * 1024 * 1024 )
+
+/* The size of the data that is compressed and decompressed at once, which is the default chunk size
+ */
+#define EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE		( 32 * 1024 )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && ( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) )
+
+/* Fills the buffer with compressible text-like data
+ */
+void ewf_test_deflate_benchmark_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *words[ 8 ] = {
+		"acquired ", "chunk ", "evidence ", "file ", "media ", "sector ", "segment ", "\n" };
+
+	const char *word    = NULL;
+	size_t data_offset  = 0;
+	size_t word_length  = 0;
+	uint32_t seed       = 0x12345678UL;
+
+	while( data_offset < data_size )
+	{
+		/* Use a linear congruential generator to have reproducible data
+		 */
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		word        = words[ ( seed >> 16 ) & 0x07 ];
+		word_length = narrow_string_length(
+		               word );
+
+		if( word_length > ( data_size - data_offset ) )
+		{
+			word_length = data_size - data_offset;
+		}
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 word,
+		 word_length );
+
+		data_offset += word_length;
+	}
+}
+
+/* Prints the throughput
+ */
+void ewf_test_deflate_benchmark_print_throughput(
+      const char *name,
+      size_t data_size,
+      clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%s: %.1f MB/s\n",
+	 name,
+	 ( (double) data_size / ( 1024.0 * 1024.0 ) ) / number_of_seconds );
+}
+
+/* Runs the DEFLATE decompression benchmark
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_deflate_benchmark(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *compressed_data       = NULL;
+	uint8_t *uncompressed_data     = NULL;
+	uint8_t *verification_data     = NULL;
+	size_t *compressed_chunk_sizes = NULL;
+	clock_t start_clock            = 0;
+	size_t chunk_offset            = 0;
+	size_t compressed_data_offset  = 0;
+	size_t maximum_chunk_size      = 0;
+	size_t uncompressed_chunk_size = 0;
+	uLongf zlib_compressed_size    = 0;
+	uLongf zlib_uncompressed_size  = 0;
+	int chunk_index                = 0;
+	int number_of_chunks           = 0;
+	int result                     = 0;
+
+	number_of_chunks   = EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE / EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+	maximum_chunk_size = (size_t) compressBound( EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	verification_data = (uint8_t *) memory_allocate(
+	                                 EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "verification_data",
+	 verification_data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               maximum_chunk_size * number_of_chunks );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	compressed_chunk_sizes = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_chunks );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_sizes",
+	 compressed_chunk_sizes );
+
+	ewf_test_deflate_benchmark_fill_data(
+	 verification_data,
+	 EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE );
+
+	/* Compress the data per chunk as an EWF writer would
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset         = (size_t) chunk_index * EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+		zlib_compressed_size = (uLongf) maximum_chunk_size;
+
+		result = compress2(
+		          &( compressed_data[ (size_t) chunk_index * maximum_chunk_size ] ),
+		          &zlib_compressed_size,
+		          &( verification_data[ chunk_offset ] ),
+		          (uLong) EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE,
+		          Z_DEFAULT_COMPRESSION );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 Z_OK );
+
+		compressed_chunk_sizes[ chunk_index ] = (size_t) zlib_compressed_size;
+	}
+	/* Decompress the data with the built-in DEFLATE decompression
+	 */
+	start_clock = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset            = (size_t) chunk_index * EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset  = (size_t) chunk_index * maximum_chunk_size;
+		uncompressed_chunk_size = EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+
+		result = libewf_deflate_decompress_zlib(
+		          &( compressed_data[ compressed_data_offset ] ),
+		          compressed_chunk_sizes[ chunk_index ],
+		          &( uncompressed_data[ chunk_offset ] ),
+		          &uncompressed_chunk_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_chunk_size",
+		 uncompressed_chunk_size,
+		 (size_t) EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE );
+	}
+	ewf_test_deflate_benchmark_print_throughput(
+	 "libewf_deflate_decompress_zlib",
+	 EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE,
+	 clock() - start_clock );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          verification_data,
+	          EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Decompress the data with zlib
+	 */
+	start_clock = clock();
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_offset           = (size_t) chunk_index * EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+		compressed_data_offset = (size_t) chunk_index * maximum_chunk_size;
+		zlib_uncompressed_size = (uLongf) EWF_TEST_DEFLATE_BENCHMARK_CHUNK_SIZE;
+
+		result = uncompress(
+		          &( uncompressed_data[ chunk_offset ] ),
+		          &zlib_uncompressed_size,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          (uLong) compressed_chunk_sizes[ chunk_index ] );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 Z_OK );
+	}
+	ewf_test_deflate_benchmark_print_throughput(
+	 "zlib uncompress",
+	 EWF_TEST_DEFLATE_BENCHMARK_DATA_SIZE,
+	 clock() - start_clock );
+
+	/* Clean up
+	 */
+	memory_free(
+	 compressed_chunk_sizes );
+
+	memory_free(
+	 compressed_data );
+
+	memory_free(
+	 verification_data );
+
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_sizes != NULL )
+	{
+		memory_free(
+		 compressed_chunk_sizes );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( verification_data != NULL )
+	{
+		memory_free(
+		 verification_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && ( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && ( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) )
+
+	EWF_TEST_RUN(
+	 "libewf_deflate_decompress_zlib",
+	 ewf_test_deflate_benchmark );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+
+#else
+	fprintf(
+	 stdout,
+	 "Benchmark requires zlib compress2 and uncompress support.\n" );
+
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && ( ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_COMPRESS2 ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -2399,21 +2400,2171 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_read_buffer_at_offset_concurrent function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_read_buffer_at_offset_concurrent(
+     libewf_handle_t *handle )
+{
+	uint8_t buffer[ EWF_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error      = NULL;
+	time_t timestamp              = 0;
+	size64_t media_size           = 0;
+	size64_t remaining_media_size = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t current_offset        = 0;
+	off64_t offset                = 0;
+	off64_t read_offset           = 0;
+	int number_of_tests           = 1024;
+	int random_number             = 0;
+	int result                    = 0;
+	int test_number               = 0;
+
+	/* Determine size
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = EWF_TEST_HANDLE_READ_BUFFER_SIZE;
+
+	if( media_size < EWF_TEST_HANDLE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) media_size;
+	}
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              buffer,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size > 8 )
+	{
+		/* Read buffer on media_size boundary
+		 */
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
+		              handle,
+		              buffer,
+		              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+		              media_size - 8,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond media_size boundary
+		 */
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
+		              handle,
+		              buffer,
+		              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+		              media_size + 8,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Determine the current offset which should not be changed
+	 */
+	result = libewf_handle_get_offset(
+	          handle,
+	          &current_offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		EWF_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		if( media_size > 0 )
+		{
+			read_offset = (off64_t) random_number % media_size;
+		}
+		read_size = (size_t) random_number % EWF_TEST_HANDLE_READ_BUFFER_SIZE;
+
+#if defined( EWF_TEST_HANDLE_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libewf_handle_read_buffer_at_offset_concurrent: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libewf_handle_read_buffer_at_offset_concurrent(
+		              handle,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              &error );
+
+		remaining_media_size = media_size - read_offset;
+
+		if( read_size > remaining_media_size )
+		{
+			read_size = (size_t) remaining_media_size;
+		}
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_handle_get_offset(
+		          handle,
+		          &offset,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 current_offset );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              NULL,
+	              buffer,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              NULL,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              buffer,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              -1,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_RWLOCK )
+
+	/* Test libewf_handle_read_buffer_at_offset_concurrent with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	ewf_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              buffer,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( ewf_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		ewf_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libewf_handle_read_buffer_at_offset_concurrent with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	ewf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libewf_handle_read_buffer_at_offset_concurrent(
+	              handle,
+	              buffer,
+	              EWF_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( ewf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		ewf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libewf_handle_read_buffer_at_offset function with a chunk read pool
+ * The data read by a handle with multiple threads is compared with the data read by the handle
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_read_buffer_at_offset_with_threads(
+     const system_character_t *source,
+     libewf_handle_t *handle )
+{
+	char narrow_source[ 256 ];
+	off64_t read_offsets[ 4 ];
+	size_t read_sizes[ 4 ];
+
+	libcerror_error_t *error        = NULL;
+	libewf_handle_t *pooled_handle  = NULL;
+	uint8_t *expected_buffer        = NULL;
+	uint8_t *pooled_buffer          = NULL;
+	char **filenames                = NULL;
+	size64_t media_size             = 0;
+	size_t buffer_size              = 0;
+	size_t expected_read_size       = 0;
+	size_t narrow_source_length     = 0;
+	ssize_t read_count              = 0;
+	size32_t chunk_size             = 0;
+	int number_of_filenames         = 0;
+	int number_of_tests             = 0;
+	int result                      = 0;
+	int test_number                 = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_chunk_size(
+	          handle,
+	          &chunk_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	narrow_source_length = narrow_string_length(
+	                        narrow_source );
+
+	result = libewf_glob(
+	          narrow_source,
+	          narrow_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_initialize(
+	          &pooled_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunk read pool is created when the handle is opened
+	 */
+	result = libewf_handle_set_number_of_threads(
+	          pooled_handle,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_open(
+	          pooled_handle,
+	          (char * const *) filenames,
+	          number_of_filenames,
+	          LIBEWF_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A read must span multiple chunks to be handled by the chunk read pool
+	 */
+	buffer_size = 8 * (size_t) chunk_size;
+
+	expected_buffer = (uint8_t *) memory_allocate(
+	                               buffer_size );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_buffer",
+	 expected_buffer );
+
+	pooled_buffer = (uint8_t *) memory_allocate(
+	                             buffer_size );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "pooled_buffer",
+	 pooled_buffer );
+
+	/* Test a read at a chunk aligned offset
+	 */
+	read_offsets[ 0 ] = 0;
+	read_sizes[ 0 ]   = buffer_size;
+
+	/* Test a read with an unaligned start and end offset
+	 */
+	read_offsets[ 1 ] = 7;
+	read_sizes[ 1 ]   = buffer_size - 11;
+
+	number_of_tests = 2;
+
+	if( media_size >= (size64_t) buffer_size )
+	{
+		/* Test a read that ends at the media size
+		 */
+		read_offsets[ 2 ] = (off64_t) ( media_size - buffer_size + 5 );
+		read_sizes[ 2 ]   = buffer_size - 5;
+
+		/* Test a read that is beyond the media size, the last chunk is short
+		 */
+		read_offsets[ 3 ] = (off64_t) ( media_size - ( 5 * chunk_size ) - 3 );
+		read_sizes[ 3 ]   = buffer_size;
+
+		number_of_tests = 4;
+	}
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		expected_read_size = read_sizes[ test_number ];
+
+		if( (size64_t) read_offsets[ test_number ] >= media_size )
+		{
+			expected_read_size = 0;
+		}
+		else if( expected_read_size > (size_t) ( media_size - read_offsets[ test_number ] ) )
+		{
+			expected_read_size = (size_t) ( media_size - read_offsets[ test_number ] );
+		}
+		read_count = libewf_handle_read_buffer_at_offset(
+		              handle,
+		              expected_buffer,
+		              read_sizes[ test_number ],
+		              read_offsets[ test_number ],
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) expected_read_size );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libewf_handle_read_buffer_at_offset(
+		              pooled_handle,
+		              pooled_buffer,
+		              read_sizes[ test_number ],
+		              read_offsets[ test_number ],
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) expected_read_size );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          pooled_buffer,
+		          expected_buffer,
+		          expected_read_size );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 pooled_buffer );
+
+	pooled_buffer = NULL;
+
+	memory_free(
+	 expected_buffer );
+
+	expected_buffer = NULL;
+
+	result = libewf_handle_close(
+	          pooled_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &pooled_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "pooled_handle",
+	 pooled_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_free(
+	          filenames,
+	          number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pooled_buffer != NULL )
+	{
+		memory_free(
+		 pooled_buffer );
+	}
+	if( expected_buffer != NULL )
+	{
+		memory_free(
+		 expected_buffer );
+	}
+	if( pooled_handle != NULL )
+	{
+		libewf_handle_free(
+		 &pooled_handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libewf_handle_get_chunk_view and libewf_handle_release_chunk_view functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_chunk_view(
+     libewf_handle_t *handle )
+{
+	uint8_t buffer[ EWF_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	size64_t media_size      = 0;
+	size_t data_size         = 0;
+	size_t compare_size      = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( media_size > 0 )
+	{
+		result = libewf_handle_get_chunk_view(
+		          handle,
+		          0,
+		          &data,
+		          &data_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "data_size",
+		 (ssize_t) data_size,
+		 (ssize_t) 0 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The view contains the same data as read
+		 */
+		compare_size = data_size;
+
+		if( compare_size > EWF_TEST_HANDLE_READ_BUFFER_SIZE )
+		{
+			compare_size = EWF_TEST_HANDLE_READ_BUFFER_SIZE;
+		}
+		read_count = libewf_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              compare_size,
+		              0,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) compare_size );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          buffer,
+		          compare_size );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libewf_handle_release_chunk_view(
+		          handle,
+		          data,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A view on the media_size boundary ends at the media size
+		 */
+		if( media_size > 8 )
+		{
+			result = libewf_handle_get_chunk_view(
+			          handle,
+			          media_size - 8,
+			          &data,
+			          &data_size,
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_EQUAL_SIZE(
+			 "data_size",
+			 data_size,
+			 (size_t) 8 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libewf_handle_release_chunk_view(
+			          handle,
+			          data,
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* A view beyond the media_size boundary is empty
+	 */
+	result = libewf_handle_get_chunk_view(
+	          handle,
+	          media_size + 8,
+	          &data,
+	          &data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_chunk_view(
+	          NULL,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_chunk_view(
+	          handle,
+	          -1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_chunk_view(
+	          handle,
+	          0,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_chunk_view(
+	          handle,
+	          0,
+	          &data,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_release_chunk_view(
+	          NULL,
+	          buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Data that is not part of a view cannot be released
+	 */
+	result = libewf_handle_release_chunk_view(
+	          handle,
+	          buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_handle_get_data_chunk function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_handle_get_data_chunk(
+int ewf_test_handle_get_data_chunk(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_data_chunk_t *data_chunk = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_data_chunk(
+	          handle,
+	          &data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_chunk",
+	 data_chunk );
+
+	result = libewf_data_chunk_free(
+	          &data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_data_chunk(
+	          NULL,
+	          &data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_chunk",
+	 data_chunk );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_data_chunk(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_chunk",
+	 data_chunk );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_chunk != NULL )
+	{
+		libewf_data_chunk_free(
+		 &data_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_seek_offset(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	EWF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	size = (size64_t) offset;
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          -512,
+	          SEEK_CUR,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          (off64_t) ( size + 512 ),
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libewf_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_CUR,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_RWLOCK )
+
+	/* Test libewf_handle_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	ewf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( ewf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		ewf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libewf_handle_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	ewf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( ewf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		ewf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_offset(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_offset(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_maximum_cache_size(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error    = NULL;
+	size64_t maximum_cache_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_maximum_cache_size(
+	          handle,
+	          &maximum_cache_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_maximum_cache_size(
+	          NULL,
+	          &maximum_cache_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_maximum_cache_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_set_maximum_cache_size(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error    = NULL;
+	size64_t maximum_cache_size = 0;
+	size64_t test_cache_size    = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_get_maximum_cache_size(
+	          handle,
+	          &maximum_cache_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_set_maximum_cache_size(
+	          handle,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_maximum_cache_size(
+	          handle,
+	          &test_cache_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "test_cache_size",
+	 (uint64_t) test_cache_size,
+	 (uint64_t) 1024 * 1024 );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_set_maximum_cache_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_handle_set_maximum_cache_size(
+	          handle,
+	          maximum_cache_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_cache_statistics(
+     libewf_handle_t *handle )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error     = NULL;
+	size64_t media_size          = 0;
+	ssize_t read_count           = 0;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	uint64_t previous_hits       = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_cache_statistics(
+	          handle,
+	          &previous_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size >= 16 )
+	{
+		/* Reading the same data twice should result in a cache hit
+		 */
+		read_count = libewf_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              16,
+		              0,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libewf_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              16,
+		              0,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_handle_get_cache_statistics(
+		          handle,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &number_of_evictions,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_LESS_THAN_UINT64(
+		 "previous_hits",
+		 previous_hits,
+		 number_of_hits );
+	}
+	/* Test error cases
+	 */
+	result = libewf_handle_get_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_cache_statistics(
+	          handle,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_maximum_coalesced_read_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_maximum_coalesced_read_size(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error             = NULL;
+	size64_t maximum_coalesced_read_size = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_maximum_coalesced_read_size(
+	          handle,
+	          &maximum_coalesced_read_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_maximum_coalesced_read_size(
+	          NULL,
+	          &maximum_coalesced_read_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_maximum_coalesced_read_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_set_maximum_coalesced_read_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_set_maximum_coalesced_read_size(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error             = NULL;
+	size64_t maximum_coalesced_read_size = 0;
+	size64_t test_read_size              = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_get_maximum_coalesced_read_size(
+	          handle,
+	          &maximum_coalesced_read_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_set_maximum_coalesced_read_size(
+	          handle,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_maximum_coalesced_read_size(
+	          handle,
+	          &test_read_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "test_read_size",
+	 (uint64_t) test_read_size,
+	 (uint64_t) 1024 * 1024 );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_set_maximum_coalesced_read_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_set_maximum_coalesced_read_size(
+	          handle,
+	          (size64_t) 1024 * 1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_handle_set_maximum_coalesced_read_size(
+	          handle,
+	          maximum_coalesced_read_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_number_of_threads(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_number_of_threads(
+	          handle,
+	          &number_of_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_number_of_threads(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_set_number_of_threads(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libewf_handle_set_number_of_threads(
+	          handle,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_number_of_threads(
+	          handle,
+	          &number_of_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 2 );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libewf_handle_set_number_of_threads(
+	          handle,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_number_of_threads(
+	          handle,
+	          &number_of_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_set_number_of_threads(
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_set_number_of_threads(
+	          handle,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_prefetch_window function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_prefetch_window(
      libewf_handle_t *handle )
 {
-	libcerror_error_t *error        = NULL;
-	libewf_data_chunk_t *data_chunk = NULL;
-	int result                      = 0;
+	libcerror_error_t *error = NULL;
+	int number_of_chunks     = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libewf_handle_get_data_chunk(
+	result = libewf_handle_get_prefetch_window(
 	          handle,
-	          &data_chunk,
+	          &number_of_chunks,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2425,12 +4576,118 @@ int ewf_test_handle_get_data_chunk(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libewf_handle_get_prefetch_window(
+	          NULL,
+	          &number_of_chunks,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "data_chunk",
-	 data_chunk );
+	 "error",
+	 error );
 
-	result = libewf_data_chunk_free(
-	          &data_chunk,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_prefetch_window(
+	          handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_set_prefetch_window function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_set_prefetch_window(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_chunks     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libewf_handle_set_prefetch_window(
+	          handle,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_prefetch_window(
+	          handle,
+	          &number_of_chunks,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 4 );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libewf_handle_set_prefetch_window(
+	          handle,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_prefetch_window(
+	          handle,
+	          &number_of_chunks,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2442,11 +4699,16 @@ int ewf_test_handle_get_data_chunk(
 	 "error",
 	 error );
 
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libewf_handle_get_data_chunk(
+	result = libewf_handle_set_prefetch_window(
 	          NULL,
-	          &data_chunk,
+	          0,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2454,10 +4716,6 @@ int ewf_test_handle_get_data_chunk(
 	 result,
 	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "data_chunk",
-	 data_chunk );
-
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2465,9 +4723,9 @@ int ewf_test_handle_get_data_chunk(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_handle_get_data_chunk(
+	result = libewf_handle_set_prefetch_window(
 	          handle,
-	          NULL,
+	          -1,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2475,9 +4733,22 @@ int ewf_test_handle_get_data_chunk(
 	 result,
 	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "data_chunk",
-	 data_chunk );
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_set_prefetch_window(
+	          handle,
+	          LIBEWF_MAXIMUM_PREFETCH_WINDOW + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2494,101 +4765,108 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( data_chunk != NULL )
-	{
-		libewf_data_chunk_free(
-		 &data_chunk,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libewf_handle_seek_offset function
+/* Tests the libewf_handle_get_prefetch_statistics function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_handle_seek_offset(
+int ewf_test_handle_get_prefetch_statistics(
      libewf_handle_t *handle )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	off64_t offset           = 0;
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error             = NULL;
+	size64_t media_size                  = 0;
+	ssize_t read_count                   = 0;
+	uint64_t number_of_prefetch_hits     = 0;
+	uint64_t number_of_prefetched_chunks = 0;
+	off64_t offset                       = 0;
+	int result                           = 0;
 
 	/* Test regular cases
 	 */
-	offset = libewf_handle_seek_offset(
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libewf_handle_set_prefetch_window(
 	          handle,
-	          0,
-	          SEEK_END,
+	          4,
 	          &error );
 
-	EWF_TEST_ASSERT_NOT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size = (size64_t) offset;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-	offset = libewf_handle_seek_offset(
+	result = libewf_handle_get_media_size(
 	          handle,
-	          1024,
-	          SEEK_SET,
+	          &media_size,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 1024 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libewf_handle_seek_offset(
-	          handle,
-	          -512,
-	          SEEK_CUR,
-	          &error );
+	/* Read the media data sequentially so that chunks are prefetched
+	 */
+	while( (size64_t) offset < media_size )
+	{
+		read_count = libewf_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              4096,
+		              offset,
+		              &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 512 );
+		EWF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	offset = libewf_handle_seek_offset(
+		if( read_count == 0 )
+		{
+			break;
+		}
+		offset += read_count;
+	}
+	result = libewf_handle_get_prefetch_statistics(
 	          handle,
-	          (off64_t) ( size + 512 ),
-	          SEEK_SET,
+	          &number_of_prefetched_chunks,
+	          &number_of_prefetch_hits,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) ( size + 512 ) );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libewf_handle_seek_offset(
+	result = libewf_handle_set_prefetch_window(
 	          handle,
 	          0,
-	          SEEK_SET,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2596,16 +4874,16 @@ int ewf_test_handle_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libewf_handle_seek_offset(
+	result = libewf_handle_get_prefetch_statistics(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          &number_of_prefetched_chunks,
+	          &number_of_prefetch_hits,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2614,16 +4892,16 @@ int ewf_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libewf_handle_seek_offset(
+	result = libewf_handle_get_prefetch_statistics(
 	          handle,
-	          -1,
-	          SEEK_SET,
+	          NULL,
+	          &number_of_prefetch_hits,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2632,31 +4910,16 @@ int ewf_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libewf_handle_seek_offset(
-	          handle,
-	          -1,
-	          SEEK_CUR,
-	          &error );
-
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
-
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	offset = libewf_handle_seek_offset(
+	result = libewf_handle_get_prefetch_statistics(
 	          handle,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
+	          &number_of_prefetched_chunks,
+	          NULL,
 	          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2665,66 +4928,6 @@ int ewf_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_EWF_TEST_RWLOCK )
-
-	/* Test libewf_handle_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	ewf_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	offset = libewf_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	if( ewf_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		ewf_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		EWF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
-
-		EWF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libewf_handle_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	ewf_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	offset = libewf_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	if( ewf_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		ewf_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		EWF_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
-
-		EWF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_EWF_TEST_RWLOCK ) */
-
 	return( 1 );
 
 on_error:
@@ -2736,21 +4939,54 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libewf_handle_get_offset function
+/* Tests the libewf_handle_set_read_segment_files_on_demand function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_handle_get_offset(
+int ewf_test_handle_set_read_segment_files_on_demand(
      libewf_handle_t *handle )
 {
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int result               = 0;
+	libcerror_error_t *error         = NULL;
+	libewf_handle_t *unopened_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_initialize(
+	          &unopened_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "unopened_handle",
+	 unopened_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libewf_handle_get_offset(
-	          handle,
-	          &offset,
+	result = libewf_handle_set_read_segment_files_on_demand(
+	          unopened_handle,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_set_read_segment_files_on_demand(
+	          unopened_handle,
+	          0,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2764,9 +5000,9 @@ int ewf_test_handle_get_offset(
 
 	/* Test error cases
 	 */
-	result = libewf_handle_get_offset(
+	result = libewf_handle_set_read_segment_files_on_demand(
 	          NULL,
-	          &offset,
+	          1,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2781,9 +5017,11 @@ int ewf_test_handle_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_handle_get_offset(
+	/* Test read segment files on demand cannot be changed on an open handle
+	 */
+	result = libewf_handle_set_read_segment_files_on_demand(
 	          handle,
-	          NULL,
+	          1,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2798,6 +5036,25 @@ int ewf_test_handle_get_offset(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libewf_handle_free(
+	          &unopened_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "unopened_handle",
+	 unopened_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2806,6 +5063,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( unopened_handle != NULL )
+	{
+		libewf_handle_free(
+		 &unopened_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -4900,6 +7163,26 @@ int main(
 		 ewf_test_handle_read_buffer_at_offset,
 		 handle );
 
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_read_buffer_at_offset_concurrent",
+		 ewf_test_handle_read_buffer_at_offset_concurrent,
+		 handle );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_read_buffer_at_offset_with_threads",
+		 ewf_test_handle_read_buffer_at_offset_with_threads,
+		 source,
+		 handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_chunk_view",
+		 ewf_test_handle_get_chunk_view,
+		 handle );
+
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
 		/* TODO: add tests for libewf_internal_handle_write_buffer_to_file_io_pool */
@@ -4957,6 +7240,61 @@ int main(
 
 		/* TODO: add tests for libewf_handle_set_maximum_number_of_open_handles */
 
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_maximum_cache_size",
+		 ewf_test_handle_get_maximum_cache_size,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_maximum_cache_size",
+		 ewf_test_handle_set_maximum_cache_size,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_cache_statistics",
+		 ewf_test_handle_get_cache_statistics,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_maximum_coalesced_read_size",
+		 ewf_test_handle_get_maximum_coalesced_read_size,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_maximum_coalesced_read_size",
+		 ewf_test_handle_set_maximum_coalesced_read_size,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_number_of_threads",
+		 ewf_test_handle_get_number_of_threads,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_number_of_threads",
+		 ewf_test_handle_set_number_of_threads,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_prefetch_window",
+		 ewf_test_handle_get_prefetch_window,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_prefetch_window",
+		 ewf_test_handle_set_prefetch_window,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_prefetch_statistics",
+		 ewf_test_handle_get_prefetch_statistics,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_read_segment_files_on_demand",
+		 ewf_test_handle_set_read_segment_files_on_demand,
+		 handle );
+
 		/* TODO: add tests for libewf_handle_segment_files_corrupted */
 
 		/* TODO: add tests for libewf_handle_segment_files_encrypted */
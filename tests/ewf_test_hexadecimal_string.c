@@ -0,0 +1,1328 @@
+/*
+ * Library hexadecimal_string functions test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_definitions.h"
+#include "../libewf/libewf_hexadecimal_string.h"
+
+uint8_t ewf_test_hexadecimal_string_values_data1[ 33 ] = {
+	0x44, 0x43, 0x31, 0x38, 0x35, 0x43, 0x36, 0x38, 0x31, 0x31, 0x34, 0x44, 0x34, 0x45, 0x41, 0x45,
+	0x42, 0x33, 0x41, 0x37, 0x38, 0x45, 0x43, 0x33, 0x33, 0x36, 0x33, 0x43, 0x36, 0x34, 0x42, 0x36,
+	0x00 };
+
+uint8_t ewf_test_hexadecimal_string_values_data2[ 32 ] = {
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30 };
+
+uint8_t ewf_test_hexadecimal_string_values_data3[ 18 ] = {
+	0x64, 0x00, 0x63, 0x00, 0x31, 0x00, 0x38, 0x00, 0x35, 0x00, 0x43, 0x00, 0x36, 0x00, 0x38, 0x00,
+	0x00, 0x00 };
+
+uint8_t ewf_test_hexadecimal_string_values_data4[ 64 ] = {
+	0x65, 0x33, 0x62, 0x30, 0x63, 0x34, 0x34, 0x32, 0x39, 0x38, 0x66, 0x63, 0x31, 0x63, 0x31, 0x34,
+	0x39, 0x61, 0x66, 0x62, 0x66, 0x34, 0x63, 0x38, 0x39, 0x39, 0x36, 0x66, 0x62, 0x39, 0x32, 0x34,
+	0x32, 0x37, 0x61, 0x65, 0x34, 0x31, 0x65, 0x34, 0x36, 0x34, 0x39, 0x62, 0x39, 0x33, 0x34, 0x63,
+	0x61, 0x34, 0x39, 0x35, 0x39, 0x39, 0x31, 0x62, 0x37, 0x38, 0x35, 0x32, 0x62, 0x38, 0x35, 0x35 };
+
+uint8_t ewf_test_hexadecimal_string_values_data5[ 4 ] = {
+	0x31, 0x32, 0x33, 0x58 };
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_hexadecimal_string_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_clear(
+     void )
+{
+	libewf_hexadecimal_string_t hexadecimal_string;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &hexadecimal_string,
+	                 0,
+	                 sizeof( libewf_hexadecimal_string_t ) );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data4,
+	          64,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_clear(
+	          &hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "hexadecimal_string.serialized_string",
+	 hexadecimal_string.serialized_string );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hexadecimal_string.data_size",
+	 hexadecimal_string.data_size,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_clear(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libewf_hexadecimal_string_clear(
+	 &hexadecimal_string,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_clone(
+     void )
+{
+	libewf_hexadecimal_string_t destination_hexadecimal_string;
+	libewf_hexadecimal_string_t source_hexadecimal_string;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &destination_hexadecimal_string,
+	                 0,
+	                 sizeof( libewf_hexadecimal_string_t ) );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &source_hexadecimal_string,
+	                 0,
+	                 sizeof( libewf_hexadecimal_string_t ) );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &source_hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data1,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_clone(
+	          &destination_hexadecimal_string,
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_hexadecimal_string.data_size",
+	 destination_hexadecimal_string.data_size,
+	 (uint8_t) 16 );
+
+	result = memory_compare(
+	          destination_hexadecimal_string.data,
+	          source_hexadecimal_string.data,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test clone of a hexadecimal string stored as serialized string
+	 */
+	result = libewf_hexadecimal_string_clear(
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &source_hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data4,
+	          64,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_hexadecimal_string_clone(
+	          &destination_hexadecimal_string,
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_hexadecimal_string.serialized_string",
+	 destination_hexadecimal_string.serialized_string );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_clone(
+	          &destination_hexadecimal_string,
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_clear(
+	          &destination_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_hexadecimal_string_clone(
+	          NULL,
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_clone(
+	          &destination_hexadecimal_string,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_hexadecimal_string_clone with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_hexadecimal_string_clone(
+	          &destination_hexadecimal_string,
+	          &source_hexadecimal_string,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		libewf_hexadecimal_string_clear(
+		 &destination_hexadecimal_string,
+		 NULL );
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "destination_hexadecimal_string.serialized_string",
+		 destination_hexadecimal_string.serialized_string );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libewf_hexadecimal_string_clear(
+	          &source_hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libewf_hexadecimal_string_clear(
+	 &destination_hexadecimal_string,
+	 NULL );
+	libewf_hexadecimal_string_clear(
+	 &source_hexadecimal_string,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_read_data(
+     void )
+{
+	uint8_t expected_data[ 4 ] = {
+		0xdc, 0x18, 0x5c, 0x68 };
+
+	libewf_hexadecimal_string_t hexadecimal_string;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	size_t memory_usage      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &hexadecimal_string,
+	                 0,
+	                 sizeof( libewf_hexadecimal_string_t ) );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data1,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hexadecimal_string.data_size",
+	 hexadecimal_string.data_size,
+	 (uint8_t) 16 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "hexadecimal_string.serialized_string",
+	 hexadecimal_string.serialized_string );
+
+	result = memory_compare(
+	          hexadecimal_string.data,
+	          expected_data,
+	          4 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read when already set
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data1,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_clear(
+	          &hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all zeros
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data2,
+	          32,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hexadecimal_string.data_size",
+	 hexadecimal_string.data_size,
+	 (uint8_t) 0 );
+
+	/* Test with UTF-16 little-endian data
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data3,
+	          18,
+	          LIBEWF_VALUE_DATA_TYPE_UTF16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hexadecimal_string.data_size",
+	 hexadecimal_string.data_size,
+	 (uint8_t) 4 );
+
+	result = memory_compare(
+	          hexadecimal_string.data,
+	          expected_data,
+	          4 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libewf_hexadecimal_string_clear(
+	          &hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a hexadecimal string that does not fit in the binary data
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data4,
+	          64,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "hexadecimal_string.serialized_string",
+	 hexadecimal_string.serialized_string );
+
+	result = libewf_hexadecimal_string_get_memory_usage(
+	          &hexadecimal_string,
+	          &memory_usage,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_usage",
+	 memory_usage,
+	 sizeof( libewf_serialized_string_t ) + 65 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_hexadecimal_string_clear(
+	          &hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          NULL,
+	          ewf_test_hexadecimal_string_values_data1,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          NULL,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported character
+	 */
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data5,
+	          4,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hexadecimal_string.data_size",
+	 hexadecimal_string.data_size,
+	 (uint8_t) 0 );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_hexadecimal_string_read_data with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data4,
+	          64,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		libewf_hexadecimal_string_clear(
+		 &hexadecimal_string,
+		 NULL );
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "hexadecimal_string.serialized_string",
+		 hexadecimal_string.serialized_string );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libewf_hexadecimal_string_clear(
+	 &hexadecimal_string,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_get_utf8_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_get_utf8_string_size(
+	          hexadecimal_string,
+	          &utf8_string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 33 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_get_utf8_string_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf8_string_size(
+	          hexadecimal_string,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_get_utf8_string(
+     libewf_hexadecimal_string_t *hexadecimal_string )
+{
+	uint8_t expected_utf8_string[ 33 ] = {
+		'd', 'c', '1', '8', '5', 'c', '6', '8', '1', '1', '4', 'd', '4', 'e', 'a', 'e',
+		'b', '3', 'a', '7', '8', 'e', 'c', '3', '3', '6', '3', 'c', '6', '4', 'b', '6',
+		0 };
+
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          hexadecimal_string,
+	          utf8_string,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          33 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          NULL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          hexadecimal_string,
+	          NULL,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          hexadecimal_string,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf8_string(
+	          hexadecimal_string,
+	          utf8_string,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_get_utf16_string_size(
+     libewf_hexadecimal_string_t *hexadecimal_string )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_get_utf16_string_size(
+	          hexadecimal_string,
+	          &utf16_string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 33 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_get_utf16_string_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf16_string_size(
+	          hexadecimal_string,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_hexadecimal_string_get_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_hexadecimal_string_get_utf16_string(
+     libewf_hexadecimal_string_t *hexadecimal_string )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          hexadecimal_string,
+	          utf16_string,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 0 ]",
+	 utf16_string[ 0 ],
+	 (uint16_t) 'd' );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 31 ]",
+	 utf16_string[ 31 ],
+	 (uint16_t) '6' );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 32 ]",
+	 utf16_string[ 32 ],
+	 (uint16_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          NULL,
+	          utf16_string,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          hexadecimal_string,
+	          NULL,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          hexadecimal_string,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_hexadecimal_string_get_utf16_string(
+	          hexadecimal_string,
+	          utf16_string,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	libewf_hexadecimal_string_t hexadecimal_string;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_hexadecimal_string_clear",
+	 ewf_test_hexadecimal_string_clear );
+
+	EWF_TEST_RUN(
+	 "libewf_hexadecimal_string_clone",
+	 ewf_test_hexadecimal_string_clone );
+
+	EWF_TEST_RUN(
+	 "libewf_hexadecimal_string_read_data",
+	 ewf_test_hexadecimal_string_read_data );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize hexadecimal_string for tests
+	 */
+	memset_result = memory_set(
+	                 &hexadecimal_string,
+	                 0,
+	                 sizeof( libewf_hexadecimal_string_t ) );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libewf_hexadecimal_string_read_data(
+	          &hexadecimal_string,
+	          ewf_test_hexadecimal_string_values_data1,
+	          33,
+	          LIBEWF_VALUE_DATA_TYPE_UTF8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Run tests
+	 */
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_hexadecimal_string_get_utf8_string_size",
+	 ewf_test_hexadecimal_string_get_utf8_string_size,
+	 &hexadecimal_string );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_hexadecimal_string_get_utf8_string",
+	 ewf_test_hexadecimal_string_get_utf8_string,
+	 &hexadecimal_string );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_hexadecimal_string_get_utf16_string_size",
+	 ewf_test_hexadecimal_string_get_utf16_string_size,
+	 &hexadecimal_string );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_hexadecimal_string_get_utf16_string",
+	 ewf_test_hexadecimal_string_get_utf16_string,
+	 &hexadecimal_string );
+
+	/* Clean up
+	 */
+	result = libewf_hexadecimal_string_clear(
+	          &hexadecimal_string,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libewf_hexadecimal_string_clear(
+	 &hexadecimal_string,
+	 NULL );
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -677,6 +677,328 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_huffman_tree_build_lookup_table function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_huffman_tree_build_lookup_table(
+     void )
+{
+	uint8_t code_size_array[ 13 ];
+	uint8_t byte_stream_data[ 2 ] = {
+		0xff, 0x0f };
+
+	libewf_bit_stream_t *bit_stream     = NULL;
+	libewf_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error             = NULL;
+	uint16_t symbol                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 * Use a complete set of codes where the largest codes do not fit in the primary lookup table
+	 */
+	for( symbol = 0;
+	     symbol < 12;
+	     symbol++ )
+	{
+		code_size_array[ symbol ] = (uint8_t) ( symbol + 1 );
+	}
+	code_size_array[ 12 ] = 12;
+
+	result = libewf_huffman_tree_initialize(
+	          &huffman_tree,
+	          13,
+	          15,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          13,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          code_size_array,
+	          13,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "huffman_tree->lookup_table_bits",
+	 huffman_tree->lookup_table_bits,
+	 (uint8_t) LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_BITS );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree->lookup_table",
+	 huffman_tree->lookup_table );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 0 ]",
+	 huffman_tree->lookup_table[ 0 ],
+	 (uint32_t) 0x00000001UL );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 0x3ff ]",
+	 huffman_tree->lookup_table[ 0x3ff ],
+	 (uint32_t) ( 0x04000000UL | LIBEWF_HUFFMAN_TREE_LOOKUP_TABLE_FLAG_SUB_TABLE | 2 ) );
+
+	/* Decode a 12-bit code that requires a sub table followed by 1-bit codes
+	 */
+	result = libewf_bit_stream_initialize(
+	          &bit_stream,
+	          byte_stream_data,
+	          2,
+	          0,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_huffman_tree_get_symbol_from_bit_stream(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 (uint16_t) 12 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_huffman_tree_get_symbol_from_bit_stream(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 (uint16_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 3 );
+
+	result = libewf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_huffman_tree_build_lookup_table(
+	          NULL,
+	          code_size_array,
+	          13,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          NULL,
+	          13,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          code_size_array,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with a maximum code size that is not supported by the lookup table
+	 */
+	result = libewf_huffman_tree_initialize(
+	          &huffman_tree,
+	          13,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          code_size_array,
+	          13,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libewf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( huffman_tree != NULL )
+	{
+		libewf_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_huffman_tree_get_symbol_from_bit_stream function
  * Returns 1 if successful or 0 if not
  */
@@ -964,6 +1286,10 @@ int main(
 	 "libewf_huffman_tree_build",
 	 ewf_test_huffman_tree_build );
 
+	EWF_TEST_RUN(
+	 "libewf_huffman_tree_build_lookup_table",
+	 ewf_test_huffman_tree_build_lookup_table );
+
 	EWF_TEST_RUN(
 	 "libewf_huffman_tree_get_symbol_from_bit_stream",
 	 ewf_test_huffman_tree_get_symbol_from_bit_stream );
@@ -664,7 +664,7 @@ int ewf_test_lef_file_entry_initialize(
 	int result                              = 0;
 
 #if defined( HAVE_EWF_TEST_MEMORY )
-	int number_of_malloc_fail_tests         = 7;
+	int number_of_malloc_fail_tests         = 1;
 	int number_of_memset_fail_tests         = 1;
 	int test_number                         = 0;
 #endif
@@ -45,6 +45,8 @@ int ewf_test_memcpy_attempts_before_fail                           = -1;
 int ewf_test_memset_attempts_before_fail                           = -1;
 int ewf_test_realloc_attempts_before_fail                          = -1;
 
+int ewf_test_number_of_malloc_calls                                = 0;
+
 /* Custom malloc for testing memory error cases
  * Note this function might fail if compiled with optimation
  * Returns a pointer to newly allocated data or NULL
@@ -60,6 +62,8 @@ void *malloc(
 		                        RTLD_NEXT,
 		                        "malloc" );
 	}
+	ewf_test_number_of_malloc_calls++;
+
 	if( ewf_test_malloc_attempts_before_fail == 0 )
 	{
 		ewf_test_malloc_attempts_before_fail = -1;
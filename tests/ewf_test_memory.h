@@ -42,6 +42,8 @@ extern int ewf_test_memset_attempts_before_fail;
 
 extern int ewf_test_realloc_attempts_before_fail;
 
+extern int ewf_test_number_of_malloc_calls;
+
 #endif /* defined( HAVE_EWF_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
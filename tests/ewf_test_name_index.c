@@ -0,0 +1,1291 @@
+/*
+ * Library name_index type test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcdata.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_lef_file_entry.h"
+#include "../libewf/libewf_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Appends a sub node with a file entry of the specific name
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_name_index_append_sub_node(
+     libcdata_tree_node_t *node,
+     const char *name,
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_sub_node     = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	size_t name_index                       = 0;
+	size_t name_length                      = 0;
+
+	if( libewf_lef_file_entry_initialize(
+	     &lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	lef_file_entry->name_data_size = ( name_length + 1 ) * 2;
+
+	lef_file_entry->name_data = (uint8_t *) memory_allocate(
+	                                         lef_file_entry->name_data_size );
+
+	if( lef_file_entry->name_data == NULL )
+	{
+		goto on_error;
+	}
+	for( name_index = 0;
+	     name_index <= name_length;
+	     name_index++ )
+	{
+		lef_file_entry->name_data[ name_index * 2 ]         = (uint8_t) name[ name_index ];
+		lef_file_entry->name_data[ ( name_index * 2 ) + 1 ] = 0;
+	}
+	if( libcdata_tree_node_initialize(
+	     &safe_sub_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     safe_sub_node,
+	     (intptr_t *) lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	lef_file_entry = NULL;
+
+	if( libcdata_tree_node_append_node(
+	     node,
+	     safe_sub_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*sub_node = safe_sub_node;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &safe_sub_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libewf_name_index_fold_character function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_name_index_fold_character(
+     void )
+{
+	uint16_t character = 0;
+
+	character = libewf_name_index_fold_character(
+	             (uint16_t) 'A' );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 'a' );
+
+	character = libewf_name_index_fold_character(
+	             (uint16_t) 'z' );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 'z' );
+
+	character = libewf_name_index_fold_character(
+	             (uint16_t) '_' );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) '_' );
+
+	/* LATIN CAPITAL LETTER A WITH GRAVE
+	 */
+	character = libewf_name_index_fold_character(
+	             0x00c0 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x00e0 );
+
+	/* MULTIPLICATION SIGN
+	 */
+	character = libewf_name_index_fold_character(
+	             0x00d7 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x00d7 );
+
+	/* LATIN CAPITAL LETTER C WITH CARON
+	 */
+	character = libewf_name_index_fold_character(
+	             0x010c );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x010d );
+
+	/* LATIN CAPITAL LETTER L WITH STROKE
+	 */
+	character = libewf_name_index_fold_character(
+	             0x0141 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x0142 );
+
+	/* LATIN CAPITAL LETTER Y WITH DIAERESIS
+	 */
+	character = libewf_name_index_fold_character(
+	             0x0178 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x00ff );
+
+	/* GREEK CAPITAL LETTER OMEGA
+	 */
+	character = libewf_name_index_fold_character(
+	             0x03a9 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x03c9 );
+
+	/* CYRILLIC CAPITAL LETTER IO
+	 */
+	character = libewf_name_index_fold_character(
+	             0x0401 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x0451 );
+
+	/* CYRILLIC CAPITAL LETTER YA
+	 */
+	character = libewf_name_index_fold_character(
+	             0x042f );
+
+	EWF_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 0x044f );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libewf_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_name_index_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_name_index_t *name_index = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_name_index_initialize(
+	          &name_index,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "name_index->number_of_buckets",
+	 name_index->number_of_buckets,
+	 256 );
+
+	result = libewf_name_index_free(
+	          &name_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_name_index_initialize(
+	          NULL,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = (libewf_name_index_t *) 0x12345678UL;
+
+	result = libewf_name_index_initialize(
+	          &name_index,
+	          100,
+	          &error );
+
+	name_index = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_initialize(
+	          &name_index,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_name_index_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_name_index_initialize(
+		          &name_index,
+		          100,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libewf_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_name_index_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_name_index_initialize(
+		          &name_index,
+		          100,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libewf_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libewf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_name_index_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_name_index_append_node, libewf_name_index_get_node_by_utf8_name
+ * and libewf_name_index_get_node_by_utf16_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_name_index_get_node_by_name(
+     void )
+{
+	char name[ 16 ];
+
+	uint16_t utf16_name[ 11 ]               = { 'r', 'e', 'a', 'd', 'm', 'e', '.', 'T', 'X', 'T', 0 };
+	uint8_t utf8_name[ 11 ]                 = { 'R', 'E', 'A', 'D', 'M', 'E', '.', 't', 'x', 't', 0 };
+
+	libcdata_tree_node_t *expected_sub_node = NULL;
+	libcdata_tree_node_t *node              = NULL;
+	libcdata_tree_node_t *readme_sub_node   = NULL;
+	libcdata_tree_node_t *sub_node          = NULL;
+	libcerror_error_t *error                = NULL;
+	libewf_name_index_t *name_index         = NULL;
+	int result                              = 0;
+	int sub_node_index                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_initialize(
+	          &node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_initialize(
+	          &name_index,
+	          101,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_node_index = 0;
+	     sub_node_index < 100;
+	     sub_node_index++ )
+	{
+		narrow_string_snprintf(
+		 name,
+		 16,
+		 "file%d",
+		 sub_node_index );
+
+		result = ewf_test_name_index_append_sub_node(
+		          node,
+		          name,
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( sub_node_index == 37 )
+		{
+			expected_sub_node = sub_node;
+		}
+		result = libewf_name_index_append_node(
+		          name_index,
+		          sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = ewf_test_name_index_append_sub_node(
+	          node,
+	          "ReadMe.txt",
+	          &readme_sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_append_node(
+	          name_index,
+	          readme_sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "name_index->number_of_entries",
+	 name_index->number_of_entries,
+	 101 );
+
+	/* Test regular cases
+	 */
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "file37",
+	          6,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == expected_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "file3",
+	          5,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node != expected_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "FILE37",
+	          6,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "sub_node",
+	 sub_node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "FILE37",
+	          6,
+	          1,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == expected_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "file100",
+	          7,
+	          1,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          utf8_name,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          utf8_name,
+	          10,
+	          1,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == readme_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          10,
+	          1,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == readme_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_name_index_append_node(
+	          name_index,
+	          readme_sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_append_node(
+	          NULL,
+	          readme_sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          NULL,
+	          utf8_name,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          NULL,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          utf8_name,
+	          10,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf16_name(
+	          name_index,
+	          NULL,
+	          10,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_name_index_get_node_by_utf16_name(
+	          name_index,
+	          utf16_name,
+	          10,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_name_index_free(
+	          &name_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_free(
+	          &node,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libewf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	if( node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_name_index_get_node_by_utf8_name function with duplicate names
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_name_index_get_node_by_name_duplicate(
+     void )
+{
+	const char *names[ 4 ]                  = { "dup", "other", "dup", "Dup" };
+
+	libcdata_tree_node_t *expected_sub_node = NULL;
+	libcdata_tree_node_t *node              = NULL;
+	libcdata_tree_node_t *sub_node          = NULL;
+	libcerror_error_t *error                = NULL;
+	libewf_name_index_t *name_index         = NULL;
+	int result                              = 0;
+	int sub_node_index                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_initialize(
+	          &node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_initialize(
+	          &name_index,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_node_index = 0;
+	     sub_node_index < 4;
+	     sub_node_index++ )
+	{
+		result = ewf_test_name_index_append_sub_node(
+		          node,
+		          names[ sub_node_index ],
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( sub_node_index == 0 )
+		{
+			expected_sub_node = sub_node;
+		}
+		result = libewf_name_index_append_node(
+		          name_index,
+		          sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that a duplicate name resolves to the first sub node
+	 */
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "dup",
+	          3,
+	          0,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == expected_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_name_index_get_node_by_utf8_name(
+	          name_index,
+	          (uint8_t *) "DUP",
+	          3,
+	          1,
+	          &sub_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "sub_node",
+	 (int) ( sub_node == expected_sub_node ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libewf_name_index_free(
+	          &name_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_free(
+	          &node,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libewf_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	if( node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_name_index_fold_character",
+	 ewf_test_name_index_fold_character );
+
+	EWF_TEST_RUN(
+	 "libewf_name_index_initialize",
+	 ewf_test_name_index_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_name_index_free",
+	 ewf_test_name_index_free );
+
+	EWF_TEST_RUN(
+	 "libewf_name_index_get_node_by_name",
+	 ewf_test_name_index_get_node_by_name );
+
+	EWF_TEST_RUN(
+	 "libewf_name_index_get_node_by_name_duplicate",
+	 ewf_test_name_index_get_node_by_name_duplicate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,978 @@
+/*
+ * Library segment_index type test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_functions.h"
+#include "ewf_test_libbfio.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_segment_index.h"
+#include "../libewf/libewf_segment_index_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Creates a segment index with a single entry
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_segment_index_create(
+     libewf_segment_index_t **segment_index,
+     libcerror_error_t **error )
+{
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	int entry_index                                   = 0;
+
+	if( libewf_segment_index_initialize(
+	     segment_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_segment_index_entry_initialize(
+	     &segment_index_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	segment_index_entry->segment_number      = 1;
+	segment_index_entry->type                = 1;
+	segment_index_entry->major_version       = 1;
+	segment_index_entry->segment_file_size   = 1048576;
+	segment_index_entry->head_checksum       = 0x12345678UL;
+	segment_index_entry->tail_checksum       = 0x9abcdef0UL;
+	segment_index_entry->last_section_offset = 1048500;
+	segment_index_entry->storage_media_size  = 65536;
+	segment_index_entry->number_of_chunks    = 2;
+
+	if( libewf_segment_index_entry_resize(
+	     segment_index_entry,
+	     2,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_segment_index_entry_set_section_by_index(
+	     segment_index_entry,
+	     0,
+	     13,
+	     76,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_segment_index_entry_set_section_by_index(
+	     segment_index_entry,
+	     1,
+	     1048500,
+	     76,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_segment_index_entry_set_chunk_group_by_index(
+	     segment_index_entry,
+	     0,
+	     4096,
+	     1024,
+	     65536,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libewf_segment_index_append_entry(
+	     *segment_index,
+	     &entry_index,
+	     segment_index_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( segment_index_entry != NULL )
+	{
+		libewf_segment_index_entry_free(
+		 &segment_index_entry,
+		 NULL );
+	}
+	if( *segment_index != NULL )
+	{
+		libewf_segment_index_free(
+		 segment_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libewf_segment_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_segment_index_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libewf_segment_index_t *segment_index = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 2;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_index",
+	 segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "segment_index",
+	 segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_segment_index_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segment_index = (libewf_segment_index_t *) 0x12345678UL;
+
+	result = libewf_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	segment_index = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_segment_index_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_segment_index_initialize(
+		          &segment_index,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( segment_index != NULL )
+			{
+				libewf_segment_index_free(
+				 &segment_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "segment_index",
+			 segment_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_segment_index_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_segment_index_initialize(
+		          &segment_index,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( segment_index != NULL )
+			{
+				libewf_segment_index_free(
+				 &segment_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "segment_index",
+			 segment_index );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_index != NULL )
+	{
+		libewf_segment_index_free(
+		 &segment_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_segment_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_segment_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_segment_index_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_segment_index_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_segment_index_clone(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	libewf_segment_index_t *destination_segment_index = NULL;
+	libewf_segment_index_t *source_segment_index      = NULL;
+	int number_of_entries                             = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_segment_index_create(
+	          &source_segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "source_segment_index",
+	 source_segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_segment_index_clone(
+	          &destination_segment_index,
+	          source_segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_segment_index",
+	 destination_segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_get_number_of_entries(
+	          destination_segment_index,
+	          &number_of_entries,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_get_entry_by_index(
+	          destination_segment_index,
+	          0,
+	          &segment_index_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_index_entry",
+	 segment_index_entry );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index_entry->number_of_sections",
+	 segment_index_entry->number_of_sections,
+	 2 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index_entry->number_of_chunk_groups",
+	 segment_index_entry->number_of_chunk_groups,
+	 1 );
+
+	result = libewf_segment_index_free(
+	          &destination_segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_segment_index",
+	 destination_segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_clone(
+	          &destination_segment_index,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_segment_index",
+	 destination_segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_segment_index_clone(
+	          NULL,
+	          source_segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_segment_index_free(
+	          &source_segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "source_segment_index",
+	 source_segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_segment_index != NULL )
+	{
+		libewf_segment_index_free(
+		 &destination_segment_index,
+		 NULL );
+	}
+	if( source_segment_index != NULL )
+	{
+		libewf_segment_index_free(
+		 &source_segment_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_segment_index_write_file_io_handle and libewf_segment_index_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_segment_index_write_and_read_file_io_handle(
+     void )
+{
+	uint8_t segment_index_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libewf_segment_index_entry_t *segment_index_entry = NULL;
+	libewf_segment_index_t *segment_index             = NULL;
+	size64_t mapped_size                              = 0;
+	size64_t size                                     = 0;
+	off64_t offset                                    = 0;
+	uint32_t range_flags                              = 0;
+	uint8_t flags                                     = 0;
+	int number_of_entries                             = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_segment_index_create(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_index",
+	 segment_index );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_open_file_io_handle(
+	          &file_io_handle,
+	          segment_index_data,
+	          1024,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_segment_index_write_file_io_handle(
+	          segment_index,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_open_file_io_handle(
+	          &file_io_handle,
+	          segment_index_data,
+	          1024,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_read_file_io_handle(
+	          segment_index,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_get_number_of_entries(
+	          segment_index,
+	          &number_of_entries,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libewf_segment_index_get_entry_by_index(
+	          segment_index,
+	          0,
+	          &segment_index_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_index_entry",
+	 segment_index_entry );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_index_entry->segment_file_size",
+	 (uint64_t) segment_index_entry->segment_file_size,
+	 (uint64_t) 1048576 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_index_entry->head_checksum",
+	 segment_index_entry->head_checksum,
+	 (uint32_t) 0x12345678UL );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_index_entry->tail_checksum",
+	 segment_index_entry->tail_checksum,
+	 (uint32_t) 0x9abcdef0UL );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_index_entry->number_of_chunks",
+	 segment_index_entry->number_of_chunks,
+	 (uint64_t) 2 );
+
+	result = libewf_segment_index_entry_get_section_by_index(
+	          segment_index_entry,
+	          1,
+	          &offset,
+	          &size,
+	          &flags,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1048500 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 76 );
+
+	result = libewf_segment_index_entry_get_chunk_group_by_index(
+	          segment_index_entry,
+	          0,
+	          &offset,
+	          &size,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4096 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 (uint64_t) mapped_size,
+	 (uint64_t) 65536 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	segment_index_data[ 0 ] = 0xff;
+
+	result = ewf_test_open_file_io_handle(
+	          &file_io_handle,
+	          segment_index_data,
+	          1024,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_read_file_io_handle(
+	          segment_index,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_segment_index_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = ewf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( segment_index != NULL )
+	{
+		libewf_segment_index_free(
+		 &segment_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_segment_index_initialize",
+	 ewf_test_segment_index_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_segment_index_free",
+	 ewf_test_segment_index_free );
+
+	EWF_TEST_RUN(
+	 "libewf_segment_index_clone",
+	 ewf_test_segment_index_clone );
+
+	EWF_TEST_RUN(
+	 "libewf_segment_index_write_and_read_file_io_handle",
+	 ewf_test_segment_index_write_and_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
@@ -475,8 +475,9 @@ int ewf_test_single_file_tree_get_sub_node_by_utf8_name(
 	 "error",
 	 error );
 
-	result = libfdata_stream_free(
-	          &data_stream,
+	result = libewf_single_files_get_file_entry_tree_root_node(
+	          single_files,
+	          &root_node,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -484,17 +485,17 @@ int ewf_test_single_file_tree_get_sub_node_by_utf8_name(
 	 result,
 	 1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "data_stream",
-	 data_stream );
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_node",
+	 root_node );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libewf_single_files_get_file_entry_tree_root_node(
+	result = libewf_single_files_read_sub_file_entries(
 	          single_files,
-	          &root_node,
+	          root_node,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -502,9 +503,22 @@ int ewf_test_single_file_tree_get_sub_node_by_utf8_name(
 	 result,
 	 1 );
 
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "root_node",
-	 root_node );
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -734,8 +748,9 @@ int ewf_test_single_file_tree_get_sub_node_by_utf16_name(
 	 "error",
 	 error );
 
-	result = libfdata_stream_free(
-	          &data_stream,
+	result = libewf_single_files_get_file_entry_tree_root_node(
+	          single_files,
+	          &root_node,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -743,17 +758,17 @@ int ewf_test_single_file_tree_get_sub_node_by_utf16_name(
 	 result,
 	 1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "data_stream",
-	 data_stream );
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_node",
+	 root_node );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libewf_single_files_get_file_entry_tree_root_node(
+	result = libewf_single_files_read_sub_file_entries(
 	          single_files,
-	          &root_node,
+	          root_node,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -761,9 +776,22 @@ int ewf_test_single_file_tree_get_sub_node_by_utf16_name(
 	 result,
 	 1 );
 
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "root_node",
-	 root_node );
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
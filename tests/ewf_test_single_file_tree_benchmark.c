@@ -0,0 +1,425 @@
+/*
+ * Library single file tree name lookup benchmark program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "ewf_test_libcdata.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_lef_file_entry.h"
+#include "../libewf/libewf_name_index.h"
+#include "../libewf/libewf_single_file_tree.h"
+#include "../libewf/libewf_single_files.h"
+
+/* The number of sub file entries of the synthetic wide directory
+ */
+#define EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES	100000
+
+/* The number of lookups without a name index, which are slow
+ */
+#define EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SCAN_LOOKUPS	1000
+
+/* The number of lookups with a name index
+ */
+#define EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_INDEX_LOOKUPS	1000000
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Creates a file entry node with the specific name
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_single_file_tree_benchmark_create_node(
+     const char *name,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_node         = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	size_t name_index                       = 0;
+	size_t name_length                      = 0;
+
+	if( libewf_lef_file_entry_initialize(
+	     &lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	lef_file_entry->name_data_size = ( name_length + 1 ) * 2;
+
+	lef_file_entry->name_data = (uint8_t *) memory_allocate(
+	                                         lef_file_entry->name_data_size );
+
+	if( lef_file_entry->name_data == NULL )
+	{
+		goto on_error;
+	}
+	for( name_index = 0;
+	     name_index <= name_length;
+	     name_index++ )
+	{
+		lef_file_entry->name_data[ name_index * 2 ]         = (uint8_t) name[ name_index ];
+		lef_file_entry->name_data[ ( name_index * 2 ) + 1 ] = 0;
+	}
+	if( libcdata_tree_node_initialize(
+	     &safe_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     safe_node,
+	     (intptr_t *) lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*node = safe_node;
+
+	return( 1 );
+
+on_error:
+	if( safe_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &safe_node,
+		 NULL,
+		 NULL );
+	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the number of lookups per second
+ */
+void ewf_test_single_file_tree_benchmark_print_lookups(
+      const char *name,
+      int number_of_lookups,
+      clock_t number_of_clocks )
+{
+	double number_of_seconds = (double) number_of_clocks / CLOCKS_PER_SEC;
+
+	if( number_of_seconds <= 0.0 )
+	{
+		number_of_seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%s: %.0f lookups/s (%.3f us per lookup)\n",
+	 name,
+	 (double) number_of_lookups / number_of_seconds,
+	 ( number_of_seconds * 1000000.0 ) / number_of_lookups );
+}
+
+/* Runs the name lookup benchmark on a synthetic wide directory
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_file_tree_benchmark(
+     void )
+{
+	char name[ 32 ];
+
+	libcdata_tree_node_t *root_node             = NULL;
+	libcdata_tree_node_t *sub_node              = NULL;
+	libcerror_error_t *error                    = NULL;
+	libewf_lef_file_entry_t *root_file_entry    = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	clock_t start_clock                         = 0;
+	size_t name_length                          = 0;
+	uint32_t seed                               = 0x12345678UL;
+	int lookup_index                            = 0;
+	int result                                  = 0;
+	int sub_node_index                          = 0;
+
+	result = ewf_test_single_file_tree_benchmark_create_node(
+	          "",
+	          &root_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( sub_node_index = 0;
+	     sub_node_index < EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES;
+	     sub_node_index++ )
+	{
+		narrow_string_snprintf(
+		 name,
+		 32,
+		 "File%06d.dat",
+		 sub_node_index );
+
+		result = ewf_test_single_file_tree_benchmark_create_node(
+		          name,
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcdata_tree_node_append_node(
+		          root_node,
+		          sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		sub_node = NULL;
+	}
+	fprintf(
+	 stdout,
+	 "Directory with %d sub file entries\n",
+	 EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES );
+
+	/* Look up names by scanning the sub nodes
+	 */
+	start_clock = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SCAN_LOOKUPS;
+	     lookup_index++ )
+	{
+		/* Use a linear congruential generator to have reproducible names
+		 */
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		name_length = (size_t) narrow_string_snprintf(
+		                        name,
+		                        32,
+		                        "File%06d.dat",
+		                        (int) ( ( seed >> 8 ) % EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES ) );
+
+		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+		          root_node,
+		          (uint8_t *) name,
+		          name_length,
+		          &sub_node,
+		          &sub_lef_file_entry,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	ewf_test_single_file_tree_benchmark_print_lookups(
+	 "scan",
+	 EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SCAN_LOOKUPS,
+	 clock() - start_clock );
+
+	/* Build the name index as the single files do when the sub file entries are read
+	 */
+	start_clock = clock();
+
+	result = libewf_single_files_build_name_indexes(
+	          root_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fprintf(
+	 stdout,
+	 "name index build: %.3f ms\n",
+	 ( (double) ( clock() - start_clock ) * 1000.0 ) / CLOCKS_PER_SEC );
+
+	result = libcdata_tree_node_get_value(
+	          root_node,
+	          (intptr_t **) &root_file_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_file_entry->sub_file_entries_name_index",
+	 root_file_entry->sub_file_entries_name_index );
+
+	/* Look up names with the name index
+	 */
+	start_clock = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_INDEX_LOOKUPS;
+	     lookup_index++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		name_length = (size_t) narrow_string_snprintf(
+		                        name,
+		                        32,
+		                        "File%06d.dat",
+		                        (int) ( ( seed >> 8 ) % EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES ) );
+
+		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+		          root_node,
+		          (uint8_t *) name,
+		          name_length,
+		          &sub_node,
+		          &sub_lef_file_entry,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	ewf_test_single_file_tree_benchmark_print_lookups(
+	 "name index",
+	 EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_INDEX_LOOKUPS,
+	 clock() - start_clock );
+
+	/* Look up names with the case folded name index
+	 */
+	start_clock = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_INDEX_LOOKUPS;
+	     lookup_index++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		name_length = (size_t) narrow_string_snprintf(
+		                        name,
+		                        32,
+		                        "FILE%06d.DAT",
+		                        (int) ( ( seed >> 8 ) % EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_SUB_FILE_ENTRIES ) );
+
+		result = libewf_name_index_get_node_by_utf8_name(
+		          root_file_entry->sub_file_entries_name_index,
+		          (uint8_t *) name,
+		          name_length,
+		          1,
+		          &sub_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	ewf_test_single_file_tree_benchmark_print_lookups(
+	 "case folded name index",
+	 EWF_TEST_SINGLE_FILE_TREE_BENCHMARK_NUMBER_OF_INDEX_LOOKUPS,
+	 clock() - start_clock );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_node_free(
+	          &root_node,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &sub_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	if( root_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &root_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_single_file_tree_get_sub_node_by_utf8_name",
+	 ewf_test_single_file_tree_benchmark );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+
+#else
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
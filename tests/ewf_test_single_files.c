@@ -2305,6 +2305,7 @@ int ewf_test_single_files_parse_entry_category(
 	/* Test regular cases
 	 */
 	line_reader->buffer_offset = 0x5b8;
+	line_reader->line_offset   = 0x5b8;
 	line_reader->line_index    = 27;
 
 	result = libewf_single_files_parse_entry_category(
@@ -2808,6 +2809,106 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_single_files_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_get_memory_usage(
+     libewf_single_files_t *single_files )
+{
+	libcerror_error_t *error   = NULL;
+	size64_t memory_usage      = 0;
+	int number_of_file_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_single_files_get_memory_usage(
+	          single_files,
+	          &number_of_file_entries,
+	          &memory_usage,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_single_files_get_memory_usage(
+	          NULL,
+	          &number_of_file_entries,
+	          &memory_usage,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_memory_usage(
+	          single_files,
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_memory_usage(
+	          single_files,
+	          &number_of_file_entries,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
@@ -3109,6 +3210,11 @@ int main(
 	 ewf_test_single_files_get_file_entry_tree_root_node,
 	 single_files );
 
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_single_files_get_memory_usage",
+	 ewf_test_single_files_get_memory_usage,
+	 single_files );
+
 	/* TODO: add tests for libewf_single_files_get_source_by_index */
 
 	/* Clean up
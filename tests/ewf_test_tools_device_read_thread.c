@@ -0,0 +1,1663 @@
+/*
+ * Tools device_read_thread functions test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcfile.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/device_handle.h"
+#include "../ewftools/device_read_thread.h"
+#include "../ewftools/ewftools_libcthreads.h"
+#include "../ewftools/storage_media_buffer.h"
+#include "../ewftools/storage_media_buffer_queue.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE		512
+#define EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE		( ( 8 * 512 ) + 100 )
+
+system_character_t *ewf_test_device_read_thread_filename = _SYSTEM_STRING( "ewf_test_tools_device_read_thread.raw" );
+
+uint8_t ewf_test_device_read_thread_data[ EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE ];
+
+/* Writes the test data to the test file
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_device_read_thread_write_file(
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	static char *function = "ewf_test_tools_device_read_thread_write_file";
+	ssize_t write_count   = 0;
+	size_t data_offset    = 0;
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE;
+	     data_offset++ )
+	{
+		ewf_test_device_read_thread_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     ewf_test_device_read_thread_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     ewf_test_device_read_thread_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               file,
+	               ewf_test_device_read_thread_data,
+	               EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	               error );
+
+	if( write_count != (ssize_t) EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a device handle and opens the test file
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_device_read_thread_open_device_handle(
+     device_handle_t **device_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "ewf_test_tools_device_read_thread_open_device_handle";
+
+	if( device_handle_initialize(
+	     device_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create device handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( device_handle_open_input(
+	     *device_handle,
+	     &ewf_test_device_read_thread_filename,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open device handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *device_handle != NULL )
+	{
+		device_handle_free(
+		 device_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the device_read_thread_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_device_read_thread_initialize(
+     void )
+{
+	device_handle_t *device_handle    = NULL;
+	device_read_thread_t *read_thread = NULL;
+	libcerror_error_t *error          = NULL;
+	libcthreads_queue_t *queue        = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_open_device_handle(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_initialize(
+	          &queue,
+	          NULL,
+	          4,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_free(
+	          &read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = device_read_thread_initialize(
+	          NULL,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_thread = (device_read_thread_t *) 0x12345678UL;
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	read_thread = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          NULL,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          NULL,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          -1,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          0,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test device_read_thread_initialize with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		if( read_thread != NULL )
+		{
+			device_read_thread_free(
+			 &read_thread,
+			 NULL );
+		}
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "read_thread",
+		 read_thread );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_queue_free(
+	          &queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_handle_free(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread != NULL )
+	{
+		device_read_thread_free(
+		 &read_thread,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( device_handle != NULL )
+	{
+		device_handle_free(
+		 &device_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the device_read_thread_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_device_read_thread_free(
+     void )
+{
+	device_handle_t *device_handle               = NULL;
+	device_read_thread_t *read_thread            = NULL;
+	libcerror_error_t *error                     = NULL;
+	libcthreads_queue_t *queue                   = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	ssize_t read_count                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_open_device_handle(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_initialize(
+	          &queue,
+	          NULL,
+	          4,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = device_read_thread_read_buffer(
+	              read_thread,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_release_buffer(
+	          queue,
+	          storage_media_buffer,
+	          &error );
+
+	storage_media_buffer = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the read thread is freed before the last read was requested
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "read_thread->last_read_requested",
+	 read_thread->last_read_requested,
+	 0 );
+
+	result = device_read_thread_free(
+	          &read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "read_thread",
+	 read_thread );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = device_read_thread_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_queue_free(
+	          &queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_handle_free(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread != NULL )
+	{
+		device_read_thread_free(
+		 &read_thread,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_queue_release_buffer(
+		 queue,
+		 storage_media_buffer,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( device_handle != NULL )
+	{
+		device_handle_free(
+		 &device_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the device_read_thread_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_device_read_thread_signal_abort(
+     void )
+{
+	device_handle_t *device_handle               = NULL;
+	device_read_thread_t *read_thread            = NULL;
+	libcerror_error_t *error                     = NULL;
+	libcthreads_queue_t *queue                   = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	ssize_t read_count                           = 0;
+	size_t data_size                             = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_open_device_handle(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_initialize(
+	          &queue,
+	          NULL,
+	          4,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = device_read_thread_read_buffer(
+	              read_thread,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_size = (size_t) read_count;
+
+	result = storage_media_buffer_queue_release_buffer(
+	          queue,
+	          storage_media_buffer,
+	          &error );
+
+	storage_media_buffer = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_signal_abort(
+	          read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the reads that were in flight when abort was signalled are returned
+	 * and that no more data is returned after them
+	 */
+	do
+	{
+		read_count = device_read_thread_read_buffer(
+		              read_thread,
+		              &storage_media_buffer,
+		              &error );
+
+		if( read_count > 0 )
+		{
+			EWF_TEST_ASSERT_EQUAL_INT64(
+			 "storage_media_buffer->storage_media_offset",
+			 (int64_t) storage_media_buffer->storage_media_offset,
+			 (int64_t) data_size );
+
+			data_size += (size_t) read_count;
+
+			result = storage_media_buffer_queue_release_buffer(
+			          queue,
+			          storage_media_buffer,
+			          &error );
+
+			storage_media_buffer = NULL;
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	while( read_count > 0 );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( data_size < EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = device_read_thread_signal_abort(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = device_read_thread_free(
+	          &read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_free(
+	          &queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_handle_free(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread != NULL )
+	{
+		device_read_thread_free(
+		 &read_thread,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_queue_release_buffer(
+		 queue,
+		 storage_media_buffer,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( device_handle != NULL )
+	{
+		device_handle_free(
+		 &device_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the device_read_thread_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_device_read_thread_read_buffer(
+     void )
+{
+	device_handle_t *device_handle               = NULL;
+	device_read_thread_t *read_thread            = NULL;
+	libcerror_error_t *error                     = NULL;
+	libcthreads_queue_t *queue                   = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	ssize_t read_count                           = 0;
+	size_t data_size                             = 0;
+	size_t expected_read_size                    = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_open_device_handle(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_initialize(
+	          &queue,
+	          NULL,
+	          4,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the storage media buffers are returned in storage media offset order
+	 */
+	do
+	{
+		read_count = device_read_thread_read_buffer(
+		              read_thread,
+		              &storage_media_buffer,
+		              &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count > 0 )
+		{
+			expected_read_size = EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE - data_size;
+
+			if( expected_read_size > EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE )
+			{
+				expected_read_size = EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE;
+			}
+			EWF_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) expected_read_size );
+
+			EWF_TEST_ASSERT_EQUAL_INT64(
+			 "storage_media_buffer->storage_media_offset",
+			 (int64_t) storage_media_buffer->storage_media_offset,
+			 (int64_t) data_size );
+
+			result = memory_compare(
+			          storage_media_buffer->raw_buffer,
+			          &( ewf_test_device_read_thread_data[ data_size ] ),
+			          expected_read_size );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			data_size += (size_t) read_count;
+
+			result = storage_media_buffer_queue_release_buffer(
+			          queue,
+			          storage_media_buffer,
+			          &error );
+
+			storage_media_buffer = NULL;
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	while( read_count > 0 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE );
+
+	/* Test error cases
+	 */
+	read_count = device_read_thread_read_buffer(
+	              NULL,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = device_read_thread_read_buffer(
+	              read_thread,
+	              NULL,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = device_read_thread_free(
+	          &read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_handle_free(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_open_device_handle(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reading from a closed device handle fails
+	 */
+	result = device_handle_close(
+	          device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_read_thread_initialize(
+	          &read_thread,
+	          device_handle,
+	          queue,
+	          0,
+	          EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE,
+	          EWF_TEST_DEVICE_READ_THREAD_BUFFER_SIZE,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a failed read is returned as an error
+	 */
+	read_count = device_read_thread_read_buffer(
+	              read_thread,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "read_thread->read_failed",
+	 read_thread->read_failed,
+	 1 );
+
+	/* Clean up
+	 */
+	result = device_read_thread_free(
+	          &read_thread,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_free(
+	          &queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = device_handle_free(
+	          &device_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread != NULL )
+	{
+		device_read_thread_free(
+		 &read_thread,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_queue_release_buffer(
+		 queue,
+		 storage_media_buffer,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( device_handle != NULL )
+	{
+		device_handle_free(
+		 &device_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the device_read_thread_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_device_read_thread_callback(
+     void )
+{
+	device_read_thread_t read_thread;
+
+	libcerror_error_t *error                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	ssize_t read_count                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &read_thread,
+	     0,
+	     sizeof( device_read_thread_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	result = libcthreads_queue_initialize(
+	          &( read_thread.read_queue ),
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_thread.end_offset                        = EWF_TEST_DEVICE_READ_THREAD_DATA_SIZE;
+	read_thread.maximum_number_of_reads_in_flight = 2;
+	read_thread.number_of_reads_in_flight         = 2;
+
+	/* Test that the caller is woken up when the reader thread stops because
+	 * popping a read request fails
+	 */
+	result = device_read_thread_callback(
+	          &read_thread );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "read_thread.read_failed",
+	 read_thread.read_failed,
+	 1 );
+
+	read_count = device_read_thread_read_buffer(
+	              &read_thread,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "read_thread.reader_stopped",
+	 read_thread.reader_stopped,
+	 1 );
+
+	/* Test that no read is waited for once the reader thread stopped
+	 */
+	read_count = device_read_thread_read_buffer(
+	              &read_thread,
+	              &storage_media_buffer,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = device_read_thread_callback(
+	          NULL );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &( read_thread.read_queue ),
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread.read_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( read_thread.read_queue ),
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+#endif
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_device_read_thread_write_file(
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_RUN(
+	 "device_read_thread_initialize",
+	 ewf_test_tools_device_read_thread_initialize );
+
+	EWF_TEST_RUN(
+	 "device_read_thread_free",
+	 ewf_test_tools_device_read_thread_free );
+
+	EWF_TEST_RUN(
+	 "device_read_thread_signal_abort",
+	 ewf_test_tools_device_read_thread_signal_abort );
+
+	/* device_read_thread_push_read_requests is tested by device_read_thread_initialize */
+
+	EWF_TEST_RUN(
+	 "device_read_thread_read_buffer",
+	 ewf_test_tools_device_read_thread_read_buffer );
+
+	EWF_TEST_RUN(
+	 "device_read_thread_callback",
+	 ewf_test_tools_device_read_thread_callback );
+
+	/* Clean up
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+	          ewf_test_device_read_thread_filename,
+	          &error );
+#else
+	result = libcfile_file_remove(
+	          ewf_test_device_read_thread_filename,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -22,19 +22,25 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "ewf_test_libcdata.h"
 #include "ewf_test_libcerror.h"
+#include "ewf_test_libcfile.h"
 #include "ewf_test_libewf.h"
 #include "ewf_test_macros.h"
 #include "ewf_test_memory.h"
 #include "ewf_test_unused.h"
 
+#include "../ewftools/export_file_entry_job.h"
 #include "../ewftools/export_handle.h"
+#include "../libewf/libewf_file_entry.h"
+#include "../libewf/libewf_lef_file_entry.h"
 
 /* Tests the export_handle_initialize function
  * Returns 1 if successful or 0 if not
@@ -391,6 +397,1266 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a file entry for testing
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_export_handle_file_entry_initialize(
+     libewf_file_entry_t **file_entry,
+     libcdata_tree_node_t **file_entry_tree_node,
+     uint32_t flags,
+     off64_t data_offset,
+     off64_t duplicate_data_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+
+	if( libewf_lef_file_entry_initialize(
+	     &lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	lef_file_entry->flags                  = flags;
+	lef_file_entry->data_offset            = data_offset;
+	lef_file_entry->duplicate_data_offset  = duplicate_data_offset;
+	lef_file_entry->size                   = size;
+	lef_file_entry->permission_group_index = -1;
+
+	if( libcdata_tree_node_initialize(
+	     file_entry_tree_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     *file_entry_tree_node,
+	     (intptr_t *) lef_file_entry,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	lef_file_entry = NULL;
+
+	if( libewf_file_entry_initialize(
+	     file_entry,
+	     NULL,
+	     NULL,
+	     *file_entry_tree_node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_entry_tree_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 file_entry_tree_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+		 NULL );
+	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a file entry created for testing
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_export_handle_file_entry_free(
+     libewf_file_entry_t **file_entry,
+     libcdata_tree_node_t **file_entry_tree_node,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( libewf_file_entry_free(
+	     file_entry,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcdata_tree_node_free(
+	     file_entry_tree_node,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_file_entry_free,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Tests the export_file_entry_job_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_export_file_entry_job_initialize(
+     void )
+{
+	libcdata_tree_node_t *file_entry_tree_node = NULL;
+	libcerror_error_t *error                   = NULL;
+	libewf_file_entry_t *file_entry            = NULL;
+	export_file_entry_job_t *job               = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 2;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_export_handle_file_entry_initialize(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          0,
+	          1024,
+	          -1,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "job->data_offset",
+	 (int64_t) job->data_offset,
+	 (int64_t) 1024 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "job->data_size",
+	 (uint64_t) job->data_size,
+	 (uint64_t) 100 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "job->is_sparse",
+	 job->is_sparse,
+	 (uint8_t) 0 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "job->target_path_size",
+	 job->target_path_size,
+	 (size_t) 5 );
+
+	result = export_file_entry_job_free(
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_export_handle_file_entry_free(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sparse data stored as a reference to duplicate data
+	 */
+	result = ewf_test_tools_export_handle_file_entry_initialize(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA,
+	          1024,
+	          4096,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "job->data_offset",
+	 (int64_t) job->data_offset,
+	 (int64_t) 4096 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "job->is_sparse",
+	 job->is_sparse,
+	 (uint8_t) 0 );
+
+	result = export_file_entry_job_free(
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_export_handle_file_entry_free(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sparse data stored as a single byte that is repeated
+	 */
+	result = ewf_test_tools_export_handle_file_entry_initialize(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA,
+	          1024,
+	          -1,
+	          100,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "job->data_offset",
+	 (int64_t) job->data_offset,
+	 (int64_t) 1024 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "job->is_sparse",
+	 job->is_sparse,
+	 (uint8_t) 1 );
+
+	result = export_file_entry_job_free(
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_file_entry_job_initialize(
+	          NULL,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	job = (export_file_entry_job_t *) 0x12345678UL;
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	job = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          NULL,
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          _SYSTEM_STRING( "file" ),
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          NULL,
+	          _SYSTEM_STRING( "file" ),
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_file_entry_job_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = export_file_entry_job_initialize(
+		          &job,
+		          file_entry,
+		          _SYSTEM_STRING( "file" ),
+		          5,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( job != NULL )
+			{
+				export_file_entry_job_free(
+				 &job,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "job",
+			 job );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_file_entry_job_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = export_file_entry_job_initialize(
+		          &job,
+		          file_entry,
+		          _SYSTEM_STRING( "file" ),
+		          5,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( job != NULL )
+			{
+				export_file_entry_job_free(
+				 &job,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "job",
+			 job );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = ewf_test_tools_export_handle_file_entry_free(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job != NULL )
+	{
+		export_file_entry_job_free(
+		 &job,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		ewf_test_tools_export_handle_file_entry_free(
+		 &file_entry,
+		 &file_entry_tree_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_file_entry_job_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_export_file_entry_job_compare(
+     void )
+{
+	export_file_entry_job_t first_job;
+	export_file_entry_job_t second_job;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &first_job,
+	          0,
+	          sizeof( export_file_entry_job_t ) ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &second_job,
+	          0,
+	          sizeof( export_file_entry_job_t ) ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	first_job.data_offset  = 512;
+	second_job.data_offset = 4096;
+
+	result = export_file_entry_job_compare(
+	          &first_job,
+	          &second_job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_file_entry_job_compare(
+	          &second_job,
+	          &first_job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test jobs with equal data offsets, such as duplicate data
+	 */
+	second_job.data_offset = 512;
+	second_job.is_sparse   = 1;
+
+	result = export_file_entry_job_compare(
+	          &first_job,
+	          &second_job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_file_entry_job_compare(
+	          NULL,
+	          &second_job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_file_entry_job_compare(
+	          &first_job,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_export_file_entry_job function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_export_handle_export_file_entry_job(
+     export_handle_t *export_handle )
+{
+	uint8_t buffer[ 1024 ];
+	uint8_t file_data[ 8192 ];
+
+	system_character_t *image_basename         = _SYSTEM_STRING( "ewf_test_tools_export_handle" );
+	system_character_t *image_filename         = _SYSTEM_STRING( "ewf_test_tools_export_handle.E01" );
+	system_character_t *target_path            = _SYSTEM_STRING( "ewf_test_tools_export_handle.sparse" );
+	libcdata_tree_node_t *file_entry_tree_node = NULL;
+	libcerror_error_t *error                   = NULL;
+	libcfile_file_t *file                      = NULL;
+	libewf_file_entry_t *file_entry            = NULL;
+	libewf_handle_t *input_handle              = NULL;
+	export_file_entry_job_t *job               = NULL;
+	size64_t file_size                         = 0;
+	size_t data_offset                         = 0;
+	ssize_t read_count                         = 0;
+	ssize_t write_count                        = 0;
+	int sector_index                           = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 * Create an image of 32 sectors where every sector contains a different repeated byte
+	 */
+	result = libewf_handle_initialize(
+	          &input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_handle_open_wide(
+	          input_handle,
+	          (wchar_t * const *) &image_basename,
+	          1,
+	          LIBEWF_OPEN_WRITE,
+	          &error );
+#else
+	result = libewf_handle_open(
+	          input_handle,
+	          (char * const *) &image_basename,
+	          1,
+	          LIBEWF_OPEN_WRITE,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_set_media_size(
+	          input_handle,
+	          32 * 512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sector_index = 0;
+	     sector_index < 32;
+	     sector_index++ )
+	{
+		memory_set(
+		 buffer,
+		 (int) 'A' + sector_index,
+		 512 );
+
+		write_count = libewf_handle_write_buffer(
+		               input_handle,
+		               buffer,
+		               512,
+		               &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 512 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libewf_handle_close(
+	          input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_initialize(
+	          &input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_handle_open_wide(
+	          input_handle,
+	          (wchar_t * const *) &image_filename,
+	          1,
+	          LIBEWF_OPEN_READ,
+	          &error );
+#else
+	result = libewf_handle_open(
+	          input_handle,
+	          (char * const *) &image_filename,
+	          1,
+	          LIBEWF_OPEN_READ,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sparse data is the byte at the start of sector 3, repeated for more than the buffer size
+	 */
+	result = ewf_test_tools_export_handle_file_entry_initialize(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          LIBEWF_FILE_ENTRY_FLAG_SPARSE_DATA,
+	          3 * 512,
+	          -1,
+	          4196,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_file_entry_job_initialize(
+	          &job,
+	          file_entry,
+	          target_path,
+	          system_string_length( target_path ) + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = export_handle_export_file_entry_job(
+	          export_handle,
+	          input_handle,
+	          job,
+	          buffer,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &file,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          target_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          target_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_get_size(
+	          file,
+	          &file_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) 4196 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              file_data,
+	              8192,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4196 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 4196;
+	     data_offset++ )
+	{
+		EWF_TEST_ASSERT_EQUAL_UINT8(
+		 "file_data[ data_offset ]",
+		 file_data[ data_offset ],
+		 (uint8_t) 'D' );
+	}
+	result = libcfile_file_close(
+	          file,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &file,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_export_file_entry_job(
+	          NULL,
+	          input_handle,
+	          job,
+	          buffer,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_export_file_entry_job(
+	          export_handle,
+	          input_handle,
+	          NULL,
+	          buffer,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_export_file_entry_job(
+	          export_handle,
+	          input_handle,
+	          job,
+	          NULL,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_export_file_entry_job(
+	          export_handle,
+	          input_handle,
+	          job,
+	          buffer,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_file_entry_job_free(
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_export_handle_file_entry_free(
+	          &file_entry,
+	          &file_entry_tree_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_close(
+	          input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &input_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+	          target_path,
+	          &error );
+#else
+	result = libcfile_file_remove(
+	          target_path,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+	          image_filename,
+	          &error );
+#else
+	result = libcfile_file_remove(
+	          image_filename,
+	          &error );
+#endif
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( job != NULL )
+	{
+		export_file_entry_job_free(
+		 &job,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		ewf_test_tools_export_handle_file_entry_free(
+		 &file_entry,
+		 &file_entry_tree_node,
+		 NULL );
+	}
+	if( input_handle != NULL )
+	{
+		libewf_handle_free(
+		 &input_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -418,6 +1684,18 @@ int main(
 	 "export_handle_free",
 	 ewf_test_tools_export_handle_free );
 
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "export_file_entry_job_initialize",
+	 ewf_test_tools_export_file_entry_job_initialize );
+
+	EWF_TEST_RUN(
+	 "export_file_entry_job_compare",
+	 ewf_test_tools_export_file_entry_job_compare );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	/* Initialize info handle for tests
 	 */
@@ -534,6 +1812,15 @@ int main(
 
 	/* TODO add tests for export_handle_empty_output_list */
 
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "export_handle_export_file_entry_job",
+	 ewf_test_tools_export_handle_export_file_entry_job,
+	 export_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* TODO add tests for export_handle_export_input */
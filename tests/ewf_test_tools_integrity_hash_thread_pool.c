@@ -0,0 +1,2106 @@
+/*
+ * Tools integrity_hash_thread_pool functions test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <errno.h>
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/digest_hash.h"
+#include "../ewftools/ewftools_libcthreads.h"
+#include "../ewftools/ewftools_libhmac.h"
+#include "../ewftools/integrity_hash_thread_pool.h"
+#include "../ewftools/storage_media_buffer.h"
+#include "../ewftools/storage_media_buffer_queue.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) && defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && !defined( HAVE_ASAN )
+#define HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK	1
+#endif
+
+#if defined( HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK )
+
+static int (*ewf_test_real_pthread_mutex_lock)(pthread_mutex_t *) = NULL;
+
+/* Only the pthread_mutex_lock calls of this thread are counted, so that
+ * the digest threads cannot consume the failing attempt
+ */
+static pthread_t ewf_test_pthread_mutex_lock_thread;
+
+int ewf_test_pthread_mutex_lock_attempts_before_fail              = -1;
+
+/* Custom pthread_mutex_lock for testing error cases
+ * Returns 0 if successful or an error value otherwise
+ */
+int pthread_mutex_lock(
+     pthread_mutex_t *mutex )
+{
+	int result = 0;
+
+	if( ewf_test_real_pthread_mutex_lock == NULL )
+	{
+		ewf_test_real_pthread_mutex_lock = dlsym(
+		                                    RTLD_NEXT,
+		                                    "pthread_mutex_lock" );
+	}
+	if( pthread_equal(
+	     pthread_self(),
+	     ewf_test_pthread_mutex_lock_thread ) != 0 )
+	{
+		if( ewf_test_pthread_mutex_lock_attempts_before_fail == 0 )
+		{
+			ewf_test_pthread_mutex_lock_attempts_before_fail = -1;
+
+			return( EBUSY );
+		}
+		else if( ewf_test_pthread_mutex_lock_attempts_before_fail > 0 )
+		{
+			ewf_test_pthread_mutex_lock_attempts_before_fail--;
+		}
+	}
+	result = ewf_test_real_pthread_mutex_lock(
+	          mutex );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the integrity_hash_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_initialize(
+     void )
+{
+	integrity_hash_thread_pool_t *thread_pool = NULL;
+	libcerror_error_t *error                  = NULL;
+	libhmac_md5_context_t *md5_context        = NULL;
+	libhmac_sha1_context_t *sha1_context      = NULL;
+	libhmac_sha256_context_t *sha256_context  = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libhmac_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_initialize(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_initialize(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "thread_pool->number_of_thread_pools",
+	 thread_pool->number_of_thread_pools,
+	 3 );
+
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          NULL,
+	          sha1_context,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "thread_pool->number_of_thread_pools",
+	 thread_pool->number_of_thread_pools,
+	 1 );
+
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = integrity_hash_thread_pool_initialize(
+	          NULL,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	thread_pool = (integrity_hash_thread_pool_t *) 0x12345678UL;
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          4,
+	          &error );
+
+	thread_pool = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test integrity_hash_thread_pool_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = integrity_hash_thread_pool_initialize(
+		          &thread_pool,
+		          md5_context,
+		          sha1_context,
+		          sha256_context,
+		          NULL,
+		          4,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				integrity_hash_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test integrity_hash_thread_pool_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = integrity_hash_thread_pool_initialize(
+		          &thread_pool,
+		          md5_context,
+		          sha1_context,
+		          sha256_context,
+		          NULL,
+		          4,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				integrity_hash_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libhmac_sha256_free(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_free(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the integrity_hash_thread_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = integrity_hash_thread_pool_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the integrity_hash_thread_pool_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_signal_abort(
+     void )
+{
+	integrity_hash_thread_pool_t *thread_pool = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = integrity_hash_thread_pool_signal_abort(
+	          thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "thread_pool->abort",
+	 thread_pool->abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = integrity_hash_thread_pool_signal_abort(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the integrity_hash_thread_pool_release_buffer and integrity_hash_thread_pool_wait_for_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_release_buffer(
+     void )
+{
+	integrity_hash_thread_pool_t *thread_pool    = NULL;
+	libcerror_error_t *error                     = NULL;
+	libcthreads_queue_t *queue                   = NULL;
+	storage_media_buffer_t *queued_buffer        = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_initialize(
+	          &storage_media_buffer,
+	          NULL,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that only the last reference makes the buffer available to its owner
+	 */
+	storage_media_buffer->reference_count = 2;
+
+	result = integrity_hash_thread_pool_release_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "storage_media_buffer->reference_count",
+	 storage_media_buffer->reference_count,
+	 1 );
+
+	result = integrity_hash_thread_pool_release_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "storage_media_buffer->reference_count",
+	 storage_media_buffer->reference_count,
+	 0 );
+
+	result = integrity_hash_thread_pool_wait_for_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that pushing onto no digest thread pools leaves the buffer unreferenced
+	 */
+	result = integrity_hash_thread_pool_push_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "storage_media_buffer->reference_count",
+	 storage_media_buffer->reference_count,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = integrity_hash_thread_pool_release_buffer(
+	          NULL,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = integrity_hash_thread_pool_release_buffer(
+	          thread_pool,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = integrity_hash_thread_pool_wait_for_buffer(
+	          NULL,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = integrity_hash_thread_pool_wait_for_buffer(
+	          thread_pool,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_free(
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_queue_initialize(
+	          &queue,
+	          NULL,
+	          1,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          NULL,
+	          NULL,
+	          NULL,
+	          queue,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_grab_buffer(
+	          queue,
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the last reference releases the buffer onto the storage media buffer queue
+	 */
+	storage_media_buffer->reference_count = 2;
+
+	result = integrity_hash_thread_pool_release_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = integrity_hash_thread_pool_release_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_grab_buffer(
+	          queue,
+	          &queued_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( queued_buffer == storage_media_buffer );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	storage_media_buffer = NULL;
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_queue_release_buffer(
+	          queue,
+	          queued_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	queued_buffer = NULL;
+
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_free(
+	          &queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &queue,
+		 NULL );
+	}
+	else if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the integrity_hash_thread_pool_push_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_push_buffer(
+     void )
+{
+	integrity_hash_thread_pool_t *thread_pool    = NULL;
+	libcerror_error_t *error                     = NULL;
+	libhmac_md5_context_t *md5_context           = NULL;
+	libhmac_sha1_context_t *sha1_context         = NULL;
+	libhmac_sha256_context_t *sha256_context     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libhmac_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_initialize(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_initialize(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_initialize(
+	          &storage_media_buffer,
+	          NULL,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_buffer->raw_buffer_data_size = 512;
+
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = integrity_hash_thread_pool_push_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = integrity_hash_thread_pool_wait_for_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "storage_media_buffer->reference_count",
+	 storage_media_buffer->reference_count,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "thread_pool->update_failed",
+	 thread_pool->update_failed,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = integrity_hash_thread_pool_push_buffer(
+	          NULL,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = integrity_hash_thread_pool_push_buffer(
+	          thread_pool,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK )
+
+	/* Test integrity_hash_thread_pool_push_buffer with the push onto the SHA1 thread pool failing
+	 * after the push onto the MD5 thread pool succeeded
+	 */
+	ewf_test_pthread_mutex_lock_attempts_before_fail = 1;
+
+	result = integrity_hash_thread_pool_push_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	ewf_test_pthread_mutex_lock_attempts_before_fail = -1;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "thread_pool->update_failed",
+	 thread_pool->update_failed,
+	 1 );
+
+	/* The references of the thread pools that were not pushed onto must have been dropped
+	 * otherwise this waits forever
+	 */
+	result = integrity_hash_thread_pool_wait_for_buffer(
+	          thread_pool,
+	          storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "storage_media_buffer->reference_count",
+	 storage_media_buffer->reference_count,
+	 0 );
+
+	/* Freeing the thread pool reports the failed update
+	 */
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK ) */
+
+	/* Clean up
+	 */
+	if( thread_pool != NULL )
+	{
+		result = integrity_hash_thread_pool_free(
+		          &thread_pool,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = storage_media_buffer_free(
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_free(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_free(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests if the digest hashes calculated by the integrity hash thread pool
+ * match the digest hashes calculated serially
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_integrity_hash_thread_pool_digest_hashes(
+     void )
+{
+	storage_media_buffer_t *storage_media_buffers[ 4 ] = { NULL, NULL, NULL, NULL };
+
+	char calculated_hash_string[ 65 ];
+	char expected_hash_string[ 65 ];
+	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t expected_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t expected_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t expected_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	integrity_hash_thread_pool_t *thread_pool       = NULL;
+	libcerror_error_t *error                        = NULL;
+	libhmac_md5_context_t *md5_context              = NULL;
+	libhmac_md5_context_t *serial_md5_context       = NULL;
+	libhmac_sha1_context_t *sha1_context            = NULL;
+	libhmac_sha1_context_t *serial_sha1_context     = NULL;
+	libhmac_sha256_context_t *sha256_context        = NULL;
+	libhmac_sha256_context_t *serial_sha256_context = NULL;
+	storage_media_buffer_t *storage_media_buffer    = NULL;
+	size_t data_offset                              = 0;
+	size_t data_size                                = 0;
+	int buffer_index                                = 0;
+	int iterator                                    = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libhmac_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_initialize(
+	          &serial_md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_initialize(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_initialize(
+	          &serial_sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_initialize(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_initialize(
+	          &serial_sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 4;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_initialize(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          NULL,
+		          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+		          4096,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = integrity_hash_thread_pool_initialize(
+	          &thread_pool,
+	          md5_context,
+	          sha1_context,
+	          sha256_context,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Hash a stream of buffers of different sizes both concurrently and serially
+	 */
+	for( iterator = 0;
+	     iterator < 64;
+	     iterator++ )
+	{
+		storage_media_buffer = storage_media_buffers[ iterator % 4 ];
+
+		result = integrity_hash_thread_pool_wait_for_buffer(
+		          thread_pool,
+		          storage_media_buffer,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_size = 4096 - ( (size_t) iterator * 61 );
+
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			storage_media_buffer->raw_buffer[ data_offset ] = (uint8_t) ( ( iterator * 7 ) + data_offset );
+		}
+		storage_media_buffer->raw_buffer_data_size = data_size;
+
+		result = libhmac_md5_update(
+		          serial_md5_context,
+		          storage_media_buffer->raw_buffer,
+		          data_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_update(
+		          serial_sha1_context,
+		          storage_media_buffer->raw_buffer,
+		          data_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha256_update(
+		          serial_sha256_context,
+		          storage_media_buffer->raw_buffer,
+		          data_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = integrity_hash_thread_pool_push_buffer(
+		          thread_pool,
+		          storage_media_buffer,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	storage_media_buffer = NULL;
+
+	/* Freeing the thread pool waits for all the pushed buffers to be hashed
+	 */
+	result = integrity_hash_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_finalize(
+	          md5_context,
+	          calculated_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_finalize(
+	          serial_md5_context,
+	          expected_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          calculated_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          calculated_hash_string,
+	          33,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          expected_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          expected_hash_string,
+	          33,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          calculated_hash_string,
+	          expected_hash_string,
+	          33 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_finalize(
+	          sha1_context,
+	          calculated_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_finalize(
+	          serial_sha1_context,
+	          expected_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          calculated_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          calculated_hash_string,
+	          41,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          expected_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          expected_hash_string,
+	          41,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          calculated_hash_string,
+	          expected_hash_string,
+	          41 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha256_finalize(
+	          sha256_context,
+	          calculated_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_finalize(
+	          serial_sha256_context,
+	          expected_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          calculated_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          calculated_hash_string,
+	          65,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          expected_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          expected_hash_string,
+	          65,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          calculated_hash_string,
+	          expected_hash_string,
+	          65 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 4;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_free(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhmac_sha256_free(
+	          &serial_sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_free(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_free(
+	          &serial_sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_free(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &serial_md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		integrity_hash_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 4;
+	     buffer_index++ )
+	{
+		if( storage_media_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	if( serial_sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &serial_sha256_context,
+		 NULL );
+	}
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( serial_sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &serial_sha1_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( serial_md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &serial_md5_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_EWF_TEST_PTHREAD_MUTEX_LOCK )
+	ewf_test_pthread_mutex_lock_thread = pthread_self();
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_initialize",
+	 ewf_test_tools_integrity_hash_thread_pool_initialize );
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_free",
+	 ewf_test_tools_integrity_hash_thread_pool_free );
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_signal_abort",
+	 ewf_test_tools_integrity_hash_thread_pool_signal_abort );
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_release_buffer",
+	 ewf_test_tools_integrity_hash_thread_pool_release_buffer );
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_push_buffer",
+	 ewf_test_tools_integrity_hash_thread_pool_push_buffer );
+
+	EWF_TEST_RUN(
+	 "integrity_hash_thread_pool_digest_hashes",
+	 ewf_test_tools_integrity_hash_thread_pool_digest_hashes );
+
+	/* TODO add tests for integrity_hash_thread_pool_md5_callback */
+
+	/* TODO add tests for integrity_hash_thread_pool_sha1_callback */
+
+	/* TODO add tests for integrity_hash_thread_pool_sha256_callback */
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,1024 @@
+/*
+ * Tools storage_media_buffer_ring functions test program
+ *
+ * Copyright (C) 2006-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/storage_media_buffer.h"
+#include "../ewftools/storage_media_buffer_ring.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the storage_media_buffer_ring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_ring_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	storage_media_buffer_ring_t *ring = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_ring_free(
+	          &ring,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_ring_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ring = (storage_media_buffer_ring_t *) 0x12345678UL;
+
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          4,
+	          &error );
+
+	ring = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test storage_media_buffer_ring_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = storage_media_buffer_ring_initialize(
+		          &ring,
+		          4,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( ring != NULL )
+			{
+				storage_media_buffer_ring_free(
+				 &ring,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "ring",
+			 ring );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test storage_media_buffer_ring_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = storage_media_buffer_ring_initialize(
+		          &ring,
+		          4,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( ring != NULL )
+			{
+				storage_media_buffer_ring_free(
+				 &ring,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "ring",
+			 ring );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ring != NULL )
+	{
+		storage_media_buffer_ring_free(
+		 &ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_ring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_ring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_ring_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_ring_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_ring_empty(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	storage_media_buffer_ring_t *ring = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_ring_empty(
+	          ring,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_ring_empty(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_ring_free(
+	          &ring,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ring != NULL )
+	{
+		storage_media_buffer_ring_free(
+		 &ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_ring_set_sequence_number function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_ring_set_sequence_number(
+     void )
+{
+	storage_media_buffer_t buffers[ 2 ];
+
+	libcerror_error_t *error          = NULL;
+	storage_media_buffer_ring_t *ring = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          buffers,
+	          0,
+	          sizeof( storage_media_buffer_t ) * 2 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_ring_set_sequence_number(
+	          ring,
+	          &( buffers[ 0 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "buffers[ 0 ].sequence_number",
+	 buffers[ 0 ].sequence_number,
+	 (uint64_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_ring_set_sequence_number(
+	          ring,
+	          &( buffers[ 1 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "buffers[ 1 ].sequence_number",
+	 buffers[ 1 ].sequence_number,
+	 (uint64_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_ring_set_sequence_number(
+	          NULL,
+	          &( buffers[ 0 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_ring_set_sequence_number(
+	          ring,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_ring_free(
+	          &ring,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ring != NULL )
+	{
+		storage_media_buffer_ring_free(
+		 &ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_ring_insert_buffer and storage_media_buffer_ring_remove_next_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_ring_insert_buffer(
+     void )
+{
+	storage_media_buffer_t buffers[ 7 ];
+
+	/* The buffers are inserted out of order
+	 */
+	int insert_order[ 4 ]             = { 2, 0, 3, 1 };
+
+	libcerror_error_t *error          = NULL;
+	storage_media_buffer_ring_t *ring = NULL;
+	storage_media_buffer_t *buffer    = NULL;
+	int buffer_index                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_ring_initialize(
+	          &ring,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          buffers,
+	          0,
+	          sizeof( storage_media_buffer_t ) * 7 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( buffer_index = 0;
+	     buffer_index < 6;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_ring_set_sequence_number(
+		          ring,
+		          &( buffers[ buffer_index ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that no buffer is removed while the next buffer is not available
+	 */
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          ring,
+	          &buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test out of order insert and in order remove
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_ring_insert_buffer(
+		          ring,
+		          &( buffers[ insert_order[ buffer_index ] ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          ring,
+	          &buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "buffer->sequence_number",
+	 buffer->sequence_number,
+	 (uint64_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = NULL;
+
+	/* Buffer 1 has not been inserted yet
+	 */
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          ring,
+	          &buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ insert_order[ 3 ] ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Buffer 4 wraps around to the slot of buffer 0
+	 */
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ 4 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 1;
+	     buffer_index < 5;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          ring,
+		          &buffer,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "buffer",
+		 buffer );
+
+		EWF_TEST_ASSERT_EQUAL_UINT64(
+		 "buffer->sequence_number",
+		 buffer->sequence_number,
+		 (uint64_t) buffer_index );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		buffer = NULL;
+	}
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "ring->next_sequence_number",
+	 ring->next_sequence_number,
+	 (uint64_t) 5 );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_ring_insert_buffer(
+	          NULL,
+	          &( buffers[ 5 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test storage_media_buffer_ring_insert_buffer with a sequence number that was already removed
+	 */
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ 0 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test storage_media_buffer_ring_insert_buffer with a sequence number that exceeds the number of slots
+	 */
+	buffers[ 6 ].sequence_number = ring->next_sequence_number + 4;
+
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ 6 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test storage_media_buffer_ring_insert_buffer with an occupied slot
+	 */
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ 5 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_ring_insert_buffer(
+	          ring,
+	          &( buffers[ 5 ] ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          ring,
+	          &buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "buffer->sequence_number",
+	 buffer->sequence_number,
+	 (uint64_t) 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = NULL;
+
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          NULL,
+	          &buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_ring_remove_next_buffer(
+	          ring,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_ring_free(
+	          &ring,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "ring",
+	 ring );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ring != NULL )
+	{
+		storage_media_buffer_ring_free(
+		 &ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_ring_initialize",
+	 ewf_test_tools_storage_media_buffer_ring_initialize );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_ring_free",
+	 ewf_test_tools_storage_media_buffer_ring_free );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_ring_empty",
+	 ewf_test_tools_storage_media_buffer_ring_empty );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_ring_set_sequence_number",
+	 ewf_test_tools_storage_media_buffer_ring_set_sequence_number );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_ring_insert_buffer",
+	 ewf_test_tools_storage_media_buffer_ring_insert_buffer );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -35,6 +35,7 @@
 #include "ewf_test_getopt.h"
 #include "ewf_test_libcerror.h"
 #include "ewf_test_libewf.h"
+#include "ewf_test_unused.h"
 
 /* Define to make ewf_test_write generate verbose output
 #define EWF_TEST_WRITE_VERBOSE
@@ -161,6 +162,7 @@ int ewf_test_write(
      size64_t maximum_segment_size,
      int8_t compression_level,
      uint8_t compression_flags,
+     int number_of_threads,
      libcerror_error_t **error )
 {
 	libewf_handle_t *handle = NULL;
@@ -257,6 +259,27 @@ int ewf_test_write(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 0 )
+	{
+		if( libewf_handle_set_number_of_threads(
+		     handle,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable set number of threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	EWF_TEST_UNREFERENCED_PARAMETER( number_of_threads )
+#endif
 	buffer = (uint8_t *) memory_allocate(
 	                      EWF_TEST_WRITE_BUFFER_SIZE );
 
@@ -451,10 +474,12 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_compression_level    = NULL;
 	system_character_t *option_maximum_segment_size = NULL;
 	system_character_t *option_media_size           = NULL;
+	system_character_t *option_number_of_threads    = NULL;
 	system_integer_t option                         = 0;
 	size64_t chunk_size                             = 0;
 	size64_t maximum_segment_size                   = 0;
 	size64_t media_size                             = 0;
+	uint64_t number_of_threads                      = 0;
 	size_t string_length                            = 0;
 	uint8_t compression_flags                       = 0;
 	int8_t compression_level                        = LIBEWF_COMPRESSION_NONE;
@@ -462,7 +487,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewf_test_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "b:B:c:S:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:B:c:j:S:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -490,6 +515,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'S':
 				option_maximum_segment_size = optarg;
 
@@ -607,12 +637,39 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		string_length = system_string_length(
+				 option_number_of_threads );
+
+		if( ewf_test_system_string_decimal_copy_to_64_bit(
+		     option_number_of_threads,
+		     string_length + 1,
+		     &number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads.\n" );
+
+			goto on_error;
+		}
+		if( number_of_threads > 32 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads.\n" );
+
+			goto on_error;
+		}
+	}
 	if( ewf_test_write(
 	     argv[ optind ],
 	     media_size,
 	     maximum_segment_size,
 	     compression_level,
 	     compression_flags,
+	     (int) number_of_threads,
 	     &error ) != 1 )
 	{
 		fprintf(
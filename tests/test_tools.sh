@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="bodyfile byte_size_string device_handle digest_hash export_handle guid imaging_handle info_handle log_handle mount_path_string output path_string platform signal storage_media_buffer system_string verification_handle";
+TOOLS_TESTS="bodyfile byte_size_string device_handle device_read_thread digest_hash export_handle guid imaging_handle integrity_hash_thread_pool info_handle log_handle mount_path_string output path_string platform signal storage_media_buffer storage_media_buffer_ring system_string verification_handle";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 
@@ -95,6 +95,25 @@ test_write()
 			return ${RESULT};
 		fi
 
+		# Only libewf_handle_write_buffer supports packing chunks on multiple threads.
+		if test "${TEST_FUNCTION}" = "write";
+		then
+			test_api_write_function "${TEST_FUNCTION}" -B0 -c${COMPRESSION_LEVEL} -j4 -S10000;
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				return ${RESULT};
+			fi
+
+			test_api_write_function "${TEST_FUNCTION}" -B100000 -c${COMPRESSION_LEVEL} -j4 -S10000;
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				return ${RESULT};
+			fi
+		fi
 		echo "";
 	done
 